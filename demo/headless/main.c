@@ -0,0 +1,602 @@
+/* nuklear - public domain */
+/* Headless benchmark. Drives the demo UIs and a set of synthetic stress
+ * scenes with scripted input and without any display. Every frame is built,
+ * converted into vertices with `nk_convert` and rasterized into a memory
+ * framebuffer by the rawfb renderer. Usage:
+ *
+ *      headless_bench [-f frames] [-e tolerance] [-o results.csv] [-t trace.csv] [scenario...]
+ *      headless_bench -R session.nki [-f frames] [-S] [-D dump.nks -d frame] scenario
+ *      headless_bench -P session.nki [-o results.csv] [-t trace.csv] [-S] [-D dump.nks [-d frame]] scenario
+ *
+ * Without scenario names all scenarios are run. For each scenario the average
+ * time per frame of the build, convert and raster phase is reported together
+ * with draw command bytes, vertex and index counts and the number of
+ * allocations made after warm-up. `-o` additionally writes one CSV row per
+ * scenario for regression tracking and `-t` one row per frame. The raster
+ * phase includes `nk_clear` since the rawfb renderer clears the context
+ * after drawing. `-e` sets `curve_tolerance` of the convert configuration to
+ * compare fixed against adaptive circle and curve tessellation.
+ *
+ * `-R` records the input of a scenario with `nk_input_record_begin` and `-P`
+ * replays a recording instead of the scripted input. Replayed frames are
+ * checked against the recorded draw commands, so the same recording
+ * benchmarks two versions and reports the first frame that draws differently.
+ * Checking is not part of any measured phase and shows up as `verify_ns` in
+ * the trace. While recording, `nk_clear` hashes the draw commands of every
+ * frame, which adds to the raster phase.
+ *
+ * Recordings only keep a hash per frame, so `-D` writes the draw commands of
+ * the first diverged frame as a stream key frame. `-d frame` dumps a given
+ * frame instead, also while recording or running scripted input, so dumps
+ * of two versions can be compared byte by byte.
+ *
+ * `-S` ends every frame with `nk_frame_swap` instead of rendering it, so the
+ * raster phase only measures the handoff. Recordings made with and without
+ * `-S` replay against each other. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_STANDARD_VARARGS
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT
+#define NK_INCLUDE_SOFTWARE_FONT
+#define NK_UINT_DRAW_INDEX
+#define NK_IMPLEMENTATION
+#define NK_RAWFB_IMPLEMENTATION
+#include "../../nuklear.h"
+#include "../x11_rawfb/nuklear_rawfb.h"
+
+#include "../style.c"
+#include "../calculator.c"
+#include "../overview.c"
+#include "../node_editor.c"
+
+#define FB_WIDTH        1280
+#define FB_HEIGHT       800
+#define WARMUP_FRAMES   10
+#define DEFAULT_FRAMES  200
+#define LEN(a) (sizeof(a)/sizeof(a)[0])
+
+/* ===============================================================
+ *
+ *                          ALLOCATOR
+ *
+ * ===============================================================*/
+struct alloc_stats {
+    unsigned long allocs;
+    unsigned long frees;
+};
+
+static void*
+count_alloc(nk_handle handle, void *old, nk_size size)
+{
+    struct alloc_stats *stats = (struct alloc_stats*)handle.ptr;
+    NK_UNUSED(old);
+    stats->allocs++;
+    return malloc(size);
+}
+
+static void
+count_free(nk_handle handle, void *ptr)
+{
+    struct alloc_stats *stats = (struct alloc_stats*)handle.ptr;
+    if (ptr) stats->frees++;
+    free(ptr);
+}
+
+/* ===============================================================
+ *
+ *                          SCENES
+ *
+ * ===============================================================*/
+static void
+scene_overview(struct nk_context *ctx, int frame)
+{
+    NK_UNUSED(frame);
+    overview(ctx);
+}
+
+static void
+scene_calculator(struct nk_context *ctx, int frame)
+{
+    NK_UNUSED(frame);
+    calculator(ctx);
+}
+
+static void
+scene_node_editor(struct nk_context *ctx, int frame)
+{
+    NK_UNUSED(frame);
+    node_editor(ctx);
+}
+
+static void
+scene_style(struct nk_context *ctx, int frame)
+{
+    static const enum theme themes[] = {
+        THEME_BLACK, THEME_WHITE, THEME_RED, THEME_BLUE, THEME_DARK
+    };
+    if ((frame % 50) == 0)
+        set_style(ctx, themes[(frame / 50) % (int)LEN(themes)]);
+    calculator(ctx);
+    overview(ctx);
+}
+
+static void
+scene_labels(struct nk_context *ctx, int frame)
+{
+    char buffer[32];
+    int i;
+    NK_UNUSED(frame);
+    if (nk_begin(ctx, "Labels", nk_rect(0, 0, FB_WIDTH, FB_HEIGHT), NK_WINDOW_BORDER)) {
+        nk_layout_row_dynamic(ctx, 14, 8);
+        for (i = 0; i < 10000; ++i) {
+            sprintf(buffer, "label %d", i);
+            nk_label(ctx, buffer, NK_TEXT_LEFT);
+        }
+    }
+    nk_end(ctx);
+}
+
+static void
+scene_windows(struct nk_context *ctx, int frame)
+{
+    char title[32];
+    int i;
+    NK_UNUSED(frame);
+    for (i = 0; i < 1000; ++i) {
+        float x = (float)((i % 12) * 105 + (i / 156) * 7);
+        float y = (float)(((i / 12) % 13) * 60 + (i / 156) * 5);
+        sprintf(title, "w%d", i);
+        if (nk_begin(ctx, title, nk_rect(x, y, 100, 55), NK_WINDOW_BORDER|NK_WINDOW_MOVABLE)) {
+            nk_layout_row_dynamic(ctx, 20, 2);
+            nk_label(ctx, title, NK_TEXT_LEFT);
+            nk_button_label(ctx, "ok");
+        }
+        nk_end(ctx);
+    }
+}
+
+static void
+tree(struct nk_context *ctx, int depth, int *id)
+{
+    char title[32];
+    int i;
+    for (i = 0; i < 4; ++i) {
+        int node = (*id)++;
+        sprintf(title, "node %d", node);
+        if (!depth) {
+            nk_label(ctx, title, NK_TEXT_LEFT);
+        } else if (nk_tree_push_id(ctx, NK_TREE_NODE, title, NK_MAXIMIZED, node)) {
+            tree(ctx, depth - 1, id);
+            nk_tree_pop(ctx);
+        }
+    }
+}
+
+static void
+scene_tree(struct nk_context *ctx, int frame)
+{
+    NK_UNUSED(frame);
+    if (nk_begin(ctx, "Tree", nk_rect(0, 0, 600, FB_HEIGHT), NK_WINDOW_BORDER|NK_WINDOW_TITLE)) {
+        int id = 0;
+        nk_layout_row_dynamic(ctx, 18, 1);
+        tree(ctx, 5, &id);
+    }
+    nk_end(ctx);
+}
+
+static void
+scene_edit(struct nk_context *ctx, int frame)
+{
+    static char text[64 * 1024];
+    static int len;
+    if (!frame) {
+        len = 0;
+        while (len < (int)sizeof(text) / 2) {
+            int n = sprintf(text + len, "line %d of a long text buffer\n", len);
+            len += n;
+        }
+    }
+    if (nk_begin(ctx, "Edit", nk_rect(0, 0, 800, FB_HEIGHT), NK_WINDOW_BORDER|NK_WINDOW_TITLE)) {
+        nk_layout_row_dynamic(ctx, FB_HEIGHT - 60, 1);
+        if (!frame) nk_edit_focus(ctx, NK_EDIT_BOX);
+        nk_edit_string(ctx, NK_EDIT_BOX, text, &len, (int)sizeof(text) - 1, nk_filter_default);
+    }
+    nk_end(ctx);
+}
+
+static void
+scene_charts(struct nk_context *ctx, int frame)
+{
+    int i, j;
+    if (nk_begin(ctx, "Charts", nk_rect(0, 0, FB_WIDTH, FB_HEIGHT), NK_WINDOW_BORDER)) {
+        nk_layout_row_dynamic(ctx, 180, 2);
+        for (i = 0; i < 8; ++i) {
+            enum nk_chart_type type = (i & 1) ? NK_CHART_COLUMN: NK_CHART_LINES;
+            if (nk_chart_begin(ctx, type, 2000, -1.0f, 1.0f)) {
+                for (j = 0; j < 2000; ++j)
+                    nk_chart_push(ctx, (float)sin((double)(j + frame + i * 100) * 0.01));
+                nk_chart_end(ctx);
+            }
+        }
+    }
+    nk_end(ctx);
+}
+
+/* ===============================================================
+ *
+ *                          SCRIPT
+ *
+ * ===============================================================*/
+enum script_flags {
+    SCRIPT_CLICK = 1,
+    SCRIPT_SCROLL = 2,
+    SCRIPT_TYPE = 4
+};
+
+struct scenario {
+    const char *name;
+    void (*run)(struct nk_context*, int frame);
+    int script;
+};
+
+static const struct scenario scenarios[] = {
+    {"overview",    scene_overview,     SCRIPT_CLICK|SCRIPT_SCROLL},
+    {"calculator",  scene_calculator,   SCRIPT_CLICK},
+    {"node_editor", scene_node_editor,  SCRIPT_CLICK},
+    {"style",       scene_style,        SCRIPT_CLICK|SCRIPT_SCROLL},
+    {"labels",      scene_labels,       SCRIPT_SCROLL},
+    {"windows",     scene_windows,      SCRIPT_CLICK},
+    {"tree",        scene_tree,         SCRIPT_SCROLL},
+    {"edit",        scene_edit,         SCRIPT_TYPE},
+    {"charts",      scene_charts,       0}
+};
+
+static void
+script_input(struct nk_context *ctx, int frame, int script)
+{
+    /* the mouse sweeps the framebuffer on a fixed path so every run
+     * hovers, presses and scrolls the same widgets */
+    int x = (int)(FB_WIDTH * (0.5 + 0.45 * sin((double)frame * 0.05)));
+    int y = (int)(FB_HEIGHT * (0.5 + 0.45 * sin((double)frame * 0.037)));
+    nk_input_begin(ctx);
+    nk_input_motion(ctx, x, y);
+    if (script & SCRIPT_CLICK) {
+        if ((frame % 20) == 5) nk_input_button(ctx, NK_BUTTON_LEFT, x, y, nk_true);
+        if ((frame % 20) == 7) nk_input_button(ctx, NK_BUTTON_LEFT, x, y, nk_false);
+    }
+    if ((script & SCRIPT_SCROLL) && (frame % 30) == 15)
+        nk_input_scroll(ctx, nk_vec2(0, ((frame / 30) & 1) ? 3.0f: -3.0f));
+    if (script & SCRIPT_TYPE) {
+        if ((frame % 64) == 63) {
+            nk_input_key(ctx, NK_KEY_ENTER, nk_true);
+            nk_input_key(ctx, NK_KEY_ENTER, nk_false);
+        } else nk_input_char(ctx, (char)('a' + frame % 26));
+    }
+    nk_input_end(ctx);
+}
+
+/* ===============================================================
+ *
+ *                          BENCHMARK
+ *
+ * ===============================================================*/
+struct vertex {
+    float position[2];
+    float uv[2];
+    nk_byte col[4];
+};
+
+struct result {
+    double build, convert, raster;
+    /* nanoseconds per frame */
+    nk_size command_bytes;
+    unsigned int commands;
+    nk_size vertices, indices;
+    unsigned long allocs;
+    /* allocations after warm-up */
+    int frames;
+    /* measured frames after warm-up */
+};
+
+static double
+now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+struct session {
+    struct nk_input_recorder *record;
+    struct nk_input_replay *replay;
+    FILE *trace;
+    FILE *dump;
+    int dump_frame;
+    /* frame number to dump or 0 for the first diverged frame */
+    int swap;
+    /* hand frames off with `nk_frame_swap` instead of rendering */
+    float tolerance;
+};
+
+static void
+dump_commands(FILE *file, struct nk_context *ctx, const struct nk_user_font *font)
+{
+    /* a fresh encoder only emits key frames which decode on their own */
+    struct nk_stream_encoder enc;
+    struct nk_buffer out;
+    nk_stream_encoder_init_default(&enc, &font, 1);
+    nk_buffer_init_default(&out);
+    if (nk_stream_encode(&enc, ctx, &out))
+        fwrite(nk_buffer_memory(&out), 1, out.allocated, file);
+    nk_buffer_free(&out);
+    nk_stream_encoder_free(&enc);
+}
+
+static void
+bench(struct result *res, struct rawfb_context *rawfb,
+    const struct scenario *scene, int frames, const struct session *session)
+{
+    static const struct nk_draw_vertex_layout_element layout[] = {
+        {NK_VERTEX_POSITION, NK_FORMAT_FLOAT, NK_OFFSETOF(struct vertex, position)},
+        {NK_VERTEX_TEXCOORD, NK_FORMAT_FLOAT, NK_OFFSETOF(struct vertex, uv)},
+        {NK_VERTEX_COLOR, NK_FORMAT_R8G8B8A8, NK_OFFSETOF(struct vertex, col)},
+        {NK_VERTEX_LAYOUT_END}
+    };
+    struct nk_context *ctx = &rawfb->ctx;
+    struct nk_convert_config config;
+    struct nk_buffer cmds, verts, idx;
+    struct nk_memory_stats stats;
+    struct alloc_stats counter;
+    struct nk_allocator alloc;
+    unsigned long allocs = 0;
+    struct nk_buffer handoff_memory;
+    struct nk_frame handoff;
+    int frame, measured = 0, dumped = 0;
+
+    /* every scenario starts from a fresh context using the counting allocator */
+    NK_MEMSET(&counter, 0, sizeof(counter));
+    alloc.userdata = nk_handle_ptr(&counter);
+    alloc.alloc = count_alloc;
+    alloc.free = count_free;
+    nk_free(ctx);
+    nk_init(ctx, &alloc, &rawfb->atlas.default_font->handle);
+    nk_style_load_all_cursors(ctx, rawfb->atlas.cursors);
+    nk_buffer_init(&cmds, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_buffer_init(&verts, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_buffer_init(&idx, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_buffer_init(&handoff_memory, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_frame_init(&handoff, &handoff_memory);
+
+    NK_MEMSET(&config, 0, sizeof(config));
+    config.vertex_layout = layout;
+    config.vertex_size = sizeof(struct vertex);
+    config.vertex_alignment = NK_ALIGNOF(struct vertex);
+    config.circle_segment_count = 22;
+    config.curve_segment_count = 22;
+    config.arc_segment_count = 22;
+    config.curve_tolerance = session->tolerance;
+    config.global_alpha = 1.0f;
+    config.shape_AA = NK_ANTI_ALIASING_ON;
+    config.line_AA = NK_ANTI_ALIASING_ON;
+
+    NK_MEMSET(res, 0, sizeof(*res));
+    if (session->record)
+        nk_input_record_begin(ctx, session->record);
+    for (frame = 0; session->replay || frame < WARMUP_FRAMES + frames; ++frame) {
+        double t0, t1, t2, t3, t4;
+        int same = nk_true;
+        if (frame == WARMUP_FRAMES)
+            allocs = counter.allocs;
+
+        t0 = now();
+        if (!session->replay)
+            script_input(ctx, frame, scene->script);
+        else if (!nk_input_replay_frame(ctx, session->replay))
+            break;
+        scene->run(ctx, frame);
+        t1 = now();
+        nk_buffer_clear(&cmds);
+        nk_buffer_clear(&verts);
+        nk_buffer_clear(&idx);
+        nk_convert(ctx, &cmds, &verts, &idx, &config);
+        t2 = now();
+
+        /* sizes of the last frame before the renderer clears it */
+        nk_memory_get_stats(ctx, &stats);
+        res->command_bytes = stats.command_bytes;
+        res->commands = stats.command_count;
+        res->vertices = ctx->draw_list.vertex_count;
+        res->indices = ctx->draw_list.element_count;
+        if (session->replay)
+            same = nk_input_replay_verify(ctx, session->replay);
+        if (session->dump && !dumped && (session->dump_frame ?
+            frame + 1 == session->dump_frame: !same)) {
+            dump_commands(session->dump, ctx, &rawfb->atlas.default_font->handle);
+            printf("dumped draw commands of frame %d\n", frame + 1);
+            dumped = nk_true;
+        }
+        t3 = now();
+
+        if (session->swap)
+            nk_frame_swap(ctx, &handoff);
+        else nk_rawfb_render(rawfb, nk_rgb(30,30,30), 1);
+        t4 = now();
+        if (session->trace)
+            fprintf(session->trace, "%s,%d,%.0f,%.0f,%.0f,%.0f,%d\n", scene->name,
+                frame, t1 - t0, t2 - t1, t3 - t2, t4 - t3, same);
+        if (frame < WARMUP_FRAMES) continue;
+        res->build += t1 - t0;
+        res->convert += t2 - t1;
+        res->raster += t4 - t3;
+        measured++;
+    }
+    if (session->record)
+        nk_input_record_end(ctx);
+    if (measured) {
+        res->build /= measured;
+        res->convert /= measured;
+        res->raster /= measured;
+    }
+    res->frames = measured;
+    res->allocs = counter.allocs - allocs;
+
+    nk_buffer_free(&cmds);
+    nk_buffer_free(&verts);
+    nk_buffer_free(&idx);
+    nk_frame_free(&handoff);
+}
+
+static int
+selected(const char *name, char **names, int count)
+{
+    int i;
+    if (!count) return 1;
+    for (i = 0; i < count; ++i)
+        if (!strcmp(names[i], name)) return 1;
+    return 0;
+}
+
+static FILE*
+open_file(const char *path, const char *mode)
+{
+    FILE *file = fopen(path, mode);
+    if (!file) {
+        fprintf(stderr, "failed to open %s\n", path);
+        exit(1);
+    }
+    return file;
+}
+
+static void
+load_replay(struct nk_input_replay *replay, const char *path)
+{
+    FILE *file = open_file(path, "rb");
+    struct nk_buffer data;
+    char chunk[4096];
+    size_t n;
+
+    nk_buffer_init_default(&data);
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        nk_buffer_push(&data, NK_BUFFER_FRONT, chunk, n, 1);
+    fclose(file);
+    if (!nk_input_replay_init_default(replay, nk_buffer_memory(&data), data.allocated)) {
+        fprintf(stderr, "%s is not an input recording\n", path);
+        exit(1);
+    }
+    nk_buffer_free(&data);
+}
+
+int
+main(int argc, char **argv)
+{
+    static unsigned char tex_scratch[512 * 512];
+    struct rawfb_context *rawfb;
+    struct nk_input_recorder record;
+    struct nk_input_replay replay;
+    struct session session;
+    const char *record_path = 0;
+    FILE *csv = 0;
+    void *fb;
+    int frames = DEFAULT_FRAMES;
+    int i, count = 0, status = 0;
+    char **names;
+
+    NK_MEMSET(&session, 0, sizeof(session));
+    names = (char**)malloc(sizeof(char*) * (size_t)argc);
+    for (i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-e") && i + 1 < argc) {
+            session.tolerance = (float)atof(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            csv = open_file(argv[++i], "w");
+        } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+            session.trace = open_file(argv[++i], "w");
+        } else if (!strcmp(argv[i], "-R") && i + 1 < argc) {
+            record_path = argv[++i];
+            nk_input_recorder_init_default(&record);
+            session.record = &record;
+        } else if (!strcmp(argv[i], "-P") && i + 1 < argc) {
+            load_replay(&replay, argv[++i]);
+            session.replay = &replay;
+        } else if (!strcmp(argv[i], "-D") && i + 1 < argc) {
+            session.dump = open_file(argv[++i], "wb");
+        } else if (!strcmp(argv[i], "-S")) {
+            session.swap = nk_true;
+        } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+            session.dump_frame = atoi(argv[++i]);
+        } else names[count++] = argv[i];
+    }
+    if (frames < 1) frames = 1;
+    if ((session.record || session.replay || session.dump) && count != 1) {
+        fprintf(stderr, "recording, replaying and dumping needs exactly one scenario\n");
+        return 1;
+    }
+    if (session.dump && !session.replay && session.dump_frame < 1) {
+        fprintf(stderr, "dumping without a replay needs a frame number\n");
+        return 1;
+    }
+
+    fb = calloc(FB_WIDTH * FB_HEIGHT, 4);
+    rawfb = nk_rawfb_init(fb, tex_scratch, FB_WIDTH, FB_HEIGHT, FB_WIDTH * 4, PIXEL_LAYOUT_XRGB_8888);
+    if (!rawfb) {
+        fprintf(stderr, "failed to initialize rawfb renderer\n");
+        return 1;
+    }
+    if (csv) fprintf(csv, "scenario,frames,build_ns,convert_ns,raster_ns,"
+        "command_bytes,commands,vertices,indices,allocs\n");
+    if (session.trace)
+        fprintf(session.trace, "scenario,frame,build_ns,convert_ns,verify_ns,raster_ns,same\n");
+
+    printf("%-12s %12s %12s %12s %10s %8s %9s %9s %7s\n", "scenario", "build ns",
+        "convert ns", "raster ns", "cmd bytes", "cmds", "vertices", "indices", "allocs");
+    for (i = 0; i < (int)LEN(scenarios); ++i) {
+        struct result res;
+        if (!selected(scenarios[i].name, names, count)) continue;
+        bench(&res, rawfb, &scenarios[i], frames, &session);
+        printf("%-12s %12.0f %12.0f %12.0f %10lu %8u %9lu %9lu %7lu\n",
+            scenarios[i].name, res.build, res.convert, res.raster,
+            (unsigned long)res.command_bytes, res.commands,
+            (unsigned long)res.vertices, (unsigned long)res.indices, res.allocs);
+        if (csv) fprintf(csv, "%s,%d,%.0f,%.0f,%.0f,%lu,%u,%lu,%lu,%lu\n",
+            scenarios[i].name, res.frames, res.build, res.convert, res.raster,
+            (unsigned long)res.command_bytes, res.commands,
+            (unsigned long)res.vertices, (unsigned long)res.indices, res.allocs);
+        fflush(stdout);
+    }
+
+    if (session.record) {
+        FILE *file = open_file(record_path, "wb");
+        fwrite(nk_buffer_memory(&record.data), 1, record.data.allocated, file);
+        fclose(file);
+        printf("recorded %u frames into %lu bytes\n", record.frames,
+            (unsigned long)record.data.allocated);
+        nk_input_recorder_free(&record);
+    }
+    if (session.replay) {
+        if (replay.diverged)
+            printf("replayed %u frames, draw commands differ from frame %u\n",
+                replay.frame, replay.diverged);
+        else printf("replayed %u frames, draw commands match\n", replay.frame);
+        status = replay.diverged ? 2: 0;
+        nk_input_replay_free(&replay);
+    }
+    if (session.dump) fclose(session.dump);
+    if (session.trace) fclose(session.trace);
+    if (csv) fclose(csv);
+    nk_rawfb_shutdown(rawfb);
+    free(names);
+    free(fb);
+    return status;
+}
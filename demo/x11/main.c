@@ -7,6 +7,7 @@
 #include <limits.h>
 #include <math.h>
 #include <sys/time.h>
+#include <sys/select.h>
 #include <unistd.h>
 #include <time.h>
 
@@ -69,6 +70,21 @@ sleep_for(long t)
     while(-1 == nanosleep(&req, &req));
 }
 
+static void
+wait_for_event(Display *dpy, long t)
+{
+    /* blocks until the next event or `t` milliseconds if not negative */
+    fd_set fds;
+    struct timeval tv;
+    int fd = ConnectionNumber(dpy);
+    if (XPending(dpy)) return;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    tv.tv_sec = t/1000;
+    tv.tv_usec = (t%1000) * 1000;
+    select(fd + 1, &fds, NULL, NULL, (t < 0) ? NULL: &tv);
+}
+
 /* ===============================================================
  *
  *                          EXAMPLE
@@ -112,7 +128,11 @@ main(void)
 {
     long dt;
     long started;
+    long last;
     int running = 1;
+    int redraw = 1;
+    nk_flags status;
+    float timeout;
     XWindow xw;
     struct nk_context *ctx;
 
@@ -154,15 +174,19 @@ main(void)
     /*set_style(ctx, THEME_DARK);*/
     #endif
 
+    last = timestamp();
     while (running)
     {
         /* Input */
         XEvent evt;
         started = timestamp();
+        ctx->delta_time_seconds = (float)(started - last) / 1000.0f;
+        last = started;
         nk_input_begin(ctx);
         while (XPending(xw.dpy)) {
             XNextEvent(xw.dpy, &evt);
             if (evt.type == ClientMessage) goto cleanup;
+            if (evt.type == Expose || evt.type == ConfigureNotify) redraw = 1;
             if (XFilterEvent(&evt, xw.win)) continue;
             nk_xlib_handle_event(xw.dpy, xw.screen, xw.win, &evt);
         }
@@ -201,15 +225,21 @@ main(void)
         #endif
         /* ----------------------------------------- */
 
-        /* Draw */
-        XClearWindow(xw.dpy, xw.win);
-        nk_xlib_render(xw.win, nk_rgb(30,30,30));
-        XFlush(xw.dpy);
+        /* Draw only if anything changed */
+        status = nk_frame_status(ctx, &timeout);
+        if ((status & NK_FRAME_REDRAW) || redraw) {
+            XClearWindow(xw.dpy, xw.win);
+            nk_xlib_render(xw.win, nk_rgb(30,30,30));
+            XFlush(xw.dpy);
+            redraw = 0;
+        } else nk_clear(ctx);
 
         /* Timing */
         dt = timestamp() - started;
         if (dt < DTIME)
             sleep_for(DTIME - dt);
+        if (!(status & NK_FRAME_PENDING))
+            wait_for_event(xw.dpy, (status & NK_FRAME_TIMED) ? (long)(timeout * 1000.0f) + 1: -1);
     }
 
 cleanup:
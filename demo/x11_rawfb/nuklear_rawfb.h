@@ -848,6 +848,12 @@ nk_rawfb_init(void *fb, void *tex_mem, const unsigned int w, const unsigned int
 
     nk_font_atlas_init_default(&rawfb->atlas);
     nk_font_atlas_begin(&rawfb->atlas);
+#ifdef NK_RAWFB_SDF_FONT
+    /* one distance field font baked at a large size renders sharp at any height */
+    {struct nk_font_config cfg = nk_font_config(0);
+    cfg.sdf = NK_RAWFB_SDF_FONT;
+    rawfb->atlas.default_font = nk_font_atlas_add_default(&rawfb->atlas, 32.0f, &cfg);}
+#endif
     tex = nk_font_atlas_bake(&rawfb->atlas, &rawfb->font_tex.w, &rawfb->font_tex.h, rawfb->font_tex.format);
     if (!tex) {
 	free(rawfb);
@@ -865,6 +871,9 @@ nk_rawfb_init(void *fb, void *tex_mem, const unsigned int w, const unsigned int
     /* Store the font texture in tex scratch memory */
     memcpy(rawfb->font_tex.pixels, tex, rawfb->font_tex.pitch * rawfb->font_tex.h);
     nk_font_atlas_end(&rawfb->atlas, nk_handle_ptr(NULL), NULL);
+#ifdef NK_RAWFB_SDF_FONT
+    rawfb->atlas.default_font->handle.height = 13.0f;
+#endif
     if (rawfb->atlas.default_font)
         nk_style_set_font(&rawfb->ctx, &rawfb->atlas.default_font->handle);
     nk_style_load_all_cursors(&rawfb->ctx, rawfb->atlas.cursors);
@@ -909,6 +918,45 @@ nk_rawfb_stretch_image(const struct rawfb_image *dst,
     }
 }
 
+static void
+nk_rawfb_stretch_sdf(const struct rawfb_image *dst,
+    const struct rawfb_image *src, const struct nk_rect *dst_rect,
+    const struct nk_rect *src_rect, const struct nk_rect *dst_scissors,
+    const struct nk_color *fg, const int spread)
+{
+    short i, j;
+    struct nk_color col = *fg;
+    float xinc = src_rect->w / dst_rect->w;
+    float yinc = src_rect->h / dst_rect->h;
+    /* distance to alpha ramp one destination pixel wide */
+    float ramp = (float)spread / (127.0f * xinc);
+
+    for (j = 0; j < (short)dst_rect->h; j++) {
+        for (i = 0; i < (short)dst_rect->w; i++) {
+            float u = src_rect->x + ((float)i + 0.5f) * xinc - 0.5f;
+            float v = src_rect->y + ((float)j + 0.5f) * yinc - 0.5f;
+            int x0 = (int)floorf(u), y0 = (int)floorf(v);
+            float fx = u - (float)x0, fy = v - (float)y0;
+            float d, a;
+            if (dst_scissors) {
+                if (i + (int)(dst_rect->x + 0.5f) < dst_scissors->x || i + (int)(dst_rect->x + 0.5f) >= dst_scissors->w)
+                    continue;
+                if (j + (int)(dst_rect->y + 0.5f) < dst_scissors->y || j + (int)(dst_rect->y + 0.5f) >= dst_scissors->h)
+                    continue;
+            }
+            /* bilinear filtered distance keeps edges smooth when magnified */
+            d = (nk_rawfb_img_getpixel(src, x0, y0).a * (1.0f - fx) +
+                    nk_rawfb_img_getpixel(src, x0 + 1, y0).a * fx) * (1.0f - fy) +
+                (nk_rawfb_img_getpixel(src, x0, y0 + 1).a * (1.0f - fx) +
+                    nk_rawfb_img_getpixel(src, x0 + 1, y0 + 1).a * fx) * fy;
+            a = (d - 128.0f) * ramp + 0.5f;
+            a = MIN(MAX(a, 0.0f), 1.0f);
+            col.a = (unsigned char)((float)fg->a * a);
+            nk_rawfb_img_blendpixel(dst, i + (int)(dst_rect->x + 0.5f), j + (int)(dst_rect->y + 0.5f), col);
+        }
+    }
+}
+
 static void
 nk_rawfb_font_query_font_glyph(nk_handle handle, const float height,
     struct nk_user_font_glyph *glyph, const nk_rune codepoint,
@@ -949,6 +997,7 @@ nk_rawfb_draw_text(const struct rawfb_context *rawfb,
     int glyph_len = 0;
     int next_glyph_len = 0;
     struct nk_user_font_glyph g;
+    const struct nk_font *f = (const struct nk_font*)font->userdata.ptr;
     if (!len || !text) return;
 
     x = 0;
@@ -980,7 +1029,9 @@ nk_rawfb_draw_text(const struct rawfb_context *rawfb,
         dst_rect.h = ceilf(g.height);
 
         /* Use software rescaling to blit glyph from font_text to framebuffer */
-        nk_rawfb_stretch_image(&rawfb->fb, &rawfb->font_tex, &dst_rect, &src_rect, &rawfb->scissors, &fg);
+        if (f->config && f->config->sdf)
+            nk_rawfb_stretch_sdf(&rawfb->fb, &rawfb->font_tex, &dst_rect, &src_rect, &rawfb->scissors, &fg, f->config->sdf);
+        else nk_rawfb_stretch_image(&rawfb->fb, &rawfb->font_tex, &dst_rect, &src_rect, &rawfb->scissors, &fg);
 
         /* offset next glyph */
         text_len += glyph_len;
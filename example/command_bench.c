@@ -0,0 +1,254 @@
+/* nuklear - public domain */
+/* Command buffer benchmark. Builds the same frame and reports its command
+ * memory in the native layout and as a packed stream message together with
+ * the time spent building, iterating and converting native commands and
+ * encoding, decoding and converting packed ones. Usage:
+ *
+ *      command_bench [windows]
+ *
+ * Each window holds a mix of text, buttons, sliders and custom drawing.
+ * Text is measured and converted with the pre-baked default font atlas.
+ * Vertex indices are 32-bit so up to MAX_WINDOWS windows produce command
+ * buffers of several megabytes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT_ATLAS
+#define NK_UINT_DRAW_INDEX
+#define NK_IMPLEMENTATION
+#include "../nuklear.h"
+
+#define MIN_BENCH_TIME 0.25
+#define MAX_WINDOWS 2048
+
+struct vertex {
+    float position[2];
+    float uv[2];
+    nk_byte col[4];
+};
+
+struct bench {
+    nk_size bytes;
+    nk_size packed;
+    nk_size commands;
+    double build;
+    double iterate;
+    double convert;
+    double encode;
+    double decode;
+    double convert_decoded;
+};
+
+static void
+frame(struct nk_context *ctx, int windows)
+{
+    static float values[64];
+    char title[32];
+    int i, j;
+
+    for (i = 0; i < windows; ++i) {
+        /* windows overlap beyond 32x25 to stay inside the default clip rect */
+        float x = (float)((i % 32) * 220);
+        float y = (float)(((i / 32) % 25) * 320);
+        sprintf(title, "window %d", i);
+        if (nk_begin(ctx, title, nk_rect(x, y, 210, 310),
+            NK_WINDOW_BORDER|NK_WINDOW_TITLE|NK_WINDOW_MOVABLE)) {
+            struct nk_command_buffer *canvas;
+            struct nk_rect space;
+
+            nk_layout_row_dynamic(ctx, 20, 2);
+            for (j = 0; j < 6; ++j) {
+                nk_label(ctx, "label", NK_TEXT_LEFT);
+                nk_button_label(ctx, "button");
+            }
+            nk_layout_row_dynamic(ctx, 20, 1);
+            for (j = 0; j < 3; ++j)
+                nk_slider_float(ctx, 0, &values[(i + j) % 64], 1.0f, 0.01f);
+            nk_layout_row_dynamic(ctx, 60, 1);
+            canvas = nk_window_get_canvas(ctx);
+            if (nk_widget(&space, ctx)) {
+                nk_fill_rect(canvas, space, 4, nk_rgb(40, 40, 40));
+                nk_stroke_line(canvas, space.x, space.y, space.x + space.w,
+                    space.y + space.h, 1, nk_rgb(200, 80, 80));
+                nk_fill_circle(canvas, nk_rect(space.x + 4, space.y + 4, 30, 30),
+                    nk_rgb(80, 200, 80));
+                nk_stroke_curve(canvas, space.x, space.y + space.h, space.x + 40,
+                    space.y, space.x + 80, space.y + space.h, space.x + space.w,
+                    space.y, 1, nk_rgb(80, 80, 200));
+            }
+        }
+        nk_end(ctx);
+    }
+}
+
+static double
+seconds_since(clock_t begin)
+{
+    return (double)(clock() - begin) / CLOCKS_PER_SEC;
+}
+
+static void
+bench(struct bench *result, const struct nk_user_font *font, int windows)
+{
+    static const struct nk_draw_vertex_layout_element layout[] = {
+        {NK_VERTEX_POSITION, NK_FORMAT_FLOAT, NK_OFFSETOF(struct vertex, position)},
+        {NK_VERTEX_TEXCOORD, NK_FORMAT_FLOAT, NK_OFFSETOF(struct vertex, uv)},
+        {NK_VERTEX_COLOR, NK_FORMAT_R8G8B8A8, NK_OFFSETOF(struct vertex, col)},
+        {NK_VERTEX_LAYOUT_END}
+    };
+    struct nk_convert_config config;
+    struct nk_buffer cmds, verts, idx, message;
+    struct nk_stream_encoder enc;
+    struct nk_stream_decoder dec;
+    struct nk_frame decoded;
+    struct nk_context ctx;
+    const struct nk_command *cmd;
+    unsigned long frames;
+    double seconds;
+    clock_t begin;
+
+    nk_init_default(&ctx, font);
+    nk_stream_encoder_init_default(&enc, &font, 1);
+    nk_stream_decoder_init_default(&dec, &font, 1);
+    nk_frame_init_default(&decoded);
+    nk_buffer_init_default(&message);
+    nk_buffer_init_default(&cmds);
+    nk_buffer_init_default(&verts);
+    nk_buffer_init_default(&idx);
+    NK_MEMSET(&config, 0, sizeof(config));
+    config.vertex_layout = layout;
+    config.vertex_size = sizeof(struct vertex);
+    config.vertex_alignment = NK_ALIGNOF(struct vertex);
+    config.circle_segment_count = 22;
+    config.curve_segment_count = 22;
+    config.arc_segment_count = 22;
+    config.global_alpha = 1.0f;
+    config.shape_AA = NK_ANTI_ALIASING_ON;
+    config.line_AA = NK_ANTI_ALIASING_ON;
+
+    /* first frames settle window layout and allocate all buffers */
+    frame(&ctx, windows);
+    nk_clear(&ctx);
+    frame(&ctx, windows);
+    result->bytes = ctx.memory.allocated;
+    result->commands = 0;
+    nk_foreach(cmd, &ctx)
+        result->commands++;
+    nk_clear(&ctx);
+
+    frames = 0;
+    begin = clock();
+    do {
+        frame(&ctx, windows);
+        nk_clear(&ctx);
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->build = seconds / (double)frames;
+
+    frame(&ctx, windows);
+    frames = 0;
+    begin = clock();
+    do {
+        nk_size count = 0;
+        nk_foreach(cmd, &ctx)
+            count += (nk_size)cmd->type;
+        if (!count) break;
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->iterate = seconds / (double)(frames ? frames: 1);
+
+    frames = 0;
+    begin = clock();
+    do {
+        nk_buffer_clear(&cmds);
+        nk_buffer_clear(&verts);
+        nk_buffer_clear(&idx);
+        nk_convert(&ctx, &cmds, &verts, &idx, &config);
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->convert = seconds / (double)frames;
+
+    /* every message is a key frame so no window is sent as unchanged */
+    frames = 0;
+    begin = clock();
+    do {
+        nk_buffer_clear(&message);
+        nk_stream_encoder_reset(&enc);
+        result->packed = nk_stream_encode(&enc, &ctx, &message);
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->encode = seconds / (double)frames;
+
+    frames = 0;
+    begin = clock();
+    do {
+        if (!nk_stream_decode(&dec, &decoded, message.memory.ptr, message.allocated))
+            break;
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->decode = seconds / (double)(frames ? frames: 1);
+
+    frames = 0;
+    begin = clock();
+    do {
+        nk_buffer_clear(&cmds);
+        nk_buffer_clear(&verts);
+        nk_buffer_clear(&idx);
+        nk_frame_convert(&decoded, &cmds, &verts, &idx, &config);
+        frames++;
+    } while ((seconds = seconds_since(begin)) < MIN_BENCH_TIME);
+    result->convert_decoded = seconds / (double)frames;
+
+    nk_stream_encoder_free(&enc);
+    nk_stream_decoder_free(&dec);
+    nk_frame_free(&decoded);
+    nk_buffer_free(&message);
+    nk_buffer_free(&cmds);
+    nk_buffer_free(&verts);
+    nk_buffer_free(&idx);
+    nk_free(&ctx);
+}
+
+static void
+report(const struct bench *b)
+{
+    double commands = (double)(b->commands ? b->commands: 1);
+    printf("  native: %8lu bytes %6.1f bytes/cmd  build  %8.1fus  iterate %8.1fus  convert %8.1fus\n",
+        (unsigned long)b->bytes, (double)b->bytes / commands,
+        b->build * 1000000.0, b->iterate * 1000000.0, b->convert * 1000000.0);
+    printf("  packed: %8lu bytes %6.1f bytes/cmd  encode %8.1fus  decode  %8.1fus  convert %8.1fus\n",
+        (unsigned long)b->packed, (double)b->packed / commands,
+        b->encode * 1000000.0, b->decode * 1000000.0, b->convert_decoded * 1000000.0);
+    printf("  packed size: %.1f%% of native\n",
+        100.0 * (double)b->packed / (double)(b->bytes ? b->bytes: 1));
+}
+
+int
+main(int argc, char **argv)
+{
+    struct nk_font_atlas atlas;
+    struct bench result;
+    int windows = (argc > 1) ? atoi(argv[1]): 16;
+    int width, height;
+
+    windows = NK_CLAMP(1, windows, MAX_WINDOWS);
+    nk_font_atlas_init_default(&atlas);
+    nk_font_atlas_begin(&atlas);
+    if (!nk_font_atlas_bake(&atlas, &width, &height, NK_FONT_ATLAS_ALPHA8)) {
+        fprintf(stderr, "failed to bake default font atlas\n");
+        return 1;
+    }
+    nk_font_atlas_end(&atlas, nk_handle_id(0), 0);
+
+    bench(&result, &atlas.default_font->handle, windows);
+    printf("%d windows, %lu commands per frame\n", windows, (unsigned long)result.commands);
+    report(&result);
+    nk_font_atlas_clear(&atlas);
+    return 0;
+}
@@ -0,0 +1,134 @@
+/* nuklear - public domain */
+/* Generates src/nuklear_font_atlas_default.c holding the default font baked
+ * into a font atlas for NK_INCLUDE_DEFAULT_FONT_ATLAS. Has to be run again
+ * after changes to font baking or the default font configuration:
+ *
+ *      font_atlas_embed > ../src/nuklear_font_atlas_default.c
+ *
+ * The atlas is packed tightly and only contains a handful of different alpha
+ * values, so pixels are stored with 2 bits each as index into a palette. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT
+#define NK_IMPLEMENTATION
+#include "../nuklear.h"
+
+#define PALETTE_SIZE 4
+#define PIXELS_PER_WORD 16
+
+static void
+print_float(float f, const char *sep)
+{
+    /* nine significant digits read back into the exact same float */
+    char buf[32];
+    sprintf(buf, "%.9g", (double)f);
+    printf("%s%sf%s", buf, strpbrk(buf, ".e") ? "": ".0", sep);
+}
+
+int
+main(void)
+{
+    struct nk_font_atlas atlas;
+    const nk_byte *pixels;
+    const nk_rune *range;
+    struct nk_font *font;
+    int palette[PALETTE_SIZE];
+    int palette_count = 0;
+    int width, height, words, i, j;
+
+    nk_font_atlas_init_default(&atlas);
+    nk_font_atlas_begin(&atlas);
+    atlas.packing = NK_FONT_ATLAS_PACK_TIGHT;
+    font = nk_font_atlas_add_default(&atlas, 13.0f, 0);
+    pixels = (const nk_byte*)nk_font_atlas_bake(&atlas, &width, &height, NK_FONT_ATLAS_ALPHA8);
+    if (!font || !pixels) {
+        fprintf(stderr, "failed to bake default font\n");
+        return 1;
+    }
+
+    /* collect palette */
+    for (i = 0; i < width * height; ++i) {
+        for (j = 0; j < palette_count && palette[j] != pixels[i]; ++j);
+        if (j < palette_count) continue;
+        if (palette_count == PALETTE_SIZE) {
+            fprintf(stderr, "more than %d alpha values in atlas\n", PALETTE_SIZE);
+            return 1;
+        }
+        palette[palette_count++] = pixels[i];
+    }
+    for (; palette_count < PALETTE_SIZE; ++palette_count)
+        palette[palette_count] = 0;
+    for (i = 1; i < PALETTE_SIZE; ++i) {
+        int value = palette[i];
+        for (j = i; j > 0 && palette[j-1] > value; --j)
+            palette[j] = palette[j-1];
+        palette[j] = value;
+    }
+
+    printf("#include \"nuklear.h\"\n");
+    printf("#include \"nuklear_internal.h\"\n\n");
+    printf("/* ===============================================================\n");
+    printf(" *\n");
+    printf(" *                          DEFAULT FONT ATLAS\n");
+    printf(" *\n");
+    printf(" * ===============================================================*/\n");
+    printf("/* ProggyClean.ttf baked at 13 pixels with the default font configuration\n");
+    printf(" * and glyph ranges. Pixels are stored with 2 bits per pixel as index into\n");
+    printf(" * the palette. Generated by example/font_atlas_embed.c so do not edit. */\n");
+    printf("#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS\n\n");
+    printf("#define NK_DEFAULT_FONT_ATLAS_WIDTH %d\n", width);
+    printf("#define NK_DEFAULT_FONT_ATLAS_HEIGHT %d\n", height);
+    printf("#define NK_DEFAULT_FONT_ATLAS_GLYPHS %d\n", atlas.glyph_count);
+    printf("#define NK_DEFAULT_FONT_ATLAS_USED %lu\n\n", (unsigned long)atlas.used_pixels);
+
+    printf("NK_GLOBAL const short nk_default_font_atlas_custom[4] = {%d, %d, %d, %d};\n",
+        atlas.custom.x, atlas.custom.y, atlas.custom.w, atlas.custom.h);
+    printf("NK_GLOBAL const nk_byte nk_default_font_atlas_palette[4] = {%d, %d, %d, %d};\n",
+        palette[0], palette[1], palette[2], palette[3]);
+    printf("NK_GLOBAL const float nk_default_font_atlas_metrics[3] = {");
+    print_float(font->info.height, ", ");
+    print_float(font->info.ascent, ", ");
+    print_float(font->info.descent, "};\n");
+    printf("NK_GLOBAL const nk_rune nk_default_font_atlas_ranges[] = {");
+    for (range = font->config->range; *range; ++range)
+        printf("0x%04X, ", (unsigned)*range);
+    printf("0};\n\n");
+
+    printf("NK_GLOBAL const struct nk_font_glyph nk_default_font_atlas_glyphs[NK_DEFAULT_FONT_ATLAS_GLYPHS] = {\n");
+    for (i = 0; i < atlas.glyph_count; ++i) {
+        const struct nk_font_glyph *g = &atlas.glyphs[i];
+        printf("    {0x%04X, ", (unsigned)g->codepoint);
+        print_float(g->xadvance, ", ");
+        print_float(g->x0, ", "); print_float(g->y0, ", ");
+        print_float(g->x1, ", "); print_float(g->y1, ", ");
+        print_float(g->w, ", "); print_float(g->h, ", ");
+        print_float(g->u0, ", "); print_float(g->v0, ", ");
+        print_float(g->u1, ", "); print_float(g->v1, (i + 1 < atlas.glyph_count) ? "},\n": "}\n");
+    }
+    printf("};\n\n");
+
+    words = (width * height + PIXELS_PER_WORD - 1) / PIXELS_PER_WORD;
+    printf("NK_GLOBAL const nk_uint nk_default_font_atlas_pixels[%d] = {", words);
+    for (i = 0; i < words; ++i) {
+        unsigned long word = 0;
+        for (j = 0; j < PIXELS_PER_WORD; ++j) {
+            int n = i * PIXELS_PER_WORD + j, index = 0;
+            if (n >= width * height) break;
+            while (palette[index] != pixels[n]) index++;
+            word |= (unsigned long)index << (j * 2);
+        }
+        printf("%s0x%08lX%s", (i % 8) ? "": "\n    ", word, (i + 1 < words) ? ",": "");
+    }
+    printf("\n};\n\n");
+    printf("#endif /* NK_INCLUDE_DEFAULT_FONT_ATLAS */\n");
+
+    nk_font_atlas_end(&atlas, nk_handle_id(0), 0);
+    nk_font_atlas_clear(&atlas);
+    return 0;
+}
@@ -0,0 +1,86 @@
+/* nuklear - public domain */
+/* Glyph rasterization benchmark. Rasterizes every glyph of a font's glyph
+ * ranges at several pixel sizes and reports throughput. Usage:
+ *
+ *      font_bench [latin.ttf] [cjk.ttf]
+ *
+ * The latin font defaults to DroidSans and is rasterized with the default
+ * glyph ranges. A CJK font is optional and uses the chinese glyph ranges.
+ * Compile with -DNK_INCLUDE_SSE2 to compare against the SSE2 code path. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_FONT_BAKING
+#define NK_IMPLEMENTATION
+#include "../nuklear.h"
+
+#define MAX_GLYPH_SIZE 256
+#define MIN_BENCH_TIME 0.25
+
+static void
+bench(const char *name, const char *path, const nk_rune *ranges)
+{
+    static const float sizes[] = {13.0f, 24.0f, 48.0f, 96.0f};
+    static unsigned char pixels[MAX_GLYPH_SIZE * MAX_GLYPH_SIZE];
+    struct nk_allocator alloc;
+    struct nk_tt_fontinfo info;
+    nk_size size;
+    void *data;
+    int i;
+
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    data = nk_file_load(path, &size, &alloc);
+    if (!data || !nk_tt_InitFont(&info, (const unsigned char*)data, 0)) {
+        fprintf(stderr, "%s: failed to load %s\n", name, path);
+        if (data) alloc.free(alloc.userdata, data);
+        return;
+    }
+
+    printf("%s (%s)\n", name, path);
+    for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); ++i) {
+        float scale = nk_tt_ScaleForPixelHeight(&info, sizes[i]);
+        unsigned long glyphs = 0, area = 0;
+        double seconds = 0;
+        clock_t begin = clock();
+
+        /* repeat all ranges until enough time passed for a stable result */
+        while (seconds < MIN_BENCH_TIME) {
+            const nk_rune *range;
+            for (range = ranges; range[0]; range += 2) {
+                nk_rune rune;
+                for (rune = range[0]; rune <= range[1]; ++rune) {
+                    int x0, y0, x1, y1, w, h;
+                    int glyph = nk_tt_FindGlyphIndex(&info, (int)rune);
+                    if (!glyph) continue;
+                    nk_tt_GetGlyphBitmapBox(&info, glyph, scale, scale, &x0, &y0, &x1, &y1);
+                    w = NK_MIN(x1 - x0, MAX_GLYPH_SIZE);
+                    h = NK_MIN(y1 - y0, MAX_GLYPH_SIZE);
+                    nk_tt_MakeGlyphBitmapSubpixel(&info, pixels, w, h, MAX_GLYPH_SIZE,
+                        scale, scale, 0, 0, glyph, &alloc);
+                    area += (unsigned long)(w * h);
+                    glyphs++;
+                }
+            }
+            seconds = (double)(clock() - begin) / CLOCKS_PER_SEC;
+        }
+        printf("  %5.1fpx: %10.0f glyphs/s %8.2f Mpixels/s\n", sizes[i],
+            (double)glyphs / seconds, (double)area / (seconds * 1000000.0));
+    }
+    alloc.free(alloc.userdata, data);
+}
+
+int
+main(int argc, char **argv)
+{
+    bench("latin", (argc > 1) ? argv[1]: "../extra_font/DroidSans.ttf",
+        nk_font_default_glyph_ranges());
+    if (argc > 2)
+        bench("cjk", argv[2], nk_font_chinese_glyph_ranges());
+    return 0;
+}
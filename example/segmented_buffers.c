@@ -0,0 +1,349 @@
+/* nuklear - public domain */
+/* Segmented command buffer check. Builds the same sequence of frames into a
+ * context with a fixed command buffer and into contexts with segmented
+ * command buffers of different segment sizes, then compares both command
+ * lists field by field. Usage:
+ *
+ *      segmented_buffers [frames]
+ *
+ * Windows are opened and closed over the frames, so commands move across
+ * segment borders and are bridged by `NK_COMMAND_NOP` jumps. Every frame also
+ * draws a long text and a polygon with many points, which are larger than
+ * the smaller segment sizes and need runs of consecutive segments. After
+ * the first cycles these runs have to be reused, so the segmented buffers
+ * stop allocating memory. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT_ATLAS
+#define NK_IMPLEMENTATION
+#include "../nuklear.h"
+
+#define MAX_WINDOWS 8
+#define MAX_CONTEXTS 3
+#define WINDOW_CYCLE (MAX_WINDOWS + 5)
+#define LARGE_CYCLE 3
+#define FIXED_SIZE (4 * 1024 * 1024)
+#define MAX_TEXT 9000
+#define MAX_POINTS 20000
+
+/* sizes cycle so runs of segments are created once and reused later */
+static const int text_length[LARGE_CYCLE] = {MAX_TEXT, 200, 5000};
+static const int point_count[LARGE_CYCLE] = {1500, MAX_POINTS, 100};
+static char text[MAX_TEXT];
+static float points[MAX_POINTS * 2];
+
+static void*
+count_alloc(nk_handle counter, void *old, nk_size size)
+{
+    NK_UNUSED(old);
+    (*(unsigned long*)counter.ptr)++;
+    return malloc(size);
+}
+
+static void
+count_free(nk_handle counter, void *ptr)
+{
+    NK_UNUSED(counter);
+    free(ptr);
+}
+
+static void
+frame(struct nk_context *ctx, int index)
+{
+    static float values[MAX_WINDOWS];
+    int large = (index / WINDOW_CYCLE) % LARGE_CYCLE;
+    char title[32];
+    int i, j;
+
+    for (i = 0; i < MAX_WINDOWS; ++i) {
+        /* every window is closed for a few frames of each cycle, which moves
+         * all following commands to other segments */
+        if (((index + i * 3) % WINDOW_CYCLE) < 3) continue;
+        sprintf(title, "window %d", i);
+        if (nk_begin(ctx, title, nk_rect((float)(i * 90), (float)(i * 30), 240, 260),
+            NK_WINDOW_BORDER|NK_WINDOW_TITLE)) {
+            struct nk_command_buffer *canvas;
+            struct nk_rect space;
+
+            nk_layout_row_dynamic(ctx, 20, 2);
+            for (j = 0; j < 2 + (index + i) % 5; ++j) {
+                nk_label(ctx, (index & 1) ? "tick": "tock", NK_TEXT_LEFT);
+                nk_button_label(ctx, "button");
+            }
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_slider_float(ctx, 0, &values[i], 1.0f, 0.01f);
+            nk_layout_row_dynamic(ctx, 60, 1);
+            canvas = nk_window_get_canvas(ctx);
+            if (i == MAX_WINDOWS - 1 && nk_widget(&space, ctx)) {
+                /* commands larger than the smaller segment sizes */
+                int count = point_count[large];
+                for (j = 0; j < count; ++j) {
+                    points[j*2+0] = space.x + (float)(j % 50);
+                    points[j*2+1] = space.y + (float)((j * 7 + index) % 40);
+                }
+                nk_draw_text(canvas, nk_rect(space.x, space.y, 65000, space.h), text,
+                    text_length[large], ctx->style.font, nk_rgb(0, 0, 0), nk_rgb(255, 255, 255));
+                nk_fill_polygon(canvas, points, count, nk_rgb(60, 60, 60));
+                nk_stroke_polyline(canvas, points, count / 2, 1, nk_rgb(90, 90, 90));
+            }
+        }
+        nk_end(ctx);
+    }
+}
+
+static int
+same_color(struct nk_color a, struct nk_color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static int
+same_points(const struct nk_vec2i *a, const struct nk_vec2i *b, int count)
+{
+    int i;
+    for (i = 0; i < count; ++i)
+        if (a[i].x != b[i].x || a[i].y != b[i].y) return 0;
+    return 1;
+}
+
+static int
+same_command(const struct nk_command *a, const struct nk_command *b)
+{
+    if (a->type != b->type) return 0;
+    switch (a->type) {
+    case NK_COMMAND_NOP: return 1;
+    case NK_COMMAND_SCISSOR: {
+        const struct nk_command_scissor *x = (const struct nk_command_scissor*)a;
+        const struct nk_command_scissor *y = (const struct nk_command_scissor*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h;
+    }
+    case NK_COMMAND_LINE: {
+        const struct nk_command_line *x = (const struct nk_command_line*)a;
+        const struct nk_command_line *y = (const struct nk_command_line*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->begin, &y->begin, 1) && same_points(&x->end, &y->end, 1);
+    }
+    case NK_COMMAND_CURVE: {
+        const struct nk_command_curve *x = (const struct nk_command_curve*)a;
+        const struct nk_command_curve *y = (const struct nk_command_curve*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->begin, &y->begin, 1) && same_points(&x->end, &y->end, 1) &&
+            same_points(x->ctrl, y->ctrl, 2);
+    }
+    case NK_COMMAND_RECT: {
+        const struct nk_command_rect *x = (const struct nk_command_rect*)a;
+        const struct nk_command_rect *y = (const struct nk_command_rect*)b;
+        return x->rounding == y->rounding && x->line_thickness == y->line_thickness &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->color, y->color);
+    }
+    case NK_COMMAND_RECT_FILLED: {
+        const struct nk_command_rect_filled *x = (const struct nk_command_rect_filled*)a;
+        const struct nk_command_rect_filled *y = (const struct nk_command_rect_filled*)b;
+        return x->rounding == y->rounding && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        const struct nk_command_rect_multi_color *x = (const struct nk_command_rect_multi_color*)a;
+        const struct nk_command_rect_multi_color *y = (const struct nk_command_rect_multi_color*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->left, y->left) && same_color(x->top, y->top) &&
+            same_color(x->bottom, y->bottom) && same_color(x->right, y->right);
+    }
+    case NK_COMMAND_CIRCLE: {
+        const struct nk_command_circle *x = (const struct nk_command_circle*)a;
+        const struct nk_command_circle *y = (const struct nk_command_circle*)b;
+        return x->line_thickness == y->line_thickness && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_CIRCLE_FILLED: {
+        const struct nk_command_circle_filled *x = (const struct nk_command_circle_filled*)a;
+        const struct nk_command_circle_filled *y = (const struct nk_command_circle_filled*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->color, y->color);
+    }
+    case NK_COMMAND_ARC: {
+        const struct nk_command_arc *x = (const struct nk_command_arc*)a;
+        const struct nk_command_arc *y = (const struct nk_command_arc*)b;
+        return x->cx == y->cx && x->cy == y->cy && x->r == y->r &&
+            x->line_thickness == y->line_thickness && x->a[0] == y->a[0] &&
+            x->a[1] == y->a[1] && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_ARC_FILLED: {
+        const struct nk_command_arc_filled *x = (const struct nk_command_arc_filled*)a;
+        const struct nk_command_arc_filled *y = (const struct nk_command_arc_filled*)b;
+        return x->cx == y->cx && x->cy == y->cy && x->r == y->r &&
+            x->a[0] == y->a[0] && x->a[1] == y->a[1] && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_TRIANGLE: {
+        const struct nk_command_triangle *x = (const struct nk_command_triangle*)a;
+        const struct nk_command_triangle *y = (const struct nk_command_triangle*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->a, &y->a, 1) && same_points(&x->b, &y->b, 1) &&
+            same_points(&x->c, &y->c, 1);
+    }
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        const struct nk_command_triangle_filled *x = (const struct nk_command_triangle_filled*)a;
+        const struct nk_command_triangle_filled *y = (const struct nk_command_triangle_filled*)b;
+        return same_color(x->color, y->color) && same_points(&x->a, &y->a, 1) &&
+            same_points(&x->b, &y->b, 1) && same_points(&x->c, &y->c, 1);
+    }
+    case NK_COMMAND_POLYGON:
+    case NK_COMMAND_POLYLINE: {
+        /* polylines share the layout of polygons */
+        const struct nk_command_polygon *x = (const struct nk_command_polygon*)a;
+        const struct nk_command_polygon *y = (const struct nk_command_polygon*)b;
+        return x->line_thickness == y->line_thickness && x->point_count == y->point_count &&
+            same_color(x->color, y->color) && same_points(x->points, y->points, x->point_count);
+    }
+    case NK_COMMAND_POLYGON_FILLED: {
+        const struct nk_command_polygon_filled *x = (const struct nk_command_polygon_filled*)a;
+        const struct nk_command_polygon_filled *y = (const struct nk_command_polygon_filled*)b;
+        return x->point_count == y->point_count && same_color(x->color, y->color) &&
+            same_points(x->points, y->points, x->point_count);
+    }
+    case NK_COMMAND_TEXT: {
+        const struct nk_command_text *x = (const struct nk_command_text*)a;
+        const struct nk_command_text *y = (const struct nk_command_text*)b;
+        return x->font == y->font && x->height == y->height && x->length == y->length &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->background, y->background) && same_color(x->foreground, y->foreground) &&
+            !memcmp(x->string, y->string, (size_t)x->length);
+    }
+    case NK_COMMAND_IMAGE: {
+        const struct nk_command_image *x = (const struct nk_command_image*)a;
+        const struct nk_command_image *y = (const struct nk_command_image*)b;
+        return x->img.handle.id == y->img.handle.id && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->col, y->col);
+    }
+    case NK_COMMAND_CUSTOM: {
+        const struct nk_command_custom *x = (const struct nk_command_custom*)a;
+        const struct nk_command_custom *y = (const struct nk_command_custom*)b;
+        return x->callback == y->callback && x->callback_data.ptr == y->callback_data.ptr &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h;
+    }
+    }
+    return 0;
+}
+
+
+static int
+compare(struct nk_context *fixed, struct nk_context *segmented, int *count, int *jumps)
+{
+    /* jumps over segment borders are the only additional commands */
+    const struct nk_command *a = nk__begin(fixed);
+    const struct nk_command *b = nk__begin(segmented);
+    *count = 0;
+    for (;;) {
+        while (a && a->type == NK_COMMAND_NOP) a = nk__next(fixed, a);
+        while (b && b->type == NK_COMMAND_NOP) {
+            b = nk__next(segmented, b);
+            (*jumps)++;
+        }
+        if (!a || !b) break;
+        if (!same_command(a, b)) return 0;
+        a = nk__next(fixed, a);
+        b = nk__next(segmented, b);
+        (*count)++;
+    }
+    return !a && !b;
+}
+
+int
+main(int argc, char **argv)
+{
+    static const nk_size segment_sizes[MAX_CONTEXTS] = {4 * 1024, 16 * 1024, 64 * 1024};
+    struct nk_font_atlas atlas;
+    struct nk_context fixed;
+    struct nk_context contexts[MAX_CONTEXTS];
+    struct nk_buffer cmds[MAX_CONTEXTS], pools[MAX_CONTEXTS];
+    unsigned long allocations[MAX_CONTEXTS], reused[MAX_CONTEXTS];
+    int jumps[MAX_CONTEXTS], commands = 0;
+    int frames = (argc > 1) ? atoi(argv[1]): 3 * WINDOW_CYCLE * LARGE_CYCLE;
+    int warmup = 2 * WINDOW_CYCLE * LARGE_CYCLE;
+    const struct nk_user_font *font;
+    int i, j, width, height, status = 0;
+    void *memory;
+
+    nk_font_atlas_init_default(&atlas);
+    nk_font_atlas_begin(&atlas);
+    if (!nk_font_atlas_bake(&atlas, &width, &height, NK_FONT_ATLAS_ALPHA8)) {
+        fprintf(stderr, "failed to bake default font atlas\n");
+        return 1;
+    }
+    nk_font_atlas_end(&atlas, nk_handle_id(0), 0);
+    font = &atlas.default_font->handle;
+    for (i = 0; i < MAX_TEXT; ++i)
+        text[i] = (char)('a' + i % 26);
+
+    memory = malloc(FIXED_SIZE);
+    nk_init_fixed(&fixed, memory, FIXED_SIZE, font);
+    for (i = 0; i < MAX_CONTEXTS; ++i) {
+        struct nk_allocator alloc;
+        alloc.userdata.ptr = &allocations[i];
+        alloc.alloc = count_alloc;
+        alloc.free = count_free;
+        allocations[i] = reused[i] = 0;
+        jumps[i] = 0;
+        nk_buffer_init_segmented(&cmds[i], &alloc, segment_sizes[i]);
+        nk_buffer_init_default(&pools[i]);
+        nk_init_custom(&contexts[i], &cmds[i], &pools[i], font);
+    }
+
+    for (i = 0; i < frames && !status; ++i) {
+        nk_input_begin(&fixed);
+        nk_input_end(&fixed);
+        frame(&fixed, i);
+        for (j = 0; j < MAX_CONTEXTS; ++j) {
+            unsigned long before = allocations[j];
+            int count;
+            nk_input_begin(&contexts[j]);
+            nk_input_end(&contexts[j]);
+            frame(&contexts[j], i);
+            if (!compare(&fixed, &contexts[j], &count, &jumps[j])) {
+                fprintf(stderr, "frame %d: draw commands with %lu byte segments differ\n",
+                    i, (unsigned long)segment_sizes[j]);
+                status = 1;
+                break;
+            }
+            /* once every frame size was built all runs have to be reused */
+            if (i >= warmup) reused[j] += allocations[j] - before;
+            nk_clear(&contexts[j]);
+            if (!j) commands += count;
+        }
+        nk_clear(&fixed);
+    }
+
+    for (j = 0; j < MAX_CONTEXTS && !status; ++j) {
+        /* the context works on its own copy of the command buffer */
+        const struct nk_buffer *memory = &contexts[j].memory;
+        unsigned int k, runs = 0;
+        for (k = 0; k < memory->segment_count; ++k)
+            if (memory->segments[k].count > 1) runs++;
+        printf("%6lu byte segments: %3u segments, %2u runs, %5d jumps, %3lu allocations\n",
+            (unsigned long)segment_sizes[j], memory->segment_count, runs, jumps[j],
+            allocations[j]);
+        if (frames > warmup && reused[j]) {
+            fprintf(stderr, "%lu byte segments: %lu allocations after frame %d\n",
+                (unsigned long)segment_sizes[j], reused[j], warmup);
+            status = 1;
+        }
+    }
+    if (!status)
+        printf("%d frames with %d commands, all draw commands match\n", frames, commands);
+
+    for (i = 0; i < MAX_CONTEXTS; ++i) {
+        nk_free(&contexts[i]);
+        nk_buffer_free(&pools[i]);
+    }
+    nk_free(&fixed);
+    free(memory);
+    nk_font_atlas_clear(&atlas);
+    return status;
+}
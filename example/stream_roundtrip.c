@@ -0,0 +1,290 @@
+/* nuklear - public domain */
+/* Command stream roundtrip. Builds a sequence of frames in which windows
+ * are opened, changed and closed again, encodes every frame with
+ * `nk_stream_encode`, decodes the message into a frame object and compares
+ * the decoded draw commands with the commands of the context. Everything
+ * stays in memory. Usage:
+ *
+ *      stream_roundtrip [frames]
+ *
+ * Every tenth frame is sent as a key frame, all others only carry the
+ * windows that changed since the previous message. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_STANDARD_IO
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_INCLUDE_FONT_BAKING
+#define NK_INCLUDE_DEFAULT_FONT_ATLAS
+#define NK_IMPLEMENTATION
+#include "../nuklear.h"
+
+#define MAX_WINDOWS 8
+#define KEY_FRAME_INTERVAL 10
+
+static void
+frame(struct nk_context *ctx, int index)
+{
+    static float values[MAX_WINDOWS];
+    struct nk_image img = nk_image_id(7);
+    char title[32];
+    int i;
+
+    for (i = 0; i < MAX_WINDOWS; ++i) {
+        /* every window is closed for a few frames of each cycle */
+        if (((index + i * 3) % (MAX_WINDOWS + 5)) < 3) continue;
+        sprintf(title, "window %d", i);
+        if (nk_begin(ctx, title, nk_rect((float)(i * 110), (float)(i * 40), 200, 240),
+            NK_WINDOW_BORDER|NK_WINDOW_TITLE|NK_WINDOW_MOVABLE)) {
+            struct nk_command_buffer *canvas;
+            struct nk_rect space;
+
+            /* only odd windows change from frame to frame */
+            nk_layout_row_dynamic(ctx, 20, 2);
+            nk_label(ctx, (i & 1) ? ((index & 1) ? "tick": "tock"): "static", NK_TEXT_LEFT);
+            nk_button_label(ctx, "button");
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_slider_float(ctx, 0, &values[i], 1.0f, 0.01f);
+            nk_layout_row_dynamic(ctx, 80, 1);
+            canvas = nk_window_get_canvas(ctx);
+            if (nk_widget(&space, ctx)) {
+                float points[6];
+                float x = space.x + (float)((i & 1) ? index % 20: 0);
+                points[0] = x; points[1] = space.y + space.h;
+                points[2] = x + 30; points[3] = space.y;
+                points[4] = x + 60; points[5] = space.y + space.h;
+                nk_fill_rect_multi_color(canvas, space, nk_rgb(255, 0, 0),
+                    nk_rgb(0, 255, 0), nk_rgb(0, 0, 255), nk_rgb(40, 40, 40));
+                nk_stroke_line(canvas, x, space.y, x + 50, space.y + space.h, 2, nk_rgb(200, 80, 80));
+                nk_stroke_curve(canvas, x, space.y, x + 20, space.y + 40, x + 40,
+                    space.y, x + 60, space.y + 40, 1, nk_rgb(80, 80, 200));
+                nk_fill_circle(canvas, nk_rect(x + 70, space.y + 4, 30, 30), nk_rgb(80, 200, 80));
+                nk_stroke_arc(canvas, x + 120, space.y + 40, 20, 0, 3, 1, nk_rgb(200, 200, 80));
+                nk_fill_triangle(canvas, x, space.y, x + 10, space.y + 20, x + 20, space.y, nk_rgb(9, 9, 9));
+                nk_fill_polygon(canvas, points, 3, nk_rgba(100, 100, 100, 128));
+                nk_draw_image(canvas, nk_rect(x + 150, space.y, 32, 32), &img, nk_rgb(255, 255, 255));
+            }
+        }
+        nk_end(ctx);
+    }
+}
+
+static int
+same_color(struct nk_color a, struct nk_color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static int
+same_points(const struct nk_vec2i *a, const struct nk_vec2i *b, int count)
+{
+    int i;
+    for (i = 0; i < count; ++i)
+        if (a[i].x != b[i].x || a[i].y != b[i].y) return 0;
+    return 1;
+}
+
+static int
+same_command(const struct nk_command *a, const struct nk_command *b)
+{
+    if (a->type != b->type) return 0;
+    switch (a->type) {
+    case NK_COMMAND_NOP: return 1;
+    case NK_COMMAND_SCISSOR: {
+        const struct nk_command_scissor *x = (const struct nk_command_scissor*)a;
+        const struct nk_command_scissor *y = (const struct nk_command_scissor*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h;
+    }
+    case NK_COMMAND_LINE: {
+        const struct nk_command_line *x = (const struct nk_command_line*)a;
+        const struct nk_command_line *y = (const struct nk_command_line*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->begin, &y->begin, 1) && same_points(&x->end, &y->end, 1);
+    }
+    case NK_COMMAND_CURVE: {
+        const struct nk_command_curve *x = (const struct nk_command_curve*)a;
+        const struct nk_command_curve *y = (const struct nk_command_curve*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->begin, &y->begin, 1) && same_points(&x->end, &y->end, 1) &&
+            same_points(x->ctrl, y->ctrl, 2);
+    }
+    case NK_COMMAND_RECT: {
+        const struct nk_command_rect *x = (const struct nk_command_rect*)a;
+        const struct nk_command_rect *y = (const struct nk_command_rect*)b;
+        return x->rounding == y->rounding && x->line_thickness == y->line_thickness &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->color, y->color);
+    }
+    case NK_COMMAND_RECT_FILLED: {
+        const struct nk_command_rect_filled *x = (const struct nk_command_rect_filled*)a;
+        const struct nk_command_rect_filled *y = (const struct nk_command_rect_filled*)b;
+        return x->rounding == y->rounding && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        const struct nk_command_rect_multi_color *x = (const struct nk_command_rect_multi_color*)a;
+        const struct nk_command_rect_multi_color *y = (const struct nk_command_rect_multi_color*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->left, y->left) && same_color(x->top, y->top) &&
+            same_color(x->bottom, y->bottom) && same_color(x->right, y->right);
+    }
+    case NK_COMMAND_CIRCLE: {
+        const struct nk_command_circle *x = (const struct nk_command_circle*)a;
+        const struct nk_command_circle *y = (const struct nk_command_circle*)b;
+        return x->line_thickness == y->line_thickness && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_CIRCLE_FILLED: {
+        const struct nk_command_circle_filled *x = (const struct nk_command_circle_filled*)a;
+        const struct nk_command_circle_filled *y = (const struct nk_command_circle_filled*)b;
+        return x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->color, y->color);
+    }
+    case NK_COMMAND_ARC: {
+        const struct nk_command_arc *x = (const struct nk_command_arc*)a;
+        const struct nk_command_arc *y = (const struct nk_command_arc*)b;
+        return x->cx == y->cx && x->cy == y->cy && x->r == y->r &&
+            x->line_thickness == y->line_thickness && x->a[0] == y->a[0] &&
+            x->a[1] == y->a[1] && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_ARC_FILLED: {
+        const struct nk_command_arc_filled *x = (const struct nk_command_arc_filled*)a;
+        const struct nk_command_arc_filled *y = (const struct nk_command_arc_filled*)b;
+        return x->cx == y->cx && x->cy == y->cy && x->r == y->r &&
+            x->a[0] == y->a[0] && x->a[1] == y->a[1] && same_color(x->color, y->color);
+    }
+    case NK_COMMAND_TRIANGLE: {
+        const struct nk_command_triangle *x = (const struct nk_command_triangle*)a;
+        const struct nk_command_triangle *y = (const struct nk_command_triangle*)b;
+        return x->line_thickness == y->line_thickness && same_color(x->color, y->color) &&
+            same_points(&x->a, &y->a, 1) && same_points(&x->b, &y->b, 1) &&
+            same_points(&x->c, &y->c, 1);
+    }
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        const struct nk_command_triangle_filled *x = (const struct nk_command_triangle_filled*)a;
+        const struct nk_command_triangle_filled *y = (const struct nk_command_triangle_filled*)b;
+        return same_color(x->color, y->color) && same_points(&x->a, &y->a, 1) &&
+            same_points(&x->b, &y->b, 1) && same_points(&x->c, &y->c, 1);
+    }
+    case NK_COMMAND_POLYGON:
+    case NK_COMMAND_POLYLINE: {
+        /* polylines share the layout of polygons */
+        const struct nk_command_polygon *x = (const struct nk_command_polygon*)a;
+        const struct nk_command_polygon *y = (const struct nk_command_polygon*)b;
+        return x->line_thickness == y->line_thickness && x->point_count == y->point_count &&
+            same_color(x->color, y->color) && same_points(x->points, y->points, x->point_count);
+    }
+    case NK_COMMAND_POLYGON_FILLED: {
+        const struct nk_command_polygon_filled *x = (const struct nk_command_polygon_filled*)a;
+        const struct nk_command_polygon_filled *y = (const struct nk_command_polygon_filled*)b;
+        return x->point_count == y->point_count && same_color(x->color, y->color) &&
+            same_points(x->points, y->points, x->point_count);
+    }
+    case NK_COMMAND_TEXT: {
+        const struct nk_command_text *x = (const struct nk_command_text*)a;
+        const struct nk_command_text *y = (const struct nk_command_text*)b;
+        return x->font == y->font && x->height == y->height && x->length == y->length &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h &&
+            same_color(x->background, y->background) && same_color(x->foreground, y->foreground) &&
+            !memcmp(x->string, y->string, (size_t)x->length);
+    }
+    case NK_COMMAND_IMAGE: {
+        const struct nk_command_image *x = (const struct nk_command_image*)a;
+        const struct nk_command_image *y = (const struct nk_command_image*)b;
+        return x->img.handle.id == y->img.handle.id && x->x == y->x && x->y == y->y &&
+            x->w == y->w && x->h == y->h && same_color(x->col, y->col);
+    }
+    case NK_COMMAND_CUSTOM: {
+        const struct nk_command_custom *x = (const struct nk_command_custom*)a;
+        const struct nk_command_custom *y = (const struct nk_command_custom*)b;
+        return x->callback == y->callback && x->callback_data.ptr == y->callback_data.ptr &&
+            x->x == y->x && x->y == y->y && x->w == y->w && x->h == y->h;
+    }
+    }
+    return 0;
+}
+
+static int
+compare(struct nk_context *ctx, struct nk_frame *decoded, int *count)
+{
+    /* both lists have to hold the same commands in the same order */
+    const struct nk_command *a = nk__begin(ctx);
+    const struct nk_command *b = nk__frame_begin(decoded);
+    *count = 0;
+    while (a && b) {
+        if (!same_command(a, b)) return 0;
+        a = nk__next(ctx, a);
+        b = nk__frame_next(decoded, b);
+        (*count)++;
+    }
+    return !a && !b;
+}
+
+int
+main(int argc, char **argv)
+{
+    struct nk_font_atlas atlas;
+    struct nk_context ctx;
+    struct nk_stream_encoder enc;
+    struct nk_stream_decoder dec;
+    struct nk_frame decoded;
+    struct nk_buffer message;
+    const struct nk_user_font *fonts[1];
+    int frames = (argc > 1) ? atoi(argv[1]): 40;
+    int i, width, height, status = 0;
+    unsigned long total = 0;
+
+    nk_font_atlas_init_default(&atlas);
+    nk_font_atlas_begin(&atlas);
+    if (!nk_font_atlas_bake(&atlas, &width, &height, NK_FONT_ATLAS_ALPHA8)) {
+        fprintf(stderr, "failed to bake default font atlas\n");
+        return 1;
+    }
+    nk_font_atlas_end(&atlas, nk_handle_id(0), 0);
+    fonts[0] = &atlas.default_font->handle;
+
+    nk_init_default(&ctx, fonts[0]);
+    nk_stream_encoder_init_default(&enc, fonts, 1);
+    nk_stream_decoder_init_default(&dec, fonts, 1);
+    nk_frame_init_default(&decoded);
+    nk_buffer_init_default(&message);
+
+    for (i = 0; i < frames; ++i) {
+        nk_size size;
+        int count;
+        if ((i % KEY_FRAME_INTERVAL) == 0)
+            nk_stream_encoder_reset(&enc);
+        nk_input_begin(&ctx);
+        nk_input_end(&ctx);
+        frame(&ctx, i);
+
+        nk_buffer_clear(&message);
+        size = nk_stream_encode(&enc, &ctx, &message);
+        if (!size || !nk_stream_decode(&dec, &decoded, nk_buffer_memory(&message), size)) {
+            fprintf(stderr, "frame %d: failed to %s\n", i, size ? "decode": "encode");
+            status = 1;
+            break;
+        }
+        if (!compare(&ctx, &decoded, &count)) {
+            fprintf(stderr, "frame %d: decoded draw commands differ\n", i);
+            status = 1;
+            break;
+        }
+        printf("frame %3d: %6lu bytes %4d commands%s\n", i, (unsigned long)size,
+            count, ((i % KEY_FRAME_INTERVAL) == 0) ? " (key frame)": "");
+        total += (unsigned long)size;
+        nk_clear(&ctx);
+    }
+    if (!status)
+        printf("%d frames in %lu bytes, all draw commands match\n", frames, total);
+
+    nk_buffer_free(&message);
+    nk_frame_free(&decoded);
+    nk_stream_decoder_free(&dec);
+    nk_stream_encoder_free(&enc);
+    nk_free(&ctx);
+    nk_font_atlas_clear(&atlas);
+    return status;
+}
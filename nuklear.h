@@ -102,17 +102,21 @@
 /// NK_INCLUDE_VERTEX_BUFFER_OUTPUT | Defining this adds a vertex draw command list backend to this library, which allows you to convert queue commands into vertex draw commands. This is mainly if you need a hardware accessible format for OpenGL, DirectX, Vulkan, Metal,...
 /// NK_INCLUDE_FONT_BAKING          | Defining this adds `stb_truetype` and `stb_rect_pack` implementation to this library and provides font baking and rendering. If you already have font handling or do not want to use this font handler you don't have to define it.
 /// NK_INCLUDE_DEFAULT_FONT         | Defining this adds the default font: ProggyClean.ttf into this library which can be loaded into a font atlas and allows using this library without having a truetype font
+/// NK_INCLUDE_DEFAULT_FONT_ATLAS   | Defining this adds the default font already baked into a font atlas. Baking an atlas without fonts then only copies glyphs and pixels instead of decompressing and rasterizing ProggyClean.ttf
 /// NK_INCLUDE_COMMAND_USERDATA     | Defining this adds a userdata pointer into each command. Can be useful for example if you want to provide custom shaders depending on the used widget. Can be combined with the style structures.
 /// NK_BUTTON_TRIGGER_ON_RELEASE    | Different platforms require button clicks occurring either on buttons being pressed (up to down) or released (down to up). By default this library will react on buttons being pressed, but if you define this it will only trigger if a button is released.
 /// NK_ZERO_COMMAND_MEMORY          | Defining this will zero out memory for each drawing command added to a drawing queue (inside nk_command_buffer_push). Zeroing command memory is very useful for fast checking (using memcmp) if command buffers are equal and avoid drawing frames when nothing on screen has changed since previous frame.
 /// NK_UINT_DRAW_INDEX              | Defining this will set the size of vertex index elements when using NK_VERTEX_BUFFER_OUTPUT to 32bit instead of the default of 16bit
 /// NK_KEYSTATE_BASED_INPUT         | Define this if your backend uses key state for each frame rather than key press/release events
+/// NK_INCLUDE_SSE2                 | Defining this includes header `<emmintrin.h>` and uses SSE2 instructions to speed up font rasterization. Output is identical to the scalar code path. Only needs to be defined for the implementation.
+/// NK_INCLUDE_PROFILER             | Defining this adds a collector, kept in a user owned `nk_profiler`, for call counts and time of the profiling zones placed around windows, panels, layout, widgets, draw command conversion, tessellation and font baking. Without it, and without custom `NK_PROFILE_BEGIN`/`NK_PROFILE_END`, zones compile to nothing.
 ///
 /// !!! WARNING
 ///     The following flags will pull in the standard C library:
 ///     - NK_INCLUDE_DEFAULT_ALLOCATOR
 ///     - NK_INCLUDE_STANDARD_IO
 ///     - NK_INCLUDE_STANDARD_VARARGS
+///     - NK_INCLUDE_PROFILER
 ///
 /// !!! WARNING
 ///     The following flags if defined need to be defined for both header and implementation:
@@ -122,22 +126,30 @@
 ///     - NK_INCLUDE_VERTEX_BUFFER_OUTPUT
 ///     - NK_INCLUDE_FONT_BAKING
 ///     - NK_INCLUDE_DEFAULT_FONT
+///     - NK_INCLUDE_DEFAULT_FONT_ATLAS
 ///     - NK_INCLUDE_STANDARD_VARARGS
 ///     - NK_INCLUDE_COMMAND_USERDATA
 ///     - NK_UINT_DRAW_INDEX
+///     - NK_INCLUDE_PROFILER
 ///
 /// ### Constants
 /// Define                          | Description
 /// --------------------------------|---------------------------------------
 /// NK_BUFFER_DEFAULT_INITIAL_SIZE  | Initial buffer size allocated by all buffers while using the default allocator functions included by defining NK_INCLUDE_DEFAULT_ALLOCATOR. If you don't want to allocate the default 4k memory then redefine it.
+/// NK_BUFFER_SEGMENT_MIN_SIZE      | Smallest segment size of buffers created by `nk_buffer_init_segmented`. Smaller segments need more allocations and jumps between segments, so the default is 4k.
 /// NK_MAX_NUMBER_BUFFER            | Maximum buffer size for the conversion buffer between float and string Under normal circumstances this should be more than sufficient.
 /// NK_INPUT_MAX                    | Defines the max number of bytes which can be added as text input in one frame. Under normal circumstances this should be more than sufficient.
+/// NK_INPUT_QUEUE_SIZE             | Defines the max number of timestamped events the input queue of each context can hold between frames.
+/// NK_INPUT_DOUBLE_CLICK_TIME      | Defines the max number of milliseconds between two queued left button presses to count as double click.
+/// NK_GRID_TEXT_CACHE_SIZE         | Defines the number of measured cell texts each `nk_grid_column` keeps so visible cells are not measured again every frame.
 ///
 /// !!! WARNING
 ///     The following constants if defined need to be defined for both header and implementation:
 ///     - NK_MAX_NUMBER_BUFFER
 ///     - NK_BUFFER_DEFAULT_INITIAL_SIZE
 ///     - NK_INPUT_MAX
+///     - NK_INPUT_QUEUE_SIZE
+///     - NK_GRID_TEXT_CACHE_SIZE
 ///
 /// ### Dependencies
 /// Function    | Description
@@ -151,10 +163,14 @@
 /// NK_STRTOD   | You can define this to `strtod` or your own string to double conversion implementation replacement. If not defined nuklear will use its own imprecise and possibly unsafe version (does not handle nan or infinity!).
 /// NK_DTOA     | You can define this to `dtoa` or your own double to string conversion implementation replacement. If not defined nuklear will use its own imprecise and possibly unsafe version (does not handle nan or infinity!).
 /// NK_VSNPRINTF| If you define `NK_INCLUDE_STANDARD_VARARGS` as well as `NK_INCLUDE_STANDARD_IO` and want to be safe define this to `vsnprintf` on compilers supporting later versions of C or C++. By default nuklear will check for your stdlib version in C as well as compiler version in C++. if `vsnprintf` is available it will define it to `vsnprintf` directly. If not defined and if you have older versions of C or C++ it will be defined to `vsprintf` which is unsafe.
+/// NK_PROFILE_BEGIN | Called with the attached `nk_profiler` pointer and a `nk_profile_zone` when a profiling zone is entered. Define this together with `NK_PROFILE_END` to forward zones to your own profiler. If not defined it calls the collector of `NK_INCLUDE_PROFILER` or expands to nothing.
+/// NK_PROFILE_END  | Called with the attached `nk_profiler` pointer and a `nk_profile_zone` when a profiling zone is left.
+/// NK_PROFILE_CLOCK| Returns the current time in seconds as `double` for the collector of `NK_INCLUDE_PROFILER`. If not defined nuklear will use `clock` from <time.h> which measures processor time and, being slow and coarse, is only taken for the window, build, convert and font bake zones while all other zones only count calls.
 ///
 /// !!! WARNING
 ///     The following dependencies will pull in the standard C library if not redefined:
 ///     - NK_ASSERT
+///     - NK_PROFILE_CLOCK
 ///
 /// !!! WARNING
 ///     The following dependencies if defined need to be defined for both header and implementation:
@@ -170,6 +186,9 @@
 ///     - NK_STRTOD
 ///     - NK_DTOA
 ///     - NK_VSNPRINTF
+///     - NK_PROFILE_BEGIN
+///     - NK_PROFILE_END
+///     - NK_PROFILE_CLOCK
 ///
 /// ## Example
 ///
@@ -236,12 +255,21 @@ extern "C" {
 #ifndef NK_INPUT_MAX
   #define NK_INPUT_MAX 16
 #endif
+#ifndef NK_INPUT_QUEUE_SIZE
+  #define NK_INPUT_QUEUE_SIZE 64
+#endif
+#ifndef NK_INPUT_DOUBLE_CLICK_TIME
+  #define NK_INPUT_DOUBLE_CLICK_TIME 500
+#endif
 #ifndef NK_MAX_NUMBER_BUFFER
   #define NK_MAX_NUMBER_BUFFER 64
 #endif
 #ifndef NK_SCROLLBAR_HIDING_TIMEOUT
   #define NK_SCROLLBAR_HIDING_TIMEOUT 4.0f
 #endif
+#ifndef NK_GRID_TEXT_CACHE_SIZE
+  #define NK_GRID_TEXT_CACHE_SIZE 64
+#endif
 /*
  * ==============================================================
  *
@@ -438,6 +466,16 @@ struct nk_draw_list;
 struct nk_user_font;
 struct nk_panel;
 struct nk_context;
+struct nk_frame;
+struct nk_stream_encoder;
+struct nk_stream_decoder;
+struct nk_input_recorder;
+struct nk_input_replay;
+struct nk_layout_template;
+struct nk_memory_stats;
+struct nk_window_memory_stats;
+struct nk_profile;
+struct nk_profiler;
 struct nk_draw_vertex_layout_element;
 struct nk_style_button;
 struct nk_style_toggle;
@@ -543,6 +581,14 @@ enum nk_symbol_type {
 /// __nk_clear__        | Called at the end of the frame to reset and prepare the context for the next frame
 /// __nk_free__         | Shutdown and free all memory allocated inside the context
 /// __nk_set_user_data__| Utility function to pass user data to draw command
+/// __nk_memory_get_stats__         | Queries memory usage of the context including high-water marks
+/// __nk_memory_get_window_stats__  | Queries draw command memory of each window
+/// __nk_memory_reset_stats__       | Resets high-water marks
+/// __nk_memory_compact__           | Moves windows and tables into fewer pool pages and frees empty pages
+/// __nk_frame_status__             | Returns if the frame has to be rendered and when the next frame is needed
+/// __nk_frame_schedule__           | Requests another frame after a number of seconds
+/// __nk_profile_zone_name__        | Returns the name of a profiling zone
+/// __nk_profile_collect__          | Returns and resets call counts and time of all profiling zones
  */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 /*/// #### nk_init_default
@@ -666,6 +712,214 @@ NK_API void nk_free(struct nk_context*);
 */
 NK_API void nk_set_user_data(struct nk_context*, nk_handle handle);
 #endif
+/*/// #### nk_memory_get_stats
+/// Queries memory usage of the context. Command and table numbers describe the
+/// current frame so should be queried after all windows are finished and before
+/// `nk_clear`. High-water marks track the biggest command, vertex and element
+/// buffer usage of any frame since initialization or `nk_memory_reset_stats`.
+/// Vertex and element usage is taken from the last `nk_convert` call. If
+/// `needed` values exceed the buffer capacity a fixed size buffer has overflowed.
+/// Counters are updated as part of normal bookkeeping so querying is cheap
+/// enough to be done every frame.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_memory_get_stats(const struct nk_context *ctx, struct nk_memory_stats *stats);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __stats__   | Must point to a `nk_memory_stats` struct to fill
+*/
+NK_API void nk_memory_get_stats(const struct nk_context*, struct nk_memory_stats*);
+/*/// #### nk_memory_get_window_stats
+/// Queries number of draw commands and bytes generated by each window in the
+/// current frame. Popups are accounted to their parent window.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_memory_get_window_stats(const struct nk_context *ctx, struct nk_window_memory_stats *stats, int max);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __stats__   | Array of `nk_window_memory_stats` to fill or `NULL` to only query the window count
+/// __max__     | Maximum number of windows to write into `stats`
+///
+/// Returns the number of windows which can be bigger than `max`.
+*/
+NK_API int nk_memory_get_window_stats(const struct nk_context*, struct nk_window_memory_stats*, int max);
+/*/// #### nk_memory_reset_stats
+/// Resets command, vertex and element buffer high-water marks.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_memory_reset_stats(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_memory_reset_stats(struct nk_context*);
+/*/// #### nk_memory_compact
+/// Page elements holding windows, panels and tables are never given back to
+/// the allocator but kept in a free list. After a spike of windows or popups
+/// this moves all live page elements into as few pool pages as possible and
+/// frees the pages left empty. Pointers between windows and tables are fixed
+/// up, but window pointers kept by the user, for example from `nk_window_find`,
+/// are invalid afterwards. Has to be called outside of a frame.
+/// `pool_reclaimable` of `nk_memory_get_stats` tells how many bytes a call
+/// gives back, so compaction can be skipped while it would free little.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_size nk_memory_compact(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a context allocating page elements from a dynamic pool
+///
+/// Returns the number of bytes given back to the allocator
+*/
+NK_API nk_size nk_memory_compact(struct nk_context*);
+enum nk_frame_status {
+    NK_FRAME_IDLE       = 0,
+    NK_FRAME_REDRAW     = NK_FLAG(0), /* draw commands differ from the previously checked frame */
+    NK_FRAME_PENDING    = NK_FLAG(1), /* input or state changes may alter the next frame so it should be built right away */
+    NK_FRAME_TIMED      = NK_FLAG(2)  /* a timed change like scrollbar hiding is due after the returned timeout */
+};
+/*/// #### nk_frame_status
+/// Checks if the frame has to be rendered and if another frame has to be built.
+/// Has to be called after all windows are finished and before `nk_clear`.
+/// Draw commands are compared against the frame of the previous call so
+/// unchanged frames do not need to be rendered again. If neither
+/// `NK_FRAME_PENDING` nor `NK_FRAME_TIMED` are set nothing can change until
+/// the next input event and applications can block until one arrives. Since
+/// time based state is advanced by `nk_context::delta_time_seconds` it has to be
+/// set to the real time passed since the last frame including time spent waiting.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_frame_status(struct nk_context *ctx, float *timeout);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct at the end of a frame
+/// __timeout__ | Optional output with the number of seconds until the next timed change if `NK_FRAME_TIMED` is set
+///
+/// Returns a combination of `nk_frame_status` flags
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// float timeout;
+/// nk_flags status = nk_frame_status(&ctx, &timeout);
+/// if (status & NK_FRAME_REDRAW)
+///     render(&ctx);
+/// nk_clear(&ctx);
+/// if (status & NK_FRAME_PENDING)
+///     continue;
+/// else if (status & NK_FRAME_TIMED)
+///     wait_for_event_timeout(timeout);
+/// else wait_for_event();
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+NK_API nk_flags nk_frame_status(struct nk_context*, float *timeout);
+/*/// #### nk_frame_schedule
+/// Requests another frame after a number of seconds for application driven
+/// animations. Has to be called every frame the request should stay active
+/// since requests are reset by `nk_clear`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_schedule(struct nk_context *ctx, float seconds);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __seconds__ | Time until the next frame is needed or 0 for the next frame right away
+*/
+NK_API void nk_frame_schedule(struct nk_context*, float seconds);
+/*/// #### Profiling
+/// The library marks the begin and end of its most expensive parts with the
+/// `NK_PROFILE_BEGIN(profiler, zone)` and `NK_PROFILE_END(profiler, zone)`
+/// macros. Both expand to nothing by default. They can be defined before
+/// including the implementation to forward zones to an external profiler, or
+/// `NK_INCLUDE_PROFILER` can be defined to use the built-in collector. Zones of
+/// the same kind can nest, for example a property contains buttons and an edit
+/// field, so nested zones are part of the time of their parent zone.
+///
+/// The built-in collector keeps its state in a `nk_profiler` struct owned by
+/// the caller. It is zero initialized and attached by setting the `profiler`
+/// member of a context, font atlas or frame. Zones are only collected for
+/// objects with a profiler attached, and objects used on different threads
+/// need different profilers. Command buffers and the draw list of a context
+/// take the profiler of their context. The `profiler` argument of the macros
+/// is the attached `nk_profiler` pointer and only exists together with
+/// `NK_INCLUDE_PROFILER`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define NK_PROFILE_BEGIN(profiler, zone) profiler_push(nk_profile_zone_name(zone))
+/// #define NK_PROFILE_END(profiler, zone) profiler_pop()
+/// #define NK_IMPLEMENTATION
+/// #include "nuklear.h"
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+enum nk_profile_zone {
+    NK_PROFILE_WINDOW_BEGIN,    /* nk_begin */
+    NK_PROFILE_WINDOW_END,      /* nk_end */
+    NK_PROFILE_PANEL_BEGIN,     /* panel setup of windows, groups, popups and menus */
+    NK_PROFILE_PANEL_END,       /* panel scrollbars, borders and resizing */
+    NK_PROFILE_LAYOUT,          /* row layout and widget space allocation */
+    NK_PROFILE_BUTTON,
+    NK_PROFILE_TOGGLE,
+    NK_PROFILE_SELECTABLE,
+    NK_PROFILE_SLIDER,
+    NK_PROFILE_PROGRESS,
+    NK_PROFILE_SCROLLBAR,
+    NK_PROFILE_EDIT,
+    NK_PROFILE_PROPERTY,
+    NK_PROFILE_COLOR_PICKER,
+    NK_PROFILE_BUILD,           /* linking window draw commands in nk__begin */
+    NK_PROFILE_CONVERT,         /* converting draw commands into vertices */
+    NK_PROFILE_PATH,            /* arc and curve path generation */
+    NK_PROFILE_STROKE,          /* stroke tessellation */
+    NK_PROFILE_FILL,            /* convex fill tessellation */
+    NK_PROFILE_FONT_BAKE,       /* font atlas baking and dynamic glyph rasterization */
+    NK_PROFILE_ZONE_MAX
+};
+/*/// #### nk_profile_zone_name
+/// Returns the name of a profiling zone for reports or external profilers.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const char *nk_profile_zone_name(enum nk_profile_zone zone);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __zone__    | Profiling zone
+///
+/// Returns a static string or `NULL` for an invalid zone
+*/
+NK_API const char *nk_profile_zone_name(enum nk_profile_zone);
+#ifdef NK_INCLUDE_PROFILER
+/*/// #### nk_profile_collect
+/// Copies call counts and time of all zones collected by a profiler since the
+/// last call and resets them. Calling it once per frame gives per frame
+/// numbers. Time is taken with `NK_PROFILE_CLOCK`. Without a user defined
+/// `NK_PROFILE_CLOCK` only the coarse window, build, convert and font bake
+/// zones are timed while all other zones just count calls, since the default
+/// `clock` is too slow and too coarse to be taken for every widget.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_profile_collect(struct nk_profiler *profiler, struct nk_profile *profile);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __profiler__| Must point to a zero initialized or previously collected `nk_profiler` struct
+/// __profile__ | Must point to a `nk_profile` struct to fill
+*/
+NK_API void nk_profile_collect(struct nk_profiler*, struct nk_profile*);
+#endif
 /* =============================================================================
  *
  *                                  INPUT
@@ -731,6 +985,73 @@ NK_API void nk_set_user_data(struct nk_context*, nk_handle handle);
 /// __nk_input_glyph__  | Adds a single multi-byte UTF-8 character into an internal text buffer
 /// __nk_input_unicode__| Adds a single unicode rune into an internal text buffer
 /// __nk_input_end__    | Ends the input mirroring process by calculating state changes. Don't call any `nk_input_xxx` function referenced above after this call
+/// __nk_input_push__   | Adds a timestamped event to the input queue
+/// __nk_input_push_xxx__ | Helpers to add motion, button, key, scroll and text events to the input queue
+/// __nk_input_queue_count__ | Returns the number of events not yet applied
+/// __nk_input_queue_clear__ | Removes all queued events
+/// __nk_input_record_begin__ | Starts recording input and frame timing of a context
+/// __nk_input_record_end__ | Stops recording
+/// __nk_input_replay_frame__ | Applies the recorded input of the next frame
+/// __nk_input_replay_verify__ | Compares draw commands of a replayed frame with the recording
+///
+/// #### Input queue
+/// State mirroring only keeps one state per key and button and `NK_INPUT_MAX`
+/// bytes of text for each frame. At low frame rates fast clicks, drags or
+/// typing between two frames get merged or lost. Alternatively events can be
+/// added at any time with `nk_input_push` and its helper functions. Each event
+/// carries a timestamp and events are kept in order. Consecutive motion and
+/// scroll events are merged. `nk_input_end` applies queued events in order
+/// until an event would change state already changed in the same frame, like a
+/// second click of the same button or text after a key press. Remaining events
+/// stay queued for the next frame which is signaled by `NK_FRAME_PENDING`
+/// from `nk_frame_status`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// while (GetEvent(&evt)) {
+///     if (evt.type == MOUSE_MOVE)
+///         nk_input_push_motion(&ctx, evt.time, evt.motion.x, evt.motion.y);
+///     else if (evt.type == TEXT)
+///         nk_input_push_unicode(&ctx, evt.time, evt.text.rune);
+///     // [...]
+/// }
+/// nk_input_begin(&ctx);
+/// nk_input_end(&ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Input recording
+/// Slow frames often depend on interaction like dragging a property, typing
+/// or scrolling a long group. `nk_input_record_begin` attaches a recorder to
+/// a context which stores every `nk_input_xxx` mirroring call, including
+/// events applied from the input queue, together with
+/// `nk_context::delta_time_seconds` and a hash of the draw commands of each
+/// frame. A frame ends with `nk_clear` or `nk_frame_swap`, which hash the
+/// commands before clearing or handing them over. The recording is a compact
+/// byte stream inside `nk_input_recorder::data` that can be written to a file.
+///
+/// `nk_input_replay_frame` feeds the input of one recorded frame into a
+/// context in place of the platform input. Building the same UI from the same
+/// state then reproduces the same draw commands, which is checked by
+/// `nk_input_replay_verify`. Recordings can be used as repeatable benchmark
+/// workloads or to find the first frame whose draw commands differ between
+/// two versions. Fonts are hashed by the order they are used in a frame,
+/// image and userdata handles by value.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// // record
+/// nk_input_recorder_init_default(&rec);
+/// nk_input_record_begin(&ctx, &rec);
+/// // ... frames ...
+/// nk_input_record_end(&ctx);
+/// fwrite(nk_buffer_memory(&rec.data), 1, rec.data.allocated, file);
+/// // replay
+/// nk_input_replay_init_default(&replay, data, size);
+/// while (nk_input_replay_frame(&ctx, &replay)) {
+///     // ... UI ...
+///     if (!nk_input_replay_verify(&ctx, &replay))
+///         printf("frame %u differs\n", replay.frame);
+///     nk_clear(&ctx);
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 */
 enum nk_keys {
     NK_KEY_NONE,
@@ -910,6 +1231,244 @@ NK_API void nk_input_unicode(struct nk_context*, nk_rune);
 /// __ctx__     | Must point to a previously initialized `nk_context` struct
 */
 NK_API void nk_input_end(struct nk_context*);
+enum nk_input_event_type {
+    NK_INPUT_EVENT_MOTION,
+    NK_INPUT_EVENT_BUTTON,
+    NK_INPUT_EVENT_KEY,
+    NK_INPUT_EVENT_SCROLL,
+    NK_INPUT_EVENT_UNICODE
+};
+struct nk_input_event {
+    enum nk_input_event_type type;
+    nk_uint time;
+    /* platform timestamp in milliseconds */
+    union {
+        struct {int x, y;} motion;
+        struct {enum nk_buttons id; int x, y, down;} button;
+        struct {enum nk_keys key; int down;} key;
+        struct nk_vec2 scroll;
+        nk_rune unicode;
+    } data;
+};
+/*/// #### nk_input_push
+/// Adds an event to the input queue. If the last queued event is of the same
+/// type motion events are replaced and scroll events are summed up.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_push(struct nk_context *ctx, const struct nk_input_event *evt);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __evt__     | Event to add which is copied into the queue
+///
+/// Returns `nk_false` if the queue holding `NK_INPUT_QUEUE_SIZE` events is full
+/// or the button or key of the event is out of range and `nk_true` otherwise
+*/
+NK_API int nk_input_push(struct nk_context*, const struct nk_input_event*);
+/*/// #### nk_input_push_xxx
+/// Helper functions to fill out and add an event to the input queue
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_push_motion(struct nk_context*, nk_uint time, int x, int y);
+/// int nk_input_push_button(struct nk_context*, nk_uint time, enum nk_buttons, int x, int y, int down);
+/// int nk_input_push_key(struct nk_context*, nk_uint time, enum nk_keys, int down);
+/// int nk_input_push_scroll(struct nk_context*, nk_uint time, struct nk_vec2 val);
+/// int nk_input_push_unicode(struct nk_context*, nk_uint time, nk_rune);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __time__    | Platform timestamp of the event in milliseconds
+///
+/// Remaining arguments are the same as for `nk_input_motion`, `nk_input_button`,
+/// `nk_input_key`, `nk_input_scroll` and `nk_input_unicode`.
+/// Two left button presses queued less than `NK_INPUT_DOUBLE_CLICK_TIME`
+/// milliseconds apart additionally press `NK_BUTTON_DOUBLE` until the left
+/// button is released again.
+/// Returns `nk_false` if the event was rejected by `nk_input_push` and `nk_true` otherwise
+*/
+NK_API int nk_input_push_motion(struct nk_context*, nk_uint time, int x, int y);
+NK_API int nk_input_push_button(struct nk_context*, nk_uint time, enum nk_buttons, int x, int y, int down);
+NK_API int nk_input_push_key(struct nk_context*, nk_uint time, enum nk_keys, int down);
+NK_API int nk_input_push_scroll(struct nk_context*, nk_uint time, struct nk_vec2 val);
+NK_API int nk_input_push_unicode(struct nk_context*, nk_uint time, nk_rune);
+/*/// #### nk_input_queue_count
+/// Returns the number of queued events which have not been applied by `nk_input_end` yet
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_queue_count(const struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API int nk_input_queue_count(const struct nk_context*);
+/*/// #### nk_input_queue_clear
+/// Removes all queued events, for example if the application window lost focus
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_queue_clear(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_input_queue_clear(struct nk_context*);
+/*/// #### nk_input_recorder_init
+/// Initializes an input recorder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_init(struct nk_input_recorder *rec, const struct nk_allocator *alloc);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to an either stack or heap allocated `nk_input_recorder` struct
+/// __alloc__   | Must point to a previously initialized memory allocator
+*/
+NK_API void nk_input_recorder_init(struct nk_input_recorder*, const struct nk_allocator*);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_input_recorder_init_default
+/// Initializes an input recorder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_init_default(struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to an either stack or heap allocated `nk_input_recorder` struct
+*/
+NK_API void nk_input_recorder_init_default(struct nk_input_recorder*);
+#endif
+/*/// #### nk_input_recorder_free
+/// Frees all memory held by an input recorder including the recording
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_free(struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to a previously initialized `nk_input_recorder` not attached to any context
+*/
+NK_API void nk_input_recorder_free(struct nk_input_recorder*);
+/*/// #### nk_input_record_begin
+/// Clears the recording and attaches the recorder to a context. Has to be
+/// called between `nk_clear` and the next `nk_input_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_record_begin(struct nk_context *ctx, struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __rec__     | Must point to a previously initialized `nk_input_recorder` struct
+*/
+NK_API void nk_input_record_begin(struct nk_context*, struct nk_input_recorder*);
+/*/// #### nk_input_record_end
+/// Detaches the recorder from a context. The recording stays inside
+/// `nk_input_recorder::data` until the next `nk_input_record_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_record_end(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_input_record_end(struct nk_context*);
+/*/// #### nk_input_replay_init
+/// Initializes a replay from a copy of a recording
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_init(struct nk_input_replay *replay, const struct nk_allocator *alloc,
+///     const void *memory, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to an either stack or heap allocated `nk_input_replay` struct
+/// __alloc__   | Must point to a previously initialized memory allocator
+/// __memory__  | Must point to a recording from `nk_input_recorder::data`
+/// __size__    | Size of the recording in bytes
+///
+/// Returns `nk_false` if the memory does not hold a recording and `nk_true` otherwise.
+/// The replay has to be freed with `nk_input_replay_free` in both cases
+*/
+NK_API int nk_input_replay_init(struct nk_input_replay*, const struct nk_allocator*, const void *memory, nk_size size);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_input_replay_init_default
+/// Initializes a replay from a copy of a recording using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_init_default(struct nk_input_replay *replay, const void *memory, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to an either stack or heap allocated `nk_input_replay` struct
+/// __memory__  | Must point to a recording from `nk_input_recorder::data`
+/// __size__    | Size of the recording in bytes
+///
+/// Returns `nk_false` if the memory does not hold a recording and `nk_true` otherwise
+*/
+NK_API int nk_input_replay_init_default(struct nk_input_replay*, const void *memory, nk_size size);
+#endif
+/*/// #### nk_input_replay_free
+/// Frees all memory held by a replay
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_replay_free(struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to a previously initialized `nk_input_replay` struct
+*/
+NK_API void nk_input_replay_free(struct nk_input_replay*);
+/*/// #### nk_input_replay_frame
+/// Replaces `nk_input_begin`, all input mirroring and `nk_input_end` of a
+/// frame by the recorded calls and sets `nk_context::delta_time_seconds`.
+/// Has to be called where the recorded frame called `nk_input_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_frame(struct nk_context *ctx, struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __replay__  | Must point to a previously initialized `nk_input_replay` struct
+///
+/// Returns `nk_false` after the last recorded frame or if the recording is
+/// corrupt and `nk_true` otherwise
+*/
+NK_API int nk_input_replay_frame(struct nk_context*, struct nk_input_replay*);
+/*/// #### nk_input_replay_verify
+/// Compares the draw commands of the replayed frame with the recorded frame.
+/// Has to be called after the last `nk_end` and before `nk_clear`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_verify(struct nk_context *ctx, struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __replay__  | Must point to a `nk_input_replay` struct the frame was replayed from
+///
+/// Returns `nk_true` if the draw commands are the same as recorded and
+/// `nk_false` otherwise. The first differing frame is kept in `nk_input_replay::diverged`
+*/
+NK_API int nk_input_replay_verify(struct nk_context*, struct nk_input_replay*);
 /* =============================================================================
  *
  *                                  DRAWING
@@ -1107,6 +1666,7 @@ NK_API void nk_input_end(struct nk_context*);
 /// cfg.circle_segment_count = 22;
 /// cfg.curve_segment_count = 22;
 /// cfg.arc_segment_count = 22;
+/// cfg.curve_tolerance = 0.25f; // optional: adapt segment counts to shape size
 /// cfg.global_alpha = 1.0f;
 /// cfg.null = dev->null;
 /// //
@@ -1138,6 +1698,118 @@ NK_API void nk_input_end(struct nk_context*);
 /// __nk__draw_next__   | Increments the vertex command iterator to the next command inside the context vertex command list
 /// __nk__draw_end__    | Returns the end of the vertex draw list
 /// __nk_draw_foreach__ | Iterates over each vertex draw command inside the vertex draw list
+/// __nk__begin_contexts__  | Returns the first draw command of multiple contexts drawn back to front
+/// __nk__next_contexts__   | Increments the draw command iterator over multiple contexts
+/// __nk_foreach_contexts__ | Iterates over each draw command of multiple contexts drawn back to front
+/// __nk_contexts_hovered__ | Returns the topmost context with a window at a screen position
+/// __nk_convert_contexts__ | Converts the draw commands of multiple contexts into one vertex draw list
+/// __nk_frame_init__       | Initializes a frame object holding finished draw commands from a buffer
+/// __nk_frame_free__       | Frees the command memory of a frame object
+/// __nk_frame_swap__       | Hands the finished draw commands of a context to a frame and clears the context
+/// __nk__frame_begin__     | Returns the first draw command of a frame object
+/// __nk__frame_next__      | Increments the draw command iterator of a frame object
+/// __nk_frame_foreach__    | Iterates over each draw command of a frame object
+/// __nk_frame_convert__    | Converts the draw commands of a frame object into a vertex draw list
+/// __nk_stream_encoder_init__  | Initializes an encoder serializing draw commands into stream messages
+/// __nk_stream_encoder_free__  | Frees the memory of a stream encoder
+/// __nk_stream_encoder_reset__ | Makes the next message a key frame without references to previous messages
+/// __nk_stream_encode__        | Appends a message with the draw commands of a context to a buffer
+/// __nk_stream_decoder_init__  | Initializes a decoder rebuilding draw commands from stream messages
+/// __nk_stream_decoder_free__  | Frees the memory of a stream decoder
+/// __nk_stream_decode__        | Decodes a message into the draw command list of a frame object
+///
+/// #### Multiple contexts
+/// Multiple contexts can be built in parallel, one context per thread, and
+/// composed into one frame afterwards. Each context owns its input, windows,
+/// command buffer and style. Styles can be shared by plain assignment
+/// (`ctx_b->style = ctx_a->style`) since all style data is copied by value.
+/// Fonts and baked font atlases are only read while building the UI and can be
+/// shared between contexts on different threads. A dynamic font atlas
+/// rasterizes glyphs on demand and therefore requires a lock set by
+/// `nk_font_atlas_set_lock` if it is used by multiple threads at once.
+///
+/// Contexts are passed as an array ordered back to front. Input should be
+/// routed to the context returned by `nk_contexts_hovered` and the other
+/// contexts should only receive mouse motion, so windows of different contexts
+/// overlapping each other do not both react to a click.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// struct nk_context *layers[2] = {&background, &foreground};
+/// int top = nk_contexts_hovered(layers, 2, mouse);
+/// // ... build each context on its own thread ...
+/// const struct nk_command *cmd;
+/// int index;
+/// nk_foreach_contexts(cmd, layers, 2, index) {
+///     switch (cmd->type) {
+///     //...
+///     }
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Pipelined frames
+/// `nk_clear` reuses the command memory right away, so drawing has to finish
+/// before the next frame is built. Rendering on another thread can instead
+/// overlap with building the next frame by handing finished frames off.
+/// `nk_frame_swap` replaces `nk_clear` at the end of a frame: it links all
+/// window commands, exchanges the command buffer of the context with the one
+/// held by a `nk_frame` without copying and then clears the context. The frame
+/// is immutable afterwards and owned by the render thread, which iterates it with
+/// `nk_frame_foreach` or converts it with `nk_frame_convert` into its own
+/// vertex draw list. Before the next swap the render thread has to be done with
+/// the frame since its memory becomes the command buffer of the context again.
+/// The context has to allocate windows from a pool (`nk_init`, `nk_init_default`
+/// or `nk_init_custom`) so only command memory is exchanged.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// struct nk_frame frame;
+/// nk_frame_init_default(&frame);
+/// while (1) {
+///     // ... input and UI ...
+///     wait_for_render_thread();
+///     nk_frame_swap(&ctx, &frame);
+///     signal_render_thread(&frame);
+/// }
+/// // render thread
+/// nk_frame_foreach(cmd, &frame) {
+///     // ...
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Command streams
+/// Draw commands can be rendered by another process, for example a viewer
+/// displaying the UI of a headless service. `nk_stream_encode` serializes the
+/// draw commands of a context into a binary message including text and a
+/// table of font, image and userdata handles. Messages are delta encoded:
+/// window command lists unchanged from the previous message are sent as a
+/// reference to it. On the receiving side `nk_stream_decode` rebuilds the
+/// command list inside a `nk_frame` that is iterated with `nk_frame_foreach`
+/// or converted with `nk_frame_convert`.
+///
+/// Messages have to be decoded in order. After a lost or corrupt message
+/// the decoder only accepts key frames, so the sender has to call
+/// `nk_stream_encoder_reset`. Fonts are sent as index into the font list
+/// passed to both encoder and decoder. Image and userdata handles are
+/// copied as is, so both sides have to agree on their meaning and use the
+/// same byte order and pointer size. Custom draw callbacks are not sent.
+/// Popup and cursor commands are sent as part of the last window.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_user_font *fonts[] = {&font->handle};
+/// // sender
+/// nk_stream_encoder_init_default(&enc, fonts, 1);
+/// // ... input and UI ...
+/// nk_buffer_clear(&msg);
+/// if (nk_stream_encode(&enc, &ctx, &msg))
+///     send(socket, nk_buffer_memory(&msg), msg.allocated);
+/// nk_clear(&ctx);
+/// // viewer
+/// nk_stream_decoder_init_default(&dec, fonts, 1);
+/// if (nk_stream_decode(&dec, &frame, data, size)) {
+///     nk_frame_foreach(cmd, &frame) {
+///         // ...
+///     }
+/// } else request_key_frame();
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 */
 enum nk_anti_aliasing {NK_ANTI_ALIASING_OFF, NK_ANTI_ALIASING_ON};
 enum nk_convert_result {
@@ -1162,6 +1834,7 @@ struct nk_convert_config {
     const struct nk_draw_vertex_layout_element *vertex_layout; /* describes the vertex output format and packing */
     nk_size vertex_size; /* sizeof one vertex for vertex packing */
     nk_size vertex_alignment; /* vertex alignment: Can be obtained by NK_ALIGNOF */
+    float curve_tolerance; /* if bigger than 0 segment counts of circles, arcs, curves and rounded corners are picked by shape size instead of the counts above so the tessellation stays within this distance of the exact shape. Given in draw coordinates so it has to be divided by the framebuffer scale on high DPI displays */
 };
 /*/// #### nk__begin
 /// Returns a draw command list iterator to iterate all draw
@@ -1208,50 +1881,408 @@ NK_API const struct nk_command* nk__next(struct nk_context*, const struct nk_com
 /// Iterates over each draw command inside the context draw command list
 */
 #define nk_foreach(c, ctx) for((c) = nk__begin(ctx); (c) != 0; (c) = nk__next(ctx,c))
-#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
-/*/// #### nk_convert
-/// Converts all internal draw commands into vertex draw commands and fills
-/// three buffers with vertexes, vertex draw commands and vertex indices. The vertex format
-/// as well as some other configuration values have to be configured by filling out a
-/// `nk_convert_config` struct.
+/*/// #### nk__begin_contexts
+/// Returns the first draw command of multiple contexts. Contexts are
+/// iterated in array order which is back to front.
 ///
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// nk_flags nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
-///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// const struct nk_command* nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
-/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
-/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
-/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
-/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | Output index of the context the returned command belongs to
 ///
-/// Returns one of enum nk_convert_result error codes
-///
-/// Parameter                       | Description
-/// --------------------------------|-----------------------------------------------------------
-/// NK_CONVERT_SUCCESS              | Signals a successful draw command to vertex buffer conversion
-/// NK_CONVERT_INVALID_PARAM        | An invalid argument was passed in the function call
-/// NK_CONVERT_COMMAND_BUFFER_FULL  | The provided buffer for storing draw commands is full or failed to allocate more memory
-/// NK_CONVERT_VERTEX_BUFFER_FULL   | The provided buffer for storing vertices is full or failed to allocate more memory
-/// NK_CONVERT_ELEMENT_BUFFER_FULL  | The provided buffer for storing indicies is full or failed to allocate more memory
+/// Returns draw command pointer pointing to the first command of the first non-empty context
 */
-NK_API nk_flags nk_convert(struct nk_context*, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
-/*/// #### nk__draw_begin
-/// Returns a draw vertex command buffer iterator to iterate over the vertex draw command buffer
+NK_API const struct nk_command* nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index);
+/*/// #### nk__next_contexts
+/// Returns the draw command following `cmd` and advances to the next context
+/// once all commands of the current context have been returned
 ///
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// const struct nk_draw_command* nk__draw_begin(const struct nk_context*, const struct nk_buffer*);
+/// const struct nk_command* nk__next_contexts(struct nk_context *const *ctxs, int count, int *index, const struct nk_command*);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
-/// __buf__     | Must point to an previously by `nk_convert` filled out vertex draw command buffer
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | Index of the context `cmd` belongs to and is updated to the context of the returned command
+/// __cmd__     | Must point to a draw command returned by `nk__begin_contexts` or `nk__next_contexts`
 ///
-/// Returns vertex draw command pointer pointing to the first command inside the vertex draw command buffer
+/// Returns draw command pointer pointing to the next command or NULL at the end of the last context
+*/
+NK_API const struct nk_command* nk__next_contexts(struct nk_context *const *ctxs, int count, int *index, const struct nk_command*);
+/*/// #### nk_foreach_contexts
+/// Iterates over each draw command of multiple contexts in back to front order
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define nk_foreach_contexts(c, ctxs, count, index)
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __c__       | Command pointer initialized to NULL
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | `int` variable holding the index of the context the current command belongs to
+*/
+#define nk_foreach_contexts(c, ctxs, count, index) for((c) = nk__begin_contexts(ctxs, count, &(index)); (c) != 0; (c) = nk__next_contexts(ctxs, count, &(index), c))
+/*/// #### nk_contexts_hovered
+/// Returns the topmost context with a visible window at a screen position,
+/// which is the context that should receive mouse button input
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of `nk_context` structs ordered back to front
+/// __count__   | Number of contexts inside the array
+/// __pos__     | Screen position to test, usually the mouse position
+///
+/// Returns the array index of the topmost context with a window at `pos` or -1 otherwise
+*/
+NK_API int nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos);
+/*/// #### nk_frame_init
+/// Initializes a frame object that takes over ownership of a buffer used
+/// to exchange draw command memory with a context
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_init(struct nk_frame *frame, struct nk_buffer *memory);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to an either stack or heap allocated `nk_frame` struct
+/// __memory__  | Must point to a previously initialized buffer. Fixed size buffers should have the same size as the context command buffer
+*/
+NK_API void nk_frame_init(struct nk_frame*, struct nk_buffer *memory);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_frame_init_default
+/// Initializes a frame object with a buffer using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_init_default(struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to an either stack or heap allocated `nk_frame` struct
+*/
+NK_API void nk_frame_init_default(struct nk_frame*);
+#endif
+/*/// #### nk_frame_free
+/// Frees the command memory currently held by a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_free(struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a previously initialized `nk_frame` struct
+*/
+NK_API void nk_frame_free(struct nk_frame*);
+/*/// #### nk_frame_swap
+/// Hands the draw commands of a finished frame over to a frame object by
+/// exchanging command buffers and clears the context like `nk_clear`
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_frame_swap(struct nk_context *ctx, struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a context at the end of a frame that allocates windows from a pool
+/// __frame__   | Must point to a previously initialized `nk_frame` struct no longer used by the renderer
+///
+/// Returns `true(1)` if the frame holds any draw commands or `false(0)` otherwise
+*/
+NK_API int nk_frame_swap(struct nk_context*, struct nk_frame*);
+/*/// #### nk__frame_begin
+/// Returns the first draw command of a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__frame_begin(const struct nk_frame*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+///
+/// Returns draw command pointer pointing to the first command or NULL if the frame is empty
+*/
+NK_API const struct nk_command* nk__frame_begin(const struct nk_frame*);
+/*/// #### nk__frame_next
+/// Returns the draw command following `cmd` inside a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__frame_next(const struct nk_frame*, const struct nk_command*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+/// __cmd__     | Must point to a draw command returned by `nk__frame_begin` or `nk__frame_next`
+///
+/// Returns draw command pointer pointing to the next command or NULL at the end
+*/
+NK_API const struct nk_command* nk__frame_next(const struct nk_frame*, const struct nk_command*);
+/*/// #### nk_frame_foreach
+/// Iterates over each draw command of a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define nk_frame_foreach(c, frame)
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __c__       | Command pointer initialized to NULL
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+*/
+#define nk_frame_foreach(c, frame) for((c) = nk__frame_begin(frame); (c) != 0; (c) = nk__frame_next(frame, c))
+/*/// #### nk_stream_encoder_init
+/// Initializes an encoder that serializes the draw commands of a context
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_init(struct nk_stream_encoder *enc, const struct nk_allocator *alloc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __enc__         | Must point to an either stack or heap allocated `nk_stream_encoder` struct
+/// __alloc__       | Must point to a previously initialized memory allocator
+/// __fonts__       | Fonts used by text commands in the same order as passed to the decoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_encoder_init(struct nk_stream_encoder*, const struct nk_allocator*, const struct nk_user_font *const *fonts, int font_count);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_stream_encoder_init_default
+/// Initializes a stream encoder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_init_default(struct nk_stream_encoder *enc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __enc__         | Must point to an either stack or heap allocated `nk_stream_encoder` struct
+/// __fonts__       | Fonts used by text commands in the same order as passed to the decoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_encoder_init_default(struct nk_stream_encoder*, const struct nk_user_font *const *fonts, int font_count);
+#endif
+/*/// #### nk_stream_encoder_free
+/// Frees all memory held by a stream encoder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_free(struct nk_stream_encoder *enc);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
+*/
+NK_API void nk_stream_encoder_free(struct nk_stream_encoder*);
+/*/// #### nk_stream_encoder_reset
+/// Makes the next message a key frame that can be decoded without any
+/// previous message, for example after a viewer connected or lost a message
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_reset(struct nk_stream_encoder *enc);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
+*/
+NK_API void nk_stream_encoder_reset(struct nk_stream_encoder*);
+/*/// #### nk_stream_encode
+/// Appends a message holding all draw commands of a finished frame to a buffer.
+/// Has to be called after the last `nk_end` and before `nk_clear`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_size nk_stream_encode(struct nk_stream_encoder *enc, struct nk_context *ctx, struct nk_buffer *out);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
+/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
+/// __out__     | Must point to a previously initialized buffer the message is appended to
+///
+/// Returns the size of the message in bytes or 0 if `out` is full. Nothing is appended on failure
+*/
+NK_API nk_size nk_stream_encode(struct nk_stream_encoder*, struct nk_context*, struct nk_buffer *out);
+/*/// #### nk_stream_decoder_init
+/// Initializes a decoder that rebuilds draw commands from stream messages
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_decoder_init(struct nk_stream_decoder *dec, const struct nk_allocator *alloc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __dec__         | Must point to an either stack or heap allocated `nk_stream_decoder` struct
+/// __alloc__       | Must point to a previously initialized memory allocator
+/// __fonts__       | Fonts for text commands in the same order as passed to the encoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_decoder_init(struct nk_stream_decoder*, const struct nk_allocator*, const struct nk_user_font *const *fonts, int font_count);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_stream_decoder_init_default
+/// Initializes a stream decoder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_decoder_init_default(struct nk_stream_decoder *dec,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __dec__         | Must point to an either stack or heap allocated `nk_stream_decoder` struct
+/// __fonts__       | Fonts for text commands in the same order as passed to the encoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_decoder_init_default(struct nk_stream_decoder*, const struct nk_user_font *const *fonts, int font_count);
+#endif
+/*/// #### nk_stream_decoder_free
+/// Frees all memory held by a stream decoder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_decoder_free(struct nk_stream_decoder *dec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __dec__     | Must point to a previously initialized `nk_stream_decoder` struct
+*/
+NK_API void nk_stream_decoder_free(struct nk_stream_decoder*);
+/*/// #### nk_stream_decode
+/// Decodes a message created by `nk_stream_encode` into the draw command
+/// list of a frame object. Messages have to be decoded in the order they
+/// were encoded.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_stream_decode(struct nk_stream_decoder *dec, struct nk_frame *frame,
+///     const void *message, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __dec__     | Must point to a previously initialized `nk_stream_decoder` struct
+/// __frame__   | Must point to a previously initialized `nk_frame` struct not used by the renderer
+/// __message__ | Must point to a complete message
+/// __size__    | Size of the message in bytes
+///
+/// Returns `true(1)` on success or `false(0)` if the message is corrupt or
+/// references a message the decoder did not see. Only key frames are
+/// accepted after a failure.
+*/
+NK_API int nk_stream_decode(struct nk_stream_decoder*, struct nk_frame*, const void *message, nk_size size);
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+/*/// #### nk_convert
+/// Converts all internal draw commands into vertex draw commands and fills
+/// three buffers with vertexes, vertex draw commands and vertex indices. The vertex format
+/// as well as some other configuration values have to be configured by filling out a
+/// `nk_convert_config` struct.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
+///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
+/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
+/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
+/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
+/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+///
+/// Returns one of enum nk_convert_result error codes
+///
+/// Parameter                       | Description
+/// --------------------------------|-----------------------------------------------------------
+/// NK_CONVERT_SUCCESS              | Signals a successful draw command to vertex buffer conversion
+/// NK_CONVERT_INVALID_PARAM        | An invalid argument was passed in the function call
+/// NK_CONVERT_COMMAND_BUFFER_FULL  | The provided buffer for storing draw commands is full or failed to allocate more memory
+/// NK_CONVERT_VERTEX_BUFFER_FULL   | The provided buffer for storing vertices is full or failed to allocate more memory
+/// NK_CONVERT_ELEMENT_BUFFER_FULL  | The provided buffer for storing indicies is full or failed to allocate more memory
+*/
+NK_API nk_flags nk_convert(struct nk_context*, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/*/// #### nk_convert_contexts
+/// Converts the draw commands of multiple contexts back to front into one set
+/// of vertex, element and vertex draw command buffers. The converted draw list
+/// is stored inside the first context and has to be iterated with it.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_convert_contexts(struct nk_context *const *ctxs, int count, struct nk_buffer *cmds,
+///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
+/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
+/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
+/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+///
+/// Returns one of enum nk_convert_result error codes like `nk_convert`.
+/// Vertex draw commands are iterated with `nk_draw_foreach(cmd, ctxs[0], cmds)`.
+*/
+NK_API nk_flags nk_convert_contexts(struct nk_context *const *ctxs, int count, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/*/// #### nk_frame_convert
+/// Converts the draw commands of a frame object into vertex draw commands.
+/// The vertex draw list is stored inside the frame, so conversion can run on
+/// the render thread while the context builds the next frame.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_frame_convert(struct nk_frame *frame, struct nk_buffer *cmds,
+///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
+/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
+/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
+/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+///
+/// Returns one of enum nk_convert_result error codes like `nk_convert`.
+/// Vertex draw commands are iterated with `nk_draw_list_foreach(cmd, &frame->draw_list, cmds)`.
+///
+/// !!! WARNING
+///     With `NK_INCLUDE_PROFILER` conversion and tessellation zones go to the
+///     profiler attached to `frame->profiler`. Converting on another thread than
+///     the one building the next frame needs a different profiler than the one
+///     attached to the context, or none at all.
+*/
+NK_API nk_flags nk_frame_convert(struct nk_frame*, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/*/// #### nk__draw_begin
+/// Returns a draw vertex command buffer iterator to iterate over the vertex draw command buffer
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_draw_command* nk__draw_begin(const struct nk_context*, const struct nk_buffer*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
+/// __buf__     | Must point to an previously by `nk_convert` filled out vertex draw command buffer
+///
+/// Returns vertex draw command pointer pointing to the first command inside the vertex draw command buffer
 */
 NK_API const struct nk_draw_command* nk__draw_begin(const struct nk_context*, const struct nk_buffer*);
 /*/// #### nk__draw_end
@@ -2022,6 +3053,13 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 /// row height for you and. This means if you change the font but still want
 /// a minimum row height smaller than the font you have to repush your value. <br /><br />
 ///
+/// Widgets inside rows that lie completely outside the visible area of a window
+/// or group are detected by a constant time check and skipped without being
+/// clipped, measured or drawn. For long lists of rows it is however still
+/// faster to not call widgets for invisible rows at all. `nk_layout_row_skip`
+/// jumps over any number of rows in one call while keeping the scrollbar
+/// extents the same as if all rows had been filled. <br /><br />
+///
 /// For actually more advanced UI I would even recommend using the `nk_layout_space_xxx`
 /// layouting method in combination with a cassowary constraint solver (there are
 /// some versions on github with permissive license model) to take over all control over widget
@@ -2197,6 +3235,29 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 ///     nk_end(...);
 ///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
+///     Templates repeated for a lot of rows can also be declared once as
+///     `nk_layout_template` and referenced by pointer. Column widths are
+///     then only resolved again if the panel width changes.
+///
+///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+///     // declared once
+///     struct nk_layout_template row;
+///     nk_layout_template_init(&row);
+///     nk_layout_template_push_dynamic(&row);
+///     nk_layout_template_push_variable(&row, 80);
+///     nk_layout_template_push_static(&row, 80);
+///
+///     if (nk_begin_xxx(...) {
+///         for (i = 0; i < count; ++i) {
+///             nk_layout_row_template(ctx, 30, &row);
+///             nk_widget(...);
+///             nk_widget(...);
+///             nk_widget(...);
+///         }
+///     }
+///     nk_end(...);
+///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
 /// 6.  __nk_layout_space_xxx__<br /><br />
 ///     Finally the most flexible API directly allows you to place widgets inside the
 ///     window. The space layout API is an immediate mode API which does not support
@@ -2240,12 +3301,19 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 /// nk_layout_row_push                      | Pushes another column with given size or window ratio
 /// nk_layout_row_end                       | Finished previously started row
 /// nk_layout_row                           | Specifies row columns in array as either window ratio or size
+/// nk_layout_row_skip                      | Jumps over a number of rows without allocating any widgets
+/// nk_layout_row_is_visible                | Returns if the current row is at least partially inside the visible area
 //
 /// nk_layout_row_template_begin            | Begins the row template declaration
 /// nk_layout_row_template_push_dynamic     | Adds a dynamic column that dynamically grows and can go to zero if not enough space
 /// nk_layout_row_template_push_variable    | Adds a variable column that dynamically grows but does not shrink below specified pixel width
 /// nk_layout_row_template_push_static      | Adds a static column that does not grow and will always have the same size
 /// nk_layout_row_template_end              | Marks the end of the row template
+/// nk_layout_row_template                  | Begins a new row with a template declared once with nk_layout_template_xxx
+/// nk_layout_template_init                 | Initializes a reusable row template
+/// nk_layout_template_push_dynamic         | Adds a dynamic column to a reusable row template
+/// nk_layout_template_push_variable        | Adds a variable column to a reusable row template
+/// nk_layout_template_push_static          | Adds a static column to a reusable row template
 //
 /// nk_layout_space_begin                   | Begins a new layouting space that allows to specify each widgets position and size
 /// nk_layout_space_push                    | Pushes position and size of the next widget in own coordinate space either as pixel or ratio
@@ -2393,6 +3461,39 @@ NK_API void nk_layout_row_end(struct nk_context*);
 /// __columns__ | Number of widget inside row
 */
 NK_API void nk_layout_row(struct nk_context*, enum nk_layout_format, float height, int cols, const float *ratio);
+/*/// #### nk_layout_row_skip
+/// Finishes the current row and jumps over @rows number of rows with given height
+/// without allocating any widgets. Content height and therefore scrollbars are
+/// calculated as if each skipped row had been filled with widgets.
+/// Useful to skip over long lists of rows not visible inside the current window or group.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_row_skip(struct nk_context*, float height, int rows);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+/// __height__  | Holds height of each skipped row or zero for auto layouting
+/// __rows__    | Number of rows to skip
+*/
+NK_API void nk_layout_row_skip(struct nk_context*, float height, int rows);
+/*/// #### nk_layout_row_is_visible
+/// Checks if the currently allocated row is at least partially inside the visible
+/// area of the current window or group. Widgets inside invisible rows are not
+/// drawn or updated, so callers can use this to skip expensive widget preparation.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_layout_row_is_visible(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+///
+/// Returns `true(1)` if the current row can be seen and `false(0)` if it is completely out of view
+*/
+NK_API int nk_layout_row_is_visible(struct nk_context*);
 /*/// #### nk_layout_row_template_begin
 /// Begins the row template declaration
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
@@ -2452,43 +3553,103 @@ NK_API void nk_layout_row_template_push_static(struct nk_context*, float width);
 /// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
 */
 NK_API void nk_layout_row_template_end(struct nk_context*);
-/*/// #### nk_layout_space_begin
-/// Begins a new layouting space that allows to specify each widgets position and size.
+/*/// #### nk_layout_template_init
+/// Initializes a row template that is declared once and used for many rows
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// void nk_layout_space_begin(struct nk_context*, enum nk_layout_format, float height, int widget_count);
+/// void nk_layout_template_init(struct nk_layout_template*);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
-/// __fmt__     | Either `NK_DYNAMIC` for window ratio or `NK_STATIC` for fixed size columns
-/// __height__  | Holds height of each widget in row or zero for auto layouting
-/// __columns__ | Number of widgets inside row
+/// __tmpl__    | Must point to a `nk_layout_template` struct
 */
-NK_API void nk_layout_space_begin(struct nk_context*, enum nk_layout_format, float height, int widget_count);
-/*/// #### nk_layout_space_push
-/// Pushes position and size of the next widget in own coordinate space either as pixel or ratio
+NK_API void nk_layout_template_init(struct nk_layout_template*);
+/*/// #### nk_layout_template_push_dynamic
+/// Adds a dynamic column that dynamically grows and can go to zero if not enough space
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// void nk_layout_space_push(struct nk_context *ctx, struct nk_rect bounds);
+/// void nk_layout_template_push_dynamic(struct nk_layout_template*);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_layout_space_begin`
-/// __bounds__  | Position and size in laoyut space local coordinates
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
 */
-NK_API void nk_layout_space_push(struct nk_context*, struct nk_rect bounds);
-/*/// #### nk_layout_space_end
-/// Marks the end of the layout space
+NK_API void nk_layout_template_push_dynamic(struct nk_layout_template*);
+/*/// #### nk_layout_template_push_variable
+/// Adds a variable column that dynamically grows but does not shrink below specified pixel width
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// void nk_layout_space_end(struct nk_context*);
+/// void nk_layout_template_push_variable(struct nk_layout_template*, float min_width);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_layout_space_begin`
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
+/// __width__   | Holds the minimum pixel width the next column must always be
 */
-NK_API void nk_layout_space_end(struct nk_context*);
+NK_API void nk_layout_template_push_variable(struct nk_layout_template*, float min_width);
+/*/// #### nk_layout_template_push_static
+/// Adds a static column that does not grow and will always have the same size
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_template_push_static(struct nk_layout_template*, float width);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
+/// __width__   | Holds the absolute pixel width value the next column must be
+*/
+NK_API void nk_layout_template_push_static(struct nk_layout_template*, float width);
+/*/// #### nk_layout_row_template
+/// Starts a new row using a previously declared template. Column widths are
+/// resolved once and only recalculated if the usable panel width changes.
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_row_template(struct nk_context*, float height, struct nk_layout_template*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+/// __height__  | Holds height of each widget in row or zero for auto layouting
+/// __tmpl__    | Must point to a template filled with `nk_layout_template_push_xxx`
+*/
+NK_API void nk_layout_row_template(struct nk_context*, float height, struct nk_layout_template*);
+/*/// #### nk_layout_space_begin
+/// Begins a new layouting space that allows to specify each widgets position and size.
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_space_begin(struct nk_context*, enum nk_layout_format, float height, int widget_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+/// __fmt__     | Either `NK_DYNAMIC` for window ratio or `NK_STATIC` for fixed size columns
+/// __height__  | Holds height of each widget in row or zero for auto layouting
+/// __columns__ | Number of widgets inside row
+*/
+NK_API void nk_layout_space_begin(struct nk_context*, enum nk_layout_format, float height, int widget_count);
+/*/// #### nk_layout_space_push
+/// Pushes position and size of the next widget in own coordinate space either as pixel or ratio
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_space_push(struct nk_context *ctx, struct nk_rect bounds);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_layout_space_begin`
+/// __bounds__  | Position and size in laoyut space local coordinates
+*/
+NK_API void nk_layout_space_push(struct nk_context*, struct nk_rect bounds);
+/*/// #### nk_layout_space_end
+/// Marks the end of the layout space
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_space_end(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_layout_space_begin`
+*/
+NK_API void nk_layout_space_end(struct nk_context*);
 /*/// #### nk_layout_space_bounds
 /// Utility function to calculate total space allocated for `nk_layout_space`
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
@@ -3022,6 +4183,44 @@ NK_API void nk_tree_element_pop(struct nk_context*);
  *                                  LIST VIEW
  *
  * ============================================================================= */
+/* Index over rows of different height for `nk_list_view_begin_variable`.
+ * Row heights are stored inside a fenwick tree in caller provided memory
+ * (one `nk_list_view_row` per row) which allows to find the first visible
+ * row, the offset of a row and update a single row height in O(log n).
+ * Sums are kept as doubles next to the exact height of each row, so offsets
+ * do not drift over many updates. Offsets are still returned as float and
+ * lose sub-pixel precision once lists grow beyond 2^24 pixels.
+ * Row heights must not be negative and rows shorter than the minimum row
+ * height of the panel (font height plus text and row padding) are not
+ * supported, since the row layout grows them and the drawn rows would no
+ * longer match the offsets inside the index:
+ *
+ *      struct nk_list_view_row memory[ROW_COUNT];
+ *      struct nk_list_view_index index;
+ *      nk_list_view_index_init(&index, memory, ROW_COUNT);
+ *      nk_list_view_index_build(&index, row_height_callback, userdata, ROW_COUNT);
+ *
+ *      if (nk_list_view_begin_variable(ctx, &view, "log", NK_WINDOW_BORDER, &index)) {
+ *          for (i = view.begin; i < view.end; ++i) {
+ *              nk_layout_row_dynamic(ctx, nk_list_view_index_height(&index, i), 1);
+ *              nk_label_wrap(ctx, lines[i]);
+ *          }
+ *          nk_list_view_end(&view);
+ *      }
+ */
+struct nk_list_view_row {
+    double sum;
+    /* fenwick tree node */
+    float height;
+    /* height of the row itself */
+};
+struct nk_list_view_index {
+    struct nk_list_view_row *rows;
+    int count;
+    int capacity;
+};
+typedef float(*nk_list_view_row_height)(nk_handle userdata, int row);
+
 struct nk_list_view {
 /* public: */
     int begin, end, count;
@@ -3030,9 +4229,150 @@ struct nk_list_view {
     struct nk_context *ctx;
     nk_uint *scroll_pointer;
     nk_uint scroll_value;
+    const struct nk_list_view_index *index;
 };
 NK_API int nk_list_view_begin(struct nk_context*, struct nk_list_view *out, const char *id, nk_flags, int row_height, int row_count);
+NK_API int nk_list_view_begin_variable(struct nk_context*, struct nk_list_view *out, const char *id, nk_flags, const struct nk_list_view_index*);
 NK_API void nk_list_view_end(struct nk_list_view*);
+
+NK_API void nk_list_view_index_init(struct nk_list_view_index*, struct nk_list_view_row *memory, int capacity);
+NK_API int nk_list_view_index_build(struct nk_list_view_index*, nk_list_view_row_height, nk_handle userdata, int row_count);
+NK_API void nk_list_view_index_set(struct nk_list_view_index*, int row, float height);
+NK_API float nk_list_view_index_height(const struct nk_list_view_index*, int row);
+NK_API float nk_list_view_index_offset(const struct nk_list_view_index*, int row, float spacing);
+NK_API int nk_list_view_index_find(const struct nk_list_view_index*, float offset, float spacing);
+/* =============================================================================
+ *
+ *                                  GRID
+ *
+ * ============================================================================= */
+/* Virtualized table with a fixed row height and a sticky header row. Only
+ * visible rows `[row_begin, row_end)` and visible columns `[col_begin, col_end)`
+ * have to be submitted and cells are drawn directly without going through the
+ * row layout, so grids with millions of rows cost the same as small ones.
+ * Column offsets and measured cell text widths are cached inside the caller
+ * owned columns, which also keep the width after resizing and the current
+ * sort order. Cached text widths are dropped if the font or column width
+ * changes:
+ *
+ *      static struct nk_grid_column columns[] = {
+ *          {"Name", 200, 40, NK_TEXT_LEFT},
+ *          {"Size", 80, 40, NK_TEXT_RIGHT}
+ *      };
+ *      struct nk_grid grid;
+ *      if (nk_grid_begin(ctx, &grid, "files", NK_WINDOW_BORDER|NK_GRID_SORTABLE|NK_GRID_RESIZABLE,
+ *          columns, 2, 0, ROW_COUNT)) {
+ *          for (row = grid.row_begin; row < grid.row_end; ++row)
+ *              for (col = grid.col_begin; col < grid.col_end; ++col)
+ *                  nk_grid_cell_label(&grid, row, col, cell_text(row, col));
+ *          if (nk_grid_end(&grid))
+ *              sort_rows(columns);
+ *      }
+ */
+enum nk_grid_flags {
+    NK_GRID_SORTABLE    = NK_FLAG(24), /* Clicking a column header toggles the column sort order */
+    NK_GRID_RESIZABLE   = NK_FLAG(25)  /* Dragging the right border of a column header resizes the column */
+};
+enum nk_grid_sort {
+    NK_GRID_SORT_NONE,
+    NK_GRID_SORT_ASCENDING,
+    NK_GRID_SORT_DESCENDING
+};
+struct nk_grid_text {
+    nk_hash hash;
+    int length;
+    /* hash and length of the measured text or zero length if unused */
+    int clamped;
+    float width;
+    /* length and width of the text after clamping to the column */
+};
+struct nk_grid_column {
+/* public: */
+    const char *title;
+    float width, min_width;
+    nk_flags align;
+    enum nk_grid_sort sort;
+/* private: */
+    float offset, text_width;
+    const struct nk_user_font *font;
+    float font_height, measured_width;
+    /* font and text width the cached cell texts were measured with */
+    struct nk_grid_text texts[NK_GRID_TEXT_CACHE_SIZE];
+};
+struct nk_grid {
+/* public: */
+    int row_begin, row_end;
+    int col_begin, col_end;
+/* private: */
+    struct nk_context *ctx;
+    struct nk_grid_column *columns;
+    int column_count, row_count;
+    float row_height, total_width;
+    struct nk_vec2 origin;
+    nk_uint scroll_y;
+    nk_flags flags;
+    int sorted;
+};
+NK_API int nk_grid_begin(struct nk_context*, struct nk_grid *out, const char *id, nk_flags, struct nk_grid_column*, int column_count, float row_height, int row_count);
+NK_API struct nk_rect nk_grid_cell_bounds(const struct nk_grid*, int row, int col);
+NK_API void nk_grid_cell_text(struct nk_grid*, int row, int col, const char*, int len);
+NK_API void nk_grid_cell_label(struct nk_grid*, int row, int col, const char*);
+NK_API int nk_grid_end(struct nk_grid*);
+/* =============================================================================
+ *
+ *                                  TREE VIEW
+ *
+ * ============================================================================= */
+/* Virtualized tree for large hierarchies. Nodes are provided by the caller in
+ * depth-first order together with the number of nodes inside their subtree.
+ * Expansion state lives in caller provided memory (one byte per node) and
+ * only expanded nodes are flattened into the visible row list, which is
+ * rebuilt after a node was toggled. Collapsed subtrees are skipped in one
+ * step and frame cost only depends on the number of visible rows:
+ *
+ *      static struct nk_tree_view_node nodes[NODE_COUNT] = {
+ *          {"assets", 0, 3}, {"textures", 1, 1}, {"stone.png", 2, 0}, {"shaders", 1, 0}
+ *      };
+ *      static nk_byte expanded[NODE_COUNT];
+ *      static int rows[NODE_COUNT];
+ *      static struct nk_tree_view_state tree;
+ *      nk_tree_view_init(&tree, nodes, NODE_COUNT, expanded, rows);
+ *
+ *      struct nk_tree_view view;
+ *      if (nk_tree_view_begin(ctx, &view, "assets", NK_WINDOW_BORDER, &tree)) {
+ *          for (i = view.begin; i < view.end; ++i)
+ *              nk_tree_view_node(&view, i);
+ *          nk_tree_view_end(&view);
+ *      }
+ */
+struct nk_tree_view_node {
+    const char *label;
+    int depth;
+    int descendants;
+};
+struct nk_tree_view_state {
+    const struct nk_tree_view_node *nodes;
+    int node_count;
+    nk_byte *expanded;
+    int *rows;
+    int row_count;
+    int dirty;
+};
+struct nk_tree_view {
+/* public: */
+    int begin, end;
+/* private: */
+    struct nk_list_view list;
+    struct nk_tree_view_state *state;
+    float row_height;
+};
+NK_API void nk_tree_view_init(struct nk_tree_view_state*, const struct nk_tree_view_node*, int node_count, nk_byte *expanded, int *rows);
+NK_API void nk_tree_view_set_expanded(struct nk_tree_view_state*, int node, int expanded);
+NK_API int nk_tree_view_is_expanded(const struct nk_tree_view_state*, int node);
+NK_API int nk_tree_view_update(struct nk_tree_view_state*);
+NK_API int nk_tree_view_begin(struct nk_context*, struct nk_tree_view *out, const char *id, nk_flags, struct nk_tree_view_state*);
+NK_API int nk_tree_view_node(struct nk_tree_view*, int row);
+NK_API void nk_tree_view_end(struct nk_tree_view*);
 /* =============================================================================
  *
  *                                  WIDGET
@@ -3891,6 +5231,92 @@ NK_API const char* nk_utf_at(const char *buffer, int length, int index, nk_rune
         cfg.coord_type = NK_COORD_PIXEL;
         nk_font *font = nk_font_atlas_add_from_file(&atlas, "Path/To/Your/TTF_Font.ttf", 13, &cfg);
 
+    Baking can be skipped on later runs by storing the baked atlas. After
+    `nk_font_atlas_bake` and before `nk_font_atlas_end` the glyphs, range tables,
+    cursor region and pixels can be written into one binary blob with
+    `nk_font_atlas_save`. After adding the same fonts with the same configuration
+    `nk_font_atlas_load` can be used instead of `nk_font_atlas_bake`. The blob is
+    keyed by a hash of all font data and configurations (`nk_font_atlas_hash`)
+    and loading returns `NULL` if it does not match anymore, in which case
+    the atlas has to be baked again:
+
+        const void *img = nk_font_atlas_load_from_file(&atlas, "fonts.cache", &w, &h, NK_FONT_ATLAS_RGBA32);
+        if (!img) {
+            img = nk_font_atlas_bake(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+            nk_font_atlas_save_to_file(&atlas, "fonts.cache");
+        }
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), 0);
+
+    UIs drawing text at many scales can bake each font once as signed distance
+    field by setting `nk_font_config::sdf` to the distance in pixels stored around
+    each glyph. Each texel then holds the distance to the glyph outline with 128
+    on the outline, so one large bake (32 pixel for example) renders smooth
+    text at any font height. The renderer has to convert distance into coverage,
+    for example with `smoothstep(0.5 - w, 0.5 + w, alpha)` in a fragment shader
+    where `w` is about half a pixel in distance units (`fwidth(alpha)`):
+
+        struct nk_font_config cfg = nk_font_config(0);
+        cfg.sdf = 4;
+        struct nk_font *font = nk_font_atlas_add_from_file(&atlas, "Path/To/Your/TTF_Font.ttf", 32, &cfg);
+        font->handle.height = 13;
+
+    Fonts with big character sets (CJK for example) do not fit into a reasonably
+    sized texture. For these `nk_font_atlas_bake_dynamic` creates an empty texture
+    of fixed size and rasterizes glyphs on first use instead. The texture is split
+    into `NK_FONT_DYNAMIC_PAGES` pages and if all pages are full the least
+    recently used page is cleared. Changed texture regions have to be uploaded
+    each frame after `nk_convert` or drawing and before rendering. Font data
+    is needed for rasterization so `nk_font_atlas_cleanup` does nothing for
+    dynamic atlases:
+
+        struct nk_recti r;
+        const void *img = nk_font_atlas_bake_dynamic(&atlas, 1024, 1024, 4096, NK_FONT_ATLAS_ALPHA8);
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), &null);
+        while (1) {
+            [...]
+            nk_convert(&ctx, &cmds, &verts, &idx, &cfg);
+            while (nk_font_atlas_dirty(&atlas, &r))
+                upload_texture_region(texture, r.x, r.y, r.w, r.h, img);
+            [...]
+        }
+
+    Baked fonts and atlases are never written to after `nk_font_atlas_end`
+    and can be used by multiple contexts on different threads at the same time.
+    Adding compressed fonts uses global state so atlases should be set up on a
+    single thread. Dynamic atlases rasterize glyphs while text is measured and
+    drawn, so if contexts using the same dynamic atlas are built on different
+    threads a lock has to be provided:
+
+        nk_font_atlas_set_lock(&atlas, nk_handle_ptr(&mutex), mutex_lock, mutex_unlock);
+
+    By default glyphs are packed in a single pass into a texture 512 or 1024
+    pixels wide and the height is rounded up to the next power of two. Setting
+    `nk_font_atlas::packing` to `NK_FONT_ATLAS_PACK_TIGHT` before baking tries
+    a number of widths around a square atlas with skyline and MaxRects packing
+    and keeps the smallest result without rounding the height. It is slower to
+    bake so combine it with `nk_font_atlas_save` for big glyph sets. How well
+    the texture is used can be checked with `nk_font_atlas_get_stats`:
+
+        struct nk_font_atlas_stats stats;
+        atlas.packing = NK_FONT_ATLAS_PACK_TIGHT;
+        img = nk_font_atlas_bake(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+        if (nk_font_atlas_get_stats(&atlas, &stats))
+            printf("%.1f%% used, %lu bytes wasted\n", stats.utilization * 100.0f,
+                (unsigned long)stats.wasted_bytes);
+
+    Applications only using the default font can define `NK_INCLUDE_DEFAULT_FONT_ATLAS`
+    to compile in the default font already baked into a tightly packed atlas
+    (13 pixel height, default configuration and glyph ranges). Baking an atlas
+    without any added font, or calling `nk_font_atlas_bake_default` directly,
+    then only expands the stored pixels instead of decompressing and rasterizing
+    the font. The baked data is generated by `example/font_atlas_embed.c`:
+
+        nk_font_atlas_init_default(&atlas);
+        nk_font_atlas_begin(&atlas);
+        img = nk_font_atlas_bake_default(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), &null);
+        nk_init_default(&ctx, &atlas.default_font->handle);
+
 */
 struct nk_user_font_glyph;
 typedef float(*nk_text_width_f)(nk_handle, float h, const char*, int len);
@@ -3932,7 +5358,12 @@ enum nk_font_coord_type {
     NK_COORD_PIXEL /* texture coordinates inside font glyphs are in absolute pixel */
 };
 
+#ifndef NK_FONT_DYNAMIC_PAGES
+#define NK_FONT_DYNAMIC_PAGES 4
+#endif
+
 struct nk_font;
+struct nk_font_dynamic;
 struct nk_baked_font {
     float height;
     /* height of the font  */
@@ -3964,7 +5395,9 @@ struct nk_font_config {
     /* align every character to pixel boundary (if true set oversample (1,1)) */
     unsigned char oversample_v, oversample_h;
     /* rasterize at hight quality for sub-pixel position */
-    unsigned char padding[3];
+    unsigned char sdf;
+    /* bake glyphs as signed distance field with given spread in pixels (ignores oversampling) */
+    unsigned char padding[2];
 
     float size;
     /* baked pixel height of the font */
@@ -3999,6 +5432,7 @@ struct nk_font {
     nk_rune fallback_codepoint;
     nk_handle texture;
     struct nk_font_config *config;
+    struct nk_font_dynamic *dynamic;
 };
 
 enum nk_font_atlas_format {
@@ -4006,10 +5440,30 @@ enum nk_font_atlas_format {
     NK_FONT_ATLAS_RGBA32
 };
 
+enum nk_font_atlas_packing {
+    NK_FONT_ATLAS_PACK_DEFAULT,
+    /* one skyline pass with fixed width and power of two height */
+    NK_FONT_ATLAS_PACK_TIGHT
+    /* tries multiple packing heuristics and widths for the smallest atlas */
+};
+
+struct nk_font_atlas_stats {
+    int width, height;
+    nk_size texture_bytes;
+    /* size of the texture in bytes */
+    nk_size used_bytes;
+    /* bytes covered by packed glyphs and cursor data */
+    nk_size wasted_bytes;
+    /* bytes not covered by anything */
+    float utilization;
+    /* used bytes divided by texture bytes */
+};
+
 struct nk_font_atlas {
     void *pixel;
     int tex_width;
     int tex_height;
+    enum nk_font_atlas_format format;
 
     struct nk_allocator permanent;
     struct nk_allocator temporary;
@@ -4023,6 +5477,18 @@ struct nk_font_atlas {
     struct nk_font *fonts;
     struct nk_font_config *config;
     int font_num;
+    struct nk_font_dynamic *dynamic;
+
+    enum nk_font_atlas_packing packing;
+    nk_size used_pixels;
+
+    nk_handle lock_userdata;
+    void(*lock)(nk_handle);
+    void(*unlock)(nk_handle);
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+    /* collector of the font bake zones or NULL */
+#endif
 };
 
 /* some language glyph codepoint ranges */
@@ -4049,6 +5515,20 @@ NK_API struct nk_font* nk_font_atlas_add_from_file(struct nk_font_atlas *atlas,
 NK_API struct nk_font *nk_font_atlas_add_compressed(struct nk_font_atlas*, void *memory, nk_size size, float height, const struct nk_font_config*);
 NK_API struct nk_font* nk_font_atlas_add_compressed_base85(struct nk_font_atlas*, const char *data, float height, const struct nk_font_config *config);
 NK_API const void* nk_font_atlas_bake(struct nk_font_atlas*, int *width, int *height, enum nk_font_atlas_format);
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+NK_API const void* nk_font_atlas_bake_default(struct nk_font_atlas*, int *width, int *height, enum nk_font_atlas_format);
+#endif
+NK_API nk_hash nk_font_atlas_hash(const struct nk_font_atlas*, enum nk_font_atlas_format);
+NK_API nk_size nk_font_atlas_save(const struct nk_font_atlas*, void *memory, nk_size size);
+NK_API const void* nk_font_atlas_load(struct nk_font_atlas*, const void *memory, nk_size size, int *width, int *height, enum nk_font_atlas_format);
+#ifdef NK_INCLUDE_STANDARD_IO
+NK_API int nk_font_atlas_save_to_file(const struct nk_font_atlas*, const char *file_path);
+NK_API const void* nk_font_atlas_load_from_file(struct nk_font_atlas*, const char *file_path, int *width, int *height, enum nk_font_atlas_format);
+#endif
+NK_API const void* nk_font_atlas_bake_dynamic(struct nk_font_atlas*, int width, int height, int glyph_capacity, enum nk_font_atlas_format);
+NK_API int nk_font_atlas_dirty(struct nk_font_atlas*, struct nk_recti *rect);
+NK_API void nk_font_atlas_set_lock(struct nk_font_atlas*, nk_handle userdata, void(*lock)(nk_handle), void(*unlock)(nk_handle));
+NK_API int nk_font_atlas_get_stats(const struct nk_font_atlas*, struct nk_font_atlas_stats*);
 NK_API void nk_font_atlas_end(struct nk_font_atlas*, nk_handle tex, struct nk_draw_null_texture*);
 NK_API const struct nk_font_glyph* nk_font_find_glyph(struct nk_font*, nk_rune unicode);
 NK_API void nk_font_atlas_cleanup(struct nk_font_atlas *atlas);
@@ -4088,6 +5568,26 @@ NK_API void nk_font_atlas_clear(struct nk_font_atlas*);
     NK_INCLUDE_DEFAULT_ALLOCATOR which uses the standard library memory
     allocation functions malloc and free and takes over complete control over
     memory in this library.
+
+    Dynamic buffers grow by allocating a bigger block and copying everything
+    over, which shows up as a frame spike whenever the UI grows. Draw command
+    memory can instead be a segmented buffer created by `nk_buffer_init_segmented`.
+    It allocates additional fixed size segments when full and never moves
+    commands that were already written. Commands are still linked by offsets,
+    so `nk__begin`, `nk__next` and `nk_foreach` work the same. A command not
+    fitting into the rest of a segment is placed into the next one and the gap
+    is bridged by a `NK_COMMAND_NOP` command. Segmented buffers only support
+    front allocations, so pass them as command buffer to `nk_init_custom`
+    together with a pool buffer. Segment sizes are rounded up to a power of
+    two of at least `NK_BUFFER_SEGMENT_MIN_SIZE` (4KB). A command larger than
+    a segment, like long text or a polygon with many points, gets a run of
+    consecutive segments backed by a single allocation which is kept and
+    reused by the following frames:
+
+        struct nk_buffer cmds, pool;
+        nk_buffer_init_segmented(&cmds, &alloc, 64 * 1024);
+        nk_buffer_init(&pool, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+        nk_init_custom(&ctx, &cmds, &pool, &font);
 */
 struct nk_memory_status {
     void *memory;
@@ -4098,9 +5598,64 @@ struct nk_memory_status {
     nk_size calls;
 };
 
+struct nk_memory_stats {
+    nk_size command_bytes;
+    /* bytes of draw commands in the current frame */
+    nk_size command_capacity;
+    /* size of the memory block holding draw commands */
+    nk_size command_needed;
+    /* all bytes requested from the command memory block */
+    nk_size command_high_water;
+    /* most draw command bytes in a single frame */
+    unsigned int command_count;
+    /* number of draw commands in the current frame */
+    nk_size vertex_bytes, vertex_capacity, vertex_high_water;
+    nk_size element_bytes, element_capacity, element_high_water;
+    /* vertex and element buffer usage of `nk_convert` */
+    unsigned int pool_pages;
+    /* number of pages allocated by the page element pool */
+    unsigned int pool_page_capacity;
+    /* number of page elements per page */
+    unsigned int page_elements;
+    /* page elements allocated for windows, panels and tables */
+    unsigned int page_elements_free;
+    /* allocated page elements currently unused in the free list */
+    nk_size pool_reclaimable;
+    /* bytes of pool pages `nk_memory_compact` would free */
+    unsigned int window_count;
+    unsigned int table_count;
+};
+
+struct nk_window_memory_stats {
+    const char *name;
+    nk_size command_bytes;
+    unsigned int command_count;
+    unsigned int table_count;
+};
+
+#ifdef NK_INCLUDE_PROFILER
+struct nk_profile_zone_stats {
+    unsigned int calls;
+    /* number of times the zone was entered */
+    double seconds;
+    /* time spent in the zone with nested zones of the same kind counted once */
+};
+struct nk_profile {
+    struct nk_profile_zone_stats zones[NK_PROFILE_ZONE_MAX];
+};
+struct nk_profiler {
+    struct nk_profile data;
+    /* zone stats since the last `nk_profile_collect` */
+    double start[NK_PROFILE_ZONE_MAX];
+    unsigned int depth[NK_PROFILE_ZONE_MAX];
+    /* begin time and nesting depth of open zones */
+};
+#endif
+
 enum nk_allocation_type {
     NK_BUFFER_FIXED,
-    NK_BUFFER_DYNAMIC
+    NK_BUFFER_DYNAMIC,
+    NK_BUFFER_SEGMENTED
 };
 
 enum nk_buffer_allocation_type {
@@ -4115,6 +5670,13 @@ struct nk_buffer_marker {
 };
 
 struct nk_memory {void *ptr;nk_size size;};
+struct nk_buffer_segment {
+    void *memory;
+    /* start of the segment memory */
+    unsigned int count;
+    /* number of consecutive segments sharing the allocation starting at this
+     * segment or zero if the memory belongs to a previous segment */
+};
 struct nk_buffer {
     struct nk_buffer_marker marker[NK_BUFFER_MAX];
     /* buffer marker to free a buffer to a certain offset */
@@ -4134,6 +5696,14 @@ struct nk_buffer {
     /* number of allocation calls */
     nk_size size;
     /* current size of the buffer */
+    struct nk_buffer_segment *segments;
+    /* memory blocks of a segmented buffer in offset order */
+    unsigned int segment_count;
+    /* number of memory blocks allocated for a segmented buffer */
+    unsigned int segment_capacity;
+    /* number of memory block pointers fitting into `segments` */
+    unsigned int segment_shift;
+    /* size of each memory block of a segmented buffer as power of two */
 };
 
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
@@ -4141,6 +5711,7 @@ NK_API void nk_buffer_init_default(struct nk_buffer*);
 #endif
 NK_API void nk_buffer_init(struct nk_buffer*, const struct nk_allocator*, nk_size size);
 NK_API void nk_buffer_init_fixed(struct nk_buffer*, void *memory, nk_size size);
+NK_API void nk_buffer_init_segmented(struct nk_buffer*, const struct nk_allocator*, nk_size segment_size);
 NK_API void nk_buffer_info(struct nk_memory_status*, struct nk_buffer*);
 NK_API void nk_buffer_push(struct nk_buffer*, enum nk_buffer_allocation_type type, const void *memory, nk_size size, nk_size align);
 NK_API void nk_buffer_mark(struct nk_buffer*, enum nk_buffer_allocation_type type);
@@ -4559,12 +6130,23 @@ enum nk_command_clipping {
     NK_CLIPPING_ON = nk_true
 };
 
+struct nk_command_packing {
+    struct nk_buffer table;
+    /* fonts, images, callbacks and userdata referenced by packed commands */
+    struct nk_buffer scratch;
+    /* command packed for hashing by the input recorder */
+};
+
 struct nk_command_buffer {
     struct nk_buffer *base;
     struct nk_rect clip;
     int use_clipping;
     nk_handle userdata;
     nk_size begin, end, last;
+    unsigned int count;
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+#endif
 };
 
 /* shape outlines */
@@ -4627,6 +6209,28 @@ struct nk_input {
     struct nk_mouse mouse;
 };
 
+struct nk_input_recorder {
+    struct nk_buffer data;
+    /* recorded input calls and frames */
+    struct nk_command_packing packing;
+    /* handle table to hash draw commands independent of pointers */
+    nk_uint frames;
+    /* number of recorded frames */
+};
+struct nk_input_replay {
+    struct nk_buffer data;
+    /* copy of the recording */
+    struct nk_command_packing packing;
+    nk_size offset;
+    /* read offset of the next frame */
+    nk_uint frame;
+    /* number of replayed frames */
+    nk_hash hash;
+    /* draw command hash of the current frame inside the recording */
+    nk_uint diverged;
+    /* first frame with different draw commands or zero */
+};
+
 NK_API int nk_input_has_mouse_click(const struct nk_input*, enum nk_buttons);
 NK_API int nk_input_has_mouse_click_in_rect(const struct nk_input*, enum nk_buttons, struct nk_rect);
 NK_API int nk_input_has_mouse_click_down_in_rect(const struct nk_input*, enum nk_buttons, struct nk_rect, int down);
@@ -4730,7 +6334,7 @@ struct nk_draw_command {
 
 struct nk_draw_list {
     struct nk_rect clip_rect;
-    struct nk_vec2 circle_vtx[12];
+    struct nk_vec2 circle_vtx[48];
     struct nk_convert_config config;
 
     struct nk_buffer *buffer;
@@ -4751,6 +6355,9 @@ struct nk_draw_list {
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     nk_handle userdata;
 #endif
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+#endif
 };
 
 /* draw list */
@@ -5309,6 +6916,16 @@ struct nk_row_layout {
     float templates[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
 };
 
+struct nk_layout_template {
+/* public: */
+    int columns;
+    float templates[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
+/* private: */
+    int resolved;
+    float space;
+    float widths[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
+};
+
 struct nk_popup_buffer {
     nk_size begin;
     nk_size parent;
@@ -5430,6 +7047,8 @@ struct nk_window {
     struct nk_window *next;
     struct nk_window *prev;
     struct nk_window *parent;
+    /* position in window list when the hover index was last built */
+    unsigned int order;
 };
 
 /*==============================================================
@@ -5566,6 +7185,54 @@ struct nk_pool {
     nk_size cap;
 };
 
+struct nk_frame {
+    struct nk_buffer memory;
+    /* draw command memory exchanged with a context by `nk_frame_swap` */
+    nk_size begin;
+    /* offset of the first draw command inside `memory` */
+    unsigned int seq;
+    /* frame counter of the context the commands were built in */
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    struct nk_draw_list draw_list;
+    /* vertex draw list filled by `nk_frame_convert` */
+#endif
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+    /* collector of the convert zones of `nk_frame_convert` or NULL */
+#endif
+};
+
+struct nk_stream_history {
+    struct nk_buffer ranges[2];
+    /* window ranges of the current and previous message */
+    struct nk_buffer data[2];
+    /* packed commands of the window ranges */
+    int current;
+    /* index of the buffers holding the previous message */
+};
+struct nk_stream_encoder {
+    struct nk_command_packing packing;
+    /* font, image and userdata handle table shared with the decoder */
+    struct nk_stream_history history;
+    const struct nk_user_font *const *fonts;
+    int font_count;
+    /* fonts in the same order as passed to the decoder */
+    nk_uint sent;
+    /* number of handle table entries already sent */
+    int key;
+    /* next message is a key frame */
+};
+struct nk_stream_decoder {
+    struct nk_command_packing packing;
+    /* handle table rebuilt from messages */
+    struct nk_stream_history history;
+    const struct nk_user_font *const *fonts;
+    int font_count;
+    /* fonts in the same order as passed to the encoder */
+    int valid;
+    /* cleared on errors until the next key frame */
+};
+
 struct nk_context {
 /* public: can be accessed freely */
     struct nk_input input;
@@ -5593,6 +7260,25 @@ struct nk_context {
     struct nk_text_edit text_edit;
     /* draw buffer used for overlay drawing operation like cursor */
     struct nk_command_buffer overlay;
+    /* high-water marks and last vertex output for memory telemetry */
+    struct nk_memory_stats memory_stats;
+    /* draw command hash of the last `nk_frame_status` call and time until
+     * the next requested frame or negative if none */
+    nk_hash frame_hash;
+    float frame_deadline;
+    /* timestamped input events not yet applied to `input` */
+    struct nk_input_event input_queue[NK_INPUT_QUEUE_SIZE];
+    int input_queue_count;
+    /* timestamp of the last queued left button press and whether it can
+     * still start a double click */
+    nk_uint input_click_time;
+    int input_click_armed;
+    /* recorder of input calls if `nk_input_record_begin` was called */
+    struct nk_input_recorder *recorder;
+#ifdef NK_INCLUDE_PROFILER
+    /* collector of all zones entered by this context or NULL */
+    struct nk_profiler *profiler;
+#endif
 
     /* windows */
     int build;
@@ -5605,6 +7291,11 @@ struct nk_context {
     struct nk_page_element *freelist;
     unsigned int count;
     unsigned int seq;
+    /* hover index: topmost window under `hovered_pos` resolved in frame
+     * `hovered_seq`, or zero `hovered_seq` if it has to be rebuilt */
+    struct nk_window *hovered;
+    struct nk_vec2 hovered_pos;
+    unsigned int hovered_seq;
 };
 
 /* ==============================================================
@@ -5698,6 +7389,14 @@ template<typename T> struct nk_alignof{struct Big {T x; char c;}; enum {
 #define NK_BUFFER_DEFAULT_INITIAL_SIZE (4*1024)
 #endif
 
+#ifndef NK_BUFFER_SEGMENT_MIN_SIZE
+#define NK_BUFFER_SEGMENT_MIN_SIZE (4*1024)
+#endif
+
+#ifndef NK_FONT_PACK_MAXRECTS_LIMIT
+#define NK_FONT_PACK_MAXRECTS_LIMIT 4096
+#endif
+
 /* standard library headers */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 #include <stdlib.h> /* malloc, free */
@@ -5708,10 +7407,32 @@ template<typename T> struct nk_alignof{struct Big {T x; char c;}; enum {
 #ifdef NK_INCLUDE_STANDARD_VARARGS
 #include <stdarg.h> /* valist, va_start, va_end, ... */
 #endif
+#ifdef NK_INCLUDE_SSE2
+#include <emmintrin.h> /* __m128, _mm_add_ps, ... */
+#endif
 #ifndef NK_ASSERT
 #include <assert.h>
 #define NK_ASSERT(expr) assert(expr)
 #endif
+#if defined(NK_INCLUDE_PROFILER) && !defined(NK_PROFILE_CLOCK)
+#include <time.h> /* clock */
+#define NK_PROFILE_CLOCK() ((double)clock() / (double)CLOCKS_PER_SEC)
+#define NK_PROFILE_COARSE_CLOCK
+#endif
+#ifndef NK_PROFILE_BEGIN
+#ifdef NK_INCLUDE_PROFILER
+#define NK_PROFILE_BEGIN(profiler, zone) nk_profile_zone_begin(profiler, zone)
+#else
+#define NK_PROFILE_BEGIN(profiler, zone)
+#endif
+#endif
+#ifndef NK_PROFILE_END
+#ifdef NK_INCLUDE_PROFILER
+#define NK_PROFILE_END(profiler, zone) nk_profile_zone_end(profiler, zone)
+#else
+#define NK_PROFILE_END(profiler, zone)
+#endif
+#endif
 
 #ifndef NK_MEMSET
 #define NK_MEMSET nk_memset
@@ -5822,7 +7543,7 @@ NK_LIB void nk_zero(void *ptr, nk_size size);
 NK_LIB char *nk_itoa(char *s, long n);
 NK_LIB int nk_string_float_limit(char *string, int prec);
 NK_LIB char *nk_dtoa(char *s, double n);
-NK_LIB int nk_text_clamp(const struct nk_user_font *font, const char *text, int text_len, float space, int *glyphs, float *text_width, nk_rune *sep_list, int sep_count);
+NK_LIB int nk_text_clamp(const struct nk_user_font *font, const char *text, int text_len, float space, int *glyphs, float *text_width, const nk_rune *sep_list, int sep_count);
 NK_LIB struct nk_vec2 nk_text_calculate_text_bounds(const struct nk_user_font *font, const char *begin, int byte_len, float row_height, const char **remaining, struct nk_vec2 *out_offset, int *glyphs, int op);
 #ifdef NK_INCLUDE_STANDARD_VARARGS
 NK_LIB int nk_strfmt(char *buf, int buf_size, const char *fmt, va_list args);
@@ -5831,6 +7552,12 @@ NK_LIB int nk_strfmt(char *buf, int buf_size, const char *fmt, va_list args);
 NK_LIB char *nk_file_load(const char* path, nk_size* siz, struct nk_allocator *alloc);
 #endif
 
+/* profiling */
+#ifdef NK_INCLUDE_PROFILER
+NK_LIB void nk_profile_zone_begin(struct nk_profiler *profiler, enum nk_profile_zone zone);
+NK_LIB void nk_profile_zone_end(struct nk_profiler *profiler, enum nk_profile_zone zone);
+#endif
+
 /* buffer */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 NK_LIB void* nk_malloc(nk_handle unused, void *old,nk_size size);
@@ -5839,6 +7566,7 @@ NK_LIB void nk_mfree(nk_handle unused, void *ptr);
 NK_LIB void* nk_buffer_align(void *unaligned, nk_size align, nk_size *alignment, enum nk_buffer_allocation_type type);
 NK_LIB void* nk_buffer_alloc(struct nk_buffer *b, enum nk_buffer_allocation_type type, nk_size size, nk_size align);
 NK_LIB void* nk_buffer_realloc(struct nk_buffer *b, nk_size capacity, nk_size *size);
+NK_LIB void* nk_buffer_at(const struct nk_buffer *b, nk_size offset);
 
 /* draw */
 NK_LIB void nk_command_buffer_init(struct nk_command_buffer *cb, struct nk_buffer *b, enum nk_command_clipping clip);
@@ -5854,6 +7582,39 @@ NK_LIB void nk_finish_popup(struct nk_context *ctx, struct nk_window*);
 NK_LIB void nk_finish_buffer(struct nk_context *ctx, struct nk_command_buffer *b);
 NK_LIB void nk_finish(struct nk_context *ctx, struct nk_window *w);
 NK_LIB void nk_build(struct nk_context *ctx);
+NK_LIB int nk_command_list_begin(struct nk_context *ctx, nk_size *offset);
+NK_LIB const struct nk_command *nk_command_list_at(const struct nk_buffer *memory, nk_size offset);
+NK_LIB const struct nk_command *nk_command_list_next(const struct nk_buffer *memory, const struct nk_command *cmd);
+
+/* command packing */
+struct nk_packed_ref {
+    const struct nk_user_font *font;
+    float height;
+    struct nk_image img;
+    nk_command_custom_callback callback;
+    nk_handle handle;
+};
+NK_LIB nk_byte *nk_pack_uint(nk_byte *p, nk_uint v);
+NK_LIB nk_byte *nk_pack_int(nk_byte *p, int v);
+NK_LIB nk_byte *nk_pack_float(nk_byte *p, float f);
+NK_LIB nk_uint nk_unpack_uint(const nk_byte **p);
+NK_LIB int nk_unpack_int(const nk_byte **p);
+NK_LIB float nk_unpack_float(const nk_byte **p);
+NK_LIB nk_size nk_command_packed_size(const struct nk_command *cmd);
+NK_LIB nk_byte *nk_pack_command(struct nk_command_packing *packing, nk_byte *p, const struct nk_command *cmd);
+NK_LIB struct nk_command *nk_unpack_command(const struct nk_command_packing *packing, const nk_byte **in, const nk_byte *end, struct nk_buffer *out);
+NK_LIB void nk_command_packing_init(struct nk_command_packing *packing, const struct nk_allocator *alloc);
+NK_LIB void nk_command_packing_free(struct nk_command_packing *packing);
+
+/* input recording */
+enum nk_input_record_op {
+    NK_INPUT_RECORD_BEGIN = NK_INPUT_EVENT_UNICODE + 1,
+    NK_INPUT_RECORD_END,
+    NK_INPUT_RECORD_FRAME
+};
+NK_LIB void nk_input_record(struct nk_context *ctx, const struct nk_input_event *evt);
+NK_LIB void nk_input_record_op(struct nk_context *ctx, enum nk_input_record_op op);
+NK_LIB void nk_input_record_frame(struct nk_context *ctx);
 
 /* text editor */
 NK_LIB void nk_textedit_clear_state(struct nk_text_edit *state, enum nk_text_edit_type type, nk_plugin_filter filter);
@@ -5871,11 +7632,15 @@ NK_LIB void nk_remove_window(struct nk_context*, struct nk_window*);
 NK_LIB void nk_free_window(struct nk_context *ctx, struct nk_window *win);
 NK_LIB struct nk_window *nk_find_window(struct nk_context *ctx, nk_hash hash, const char *name);
 NK_LIB void nk_insert_window(struct nk_context *ctx, struct nk_window *win, enum nk_window_insert_location loc);
+NK_LIB int nk_window_is_any_at(const struct nk_context *ctx, struct nk_vec2 pos);
+NK_LIB struct nk_window *nk_window_at_mouse(struct nk_context *ctx);
+NK_LIB void nk_window_index_invalidate(struct nk_context *ctx);
 
 /* pool */
 NK_LIB void nk_pool_init(struct nk_pool *pool, struct nk_allocator *alloc, unsigned int capacity);
 NK_LIB void nk_pool_free(struct nk_pool *pool);
 NK_LIB void nk_pool_init_fixed(struct nk_pool *pool, void *memory, nk_size size);
+NK_LIB nk_size nk_pool_page_size(const struct nk_pool *pool);
 NK_LIB struct nk_page_element *nk_pool_alloc(struct nk_pool *pool);
 
 /* page-element */
@@ -5909,12 +7674,16 @@ NK_LIB void nk_panel_layout(const struct nk_context *ctx, struct nk_window *win,
 NK_LIB void nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt, float height, int cols, int width);
 NK_LIB void nk_panel_alloc_row(const struct nk_context *ctx, struct nk_window *win);
 NK_LIB void nk_layout_widget_space(struct nk_rect *bounds, const struct nk_context *ctx, struct nk_window *win, int modify);
-NK_LIB void nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx);
+NK_LIB int nk_panel_row_is_culled(const struct nk_panel *layout);
+NK_LIB int nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx);
 NK_LIB void nk_layout_peek(struct nk_rect *bounds, struct nk_context *ctx);
 
 /* popup */
 NK_LIB int nk_nonblock_begin(struct nk_context *ctx, nk_flags flags, struct nk_rect body, struct nk_rect header, enum nk_panel_type panel_type);
 
+/* draw */
+NK_LIB void nk_push_text(struct nk_command_buffer *b, struct nk_rect r, const char *string, int length, const struct nk_user_font *font, struct nk_color bg, struct nk_color fg);
+
 /* text */
 struct nk_text {
     struct nk_vec2 padding;
@@ -7331,7 +9100,7 @@ nk_file_load(const char* path, nk_size* siz, struct nk_allocator *alloc)
 NK_LIB int
 nk_text_clamp(const struct nk_user_font *font, const char *text,
     int text_len, float space, int *glyphs, float *text_width,
-    nk_rune *sep_list, int sep_count)
+    const nk_rune *sep_list, int sep_count)
 {
     int i = 0;
     int glyph_len = 0;
@@ -7441,6 +9210,73 @@ nk_text_calculate_text_bounds(const struct nk_user_font *font,
 
 
 
+/* ===============================================================
+ *
+ *                          PROFILING
+ *
+ * ===============================================================*/
+NK_API const char*
+nk_profile_zone_name(enum nk_profile_zone zone)
+{
+    NK_STORAGE const char *names[NK_PROFILE_ZONE_MAX] = {
+        "window begin", "window end", "panel begin", "panel end", "layout",
+        "button", "toggle", "selectable", "slider", "progress", "scrollbar",
+        "edit", "property", "color picker", "build", "convert", "path",
+        "stroke", "fill", "font bake"
+    };
+    if ((unsigned)zone >= NK_PROFILE_ZONE_MAX) return 0;
+    return names[zone];
+}
+#ifdef NK_INCLUDE_PROFILER
+/*  Zones of the same kind can be nested so only the outermost zone is timed.
+    Open zones keep running over `nk_profile_collect` and are accounted to the
+    collection they end in. Objects without an attached profiler pass NULL. */
+NK_INTERN int
+nk_profile_zone_timed(enum nk_profile_zone zone)
+{
+#ifdef NK_PROFILE_COARSE_CLOCK
+    /* the default clock is a system call with millisecond resolution on some
+     * platforms so it is only taken for zones entered a few times a frame,
+     * all other zones only count calls and report zero seconds */
+    return zone == NK_PROFILE_WINDOW_BEGIN || zone == NK_PROFILE_WINDOW_END ||
+        zone == NK_PROFILE_BUILD || zone == NK_PROFILE_CONVERT ||
+        zone == NK_PROFILE_FONT_BAKE;
+#else
+    NK_UNUSED(zone);
+    return nk_true;
+#endif
+}
+NK_LIB void
+nk_profile_zone_begin(struct nk_profiler *profiler, enum nk_profile_zone zone)
+{
+    if (!profiler) return;
+    profiler->data.zones[zone].calls++;
+    if (!profiler->depth[zone]++ && nk_profile_zone_timed(zone))
+        profiler->start[zone] = NK_PROFILE_CLOCK();
+}
+NK_LIB void
+nk_profile_zone_end(struct nk_profiler *profiler, enum nk_profile_zone zone)
+{
+    if (!profiler) return;
+    NK_ASSERT(profiler->depth[zone]);
+    if (!profiler->depth[zone] || --profiler->depth[zone]) return;
+    if (nk_profile_zone_timed(zone))
+        profiler->data.zones[zone].seconds += NK_PROFILE_CLOCK() - profiler->start[zone];
+}
+NK_API void
+nk_profile_collect(struct nk_profiler *profiler, struct nk_profile *profile)
+{
+    NK_ASSERT(profiler);
+    NK_ASSERT(profile);
+    if (!profiler || !profile) return;
+    *profile = profiler->data;
+    nk_zero_struct(profiler->data);
+}
+#endif
+
+
+
+
 /* ==============================================================
  *
  *                          COLOR
@@ -8062,45 +9898,217 @@ nk_buffer_init_fixed(struct nk_buffer *b, void *m, nk_size size)
     b->memory.size = size;
     b->size = size;
 }
-NK_LIB void*
-nk_buffer_align(void *unaligned,
-    nk_size align, nk_size *alignment,
-    enum nk_buffer_allocation_type type)
+NK_INTERN int
+nk_buffer_reserve_segments(struct nk_buffer *b, unsigned int count)
+{
+    struct nk_buffer_segment *segments;
+    unsigned int capacity;
+    if (b->segment_count + count <= b->segment_capacity) return 1;
+
+    /* only segment pointers are copied, never segment memory */
+    capacity = NK_MAX(b->segment_capacity * 2, 8);
+    capacity = NK_MAX(capacity, b->segment_count + count);
+    segments = (struct nk_buffer_segment*)b->pool.alloc(b->pool.userdata, 0,
+        sizeof(struct nk_buffer_segment) * capacity);
+    NK_ASSERT(segments);
+    if (!segments) return 0;
+    if (b->segments) {
+        NK_MEMCPY(segments, b->segments, sizeof(struct nk_buffer_segment) * b->segment_count);
+        b->pool.free(b->pool.userdata, b->segments);
+    }
+    b->segments = segments;
+    b->segment_capacity = capacity;
+    return 1;
+}
+NK_INTERN unsigned int
+nk_buffer_segment_run(const struct nk_buffer *b, unsigned int index, unsigned int count)
+{
+    /* number of segments up to `count` starting at `index` which directly
+     * follow each other in memory. Runs are moved and cut by other runs, so
+     * this is checked on the memory and not on the allocations */
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    unsigned int run = 1;
+    while (run < count && index + run < b->segment_count &&
+        b->segments[index + run].memory == nk_ptr_add(void,
+            b->segments[index + run - 1].memory, segment_size))
+        run++;
+    return run;
+}
+NK_INTERN void
+nk_buffer_reverse_segments(struct nk_buffer_segment *segments,
+    unsigned int begin, unsigned int end)
 {
-    void *memory = 0;
-    switch (type) {
-    default:
-    case NK_BUFFER_MAX:
-    case NK_BUFFER_FRONT:
-        if (align) {
-            memory = NK_ALIGN_PTR(unaligned, align);
-            *alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
-        } else {
-            memory = unaligned;
-            *alignment = 0;
-        }
-        break;
-    case NK_BUFFER_BACK:
-        if (align) {
-            memory = NK_ALIGN_PTR_BACK(unaligned, align);
-            *alignment = (nk_size)((nk_byte*)unaligned - (nk_byte*)memory);
-        } else {
-            memory = unaligned;
-            *alignment = 0;
-        }
-        break;
+    while (begin + 1 < end) {
+        struct nk_buffer_segment tmp = segments[begin];
+        segments[begin++] = segments[--end];
+        segments[end] = tmp;
     }
-    return memory;
 }
-NK_LIB void*
-nk_buffer_realloc(struct nk_buffer *b, nk_size capacity, nk_size *size)
+NK_INTERN int
+nk_buffer_acquire_segments(struct nk_buffer *b, unsigned int index, unsigned int count)
 {
-    void *temp;
-    nk_size buffer_size;
+    /* makes `count` segments starting at `index` contiguous, which is only
+     * valid as long as no memory was allocated from `index` onwards. Unused
+     * runs of segments further back are moved forward before allocating */
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    unsigned int i, run;
+    nk_byte *memory;
 
-    NK_ASSERT(b);
-    NK_ASSERT(size);
-    if (!b || !size || !b->pool.alloc || !b->pool.free)
+    NK_ASSERT(index <= b->segment_count);
+    if (index < b->segment_count && nk_buffer_segment_run(b, index, count) >= count)
+        return 1;
+    for (i = index + 1; i < b->segment_count; i += run) {
+        run = nk_buffer_segment_run(b, i, count);
+        if (run < count) continue;
+        nk_buffer_reverse_segments(b->segments, index, i);
+        nk_buffer_reverse_segments(b->segments, i, i + count);
+        nk_buffer_reverse_segments(b->segments, index, i + count);
+        b->memory.ptr = b->segments[0].memory;
+        return 1;
+    }
+
+    NK_ASSERT(b->pool.alloc && b->pool.free);
+    if (!b->pool.alloc || !b->pool.free) return 0;
+    if (!nk_buffer_reserve_segments(b, count)) return 0;
+    memory = (nk_byte*)b->pool.alloc(b->pool.userdata, 0, segment_size * count);
+    NK_ASSERT(memory);
+    if (!memory) return 0;
+    for (i = b->segment_count; i > index; --i)
+        b->segments[i - 1 + count] = b->segments[i - 1];
+    for (i = 0; i < count; ++i) {
+        b->segments[index + i].memory = memory + segment_size * i;
+        b->segments[index + i].count = i ? 0 : count;
+    }
+    b->segment_count += count;
+    b->memory.ptr = b->segments[0].memory;
+    b->memory.size = (nk_size)b->segment_count << b->segment_shift;
+    b->size = b->memory.size;
+    return 1;
+}
+NK_API void
+nk_buffer_init_segmented(struct nk_buffer *b, const struct nk_allocator *a,
+    nk_size segment_size)
+{
+    NK_ASSERT(b);
+    NK_ASSERT(a);
+    NK_ASSERT(segment_size);
+    if (!b || !a || !segment_size) return;
+
+    nk_zero(b, sizeof(*b));
+    b->type = NK_BUFFER_SEGMENTED;
+    b->pool = *a;
+    b->grow_factor = 1.0f;
+    /* power of two segments turn offsets into segment and position by shifting */
+    segment_size = NK_MAX(segment_size, NK_BUFFER_SEGMENT_MIN_SIZE);
+    while (((nk_size)1 << b->segment_shift) < segment_size)
+        b->segment_shift++;
+    nk_buffer_acquire_segments(b, 0, 1);
+}
+NK_LIB void*
+nk_buffer_at(const struct nk_buffer *b, nk_size offset)
+{
+    nk_size mask;
+    if (b->type != NK_BUFFER_SEGMENTED)
+        return nk_ptr_add(void, b->memory.ptr, offset);
+    mask = ((nk_size)1 << b->segment_shift) - 1;
+    return nk_ptr_add(void, b->segments[offset >> b->segment_shift].memory, offset & mask);
+}
+NK_INTERN void*
+nk_buffer_alloc_segmented(struct nk_buffer *b, nk_size size, nk_size align)
+{
+    /* every segment keeps room for a command jumping to the next segment */
+    NK_STORAGE const nk_size jump_size = sizeof(struct nk_command) + NK_ALIGNOF(struct nk_command);
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    nk_size index = b->allocated >> b->segment_shift;
+    nk_size offset = b->allocated & (segment_size - 1);
+    nk_size alignment;
+    void *unaligned;
+    void *memory;
+
+    unaligned = nk_ptr_add(void, b->segments[index].memory, offset);
+    memory = nk_buffer_align(unaligned, align, &alignment, NK_BUFFER_FRONT);
+    if (offset + alignment + size + jump_size > segment_size) {
+        /* commands larger than a segment need a run of consecutive segments
+         * from one allocation, which is kept for the following frames */
+        nk_size next = (offset) ? index + 1 : index;
+        nk_size count = 1;
+        if (size + align + jump_size > segment_size)
+            count = (size + 2 * align + 3 * jump_size + segment_size - 1) >> b->segment_shift;
+        if (!nk_buffer_acquire_segments(b, (unsigned int)next, (unsigned int)count))
+            return 0;
+        if (next != index) {
+            /* continue at the start of the next segment and clear the gap, so
+             * the same commands always result in the same segment content */
+            struct nk_command *jump;
+            nk_size gap = segment_size - offset;
+            jump = (struct nk_command*)NK_ALIGN_PTR(unaligned, NK_ALIGNOF(struct nk_command));
+            NK_MEMSET(unaligned, 0, gap);
+            jump->type = NK_COMMAND_NOP;
+            jump->next = next << b->segment_shift;
+            b->allocated += gap;
+            b->needed += gap;
+        }
+        unaligned = b->segments[next].memory;
+        memory = nk_buffer_align(unaligned, align, &alignment, NK_BUFFER_FRONT);
+        offset = (alignment + size) & (segment_size - 1);
+        if (offset + jump_size > segment_size) {
+            /* a command ending right before a segment border inside the run
+             * leaves no room for a jump, so it is moved behind a jump to end
+             * past the border */
+            struct nk_command *jump;
+            jump = (struct nk_command*)NK_ALIGN_PTR(unaligned, NK_ALIGNOF(struct nk_command));
+            memory = nk_buffer_align(nk_ptr_add(void, memory,
+                segment_size - offset + jump_size), align, &alignment, NK_BUFFER_FRONT);
+            alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
+            NK_MEMSET(unaligned, 0, alignment);
+            jump->type = NK_COMMAND_NOP;
+            jump->next = b->allocated + alignment;
+        }
+    }
+    b->allocated += size + alignment;
+    b->needed += alignment;
+    b->calls++;
+    return memory;
+}
+NK_LIB void*
+nk_buffer_align(void *unaligned,
+    nk_size align, nk_size *alignment,
+    enum nk_buffer_allocation_type type)
+{
+    void *memory = 0;
+    switch (type) {
+    default:
+    case NK_BUFFER_MAX:
+    case NK_BUFFER_FRONT:
+        if (align) {
+            memory = NK_ALIGN_PTR(unaligned, align);
+            *alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
+        } else {
+            memory = unaligned;
+            *alignment = 0;
+        }
+        break;
+    case NK_BUFFER_BACK:
+        if (align) {
+            memory = NK_ALIGN_PTR_BACK(unaligned, align);
+            *alignment = (nk_size)((nk_byte*)unaligned - (nk_byte*)memory);
+        } else {
+            memory = unaligned;
+            *alignment = 0;
+        }
+        break;
+    }
+    return memory;
+}
+NK_LIB void*
+nk_buffer_realloc(struct nk_buffer *b, nk_size capacity, nk_size *size)
+{
+    void *temp;
+    nk_size buffer_size;
+
+    NK_ASSERT(b);
+    NK_ASSERT(size);
+    if (!b || !size || !b->pool.alloc || !b->pool.free)
         return 0;
 
     buffer_size = b->memory.size;
@@ -8143,6 +10151,11 @@ nk_buffer_alloc(struct nk_buffer *b, enum nk_buffer_allocation_type type,
     NK_ASSERT(size);
     if (!b || !size) return 0;
     b->needed += size;
+    if (b->type == NK_BUFFER_SEGMENTED) {
+        NK_ASSERT(type == NK_BUFFER_FRONT && "segmented buffers only support front allocations");
+        if (type != NK_BUFFER_FRONT) return 0;
+        return nk_buffer_alloc_segmented(b, size, align);
+    }
 
     /* calculate total size with needed alignment + size */
     if (type == NK_BUFFER_FRONT)
@@ -8239,6 +10252,14 @@ nk_buffer_free(struct nk_buffer *b)
     if (b->type == NK_BUFFER_FIXED) return;
     if (!b->pool.free) return;
     NK_ASSERT(b->pool.free);
+    if (b->type == NK_BUFFER_SEGMENTED) {
+        unsigned int i;
+        for (i = 0; i < b->segment_count; ++i)
+            if (b->segments[i].count)
+                b->pool.free(b->pool.userdata, b->segments[i].memory);
+        b->pool.free(b->pool.userdata, b->segments);
+        return;
+    }
     b->pool.free(b->pool.userdata, b->memory.ptr);
 }
 NK_API void
@@ -8748,6 +10769,10 @@ nk_command_buffer_init(struct nk_command_buffer *cb,
     cb->begin = b->allocated;
     cb->end = b->allocated;
     cb->last = b->allocated;
+    cb->count = 0;
+#ifdef NK_INCLUDE_PROFILER
+    cb->profiler = 0;
+#endif
 }
 NK_LIB void
 nk_command_buffer_reset(struct nk_command_buffer *b)
@@ -8757,6 +10782,7 @@ nk_command_buffer_reset(struct nk_command_buffer *b)
     b->begin = 0;
     b->end = 0;
     b->last = 0;
+    b->count = 0;
     b->clip = nk_null_rect;
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     b->userdata.ptr = 0;
@@ -8779,7 +10805,7 @@ nk_command_buffer_push(struct nk_command_buffer* b,
     if (!cmd) return 0;
 
     /* make sure the offset to the next command is aligned */
-    b->last = (nk_size)((nk_byte*)cmd - (nk_byte*)b->base->memory.ptr);
+    b->last = b->base->allocated - size;
     unaligned = (nk_byte*)cmd + size;
     memory = NK_ALIGN_PTR(unaligned, align);
     alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
@@ -8793,6 +10819,7 @@ nk_command_buffer_push(struct nk_command_buffer* b,
     cmd->userdata = b->userdata;
 #endif
     b->end = cmd->next;
+    b->count++;
     return cmd;
 }
 NK_API void
@@ -9173,7 +11200,6 @@ nk_draw_text(struct nk_command_buffer *b, struct nk_rect r,
     struct nk_color bg, struct nk_color fg)
 {
     float text_width = 0;
-    struct nk_command_text *cmd;
 
     NK_ASSERT(b);
     NK_ASSERT(font);
@@ -9192,7 +11218,17 @@ nk_draw_text(struct nk_command_buffer *b, struct nk_rect r,
         length = nk_text_clamp(font, string, length, r.w, &glyphs, &txt_width, 0,0);
     }
 
-    if (!length) return;
+    nk_push_text(b, r, string, length, font, bg, fg);
+}
+NK_LIB void
+nk_push_text(struct nk_command_buffer *b, struct nk_rect r,
+    const char *string, int length, const struct nk_user_font *font,
+    struct nk_color bg, struct nk_color fg)
+{
+    struct nk_command_text *cmd;
+    NK_ASSERT(b);
+    NK_ASSERT(font);
+    if (!b || !string || !length) return;
     cmd = (struct nk_command_text*)
         nk_command_buffer_push(b, NK_COMMAND_TEXT, sizeof(*cmd) + (nk_size)(length + 1));
     if (!cmd) return;
@@ -9213,12 +11249,604 @@ nk_draw_text(struct nk_command_buffer *b, struct nk_rect r,
 
 
 
+/* ===============================================================
+ *
+ *                          COMMAND PACKING
+ *
+ * ===============================================================*/
+/*  Packed commands start with their type byte followed by the userdata
+    table index if enabled and the command payload. Integers are stored as
+    variable length integers with signed values zigzag encoded, so common
+    coordinates only take one or two bytes. Secondary points are stored
+    relative to the first point of a command. Fonts, images and callbacks
+    are replaced by indices into a side table. Commands have no padding and
+    no `next` offset since the next command directly follows.
+    Packing is the wire format of command streams and the input recorder.
+    Context command buffers always keep the native layout so drawing and
+    iterating never pay for encoding. */
+NK_LIB void
+nk_command_packing_init(struct nk_command_packing *packing,
+    const struct nk_allocator *alloc)
+{
+    NK_ASSERT(packing);
+    NK_ASSERT(alloc);
+    if (!packing || !alloc) return;
+    nk_zero(packing, sizeof(*packing));
+    nk_buffer_init(&packing->table, alloc, 16 * sizeof(struct nk_packed_ref));
+    nk_buffer_init(&packing->scratch, alloc, 256);
+}
+NK_LIB void
+nk_command_packing_free(struct nk_command_packing *packing)
+{
+    NK_ASSERT(packing);
+    if (!packing) return;
+    if (packing->table.pool.alloc)
+        nk_buffer_free(&packing->table);
+    if (packing->scratch.pool.alloc)
+        nk_buffer_free(&packing->scratch);
+    nk_zero(packing, sizeof(*packing));
+}
+NK_LIB nk_byte*
+nk_pack_uint(nk_byte *p, nk_uint v)
+{
+    while (v >= 0x80) {
+        *p++ = (nk_byte)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (nk_byte)v;
+    return p;
+}
+NK_LIB nk_byte*
+nk_pack_int(nk_byte *p, int v)
+{
+    nk_uint zigzag = (v < 0) ? (((nk_uint)(-(v + 1))) << 1) | 1u: (nk_uint)v << 1;
+    return nk_pack_uint(p, zigzag);
+}
+NK_INTERN nk_byte*
+nk_pack_color(nk_byte *p, struct nk_color c)
+{
+    p[0] = c.r; p[1] = c.g; p[2] = c.b; p[3] = c.a;
+    return p + 4;
+}
+NK_LIB nk_byte*
+nk_pack_float(nk_byte *p, float f)
+{
+    NK_MEMCPY(p, &f, sizeof(f));
+    return p + sizeof(f);
+}
+NK_LIB nk_uint
+nk_unpack_uint(const nk_byte **p)
+{
+    nk_uint v = 0;
+    int shift = 0;
+    const nk_byte *in = *p;
+    while (*in & 0x80) {
+        /* bits beyond 32 only appear in corrupt streams and are dropped */
+        if (shift < 32) v |= (nk_uint)(*in & 0x7F) << shift;
+        shift += 7;
+        in++;
+    }
+    if (shift < 32) v |= (nk_uint)(*in) << shift;
+    in++;
+    *p = in;
+    return v;
+}
+NK_LIB int
+nk_unpack_int(const nk_byte **p)
+{
+    nk_uint v = nk_unpack_uint(p);
+    return (v & 1) ? -(int)(v >> 1) - 1: (int)(v >> 1);
+}
+NK_INTERN struct nk_color
+nk_unpack_color(const nk_byte **p)
+{
+    struct nk_color c;
+    const nk_byte *in = *p;
+    c.r = in[0]; c.g = in[1]; c.b = in[2]; c.a = in[3];
+    *p = in + 4;
+    return c;
+}
+NK_LIB float
+nk_unpack_float(const nk_byte **p)
+{
+    float f;
+    NK_MEMCPY(&f, *p, sizeof(f));
+    *p += sizeof(f);
+    return f;
+}
+NK_INTERN int
+nk_packed_ref_equal(const struct nk_packed_ref *a, const struct nk_packed_ref *b)
+{
+    return a->font == b->font && a->height == b->height &&
+        a->img.handle.ptr == b->img.handle.ptr && a->img.w == b->img.w &&
+        a->img.h == b->img.h && a->img.region[0] == b->img.region[0] &&
+        a->img.region[1] == b->img.region[1] && a->img.region[2] == b->img.region[2] &&
+        a->img.region[3] == b->img.region[3] && a->callback == b->callback &&
+        a->handle.ptr == b->handle.ptr;
+}
+NK_INTERN nk_uint
+nk_packing_ref(struct nk_command_packing *packing, const struct nk_packed_ref *ref)
+{
+    /* tables only hold a handful of fonts and images so a linear search
+     * starting with the most recently added entry is sufficient */
+    const struct nk_packed_ref *entries = (const struct nk_packed_ref*)packing->table.memory.ptr;
+    nk_uint count = (nk_uint)(packing->table.allocated / sizeof(*ref));
+    nk_uint i = count;
+    struct nk_packed_ref *entry;
+    while (i--) {
+        if (nk_packed_ref_equal(&entries[i], ref))
+            return i;
+    }
+    entry = (struct nk_packed_ref*)nk_buffer_alloc(&packing->table,
+        NK_BUFFER_FRONT, sizeof(*ref), NK_ALIGNOF(struct nk_packed_ref));
+    NK_ASSERT(entry);
+    if (!entry) return count;
+    *entry = *ref;
+    return count;
+}
+NK_INTERN struct nk_packed_ref
+nk_packing_lookup(const struct nk_command_packing *packing, nk_uint index)
+{
+    struct nk_packed_ref ref;
+    if (index < packing->table.allocated / sizeof(ref)) {
+        const struct nk_packed_ref *entries = (const struct nk_packed_ref*)packing->table.memory.ptr;
+        return entries[index];
+    }
+    nk_zero(&ref, sizeof(ref));
+    return ref;
+}
+NK_INTERN nk_byte*
+nk_pack_points(nk_byte *p, const struct nk_vec2i *points, int count)
+{
+    int i;
+    if (count <= 0) return p;
+    p = nk_pack_int(p, points[0].x);
+    p = nk_pack_int(p, points[0].y);
+    for (i = 1; i < count; ++i) {
+        p = nk_pack_int(p, points[i].x - points[i-1].x);
+        p = nk_pack_int(p, points[i].y - points[i-1].y);
+    }
+    return p;
+}
+NK_INTERN void
+nk_unpack_points(const nk_byte **p, const nk_byte *end, struct nk_vec2i *points, int count)
+{
+    int i;
+    if (count <= 0) return;
+    points[0].x = (short)nk_unpack_int(p);
+    points[0].y = (short)nk_unpack_int(p);
+    /* corrupt streams can hold fewer points than their count */
+    for (i = 1; i < count && *p <= end; ++i) {
+        points[i].x = (short)(points[i-1].x + nk_unpack_int(p));
+        points[i].y = (short)(points[i-1].y + nk_unpack_int(p));
+    }
+}
+NK_INTERN nk_byte*
+nk_pack_rect(nk_byte *p, short x, short y, unsigned short w, unsigned short h)
+{
+    p = nk_pack_int(p, x);
+    p = nk_pack_int(p, y);
+    p = nk_pack_uint(p, w);
+    return nk_pack_uint(p, h);
+}
+NK_INTERN void
+nk_unpack_rect(const nk_byte **p, short *x, short *y, unsigned short *w, unsigned short *h)
+{
+    *x = (short)nk_unpack_int(p);
+    *y = (short)nk_unpack_int(p);
+    *w = (unsigned short)nk_unpack_uint(p);
+    *h = (unsigned short)nk_unpack_uint(p);
+}
+NK_LIB nk_byte*
+nk_pack_command(struct nk_command_packing *packing, nk_byte *p,
+    const struct nk_command *cmd)
+{
+    struct nk_packed_ref ref;
+    *p++ = (nk_byte)cmd->type;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    nk_zero(&ref, sizeof(ref));
+    ref.handle = cmd->userdata;
+    p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+#endif
+    switch (cmd->type) {
+    case NK_COMMAND_NOP: break;
+    case NK_COMMAND_SCISSOR: {
+        const struct nk_command_scissor *s = (const struct nk_command_scissor*)cmd;
+        p = nk_pack_rect(p, s->x, s->y, s->w, s->h);
+    } break;
+    case NK_COMMAND_LINE: {
+        const struct nk_command_line *l = (const struct nk_command_line*)cmd;
+        p = nk_pack_uint(p, l->line_thickness);
+        p = nk_pack_int(p, l->begin.x);
+        p = nk_pack_int(p, l->begin.y);
+        p = nk_pack_int(p, l->end.x - l->begin.x);
+        p = nk_pack_int(p, l->end.y - l->begin.y);
+        p = nk_pack_color(p, l->color);
+    } break;
+    case NK_COMMAND_CURVE: {
+        const struct nk_command_curve *q = (const struct nk_command_curve*)cmd;
+        p = nk_pack_uint(p, q->line_thickness);
+        p = nk_pack_int(p, q->begin.x);
+        p = nk_pack_int(p, q->begin.y);
+        p = nk_pack_int(p, q->ctrl[0].x - q->begin.x);
+        p = nk_pack_int(p, q->ctrl[0].y - q->begin.y);
+        p = nk_pack_int(p, q->ctrl[1].x - q->begin.x);
+        p = nk_pack_int(p, q->ctrl[1].y - q->begin.y);
+        p = nk_pack_int(p, q->end.x - q->begin.x);
+        p = nk_pack_int(p, q->end.y - q->begin.y);
+        p = nk_pack_color(p, q->color);
+    } break;
+    case NK_COMMAND_RECT: {
+        const struct nk_command_rect *r = (const struct nk_command_rect*)cmd;
+        p = nk_pack_uint(p, r->rounding);
+        p = nk_pack_uint(p, r->line_thickness);
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->color);
+    } break;
+    case NK_COMMAND_RECT_FILLED: {
+        const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled*)cmd;
+        p = nk_pack_uint(p, r->rounding);
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->color);
+    } break;
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        const struct nk_command_rect_multi_color *r = (const struct nk_command_rect_multi_color*)cmd;
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->left);
+        p = nk_pack_color(p, r->top);
+        p = nk_pack_color(p, r->bottom);
+        p = nk_pack_color(p, r->right);
+    } break;
+    case NK_COMMAND_CIRCLE: {
+        const struct nk_command_circle *c = (const struct nk_command_circle*)cmd;
+        p = nk_pack_uint(p, c->line_thickness);
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+        p = nk_pack_color(p, c->color);
+    } break;
+    case NK_COMMAND_CIRCLE_FILLED: {
+        const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled*)cmd;
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+        p = nk_pack_color(p, c->color);
+    } break;
+    case NK_COMMAND_ARC: {
+        const struct nk_command_arc *a = (const struct nk_command_arc*)cmd;
+        p = nk_pack_uint(p, a->line_thickness);
+        p = nk_pack_int(p, a->cx);
+        p = nk_pack_int(p, a->cy);
+        p = nk_pack_uint(p, a->r);
+        p = nk_pack_float(p, a->a[0]);
+        p = nk_pack_float(p, a->a[1]);
+        p = nk_pack_color(p, a->color);
+    } break;
+    case NK_COMMAND_ARC_FILLED: {
+        const struct nk_command_arc_filled *a = (const struct nk_command_arc_filled*)cmd;
+        p = nk_pack_int(p, a->cx);
+        p = nk_pack_int(p, a->cy);
+        p = nk_pack_uint(p, a->r);
+        p = nk_pack_float(p, a->a[0]);
+        p = nk_pack_float(p, a->a[1]);
+        p = nk_pack_color(p, a->color);
+    } break;
+    case NK_COMMAND_TRIANGLE: {
+        const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
+        p = nk_pack_uint(p, t->line_thickness);
+        p = nk_pack_int(p, t->a.x);
+        p = nk_pack_int(p, t->a.y);
+        p = nk_pack_int(p, t->b.x - t->a.x);
+        p = nk_pack_int(p, t->b.y - t->a.y);
+        p = nk_pack_int(p, t->c.x - t->a.x);
+        p = nk_pack_int(p, t->c.y - t->a.y);
+        p = nk_pack_color(p, t->color);
+    } break;
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
+        p = nk_pack_int(p, t->a.x);
+        p = nk_pack_int(p, t->a.y);
+        p = nk_pack_int(p, t->b.x - t->a.x);
+        p = nk_pack_int(p, t->b.y - t->a.y);
+        p = nk_pack_int(p, t->c.x - t->a.x);
+        p = nk_pack_int(p, t->c.y - t->a.y);
+        p = nk_pack_color(p, t->color);
+    } break;
+    case NK_COMMAND_POLYGON: {
+        const struct nk_command_polygon *g = (const struct nk_command_polygon*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_uint(p, g->line_thickness);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYGON_FILLED: {
+        const struct nk_command_polygon_filled *g = (const struct nk_command_polygon_filled*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYLINE: {
+        const struct nk_command_polyline *g = (const struct nk_command_polyline*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_uint(p, g->line_thickness);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_TEXT: {
+        const struct nk_command_text *t = (const struct nk_command_text*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.font = t->font;
+        ref.height = t->height;
+        p = nk_pack_uint(p, (nk_uint)t->length);
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_color(p, t->background);
+        p = nk_pack_color(p, t->foreground);
+        p = nk_pack_rect(p, t->x, t->y, t->w, t->h);
+        NK_MEMCPY(p, t->string, (nk_size)t->length);
+        p += t->length;
+    } break;
+    case NK_COMMAND_IMAGE: {
+        const struct nk_command_image *i = (const struct nk_command_image*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.img.handle = i->img.handle;
+        ref.img.w = i->img.w;
+        ref.img.h = i->img.h;
+        NK_MEMCPY(ref.img.region, i->img.region, sizeof(ref.img.region));
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_rect(p, i->x, i->y, i->w, i->h);
+        p = nk_pack_color(p, i->col);
+    } break;
+    case NK_COMMAND_CUSTOM: {
+        const struct nk_command_custom *c = (const struct nk_command_custom*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.callback = c->callback;
+        ref.handle = c->callback_data;
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+    } break;
+    }
+    return p;
+}
+NK_LIB nk_size
+nk_command_packed_size(const struct nk_command *cmd)
+{
+    /* upper bound of every packed command without text or points */
+    NK_STORAGE const nk_size packed_size = 64;
+    switch (cmd->type) {
+    default: return packed_size;
+    case NK_COMMAND_TEXT:
+        return packed_size + (nk_size)((const struct nk_command_text*)cmd)->length;
+    case NK_COMMAND_POLYGON:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polygon*)cmd)->point_count;
+    case NK_COMMAND_POLYGON_FILLED:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polygon_filled*)cmd)->point_count;
+    case NK_COMMAND_POLYLINE:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polyline*)cmd)->point_count;
+    }
+}
+NK_INTERN nk_size
+nk_command_unpacked_size(enum nk_command_type type, const nk_byte *payload,
+    const nk_byte *end)
+{
+    nk_uint count;
+    switch (type) {
+    default: return 0;
+    case NK_COMMAND_NOP: return sizeof(struct nk_command);
+    case NK_COMMAND_SCISSOR: return sizeof(struct nk_command_scissor);
+    case NK_COMMAND_LINE: return sizeof(struct nk_command_line);
+    case NK_COMMAND_CURVE: return sizeof(struct nk_command_curve);
+    case NK_COMMAND_RECT: return sizeof(struct nk_command_rect);
+    case NK_COMMAND_RECT_FILLED: return sizeof(struct nk_command_rect_filled);
+    case NK_COMMAND_RECT_MULTI_COLOR: return sizeof(struct nk_command_rect_multi_color);
+    case NK_COMMAND_CIRCLE: return sizeof(struct nk_command_circle);
+    case NK_COMMAND_CIRCLE_FILLED: return sizeof(struct nk_command_circle_filled);
+    case NK_COMMAND_ARC: return sizeof(struct nk_command_arc);
+    case NK_COMMAND_ARC_FILLED: return sizeof(struct nk_command_arc_filled);
+    case NK_COMMAND_TRIANGLE: return sizeof(struct nk_command_triangle);
+    case NK_COMMAND_TRIANGLE_FILLED: return sizeof(struct nk_command_triangle_filled);
+    case NK_COMMAND_IMAGE: return sizeof(struct nk_command_image);
+    case NK_COMMAND_CUSTOM: return sizeof(struct nk_command_custom);
+    case NK_COMMAND_TEXT:
+        /* text length and point counts are the first value of the payload */
+        count = nk_unpack_uint(&payload);
+        if (count > (nk_size)(end - payload)) return 0;
+        return sizeof(struct nk_command_text) + count + 1;
+    case NK_COMMAND_POLYGON:
+    case NK_COMMAND_POLYGON_FILLED:
+    case NK_COMMAND_POLYLINE:
+        /* every point takes at least two bytes */
+        count = nk_unpack_uint(&payload);
+        if (count > (nk_size)(end - payload) / 2) return 0;
+        return sizeof(struct nk_command_polyline) + sizeof(struct nk_vec2i) * count;
+    }
+}
+NK_LIB struct nk_command*
+nk_unpack_command(const struct nk_command_packing *packing, const nk_byte **in,
+    const nk_byte *end, struct nk_buffer *out)
+{
+    NK_STORAGE const nk_size align = NK_ALIGNOF(struct nk_command);
+    enum nk_command_type type;
+    struct nk_command *cmd;
+    struct nk_packed_ref ref;
+    const nk_byte *p = *in;
+    nk_size size;
+
+    type = (enum nk_command_type)*p++;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+#endif
+    if (p > end) return 0;
+    size = nk_command_unpacked_size(type, p, end);
+    if (!size) return 0;
+    /* keep the offset of a following command aligned */
+    size = (size + align - 1) & ~(align - 1);
+    cmd = (struct nk_command*)nk_buffer_alloc(out, NK_BUFFER_FRONT, size, align);
+    if (!cmd) return 0;
+    cmd->type = type;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    cmd->userdata = ref.handle;
+#endif
+
+    switch (type) {
+    case NK_COMMAND_NOP: break;
+    case NK_COMMAND_SCISSOR: {
+        struct nk_command_scissor *s = (struct nk_command_scissor*)cmd;
+        nk_unpack_rect(&p, &s->x, &s->y, &s->w, &s->h);
+    } break;
+    case NK_COMMAND_LINE: {
+        struct nk_command_line *l = (struct nk_command_line*)cmd;
+        l->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        l->begin.x = (short)nk_unpack_int(&p);
+        l->begin.y = (short)nk_unpack_int(&p);
+        l->end.x = (short)(l->begin.x + nk_unpack_int(&p));
+        l->end.y = (short)(l->begin.y + nk_unpack_int(&p));
+        l->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CURVE: {
+        struct nk_command_curve *q = (struct nk_command_curve*)cmd;
+        q->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        q->begin.x = (short)nk_unpack_int(&p);
+        q->begin.y = (short)nk_unpack_int(&p);
+        q->ctrl[0].x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->ctrl[0].y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->ctrl[1].x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->ctrl[1].y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->end.x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->end.y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT: {
+        struct nk_command_rect *r = (struct nk_command_rect*)cmd;
+        r->rounding = (unsigned short)nk_unpack_uint(&p);
+        r->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT_FILLED: {
+        struct nk_command_rect_filled *r = (struct nk_command_rect_filled*)cmd;
+        r->rounding = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        struct nk_command_rect_multi_color *r = (struct nk_command_rect_multi_color*)cmd;
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->left = nk_unpack_color(&p);
+        r->top = nk_unpack_color(&p);
+        r->bottom = nk_unpack_color(&p);
+        r->right = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CIRCLE: {
+        struct nk_command_circle *c = (struct nk_command_circle*)cmd;
+        c->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+        c->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CIRCLE_FILLED: {
+        struct nk_command_circle_filled *c = (struct nk_command_circle_filled*)cmd;
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+        c->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_ARC: {
+        struct nk_command_arc *a = (struct nk_command_arc*)cmd;
+        a->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        a->cx = (short)nk_unpack_int(&p);
+        a->cy = (short)nk_unpack_int(&p);
+        a->r = (unsigned short)nk_unpack_uint(&p);
+        a->a[0] = nk_unpack_float(&p);
+        a->a[1] = nk_unpack_float(&p);
+        a->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_ARC_FILLED: {
+        struct nk_command_arc_filled *a = (struct nk_command_arc_filled*)cmd;
+        a->cx = (short)nk_unpack_int(&p);
+        a->cy = (short)nk_unpack_int(&p);
+        a->r = (unsigned short)nk_unpack_uint(&p);
+        a->a[0] = nk_unpack_float(&p);
+        a->a[1] = nk_unpack_float(&p);
+        a->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_TRIANGLE: {
+        struct nk_command_triangle *t = (struct nk_command_triangle*)cmd;
+        t->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        t->a.x = (short)nk_unpack_int(&p);
+        t->a.y = (short)nk_unpack_int(&p);
+        t->b.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->b.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->c.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->c.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        struct nk_command_triangle_filled *t = (struct nk_command_triangle_filled*)cmd;
+        t->a.x = (short)nk_unpack_int(&p);
+        t->a.y = (short)nk_unpack_int(&p);
+        t->b.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->b.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->c.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->c.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_POLYGON: {
+        struct nk_command_polygon *g = (struct nk_command_polygon*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYGON_FILLED: {
+        struct nk_command_polygon_filled *g = (struct nk_command_polygon_filled*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYLINE: {
+        struct nk_command_polyline *g = (struct nk_command_polyline*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_TEXT: {
+        struct nk_command_text *t = (struct nk_command_text*)cmd;
+        t->length = (int)nk_unpack_uint(&p);
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        t->font = ref.font;
+        t->height = ref.height;
+        t->background = nk_unpack_color(&p);
+        t->foreground = nk_unpack_color(&p);
+        nk_unpack_rect(&p, &t->x, &t->y, &t->w, &t->h);
+        NK_MEMCPY(t->string, p, (nk_size)t->length);
+        t->string[t->length] = '\0';
+        p += t->length;
+    } break;
+    case NK_COMMAND_IMAGE: {
+        struct nk_command_image *i = (struct nk_command_image*)cmd;
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        i->img = ref.img;
+        nk_unpack_rect(&p, &i->x, &i->y, &i->w, &i->h);
+        i->col = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CUSTOM: {
+        struct nk_command_custom *c = (struct nk_command_custom*)cmd;
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        c->callback = ref.callback;
+        c->callback_data = ref.handle;
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+    } break;
+    }
+    cmd->next = 0;
+    *in = p;
+    return cmd;
+}
+
+
+
+
 /* ===============================================================
  *
  *                              VERTEX
  *
  * ===============================================================*/
 #ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_DRAW_LIST_MAX_SEGMENTS 512
+
 NK_API void
 nk_draw_list_init(struct nk_draw_list *list)
 {
@@ -9633,6 +12261,7 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
     struct nk_colorf col_trans;
     NK_ASSERT(list);
     if (!list || points_count < 2) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_STROKE);
 
     color.a = (nk_byte)((float)color.a * list->config.global_alpha);
     count = points_count;
@@ -9667,14 +12296,14 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
 
         nk_size size;
         struct nk_vec2 *normals, *temp;
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         /* temporary allocate normals + points */
         vertex_offset = (nk_size)((nk_byte*)vtx - (nk_byte*)list->vertices->memory.ptr);
         nk_buffer_mark(list->vertices, NK_BUFFER_FRONT);
         size = pnt_size * ((thick_line) ? 5 : 3) * points_count;
         normals = (struct nk_vec2*) nk_buffer_alloc(list->vertices, NK_BUFFER_FRONT, size, pnt_align);
-        if (!normals) return;
+        if (!normals) goto end;
         temp = normals + points_count;
 
         /* make sure vertex pointer is still correct */
@@ -9826,7 +12455,7 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
         const nk_size vtx_count = count * 4;
         void *vtx = nk_draw_list_alloc_vertices(list, vtx_count);
         nk_draw_index *ids = nk_draw_list_alloc_elements(list, idx_count);
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         for (i1 = 0; i1 < count; ++i1) {
             float dx, dy;
@@ -9861,6 +12490,8 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
             idx += 4;
         }
     }
+end:
+    NK_PROFILE_END(list->profiler, NK_PROFILE_STROKE);
 }
 NK_API void
 nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
@@ -9874,6 +12505,7 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
     NK_STORAGE const nk_size pnt_size = sizeof(struct nk_vec2);
     NK_ASSERT(list);
     if (!list || points_count < 3) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_FILL);
 
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     nk_draw_list_push_userdata(list, list->userdata);
@@ -9903,14 +12535,14 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
         struct nk_vec2 *normals = 0;
         unsigned int vtx_inner_idx = (unsigned int)(index + 0);
         unsigned int vtx_outer_idx = (unsigned int)(index + 1);
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         /* temporary allocate normals */
         vertex_offset = (nk_size)((nk_byte*)vtx - (nk_byte*)list->vertices->memory.ptr);
         nk_buffer_mark(list->vertices, NK_BUFFER_FRONT);
         size = pnt_size * points_count;
         normals = (struct nk_vec2*) nk_buffer_alloc(list->vertices, NK_BUFFER_FRONT, size, pnt_align);
-        if (!normals) return;
+        if (!normals) goto end;
         vtx = (void*)((nk_byte*)list->vertices->memory.ptr + vertex_offset);
 
         /* add elements */
@@ -9975,7 +12607,7 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
         void *vtx = nk_draw_list_alloc_vertices(list, vtx_count);
         nk_draw_index *ids = nk_draw_list_alloc_elements(list, idx_count);
 
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
         for (i = 0; i < vtx_count; ++i)
             vtx = nk_draw_vertex(vtx, &list->config, points[i], list->config.null.uv, col);
         for (i = 2; i < points_count; ++i) {
@@ -9985,6 +12617,8 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
             ids += 3;
         }
     }
+end:
+    NK_PROFILE_END(list->profiler, NK_PROFILE_FILL);
 }
 NK_API void
 nk_draw_list_path_clear(struct nk_draw_list *list)
@@ -10013,31 +12647,36 @@ nk_draw_list_path_line_to(struct nk_draw_list *list, struct nk_vec2 pos)
     if (!points) return;
     points[0] = pos;
 }
-NK_API void
-nk_draw_list_path_arc_to_fast(struct nk_draw_list *list, struct nk_vec2 center,
-    float radius, int a_min, int a_max)
+NK_INTERN unsigned int
+nk_draw_list_circle_segments(const struct nk_draw_list *list, float radius)
 {
-    int a = 0;
-    NK_ASSERT(list);
-    if (!list) return;
-    if (a_min <= a_max) {
-        for (a = a_min; a <= a_max; a++) {
-            const struct nk_vec2 c = list->circle_vtx[(nk_size)a % NK_LEN(list->circle_vtx)];
-            const float x = center.x + c.x * radius;
-            const float y = center.y + c.y * radius;
-            nk_draw_list_path_line_to(list, nk_vec2(x, y));
-        }
+    /* a chord spanning 2*pi/n keeps r*(1-cos(pi/n)) ~ r*(pi/n)^2/2 away
+     * from the circle, which is solved for n at the error tolerance */
+    float n;
+    radius = (radius < 0) ? -radius: radius;
+    n = NK_PI * NK_SQRT(radius / (2.0f * list->config.curve_tolerance));
+    n = NK_MIN(n, (float)NK_DRAW_LIST_MAX_SEGMENTS);
+    return (unsigned int)NK_CLAMP(4, nk_iceilf(n), NK_DRAW_LIST_MAX_SEGMENTS);
+}
+NK_INTERN unsigned int
+nk_draw_list_circle_step(const struct nk_draw_list *list,
+    unsigned int segments, unsigned int multiple)
+{
+    /* smallest segment count of at least `segments` dividing the unit circle
+     * table, returned as step between table entries or 0 if there is none */
+    NK_STORAGE const unsigned char counts[] = {4, 6, 8, 12, 16, 24, 48};
+    nk_size i;
+    for (i = 0; i < NK_LEN(counts); ++i) {
+        if (counts[i] >= segments && !(counts[i] % multiple))
+            return (unsigned int)(NK_LEN(list->circle_vtx) / counts[i]);
     }
+    return 0;
 }
-NK_API void
-nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
+NK_INTERN void
+nk_draw_list_path_arc_points(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, float a_min, float a_max, unsigned int segments)
 {
     unsigned int i = 0;
-    NK_ASSERT(list);
-    if (!list) return;
-    if (radius == 0.0f) return;
-
     /*  This algorithm for arc drawing relies on these two trigonometric identities[1]:
             sin(a + b) = sin(a) * cos(b) + cos(a) * sin(b)
             cos(a + b) = cos(a) * cos(b) - sin(a) * sin(b)
@@ -10075,6 +12714,75 @@ nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
     }}
 }
 NK_API void
+nk_draw_list_path_arc_to_fast(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, int a_min, int a_max)
+{
+    /* angles are given in twelfths of a circle */
+    const int scale = (int)NK_LEN(list->circle_vtx) / 12;
+    int a = 0, step = scale;
+    NK_ASSERT(list);
+    if (!list || a_min > a_max) return;
+    if (list->config.curve_tolerance > 0.0f) {
+        unsigned int n = nk_draw_list_circle_segments(list, radius);
+        step = (int)nk_draw_list_circle_step(list, n, 4);
+        if (!step) {
+            /* finer than the table so points have to be calculated */
+            n = (unsigned int)nk_iceilf((float)n * (float)(a_max - a_min) / 12.0f);
+            nk_draw_list_path_arc_points(list, center, radius, (float)a_min * NK_PI / 6.0f,
+                (float)a_max * NK_PI / 6.0f, NK_MAX(n, 1));
+            return;
+        }
+    }
+    for (a = a_min * scale; a < a_max * scale; a += step) {
+        const struct nk_vec2 c = list->circle_vtx[(nk_size)a % NK_LEN(list->circle_vtx)];
+        nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));
+    }
+    {const struct nk_vec2 c = list->circle_vtx[(nk_size)(a_max * scale) % NK_LEN(list->circle_vtx)];
+    nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));}
+}
+NK_API void
+nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, float a_min, float a_max, unsigned int segments)
+{
+    NK_ASSERT(list);
+    if (!list) return;
+    if (radius == 0.0f) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
+    if (list->config.curve_tolerance > 0.0f) {
+        const float span = (a_max < a_min) ? a_min - a_max: a_max - a_min;
+        const unsigned int n = nk_draw_list_circle_segments(list, radius);
+        segments = (unsigned int)NK_MAX(1, nk_iceilf((float)n * span / (2.0f * NK_PI)));
+    }
+    nk_draw_list_path_arc_points(list, center, radius, a_min, a_max, segments);
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
+}
+NK_INTERN void
+nk_draw_list_path_circle_to(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, unsigned int segs)
+{
+    unsigned int i, step = 0;
+    if (radius == 0.0f) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
+    if (list->config.curve_tolerance > 0.0f) {
+        segs = nk_draw_list_circle_segments(list, radius);
+        step = nk_draw_list_circle_step(list, segs, 1);
+    }
+    if (step) {
+        /* common segment counts walk the unit circle table */
+        for (i = 0; i < NK_LEN(list->circle_vtx); i += step) {
+            const struct nk_vec2 c = list->circle_vtx[i];
+            nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));
+        }
+    } else if (list->config.curve_tolerance > 0.0f) {
+        nk_draw_list_path_arc_points(list, center, radius, 0.0f,
+            NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs, segs - 1);
+    } else {
+        nk_draw_list_path_arc_points(list, center, radius, 0.0f,
+            NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs, segs);
+    }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
+}
+NK_API void
 nk_draw_list_path_rect_to(struct nk_draw_list *list, struct nk_vec2 a,
     struct nk_vec2 b, float rounding)
 {
@@ -10108,9 +12816,22 @@ nk_draw_list_path_curve_to(struct nk_draw_list *list, struct nk_vec2 p2,
     NK_ASSERT(list);
     NK_ASSERT(list->path_count);
     if (!list || !list->path_count) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
     num_segments = NK_MAX(num_segments, 1);
 
     p1 = nk_draw_list_path_last(list);
+    if (list->config.curve_tolerance > 0.0f) {
+        /* Wang's formula: n segments keep a cubic bezier within 3/4 of its
+         * biggest second difference of control points divided by n^2 */
+        struct nk_vec2 d0, d1;
+        float dd;
+        d0 = nk_vec2(p1.x - 2.0f * p2.x + p3.x, p1.y - 2.0f * p2.y + p3.y);
+        d1 = nk_vec2(p2.x - 2.0f * p3.x + p4.x, p2.y - 2.0f * p3.y + p4.y);
+        dd = NK_MAX(d0.x * d0.x + d0.y * d0.y, d1.x * d1.x + d1.y * d1.y);
+        dd = NK_SQRT(0.75f * NK_SQRT(dd) / list->config.curve_tolerance);
+        dd = NK_MIN(dd, (float)NK_DRAW_LIST_MAX_SEGMENTS);
+        num_segments = (unsigned int)NK_CLAMP(1, nk_iceilf(dd), NK_DRAW_LIST_MAX_SEGMENTS);
+    }
     t_step = 1.0f/(float)num_segments;
     for (i_step = 1; i_step <= num_segments; ++i_step) {
         float t = t_step * (float)i_step;
@@ -10123,6 +12844,7 @@ nk_draw_list_path_curve_to(struct nk_draw_list *list, struct nk_vec2 p2,
         float y = w1 * p1.y + w2 * p2.y + w3 * p3.y + w4 * p4.y;
         nk_draw_list_path_line_to(list, nk_vec2(x,y));
     }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
 }
 NK_API void
 nk_draw_list_path_fill(struct nk_draw_list *list, struct nk_color color)
@@ -10250,22 +12972,18 @@ NK_API void
 nk_draw_list_fill_circle(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, struct nk_color col, unsigned int segs)
 {
-    float a_max;
     NK_ASSERT(list);
     if (!list || !col.a) return;
-    a_max = NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs;
-    nk_draw_list_path_arc_to(list, center, radius, 0.0f, a_max, segs);
+    nk_draw_list_path_circle_to(list, center, radius, segs);
     nk_draw_list_path_fill(list, col);
 }
 NK_API void
 nk_draw_list_stroke_circle(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, struct nk_color col, unsigned int segs, float thickness)
 {
-    float a_max;
     NK_ASSERT(list);
     if (!list || !col.a) return;
-    a_max = NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs;
-    nk_draw_list_path_arc_to(list, center, radius, 0.0f, a_max, segs);
+    nk_draw_list_path_circle_to(list, center, radius, segs);
     nk_draw_list_path_stroke(list, col, NK_STROKE_CLOSED, thickness);
 }
 NK_API void
@@ -10387,98 +13105,84 @@ nk_draw_list_add_text(struct nk_draw_list *list, const struct nk_user_font *font
         unicode = next;
     }
 }
-NK_API nk_flags
-nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
-    struct nk_buffer *vertices, struct nk_buffer *elements,
-    const struct nk_convert_config *config)
+NK_INTERN void
+nk_convert_commands(struct nk_draw_list *list, const struct nk_buffer *memory,
+    const struct nk_command *cmd, const struct nk_convert_config *config)
 {
-    nk_flags res = NK_CONVERT_SUCCESS;
-    const struct nk_command *cmd;
-    NK_ASSERT(ctx);
-    NK_ASSERT(cmds);
-    NK_ASSERT(vertices);
-    NK_ASSERT(elements);
-    NK_ASSERT(config);
-    NK_ASSERT(config->vertex_layout);
-    NK_ASSERT(config->vertex_size);
-    if (!ctx || !cmds || !vertices || !elements || !config || !config->vertex_layout)
-        return NK_CONVERT_INVALID_PARAM;
-
-    nk_draw_list_setup(&ctx->draw_list, config, cmds, vertices, elements,
-        config->line_AA, config->shape_AA);
-    nk_foreach(cmd, ctx)
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_CONVERT);
+    for (; cmd; cmd = nk_command_list_next(memory, cmd))
     {
 #ifdef NK_INCLUDE_COMMAND_USERDATA
-        ctx->draw_list.userdata = cmd->userdata;
+        list->userdata = cmd->userdata;
 #endif
         switch (cmd->type) {
         case NK_COMMAND_NOP: break;
         case NK_COMMAND_SCISSOR: {
             const struct nk_command_scissor *s = (const struct nk_command_scissor*)cmd;
-            nk_draw_list_add_clip(&ctx->draw_list, nk_rect(s->x, s->y, s->w, s->h));
+            nk_draw_list_add_clip(list, nk_rect(s->x, s->y, s->w, s->h));
         } break;
         case NK_COMMAND_LINE: {
             const struct nk_command_line *l = (const struct nk_command_line*)cmd;
-            nk_draw_list_stroke_line(&ctx->draw_list, nk_vec2(l->begin.x, l->begin.y),
+            nk_draw_list_stroke_line(list, nk_vec2(l->begin.x, l->begin.y),
                 nk_vec2(l->end.x, l->end.y), l->color, l->line_thickness);
         } break;
         case NK_COMMAND_CURVE: {
             const struct nk_command_curve *q = (const struct nk_command_curve*)cmd;
-            nk_draw_list_stroke_curve(&ctx->draw_list, nk_vec2(q->begin.x, q->begin.y),
+            nk_draw_list_stroke_curve(list, nk_vec2(q->begin.x, q->begin.y),
                 nk_vec2(q->ctrl[0].x, q->ctrl[0].y), nk_vec2(q->ctrl[1].x,
                 q->ctrl[1].y), nk_vec2(q->end.x, q->end.y), q->color,
                 config->curve_segment_count, q->line_thickness);
         } break;
         case NK_COMMAND_RECT: {
             const struct nk_command_rect *r = (const struct nk_command_rect*)cmd;
-            nk_draw_list_stroke_rect(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_stroke_rect(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->color, (float)r->rounding, r->line_thickness);
         } break;
         case NK_COMMAND_RECT_FILLED: {
             const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled*)cmd;
-            nk_draw_list_fill_rect(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_fill_rect(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->color, (float)r->rounding);
         } break;
         case NK_COMMAND_RECT_MULTI_COLOR: {
             const struct nk_command_rect_multi_color *r = (const struct nk_command_rect_multi_color*)cmd;
-            nk_draw_list_fill_rect_multi_color(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_fill_rect_multi_color(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->left, r->top, r->right, r->bottom);
         } break;
         case NK_COMMAND_CIRCLE: {
             const struct nk_command_circle *c = (const struct nk_command_circle*)cmd;
-            nk_draw_list_stroke_circle(&ctx->draw_list, nk_vec2((float)c->x + (float)c->w/2,
+            nk_draw_list_stroke_circle(list, nk_vec2((float)c->x + (float)c->w/2,
                 (float)c->y + (float)c->h/2), (float)c->w/2, c->color,
                 config->circle_segment_count, c->line_thickness);
         } break;
         case NK_COMMAND_CIRCLE_FILLED: {
             const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled *)cmd;
-            nk_draw_list_fill_circle(&ctx->draw_list, nk_vec2((float)c->x + (float)c->w/2,
+            nk_draw_list_fill_circle(list, nk_vec2((float)c->x + (float)c->w/2,
                 (float)c->y + (float)c->h/2), (float)c->w/2, c->color,
                 config->circle_segment_count);
         } break;
         case NK_COMMAND_ARC: {
             const struct nk_command_arc *c = (const struct nk_command_arc*)cmd;
-            nk_draw_list_path_line_to(&ctx->draw_list, nk_vec2(c->cx, c->cy));
-            nk_draw_list_path_arc_to(&ctx->draw_list, nk_vec2(c->cx, c->cy), c->r,
+            nk_draw_list_path_line_to(list, nk_vec2(c->cx, c->cy));
+            nk_draw_list_path_arc_to(list, nk_vec2(c->cx, c->cy), c->r,
                 c->a[0], c->a[1], config->arc_segment_count);
-            nk_draw_list_path_stroke(&ctx->draw_list, c->color, NK_STROKE_CLOSED, c->line_thickness);
+            nk_draw_list_path_stroke(list, c->color, NK_STROKE_CLOSED, c->line_thickness);
         } break;
         case NK_COMMAND_ARC_FILLED: {
             const struct nk_command_arc_filled *c = (const struct nk_command_arc_filled*)cmd;
-            nk_draw_list_path_line_to(&ctx->draw_list, nk_vec2(c->cx, c->cy));
-            nk_draw_list_path_arc_to(&ctx->draw_list, nk_vec2(c->cx, c->cy), c->r,
+            nk_draw_list_path_line_to(list, nk_vec2(c->cx, c->cy));
+            nk_draw_list_path_arc_to(list, nk_vec2(c->cx, c->cy), c->r,
                 c->a[0], c->a[1], config->arc_segment_count);
-            nk_draw_list_path_fill(&ctx->draw_list, c->color);
+            nk_draw_list_path_fill(list, c->color);
         } break;
         case NK_COMMAND_TRIANGLE: {
             const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
-            nk_draw_list_stroke_triangle(&ctx->draw_list, nk_vec2(t->a.x, t->a.y),
+            nk_draw_list_stroke_triangle(list, nk_vec2(t->a.x, t->a.y),
                 nk_vec2(t->b.x, t->b.y), nk_vec2(t->c.x, t->c.y), t->color,
                 t->line_thickness);
         } break;
         case NK_COMMAND_TRIANGLE_FILLED: {
             const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
-            nk_draw_list_fill_triangle(&ctx->draw_list, nk_vec2(t->a.x, t->a.y),
+            nk_draw_list_fill_triangle(list, nk_vec2(t->a.x, t->a.y),
                 nk_vec2(t->b.x, t->b.y), nk_vec2(t->c.x, t->c.y), t->color);
         } break;
         case NK_COMMAND_POLYGON: {
@@ -10486,49 +13190,145 @@ nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
             const struct nk_command_polygon*p = (const struct nk_command_polygon*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_stroke(&ctx->draw_list, p->color, NK_STROKE_CLOSED, p->line_thickness);
+            nk_draw_list_path_stroke(list, p->color, NK_STROKE_CLOSED, p->line_thickness);
         } break;
         case NK_COMMAND_POLYGON_FILLED: {
             int i;
             const struct nk_command_polygon_filled *p = (const struct nk_command_polygon_filled*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_fill(&ctx->draw_list, p->color);
+            nk_draw_list_path_fill(list, p->color);
         } break;
         case NK_COMMAND_POLYLINE: {
             int i;
             const struct nk_command_polyline *p = (const struct nk_command_polyline*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_stroke(&ctx->draw_list, p->color, NK_STROKE_OPEN, p->line_thickness);
+            nk_draw_list_path_stroke(list, p->color, NK_STROKE_OPEN, p->line_thickness);
         } break;
         case NK_COMMAND_TEXT: {
             const struct nk_command_text *t = (const struct nk_command_text*)cmd;
-            nk_draw_list_add_text(&ctx->draw_list, t->font, nk_rect(t->x, t->y, t->w, t->h),
+            nk_draw_list_add_text(list, t->font, nk_rect(t->x, t->y, t->w, t->h),
                 t->string, t->length, t->height, t->foreground);
         } break;
         case NK_COMMAND_IMAGE: {
             const struct nk_command_image *i = (const struct nk_command_image*)cmd;
-            nk_draw_list_add_image(&ctx->draw_list, i->img, nk_rect(i->x, i->y, i->w, i->h), i->col);
+            nk_draw_list_add_image(list, i->img, nk_rect(i->x, i->y, i->w, i->h), i->col);
         } break;
         case NK_COMMAND_CUSTOM: {
             const struct nk_command_custom *c = (const struct nk_command_custom*)cmd;
-            c->callback(&ctx->draw_list, c->x, c->y, c->w, c->h, c->callback_data);
+            c->callback(list, c->x, c->y, c->w, c->h, c->callback_data);
         } break;
         default: break;
         }
     }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_CONVERT);
+}
+NK_INTERN nk_flags
+nk_convert_result(struct nk_context *ctx, const struct nk_buffer *cmds,
+    const struct nk_buffer *vertices, const struct nk_buffer *elements)
+{
+    nk_flags res = NK_CONVERT_SUCCESS;
     res |= (cmds->needed > cmds->allocated + (cmds->memory.size - cmds->size)) ? NK_CONVERT_COMMAND_BUFFER_FULL: 0;
     res |= (vertices->needed > vertices->allocated) ? NK_CONVERT_VERTEX_BUFFER_FULL: 0;
     res |= (elements->needed > elements->allocated) ? NK_CONVERT_ELEMENT_BUFFER_FULL: 0;
+    if (!ctx) return res;
+
+    /* memory telemetry */
+    {struct nk_memory_stats *stats = &ctx->memory_stats;
+    stats->vertex_bytes = vertices->needed;
+    stats->vertex_capacity = vertices->memory.size;
+    stats->vertex_high_water = NK_MAX(stats->vertex_high_water, vertices->needed);
+    stats->element_bytes = elements->needed;
+    stats->element_capacity = elements->memory.size;
+    stats->element_high_water = NK_MAX(stats->element_high_water, elements->needed);}
     return res;
 }
+NK_API nk_flags
+nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
+    struct nk_buffer *vertices, struct nk_buffer *elements,
+    const struct nk_convert_config *config)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!ctx || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    nk_draw_list_setup(&ctx->draw_list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    ctx->draw_list.profiler = ctx->profiler;
+#endif
+    nk_convert_commands(&ctx->draw_list, &ctx->memory, nk__begin(ctx), config);
+    return nk_convert_result(ctx, cmds, vertices, elements);
+}
+NK_API nk_flags
+nk_convert_contexts(struct nk_context *const *ctxs, int count,
+    struct nk_buffer *cmds, struct nk_buffer *vertices,
+    struct nk_buffer *elements, const struct nk_convert_config *config)
+{
+    int i;
+    struct nk_draw_list *list;
+    NK_ASSERT(ctxs);
+    NK_ASSERT(count > 0);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!ctxs || count <= 0 || !ctxs[0] || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    /* contexts are converted back to front into the draw list of the first
+     * context so the result can be drawn with a single `nk_draw_foreach` */
+    list = &ctxs[0]->draw_list;
+    nk_draw_list_setup(list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    list->profiler = ctxs[0]->profiler;
+#endif
+    for (i = 0; i < count; ++i) {
+        NK_ASSERT(ctxs[i]);
+        if (ctxs[i]) nk_convert_commands(list, &ctxs[i]->memory, nk__begin(ctxs[i]), config);
+    }
+    return nk_convert_result(ctxs[0], cmds, vertices, elements);
+}
+NK_API nk_flags
+nk_frame_convert(struct nk_frame *frame, struct nk_buffer *cmds,
+    struct nk_buffer *vertices, struct nk_buffer *elements,
+    const struct nk_convert_config *config)
+{
+    NK_ASSERT(frame);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!frame || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    /* only frame memory is read so this can run while the context builds */
+    nk_draw_list_setup(&frame->draw_list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    frame->draw_list.profiler = frame->profiler;
+#endif
+    nk_convert_commands(&frame->draw_list, &frame->memory, nk__frame_begin(frame), config);
+    return nk_convert_result(0, cmds, vertices, elements);
+}
 NK_API const struct nk_draw_command*
 nk__draw_begin(const struct nk_context *ctx,
     const struct nk_buffer *buffer)
@@ -10552,6 +13352,603 @@ nk__draw_next(const struct nk_draw_command *cmd,
 
 
 
+/* ===============================================================
+ *
+ *                          DEFAULT FONT ATLAS
+ *
+ * ===============================================================*/
+/* ProggyClean.ttf baked at 13 pixels with the default font configuration
+ * and glyph ranges. Pixels are stored with 2 bits per pixel as index into
+ * the palette. Generated by example/font_atlas_embed.c so do not edit. */
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+
+#define NK_DEFAULT_FONT_ATLAS_WIDTH 312
+#define NK_DEFAULT_FONT_ATLAS_HEIGHT 140
+#define NK_DEFAULT_FONT_ATLAS_GLYPHS 224
+#define NK_DEFAULT_FONT_ATLAS_USED 42379
+
+NK_GLOBAL const short nk_default_font_atlas_custom[4] = {0, 0, 181, 28};
+NK_GLOBAL const nk_byte nk_default_font_atlas_palette[4] = {0, 85, 170, 255};
+NK_GLOBAL const float nk_default_font_atlas_metrics[3] = {13.0f, 9.5f, -3.5f};
+NK_GLOBAL const nk_rune nk_default_font_atlas_ranges[] = {0x0020, 0x00FF, 0};
+
+NK_GLOBAL const struct nk_font_glyph nk_default_font_atlas_glyphs[NK_DEFAULT_FONT_ATLAS_GLYPHS] = {
+    {0x0020, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.660256445f, 0.200000003f, 0.666666687f, 0.200000003f},
+    {0x0021, 7.0f, 2.66666675f, 1.0f, 4.33333349f, 10.0f, 2.16666675f, 9.0f, 0.974358976f, 0.728571415f, 0.990384638f, 0.79285717f},
+    {0x0022, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 4.0f, 4.16666698f, 4.0f, 0.31089744f, 0.935714304f, 0.346153855f, 0.964285731f},
+    {0x0023, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.714743614f, 0.442857146f, 0.788461566f, 0.507142842f},
+    {0x0024, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 11.0f, 6.16666698f, 10.0f, 0.580128193f, 0.442857146f, 0.634615421f, 0.514285743f},
+    {0x0025, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.705128193f, 0.657142878f, 0.778846145f, 0.721428573f},
+    {0x0026, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.858974397f, 0.442857146f, 0.923076928f, 0.507142842f},
+    {0x0027, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 4.0f, 2.16666675f, 4.0f, 0.407051295f, 0.828571439f, 0.423076928f, 0.857142866f},
+    {0x0028, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.775641024f, 0.100000001f, 0.81089747f, 0.18571429f},
+    {0x0029, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.621794879f, 0.114285715f, 0.657051265f, 0.200000003f},
+    {0x002A, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.474358976f, 0.885714293f, 0.528846145f, 0.928571463f},
+    {0x002B, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.416666687f, 0.885714293f, 0.471153855f, 0.928571463f},
+    {0x002C, 7.0f, 0.666666627f, 7.0f, 3.33333349f, 12.0f, 3.16666698f, 5.0f, 0.445512831f, 0.757142842f, 0.471153855f, 0.79285717f},
+    {0x002D, 7.0f, 0.666666627f, 5.0f, 6.33333349f, 7.0f, 6.16666698f, 2.0f, 0.503205121f, 0.935714304f, 0.557692289f, 0.949999988f},
+    {0x002E, 7.0f, 1.66666663f, 7.0f, 3.33333349f, 10.0f, 2.16666698f, 3.0f, 0.407051295f, 0.935714304f, 0.423076928f, 0.957142889f},
+    {0x002F, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 11.0f, 6.16666698f, 11.0f, 0.926282048f, 0.357142866f, 0.980769217f, 0.435714275f},
+    {0x0030, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.878205121f, 0.800000012f, 0.932692349f, 0.864285707f},
+    {0x0031, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.820512831f, 0.800000012f, 0.875f, 0.864285707f},
+    {0x0032, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.93589747f, 0.800000012f, 0.990384638f, 0.864285707f},
+    {0x0033, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.349358976f, 0.757142842f, 0.403846145f, 0.821428597f},
+    {0x0034, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.858974397f, 0.514285743f, 0.923076928f, 0.578571439f},
+    {0x0035, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.0705128238f, 0.685714304f, 0.125f, 0.75f},
+    {0x0036, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.358974367f, 0.685714304f, 0.413461536f, 0.75f},
+    {0x0037, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.301282048f, 0.685714304f, 0.355769247f, 0.75f},
+    {0x0038, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.416666687f, 0.685714304f, 0.471153855f, 0.75f},
+    {0x0039, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.243589744f, 0.685714304f, 0.298076928f, 0.75f},
+    {0x003A, 7.0f, 2.66666675f, 3.0f, 4.33333349f, 10.0f, 2.16666675f, 7.0f, 0.426282048f, 0.757142842f, 0.442307711f, 0.807142854f},
+    {0x003B, 7.0f, 0.666666627f, 3.0f, 3.33333349f, 12.0f, 3.16666698f, 9.0f, 0.551282048f, 0.607142866f, 0.576923072f, 0.671428561f},
+    {0x003C, 7.0f, -0.333333343f, 3.0f, 6.33333349f, 9.0f, 7.16666698f, 6.0f, 0.637820542f, 0.821428597f, 0.701923072f, 0.864285707f},
+    {0x003D, 7.0f, 0.666666627f, 4.0f, 7.33333349f, 8.0f, 7.16666698f, 4.0f, 0.858974397f, 0.971428573f, 0.923076928f, 1.0f},
+    {0x003E, 7.0f, 0.666666627f, 3.0f, 7.33333349f, 9.0f, 7.16666698f, 6.0f, 0.176282048f, 0.885714293f, 0.240384623f, 0.928571463f},
+    {0x003F, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.705128193f, 0.800000012f, 0.759615421f, 0.864285707f},
+    {0x0040, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.442857146f, 0.711538494f, 0.507142842f},
+    {0x0041, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.849358976f, 0.585714281f, 0.913461566f, 0.649999976f},
+    {0x0042, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.839743614f, 0.728571415f, 0.903846145f, 0.79285717f},
+    {0x0043, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.926282048f, 0.442857146f, 0.990384638f, 0.507142842f},
+    {0x0044, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.926282048f, 0.514285743f, 0.990384638f, 0.578571439f},
+    {0x0045, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.647435904f, 0.75f, 0.701923072f, 0.814285696f},
+    {0x0046, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.762820542f, 0.800000012f, 0.817307711f, 0.864285707f},
+    {0x0047, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.916666687f, 0.585714281f, 0.980769217f, 0.649999976f},
+    {0x0048, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.907051265f, 0.728571415f, 0.971153855f, 0.79285717f},
+    {0x0049, 7.0f, 1.66666663f, 1.0f, 5.33333349f, 10.0f, 4.16666698f, 9.0f, 0.31089744f, 0.614285707f, 0.346153855f, 0.678571403f},
+    {0x004A, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 10.0f, 5.16666698f, 9.0f, 0.628205121f, 0.29285714f, 0.673076928f, 0.357142866f},
+    {0x004B, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.916666687f, 0.657142878f, 0.980769217f, 0.721428573f},
+    {0x004C, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.532051265f, 0.75f, 0.586538494f, 0.814285696f},
+    {0x004D, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.514285743f, 0.711538494f, 0.578571439f},
+    {0x004E, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.772435904f, 0.728571415f, 0.836538494f, 0.79285717f},
+    {0x004F, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.705128193f, 0.728571415f, 0.769230783f, 0.79285717f},
+    {0x0050, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.474358976f, 0.75f, 0.528846145f, 0.814285696f},
+    {0x0051, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 11.0f, 7.16666698f, 10.0f, 0.493589759f, 0.29285714f, 0.557692289f, 0.364285707f},
+    {0x0052, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.714743614f, 0.585714281f, 0.778846145f, 0.649999976f},
+    {0x0053, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.791666687f, 0.514285743f, 0.855769217f, 0.578571439f},
+    {0x0054, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.585714281f, 0.711538494f, 0.649999976f},
+    {0x0055, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.782051265f, 0.657142878f, 0.846153855f, 0.721428573f},
+    {0x0056, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.628205121f, 0.678571403f, 0.701923072f, 0.742857158f},
+    {0x0057, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.551282048f, 0.678571403f, 0.625f, 0.742857158f},
+    {0x0058, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.782051265f, 0.585714281f, 0.846153855f, 0.649999976f},
+    {0x0059, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.714743614f, 0.514285743f, 0.788461566f, 0.578571439f},
+    {0x005A, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.791666687f, 0.442857146f, 0.855769217f, 0.507142842f},
+    {0x005B, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.583333313f, 0.114285715f, 0.618589759f, 0.200000003f},
+    {0x005C, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 11.0f, 6.16666698f, 11.0f, 0.868589759f, 0.357142866f, 0.923076928f, 0.435714275f},
+    {0x005D, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.958333373f, 0.00714285718f, 0.993589759f, 0.0928571448f},
+    {0x005E, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 7.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.885714293f, 0.057692308f, 0.935714304f},
+    {0x005F, 7.0f, -0.333333343f, 10.0f, 7.33333349f, 11.0f, 8.16666698f, 1.0f, 0.387820512f, 0.992857158f, 0.461538464f, 1.0f},
+    {0x0060, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 3.0f, 3.16666698f, 3.0f, 0.349358976f, 0.935714304f, 0.375f, 0.957142889f},
+    {0x0061, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.942857146f, 0.115384616f, 0.992857158f},
+    {0x0062, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.060897436f, 0.378571421f, 0.115384616f, 0.449999988f},
+    {0x0063, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.828571439f, 0.115384616f, 0.878571451f},
+    {0x0064, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.378571421f, 0.230769232f, 0.449999988f},
+    {0x0065, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.233974367f, 0.828571439f, 0.288461536f, 0.878571451f},
+    {0x0066, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.371428579f, 0.403846145f, 0.442857146f},
+    {0x0067, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.522435904f, 0.371428579f, 0.576923072f, 0.442857146f},
+    {0x0068, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.371428579f, 0.519230783f, 0.442857146f},
+    {0x0069, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.445512831f, 0.607142866f, 0.471153855f, 0.678571403f},
+    {0x006A, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 12.0f, 5.16666698f, 12.0f, 0.660256445f, 0.107142858f, 0.705128193f, 0.192857146f},
+    {0x006B, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.449999988f, 0.519230783f, 0.521428585f},
+    {0x006C, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.416666687f, 0.607142866f, 0.442307711f, 0.678571403f},
+    {0x006D, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.791666687f, 0.871428549f, 0.865384638f, 0.921428561f},
+    {0x006E, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.828571439f, 0.057692308f, 0.878571451f},
+    {0x006F, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.176282048f, 0.828571439f, 0.230769232f, 0.878571451f},
+    {0x0070, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.291666657f, 0.378571421f, 0.346153855f, 0.449999988f},
+    {0x0071, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.407051295f, 0.449999988f, 0.461538464f, 0.521428585f},
+    {0x0072, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.118589744f, 0.828571439f, 0.173076928f, 0.878571451f},
+    {0x0073, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.118589744f, 0.885714293f, 0.173076928f, 0.935714304f},
+    {0x0074, 7.0f, 1.66666663f, 1.0f, 6.33333349f, 10.0f, 5.16666698f, 9.0f, 0.580128193f, 0.371428579f, 0.625f, 0.435714275f},
+    {0x0075, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.349358976f, 0.828571439f, 0.403846145f, 0.878571451f},
+    {0x0076, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.291666657f, 0.828571439f, 0.346153855f, 0.878571451f},
+    {0x0077, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.714743614f, 0.871428549f, 0.788461566f, 0.921428561f},
+    {0x0078, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.885714293f, 0.115384616f, 0.935714304f},
+    {0x0079, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.060897436f, 0.535714269f, 0.115384616f, 0.607142866f},
+    {0x007A, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.942857146f, 0.057692308f, 0.992857158f},
+    {0x007B, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.842948735f, 0.00714285718f, 0.897435904f, 0.0928571448f},
+    {0x007C, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 12.0f, 2.16666675f, 12.0f, 0.81410259f, 0.100000001f, 0.830128193f, 0.18571429f},
+    {0x007D, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.717948735f, 0.100000001f, 0.772435904f, 0.18571429f},
+    {0x007E, 7.0f, -0.333333343f, 4.0f, 7.33333349f, 7.0f, 8.16666698f, 3.0f, 0.147435904f, 0.978571415f, 0.221153855f, 1.0f},
+    {0x007F, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.671428561f, 0.701923072f, 0.671428561f},
+    {0x0080, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 13.0f, 8.16666698f, 14.0f, 0.583333313f, 0.00714285718f, 0.657051265f, 0.107142858f},
+    {0x0081, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.657142878f, 0.701923072f, 0.657142878f},
+    {0x0082, 7.0f, 1.66666663f, 7.0f, 4.33333349f, 12.0f, 3.16666698f, 5.0f, 0.118589744f, 0.942857146f, 0.144230768f, 0.978571415f},
+    {0x0083, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.785256445f, 0.00714285718f, 0.839743614f, 0.0928571448f},
+    {0x0084, 7.0f, 1.66666663f, 7.0f, 5.33333349f, 11.0f, 4.16666698f, 4.0f, 0.272435904f, 0.971428573f, 0.307692319f, 1.0f},
+    {0x0085, 7.0f, 0.666666627f, 8.0f, 6.33333349f, 10.0f, 6.16666698f, 2.0f, 0.493589759f, 0.957142889f, 0.548076928f, 0.971428573f},
+    {0x0086, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.407051295f, 0.528571427f, 0.461538464f, 0.600000024f},
+    {0x0087, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.378571421f, 0.057692308f, 0.449999988f},
+    {0x0088, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 4.0f, 6.16666698f, 4.0f, 0.926282048f, 0.971428573f, 0.980769217f, 1.0f},
+    {0x0089, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.00320512825f, 0.685714304f, 0.0673076957f, 0.75f},
+    {0x008A, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.205128208f, 0.20714286f, 0.269230783f, 0.285714298f},
+    {0x008B, 7.0f, 0.666666627f, 3.0f, 4.33333349f, 9.0f, 4.16666698f, 6.0f, 0.782051265f, 0.928571463f, 0.817307711f, 0.971428573f},
+    {0x008C, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.00320512825f, 0.614285707f, 0.0769230798f, 0.678571403f},
+    {0x008D, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.426282048f, 0.814285696f, 0.432692319f, 0.814285696f},
+    {0x008E, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.407051295f, 0.20714286f, 0.471153855f, 0.285714298f},
+    {0x008F, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.368589759f, 0.964285731f, 0.375f, 0.964285731f},
+    {0x0090, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.664285719f, 0.701923072f, 0.664285719f},
+    {0x0091, 7.0f, 2.66666675f, 0.0f, 5.33333349f, 4.0f, 3.16666675f, 4.0f, 0.147435904f, 0.942857146f, 0.173076928f, 0.971428573f},
+    {0x0092, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 4.0f, 3.16666698f, 4.0f, 0.31089744f, 0.971428573f, 0.336538464f, 1.0f},
+    {0x0093, 7.0f, 1.66666663f, 0.0f, 6.33333349f, 4.0f, 5.16666698f, 4.0f, 0.224358976f, 0.971428573f, 0.269230783f, 1.0f},
+    {0x0094, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 4.0f, 5.16666698f, 4.0f, 0.224358976f, 0.935714304f, 0.269230783f, 0.964285731f},
+    {0x0095, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.358974367f, 0.885714293f, 0.413461536f, 0.928571463f},
+    {0x0096, 7.0f, 0.666666627f, 5.0f, 6.33333349f, 7.0f, 6.16666698f, 2.0f, 0.637820542f, 0.657142878f, 0.692307711f, 0.671428561f},
+    {0x0097, 7.0f, -0.333333343f, 5.0f, 7.33333349f, 7.0f, 8.16666698f, 2.0f, 0.426282048f, 0.935714304f, 0.5f, 0.949999988f},
+    {0x0098, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 4.0f, 5.16666698f, 3.0f, 0.339743584f, 0.971428573f, 0.384615391f, 0.992857158f},
+    {0x0099, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 6.0f, 8.16666698f, 5.0f, 0.858974397f, 0.928571463f, 0.932692349f, 0.964285731f},
+    {0x009A, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.060897436f, 0.45714286f, 0.115384616f, 0.528571427f},
+    {0x009B, 7.0f, 0.666666627f, 3.0f, 4.33333349f, 9.0f, 4.16666698f, 6.0f, 0.743589759f, 0.928571463f, 0.778846145f, 0.971428573f},
+    {0x009C, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.868589759f, 0.871428549f, 0.942307711f, 0.921428561f},
+    {0x009D, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.358974367f, 0.964285731f, 0.365384609f, 0.964285731f},
+    {0x009E, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.378571421f, 0.288461536f, 0.449999988f},
+    {0x009F, 7.0f, -0.333333343f, 0.0f, 7.33333349f, 10.0f, 8.16666698f, 10.0f, 0.349358976f, 0.29285714f, 0.423076928f, 0.364285707f},
+    {0x00A0, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.378205121f, 0.964285731f, 0.384615391f, 0.964285731f},
+    {0x00A1, 7.0f, 2.66666675f, 1.0f, 4.33333349f, 10.0f, 2.16666675f, 9.0f, 0.407051295f, 0.757142842f, 0.423076928f, 0.821428597f},
+    {0x00A2, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 11.0f, 6.16666698f, 9.0f, 0.233974367f, 0.757142842f, 0.288461536f, 0.821428597f},
+    {0x00A3, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.176282048f, 0.757142842f, 0.230769232f, 0.821428597f},
+    {0x00A4, 7.0f, -0.333333343f, 2.0f, 7.33333349f, 10.0f, 8.16666698f, 8.0f, 0.426282048f, 0.821428597f, 0.5f, 0.878571451f},
+    {0x00A5, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.15705128f, 0.614285707f, 0.230769232f, 0.678571403f},
+    {0x00A6, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 12.0f, 2.16666675f, 12.0f, 0.833333373f, 0.100000001f, 0.849358976f, 0.18571429f},
+    {0x00A7, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.45714286f, 0.057692308f, 0.528571427f},
+    {0x00A8, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 2.0f, 4.16666698f, 2.0f, 0.551282048f, 0.957142889f, 0.586538494f, 0.971428573f},
+    {0x00A9, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.0801282078f, 0.614285707f, 0.15384616f, 0.678571403f},
+    {0x00AA, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 7.0f, 5.16666698f, 6.0f, 0.647435904f, 0.928571463f, 0.692307711f, 0.971428573f},
+    {0x00AB, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.243589744f, 0.885714293f, 0.298076928f, 0.928571463f},
+    {0x00AC, 7.0f, 0.666666627f, 5.0f, 5.33333349f, 10.0f, 5.16666698f, 5.0f, 0.589743614f, 0.885714293f, 0.634615421f, 0.921428561f},
+    {0x00AD, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.349358976f, 0.964285731f, 0.355769247f, 0.964285731f},
+    {0x00AE, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.474358976f, 0.678571403f, 0.548076928f, 0.742857158f},
+    {0x00AF, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 1.0f, 8.16666698f, 2.0f, 0.416666687f, 0.964285731f, 0.490384609f, 0.978571415f},
+    {0x00B0, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 5.0f, 5.16666698f, 5.0f, 0.176282048f, 0.935714304f, 0.221153855f, 0.971428573f},
+    {0x00B1, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 10.0f, 6.16666698f, 8.0f, 0.580128193f, 0.821428597f, 0.634615421f, 0.878571451f},
+    {0x00B2, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.945512831f, 0.871428549f, 0.990384638f, 0.914285719f},
+    {0x00B3, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.695512831f, 0.928571463f, 0.740384638f, 0.971428573f},
+    {0x00B4, 7.0f, 2.66666675f, 0.0f, 5.33333349f, 3.0f, 3.16666675f, 3.0f, 0.387820512f, 0.964285731f, 0.413461536f, 0.985714316f},
+    {0x00B5, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 12.0f, 8.16666698f, 9.0f, 0.233974367f, 0.614285707f, 0.307692319f, 0.678571403f},
+    {0x00B6, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 11.0f, 7.16666698f, 10.0f, 0.426282048f, 0.29285714f, 0.490384609f, 0.364285707f},
+    {0x00B7, 7.0f, 1.66666663f, 4.0f, 5.33333349f, 8.0f, 4.16666698f, 4.0f, 0.272435904f, 0.935714304f, 0.307692319f, 0.964285731f},
+    {0x00B8, 7.0f, 2.66666675f, 10.0f, 5.33333349f, 13.0f, 3.16666675f, 3.0f, 0.378205121f, 0.935714304f, 0.403846145f, 0.957142889f},
+    {0x00B9, 7.0f, 0.666666627f, 0.0f, 4.33333349f, 6.0f, 4.16666698f, 6.0f, 0.820512831f, 0.928571463f, 0.855769217f, 0.971428573f},
+    {0x00BA, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.945512831f, 0.921428561f, 0.990384638f, 0.964285731f},
+    {0x00BB, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.532051265f, 0.885714293f, 0.586538494f, 0.928571463f},
+    {0x00BC, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.137820512f, 0.20714286f, 0.201923072f, 0.285714298f},
+    {0x00BD, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.272435904f, 0.20714286f, 0.336538464f, 0.285714298f},
+    {0x00BE, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 10.0f, 8.16666698f, 11.0f, 0.852564096f, 0.100000001f, 0.926282048f, 0.178571433f},
+    {0x00BF, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.589743614f, 0.75f, 0.644230783f, 0.814285696f},
+    {0x00C0, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.541666687f, 0.20714286f, 0.605769217f, 0.285714298f},
+    {0x00C1, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.474358976f, 0.20714286f, 0.538461566f, 0.285714298f},
+    {0x00C2, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.608974338f, 0.20714286f, 0.673076928f, 0.285714298f},
+    {0x00C3, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.929487169f, 0.18571429f, 0.993589759f, 0.264285713f},
+    {0x00C4, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.56089747f, 0.29285714f, 0.625f, 0.364285707f},
+    {0x00C5, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.929487169f, 0.100000001f, 0.993589759f, 0.178571433f},
+    {0x00C6, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.474358976f, 0.607142866f, 0.548076928f, 0.671428561f},
+    {0x00C7, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 13.0f, 7.16666698f, 12.0f, 0.717948735f, 0.00714285718f, 0.782051265f, 0.0928571448f},
+    {0x00C8, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.060897436f, 0.29285714f, 0.115384616f, 0.371428579f},
+    {0x00C9, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.118589744f, 0.29285714f, 0.173076928f, 0.371428579f},
+    {0x00CA, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.81089747f, 0.357142866f, 0.865384638f, 0.435714275f},
+    {0x00CB, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.528571427f, 0.403846145f, 0.600000024f},
+    {0x00CC, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.272435904f, 0.29285714f, 0.307692319f, 0.371428579f},
+    {0x00CD, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.233974367f, 0.29285714f, 0.269230783f, 0.371428579f},
+    {0x00CE, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.31089744f, 0.29285714f, 0.346153855f, 0.371428579f},
+    {0x00CF, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.81089747f, 0.278571427f, 0.846153855f, 0.349999994f},
+    {0x00D0, 7.0f, -0.333333343f, 2.0f, 7.33333349f, 10.0f, 8.16666698f, 8.0f, 0.503205121f, 0.821428597f, 0.576923072f, 0.878571451f},
+    {0x00D1, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.339743584f, 0.20714286f, 0.403846145f, 0.285714298f},
+    {0x00D2, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.743589759f, 0.278571427f, 0.807692289f, 0.357142866f},
+    {0x00D3, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.676282048f, 0.278571427f, 0.740384638f, 0.357142866f},
+    {0x00D4, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.785256445f, 0.192857146f, 0.849358976f, 0.271428585f},
+    {0x00D5, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.00320512825f, 0.20714286f, 0.0673076957f, 0.285714298f},
+    {0x00D6, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.695512831f, 0.364285707f, 0.759615421f, 0.435714275f},
+    {0x00D7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.301282048f, 0.885714293f, 0.355769247f, 0.928571463f},
+    {0x00D8, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.849358976f, 0.657142878f, 0.913461566f, 0.721428573f},
+    {0x00D9, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.919871807f, 0.271428585f, 0.983974397f, 0.349999994f},
+    {0x00DA, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.852564096f, 0.271428585f, 0.916666687f, 0.349999994f},
+    {0x00DB, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.0705128238f, 0.20714286f, 0.134615391f, 0.285714298f},
+    {0x00DC, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.628205121f, 0.364285707f, 0.692307711f, 0.435714275f},
+    {0x00DD, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 10.0f, 8.16666698f, 11.0f, 0.708333313f, 0.192857146f, 0.782051265f, 0.271428585f},
+    {0x00DE, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.18589744f, 0.685714304f, 0.240384623f, 0.75f},
+    {0x00DF, 7.0f, -0.333333343f, 0.0f, 7.33333349f, 11.0f, 8.16666698f, 11.0f, 0.852564096f, 0.18571429f, 0.926282048f, 0.264285713f},
+    {0x00E0, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.580128193f, 0.521428585f, 0.634615421f, 0.592857122f},
+    {0x00E1, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.528571427f, 0.519230783f, 0.600000024f},
+    {0x00E2, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.45714286f, 0.230769232f, 0.528571427f},
+    {0x00E3, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.45714286f, 0.173076928f, 0.528571427f},
+    {0x00E4, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.128205135f, 0.685714304f, 0.182692304f, 0.75f},
+    {0x00E5, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.176282048f, 0.29285714f, 0.230769232f, 0.371428579f},
+    {0x00E6, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.637820542f, 0.871428549f, 0.711538494f, 0.921428561f},
+    {0x00E7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.291666657f, 0.45714286f, 0.346153855f, 0.528571427f},
+    {0x00E8, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.45714286f, 0.288461536f, 0.528571427f},
+    {0x00E9, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.535714269f, 0.288461536f, 0.607142866f},
+    {0x00EA, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.535714269f, 0.230769232f, 0.607142866f},
+    {0x00EB, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.291666657f, 0.757142842f, 0.346153855f, 0.821428597f},
+    {0x00EC, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.387820512f, 0.607142866f, 0.413461536f, 0.678571403f},
+    {0x00ED, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.676282048f, 0.200000003f, 0.701923072f, 0.271428585f},
+    {0x00EE, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.762820542f, 0.364285707f, 0.798076928f, 0.435714275f},
+    {0x00EF, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.349358976f, 0.607142866f, 0.384615391f, 0.678571403f},
+    {0x00F0, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.580128193f, 0.600000024f, 0.634615421f, 0.671428561f},
+    {0x00F1, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.291666657f, 0.535714269f, 0.346153855f, 0.607142866f},
+    {0x00F2, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.535714269f, 0.057692308f, 0.607142866f},
+    {0x00F3, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.522435904f, 0.528571427f, 0.576923072f, 0.600000024f},
+    {0x00F4, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.535714269f, 0.173076928f, 0.607142866f},
+    {0x00F5, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.378571421f, 0.173076928f, 0.449999988f},
+    {0x00F6, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.118589744f, 0.757142842f, 0.173076928f, 0.821428597f},
+    {0x00F7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.589743614f, 0.928571463f, 0.644230783f, 0.971428573f},
+    {0x00F8, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 11.0f, 6.16666698f, 9.0f, 0.00320512825f, 0.757142842f, 0.057692308f, 0.821428597f},
+    {0x00F9, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.407051295f, 0.371428579f, 0.461538464f, 0.442857146f},
+    {0x00FA, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.522435904f, 0.449999988f, 0.576923072f, 0.521428585f},
+    {0x00FB, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.449999988f, 0.403846145f, 0.521428585f},
+    {0x00FC, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.060897436f, 0.757142842f, 0.115384616f, 0.821428597f},
+    {0x00FD, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 13.0f, 6.16666698f, 13.0f, 0.660256445f, 0.00714285718f, 0.714743614f, 0.100000001f},
+    {0x00FE, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 12.0f, 6.16666698f, 11.0f, 0.00320512825f, 0.29285714f, 0.057692308f, 0.371428579f},
+    {0x00FF, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 13.0f, 6.16666698f, 12.0f, 0.900641024f, 0.00714285718f, 0.955128193f, 0.0928571448f}
+};
+
+NK_GLOBAL const nk_uint nk_default_font_atlas_pixels[2730] = {
+    0x0000000F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3FFF0000,0x00000300,
+    0x00000C00,0x0003FFF0,0xF0000000,0x000003FF,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x000F0000,0x003FF000,0x0000000C,0x00000030,0x000003FF,
+    0xFF000000,0x00000003,0x0CC03003,0x33000000,0x00300000,0x00000003,0x03003000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x003F0003,0x00FC0000,0x00FF0000,0x00000000,0x0003FC00,0x3F3F0000,0x00003030,0x0000C0C0,
+    0x0000C030,0xC0000000,0xFFFF9300,0x01BFFFFF,0x006E4000,0xBFFF9000,0x90000001,0x000006FF,
+    0xB9006FF9,0xFE401B91,0x000006FF,0xC0030000,0x000000FF,0x000003FF,0x0000003F,0xF0000000,
+    0x000000C3,0xC00C0330,0x00300000,0x30300003,0x00000000,0x93030000,0x0000001B,0xB90001B9,
+    0x6E400001,0x006E4000,0x00006E40,0x0006E400,0x00000000,0x06E40000,0x00000000,0x03FFF003,
+    0x0FFFC000,0x00CF0000,0x00000000,0x03C3CC00,0x03300000,0x00030003,0x000C000C,0x0000CC30,
+    0xC0000000,0x001B930C,0x01B90000,0x00000000,0x000001B9,0x6E400000,0xE4000000,0x06E40006,
+    0x0006E400,0x000C06E4,0x00030000,0x0000000C,0x00000030,0x00000303,0x03000000,0x00000CC3,
+    0xFCFF0330,0xF3FC0003,0x3330000F,0x00000003,0x93333000,0x0000001B,0x001B91B9,0x01B91B90,
+    0x00000000,0x06FFFFF9,0x0006E400,0xE40006E4,0x06E40006,0x0000003C,0x000C0003,0x00300000,
+    0x0C000000,0x00000000,0x30C000C0,0x03300000,0x00000CC0,0x00003300,0x000CC0F0,0xCC000000,
+    0x001B93C0,0x91B90000,0x1B90001B,0x000001B9,0x6E400000,0xE4000000,0x06E40006,0x0006E400,
+    0x00FC06E4,0x00030000,0x0000000C,0x00000030,0x00003000,0x00300000,0x0000C0C0,0x0CC00330,
+    0x3300F000,0x000003C0,0x00000033,0x90003300,0x0000001B,0x001B91B9,0x01B91B90,0x00000000,
+    0x40006E40,0x00001BFE,0xE40006E4,0x06E40006,0x000003FC,0x000C0003,0x003000C0,0xC000000C,
+    0x00000000,0x00C0000C,0x03300003,0xCC000CC0,0x0CC03300,0x00CC0000,0x0CC00000,0x001B9000,
+    0x91B90000,0x1B90001B,0x40006E40,0x6E40006E,0xE4000000,0x06E40006,0x0006E400,0x0FFC06E4,
+    0x00030000,0x00F0000C,0x003C0030,0x00030000,0x00030000,0x000C00C0,0x0CC00330,0x3300C300,
+    0x000030C0,0x00000330,0x90000330,0x0000001B,0x001B91B9,0x90001B90,0x0001BFFF,0x00006E40,
+    0x0006E400,0xFFFFF900,0x06E40006,0x00003FFC,0x000C0003,0x003000FC,0x000000FC,0xC000000C,
+    0x00C00000,0x03300030,0xC0C00CC0,0xC0FFF3FF,0x0CC00000,0x00CC0F3C,0x001B9000,0x01B90000,
+    0x1BFFFFE4,0x06E40000,0x6E400000,0xE4000000,0x00000006,0x0006E400,0xFFFC06E4,0x00030000,
+    0xFFFF000C,0x03FFFFFF,0x30300000,0x00003030,0x00C000C0,0x0CC00330,0x00000030,0x00030000,
+    0x33333300,0x90000033,0x0000001B,0x000001B9,0x00001B90,0x000006E4,0x00006E40,0x0006E400,
+    0xE4000000,0x06E40006,0x0003FFFC,0x000C0003,0x003000FC,0x000000FC,0x0CF03CC0,0x00C00000,
+    0x03300300,0xC0C00CC0,0xC0FFF3FF,0xCC000000,0x000CC330,0x001B9000,0x01B90000,0x1B900000,
+    0x001B9000,0x01BFE400,0x00000000,0xF9006FF9,0xFE401BFF,0xFFFC06FF,0x0003000F,0x00F0000C,
+    0x003C0030,0x3F000000,0x000003F0,0x0C0000C0,0x0CC03F3F,0x3300C300,0x000030C0,0x03303000,
+    0x90000003,0x0000001B,0xFFE401B9,0x0000006F,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xF03FFFFC,0x000C003F,0x003000C0,0x0000000C,0x0FF03FC0,0x00C00000,0x30033000,
+    0xCC000CC0,0x0CC03300,0x0C000000,0x000C0330,0xFFFF9000,0x01BFFFFF,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x3FFC0000,0x00000000,0x0000000C,0x00000030,
+    0x3FF00000,0x00003FF0,0x3FF000C0,0x0CC03FFF,0x3300F000,0x000003C0,0x03300300,0x00000030,
+    0x00000000,0x00000000,0x6FF90000,0x00000000,0xB91B91B9,0x00000001,0x000006E4,0x00006FF9,
+    0x00003CFC,0x000C0000,0x00300000,0x00000000,0x00000000,0xC0C00000,0x00000030,0x00000CC0,
+    0x00003300,0xFF000000,0x003FFF3F,0x00000000,0x00000000,0x006E4000,0x001B9000,0x9006E400,
+    0xFF91B91B,0x06E40006,0x9006E400,0xF03C001B,0x00000000,0x0000000C,0x00000030,0x00000000,
+    0x00000000,0x00C330C0,0xFCFF0000,0xF3FC0003,0x0000000F,0x00000000,0x90000000,0x1B91BFFF,
+    0x00000000,0x90000000,0xE400001B,0xB91B9006,0x91B90001,0xE400001B,0x001B9006,0x0000F00C,
+    0x03FFF000,0x0FFFC000,0x00000000,0x00000000,0x0CC00000,0x000000C3,0x00030003,0x000C000C,
+    0x0000F000,0x000003C0,0x001B9000,0x0006E400,0x00000000,0x001B9000,0x90001B90,0xE401B91B,
+    0x001B91BF,0x6FF90000,0xC0000000,0xC0000003,0x000000FF,0x000003FF,0x000000C0,0x0000000C,
+    0x030C03C0,0xC00C0000,0x00300000,0xCC000003,0x0CC00000,0x90000000,0xE400001B,0xF9000006,
+    0x9000006F,0x1B90001B,0xB91B9000,0x6FF90001,0xE4000000,0x001B9006,0x0003C000,0x003F0000,
+    0x00FC0000,0x00F00000,0x003C0000,0x00000000,0x0000030C,0x00003030,0x0000C0C0,0x0000C300,
+    0x000030C0,0x001B9000,0x01B90000,0x006E4000,0xBFE40000,0x90001B91,0xFF90001B,0x00006E46,
+    0x9006E400,0x0000001B,0x00000000,0x0000000C,0x00000030,0x000000FC,0x000000FC,0x00F00000,
+    0x0CC00000,0x33000000,0xC0C00000,0xC0FFFFFF,0x90000000,0x0000001B,0x400001B9,0x9000006E,
+    0x1B90001B,0xB91B9000,0x01B90001,0xE40006E4,0x001BFFFF,0x00000000,0x00000000,0x00000000,
+    0xFFFF0000,0x03FFFFFF,0x00000000,0x00000000,0x00000300,0x00000C00,0x00000030,0x00030000,
+    0x001B9000,0x01B90000,0x006E4000,0x001B9000,0x90001B90,0x0001B91B,0x06FF91B9,0x00001B90,
+    0x000006E4,0x00000000,0x00000000,0x00000000,0x000000FC,0x000000FC,0x00000000,0x00000000,
+    0x00000000,0xC0C00000,0xC0FFFFFF,0x90000000,0x0000001B,0x400001B9,0x9000006E,0xE400001B,
+    0xB91B9006,0xFE46E401,0x1B91BFFF,0x06E40000,0x00000000,0x00000000,0x00000000,0x00F00000,
+    0x003C0000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000C300,0x000030C0,0x001B9000,
+    0x01B90000,0x006E4000,0x001B9000,0x9006E400,0xE401B91B,0x06E40006,0x00001B90,0x000006E4,
+    0x00000000,0x00000000,0x00000000,0x000000C0,0x0000000C,0x00000000,0x00000000,0x00000000,
+    0xCC000000,0x0CC00000,0x90000000,0xE400001B,0x40000006,0x6FF9006E,0x00000000,0xB91B91B9,
+    0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x0000F000,0x000003C0,0x001B9000,0x9006E400,
+    0x0001BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x1B91BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0xFFF90000,
+    0x0000001B,0x001B91B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x06E40000,0xFE400000,0xE400001B,0x06E40006,0x6E46E400,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x90000000,0x9000001B,0x0000001B,0x06E401B9,0x0006E400,0x000006E4,
+    0x00000000,0xE46E4000,0xF9000006,0x0000006F,0x006E4000,0x06E46E40,0x00000000,0x000006E4,
+    0x001B91B9,0x01B91B90,0xE4000000,0x40000006,0x0000006E,0x006FF900,0x00006E40,0x00000000,
+    0x00000000,0xE4000000,0x001BFFFF,0x6FF90000,0xB9000000,0x00001B91,0x1B9006E4,0x40006E40,
+    0x9000006E,0xE400001B,0x06E40006,0x6E46E400,0xE4000000,0x00000006,0x00001B90,0x1B900000,
+    0x06E40000,0x00001B90,0x0006E400,0x006E4000,0x001BFE40,0x0006E400,0xE40006E4,0x001B9006,
+    0x00000000,0x00000000,0x6E400000,0x0001B900,0xBFFFFE40,0x9006E401,0x0000001B,0x40000000,
+    0xFFFFFFFE,0x0000001B,0x00000000,0x00000000,0x00000000,0xE41BFE40,0x40000006,0x01B9006E,
+    0xE40006E4,0xB9000006,0x9006E401,0x4000001B,0x90001BFE,0xE400001B,0xB9006E46,0x01B90001,
+    0xE46E4000,0x001B9006,0x0006FF90,0x000006E4,0x001B9000,0x0006FF90,0x1BFE4000,0xF9000000,
+    0x9000006F,0x01B9001B,0xE401B900,0xB9000006,0x0006E401,0xE401B900,0x001BFFFF,0xE401B900,
+    0x001B9006,0x6E46E400,0x000006E4,0x000001B9,0x6E46E400,0x1B900000,0x06E401B9,0x6E400000,
+    0x006E4000,0xB90001B9,0x0006E401,0x1B9006E4,0x001B9000,0x06E46E40,0x0006E400,0xE401B900,
+    0xB9000006,0x00001B91,0x06E406E4,0x91B90000,0xE400001B,0x06E40006,0xFE400000,0x0000001B,
+    0x06FFFE40,0x01B91B90,0x000006E4,0x400001B9,0x01B9006E,0xE401B900,0x06E40006,0x90001B90,
+    0x9000001B,0xE400001B,0xB9000006,0xFFFFE401,0x1B9006FF,0x06E40000,0x000006E4,0x001B91B9,
+    0x9006E400,0x006E401B,0xBFE40000,0x01B90001,0x1B91B900,0x06E46E40,0x0006E400,0xFFFE4000,
+    0xF90001BF,0x0006FFFF,0x1BFFFFE4,0x001B9000,0x001B9000,0x01B90000,0x1B9006E4,0x00000000,
+    0x00001B90,0x06E406E4,0x91B90000,0xE400001B,0xF91B9006,0x0000006F,0x006E4000,0x06E401B9,
+    0x6E401B90,0x1B9006E4,0xB9000000,0x6E400001,0x000006E4,0x001B91B9,0x9006E400,0x9000001B,
+    0x0000001B,0x001BFE40,0x00000000,0x00000000,0x00000000,0xE401B900,0x001B9006,0x6E46E400,
+    0x1BFFFFE4,0x400001B9,0x9006E46E,0x1B90001B,0x46FF9000,0x0000006E,0x0001B900,0x06E46E40,
+    0x91B90000,0xE400001B,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x40000000,0x00001BFE,0x1BFFFFE4,0x40006E40,0xFE40006E,0xE401BFFF,0xBFFF9006,0x90001B91,
+    0xFFFE46FF,0xB91BFFFF,0x6E400001,0x000006E4,0x001B91B9,0x0006E400,0x00000000,0x00000000,
+    0x00000000,0x6E400000,0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xB9000000,0x90000001,0xE400001B,0x00006E46,0x000001B9,0x01B90000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000006E4,0x06E40000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x000006E4,0x001B9000,0x90000000,0xE400001B,0x40000006,
+    0x01B9006E,0x0001B900,0x06E46E40,0xFFF90000,0x0001BFFF,0x00006FF9,0x6E401B90,0xFFFE4000,
+    0x00000006,0x00000000,0xE4000000,0x1B906FFF,0x46E40000,0x9000006E,0x06E4001B,0x00000000,
+    0x000006E4,0x00006E40,0x01B91B90,0x0001B900,0x46E46E40,0x0000006E,0xE4000000,0x06E46FFF,
+    0x9006E400,0x0000001B,0x00000000,0x0006E400,0x0001BFE4,0x06FF9000,0x01B90000,0x00001B90,
+    0x006E46E4,0x001B9000,0x1BFFFFE4,0x00000000,0x00000000,0xE4000000,0x00000006,0x00000000,
+    0xE4000000,0x40000006,0x6FFFE46E,0x1B9006E4,0x06E40000,0x01BFE400,0xE4000000,0x401B9006,
+    0x6E40006E,0x0001B900,0x1B9001B9,0x46E40000,0x9000006E,0x06E4001B,0xFE46E400,0xE46FFFFF,
+    0x06FFFFFF,0x00000000,0xE46FFFE4,0xFFE46FFF,0x0006E46F,0x006E4000,0x06E46FF9,0x00001B90,
+    0x1B9006E4,0x00006E40,0x6E46E400,0x1B900000,0x400001B9,0x01B9006E,0x00001B90,0x006E46E4,
+    0x001B9000,0xE40006E4,0x00006E46,0x0006E400,0xFF900000,0xB90001BF,0x01B90001,0x0001B900,
+    0xB90001B9,0x6E400001,0x1B9006E4,0x06E40000,0x6E401B90,0xE4000000,0x00006E46,0x01B91B90,
+    0x006E4000,0x1B9001B9,0x46E40000,0x9000006E,0x06E4001B,0x6E46E400,0xE4000000,0x00000006,
+    0x6E400000,0x0001B900,0xB90001B9,0x6E400001,0x000006E4,0x06E46E40,0x00001B90,0xFF9006E4,
+    0x00006FFF,0x6E46E400,0x1B900000,0x400001B9,0x01B9006E,0x00001B90,0x006E46E4,0x001B9000,
+    0xE40006E4,0xBFFFFE46,0xFFFFE401,0xFF90001B,0xB9006FFF,0x01B90001,0x0001B900,0x001B9000,
+    0x6E400000,0xE40006E4,0x401B9006,0x9000006E,0xE400001B,0x401B9006,0x6E40006E,0xE401B900,
+    0xE4006FFF,0x001BFFFF,0x6FFFFF90,0xFFE40000,0x6E401BFF,0xE4000000,0x40000006,0x6E40006E,
+    0x0001B900,0xB90001B9,0x90000001,0x0000001B,0x06E46E40,0x6FF90000,0x006E46E4,0xF91B9000,
+    0x00001BFF,0x0001BFE4,0x06FF9000,0x00000000,0x00000000,0x00000000,0x00000000,0x000006E4,
+    0x00006E40,0x0006E400,0x006E4000,0xB9006E40,0x01B90001,0x0001B900,0x001B9000,0x6E400000,
+    0x000006E4,0x46E40000,0x9000006E,0x0000001B,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x06E40000,0xFE400000,0xE46FFFFF,0x06FFFFFF,0x6FFFFF90,0xE46FFFE4,
+    0xFFE46FFF,0x0000006F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x6E400000,0x006E4000,0x00000000,0x0006E400,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x006E4000,0xB90001B9,0x0006E401,0x000006E4,0x401B91B9,0x0000006E,
+    0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xFE400000,0x1B9006FF,0x06E40000,0x90000000,0xE46FFFFF,0x00000006,0x00000000,0x00000000,
+    0xB91B9000,0x00000001,0x1B900000,0x00000000,0x00001B90,0x006E4000,0x00006E40,0x6E400000,
+    0x000006E4,0xB9006E40,0xFE401B91,0x0001BFFF,0x000001B9,0x0006E400,0x000006E4,0x40006E40,
+    0x0006E46E,0x0001B900,0x40006E40,0x00001BFE,0xE4000000,0x06FFFFFF,0x00001B90,0x1B900000,
+    0x40000000,0x6E40006E,0x00000000,0x001B91B9,0x6E400000,0x006E4000,0x40006E40,0x01B9006E,
+    0x00000000,0x06E40000,0x6E400000,0xE46E4000,0xB91BFFFF,0x6E400001,0xE401B900,0x06FF9006,
+    0x0006E400,0xE4000000,0x40000006,0x0000006E,0xFFFFFFE4,0x00006E46,0x00000000,0x00000000,
+    0x00006E40,0x6E400000,0xE46E4000,0x401BFFFF,0x6E40006E,0x1BFFFFE4,0x40006E40,0x0006E46E,
+    0x0001B900,0x06E46E40,0x01B90000,0xE40006E4,0x00000006,0x0006E400,0x006E4000,0x40000000,
+    0xFE40006E,0x0001BFFF,0x001BFFF9,0x6FFFFF90,0xFFFFFFE4,0x40006E46,0x01B9006E,0x006E4000,
+    0x06E46E40,0x6E46E400,0xE46E4000,0xB9000006,0x6E400001,0x000006E4,0x06E401B9,0xFFFFE400,
+    0x0000001B,0xB90001B9,0x00000001,0xFFFFFFE4,0x40006E46,0x0006E46E,0x006E46E4,0x00006E40,
+    0x6E46E400,0x006E4000,0x400001B9,0x6E40006E,0xE40006E4,0xFFFF9006,0x0006E46F,0x0001B900,
+    0x06E46E40,0x01B90000,0xE40006E4,0x00000006,0x01B90000,0x0001B900,0x40000000,0x6E40006E,
+    0xE46E4000,0x46E40006,0x6E40006E,0x1B900000,0xBFFFFE40,0x01B90001,0x006E4000,0x06E46E40,
+    0x0006E400,0xE46E4000,0xB9000006,0x6E400001,0xE401B900,0x06E40006,0x0006E400,0x00000000,
+    0x06E46E40,0x00000000,0x006E4000,0x40006E40,0x0006E46E,0x006E46E4,0x40006E40,0x6E40006E,
+    0x00000000,0x400001B9,0x6E40006E,0xE40006E4,0x40000006,0xFFF9006E,0xFFFE401B,0x400001BF,
+    0x00001BFE,0xE40006E4,0x06FFFFFF,0x6E400000,0x000006E4,0x40000000,0x6E40006E,0xE46E4000,
+    0x46E40006,0x6E40006E,0x0001B900,0x00006E40,0x01B90000,0xFF900000,0x06E46FFF,0x9006E400,
+    0x0001BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x006E4000,0xBFFFFE40,0xFFF90001,0xFF90001B,0xFFE46FFF,0x6E46FFFF,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00006E40,0x6FFFE400,0x00000000,0x401B91B9,0xFFFFFFFE,0x1BFE401B,0x40000000,0x0006FFFE,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00006E40,
+    0x6FFFFF90,0x000006E4,0x06E40000,0xFFF90000,0x1B9006FF,0x001B9000,0x91B90000,0x0000001B,
+    0xB91B9000,0x0006E401,0x0001B900,0xF90001B9,0x90001BFF,0x0001B91B,0x06E46E40,0x0006E400,
+    0x0001B900,0xBFFF9000,0x91B90001,0x006E401B,0x06E46E40,0x90000000,0xE400001B,0x40006E46,
+    0x6FF9006E,0xFF9006E4,0x06FFFFFF,0x6E400000,0xE401B900,0x06E40006,0x00000000,0xE40006E4,
+    0x06E40006,0x91B90000,0x1B90001B,0x400001B9,0x6E40006E,0x006E4000,0x40000000,0x6E40006E,
+    0x000006E4,0x00000000,0x6E46E400,0xE46E4000,0x06E46E46,0x6E46E400,0x00000000,0x400001B9,
+    0x6E401BFE,0x000006E4,0x06E40000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00006E40,0x0006E400,0x006E46E4,0x06E46E40,0x6E46E400,0x006E4000,0x401BFFF9,0x6E46E46E,
+    0xE40006E4,0x00006E46,0x0006E400,0xE401B900,0x06E46E46,0x00000000,0x006FF900,0xFFFF9000,
+    0xFFF9006F,0xFF90001B,0xF90001BF,0x6E401BFF,0xE4000000,0x46E40006,0x6E40006E,0x1B9006E4,
+    0x40006E40,0x6E40006E,0x006E46E4,0x401BFFF9,0xFFFFFFFE,0x1B90001B,0xB9000000,0x01B90001,
+    0x000006E4,0xB9000000,0x6E401B91,0x00000000,0x06E40000,0x6E400000,0xE40006E4,0x40006E46,
+    0x0006E46E,0xFF9006E4,0x46E46FFF,0x6E40006E,0x006E4000,0x06E46E40,0x00001B90,0x1B900000,
+    0x400001B9,0x0000006E,0x0001B900,0xB90001B9,0x01B90001,0x1BFE4000,0x06FF9000,0xFFF90000,
+    0xFF9006FF,0xFFE46FFF,0x9006FFFF,0xE401BFFF,0x06E40006,0x6E400000,0x006FFFE4,0x40006E40,
+    0xFFFFE46E,0xE400001B,0x001BFFFF,0x01B91B90,0xFFFE4000,0x401BFFFF,0x6E46FFFE,0xFFFE4000,
+    0x00000006,0x0006E400,0xE401B900,0x46E40006,0x6E40006E,0x000006E4,0x06E40000,0x0006E400,
+    0x000006E4,0x06E46E40,0x6E401B90,0x006E4000,0x00006E40,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,0x40000006,0x0006E46E,0x006E46E4,
+    0x06E46E40,0x0006E400,0x000006E4,0x06FFFFF9,0x6E400000,0xE40006E4,0xFFFF9006,0x0000006F,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xF9000000,
+    0xFE401BFF,0x0001BFFF,0x06FFFFF9,0x6FFFFF90,0x1BFFF900,0x001B9000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x40000000,0x90001BFE,0x006E46FF,0x06E40000,0x6FFFFF90,
+    0x00000000,0xFFE401B9,0x00001BFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6E400000,0x1BFE4000,
+    0x46FF9000,0x0000006E,0x006E46E4,0x001B9000,0x01BFE400,0xE40006E4,0x00000006,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x91B90000,0xE400001B,0x00000006,
+    0x00001B90,0x0001B900,0x401B9000,0x6E46E46E,0x1B9006E4,0x401B9000,0x0000006E,0x1B900000,
+    0x06E401B9,0x01B90000,0x0001B900,0x40006E40,0x6E40006E,0xE4000000,0x40000006,0x9000006E,
+    0x0001B91B,0x00000000,0x0006E400,0x006E4000,0x06E40000,0x00000000,0xE46E4000,0x06E46E46,
+    0x6E46E400,0xFF900000,0x40000006,0x01B9006E,0x000006E4,0x400001B9,0x6E40006E,0x006E4000,
+    0x001B91B9,0x01B91B90,0x0001B900,0x06E46E40,0xFFFFE400,0xFFFE46FF,0x00006FFF,0x00000000,
+    0x00000000,0x401BFFF9,0x01B9006E,0x000006E4,0x000001B9,0x6FF90000,0x0001B900,0x06E401B9,
+    0x01B90000,0x00000000,0x40006E40,0x0000006E,0x00000000,0x00000000,0x00000000,0xE4000000,
+    0x00000006,0x0006E400,0x1BFFF900,0xBFFF9000,0x00000001,0x006E46E4,0x06E401B9,0x01B90000,
+    0x00000000,0xF91B9000,0x6FFFFFFF,0x000006E4,0xF90001B9,0x6E401BFF,0x006E4000,0x001BFFF9,
+    0x01BFFF90,0x1BFFF900,0xBFFFFE40,0x0006E401,0xE4000000,0x00000006,0x6E46E400,0x006E4000,
+    0x46FFFFF9,0x0000006E,0x000006E4,0x400001B9,0x9000006E,0x0000001B,0x06E401B9,0x0006E400,
+    0xE40006E4,0x40006E46,0x0006E46E,0x006E46E4,0x06E46E40,0x6E46E400,0xE46E4000,0x001BFFFF,
+    0x0006E400,0xFFFFF900,0x40006E46,0x0006E46E,0x006E46E4,0x06E40000,0x01B90000,0xFF900000,
+    0x00006FFF,0x01B90000,0x1BFFFFE4,0x06E40000,0x9006E400,0xE46FFFFF,0x46E40006,0x6FFFFFFE,
+    0xFFFFFFE4,0x40006E46,0x0006E46E,0xE4000000,0x06E40006,0x6E46E400,0xE46E4000,0x06E40006,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,
+    0x40000006,0x0006E46E,0x006E46E4,0x06E40000,0x6E400000,0xE46E4000,0x00000006,0x0006E400,
+    0xE40006E4,0x40006E46,0xFFF9006E,0x000006FF,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x06E40000,0x0006E400,0xE46E4000,0x46E40006,0x6E40006E,0xE40006E4,
+    0x40006E46,0xFFFFE46E,0xE40006FF,0xF9000006,0x9006FFFF,0x0001BFFF,0x40000000,0xFFFFFFFE,
+    0xFFFE46FF,0xB90001BF,0x6E400001,0x1BFE4000,0xF9000000,0x00001BFF,0x1BFFF900,0xBFFF9000,
+    0xFFF90001,0xFF90001B,0xF90001BF,0x6E401BFF,0x006E4000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x400001B9,0x6E40006E,0x0001B900,0x40006E40,0x00001BFE,
+    0xE40006E4,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06E46FF9,0x01B90000,0x006E4000,
+    0x40006E40,0x01B9006E,0xE401B900,0x001B9006,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xE4000000,0x06E46E46,0x9006FF90,0xE400001B,0x401BFFFF,
+    0x9000006E,0x0000001B,0x400001B9,0x6E40006E,0xFF900000,0xB9000006,0x9006E401,0x0000001B,
+    0xF9000000,0x6FFFE46F,0xFFFFF900,0x06E401BF,0x6E400000,0x0001B900,0xFFE401B9,0x0000006F,
+    0xE401B900,0x00000006,0x01B91B90,0x006E4000,0x06E46E40,0x01B90000,0xFFFE4000,0x000001BF,
+    0x0006FF90,0xFFFFF900,0x401B9006,0x0006FFFE,0x1B9006E4,0x06E40000,0x6E400000,0x000006E4,
+    0xB9006E40,0x01B90001,0x0001B900,0x00000000,0x0006E400,0x1B900000,0x000001B9,0x00000000,
+    0x000006E4,0x400001B9,0x01B9006E,0x006E4000,0x06E401B9,0x91B90000,0xE400001B,0x06E40006,
+    0x00001B90,0xFF9006E4,0xB9006E46,0x01B90001,0x0001B900,0xB90001B9,0x01BFE401,0xE401BFE4,
+    0x401BFE46,0x6FF9006E,0x00000000,0x06FFFFF9,0x01B90000,0x006E4000,0xB9006E40,0x6E400001,
+    0x000006E4,0x06E401B9,0x0006E400,0xFF9006E4,0x46E401BF,0x6E40006E,0xE46E4000,0xB9000006,
+    0x01B90001,0x0001B900,0xB90001B9,0x9006E401,0xFFFE401B,0x400001BF,0x0006E46E,0x000006E4,
+    0x400001B9,0x9000006E,0x0001B91B,0x06E46E40,0x01B90000,0x1BFFF900,0x06E40000,0x00001B90,
+    0x006E46E4,0x00006E40,0x00001B90,0x006FF900,0xB90001B9,0x01B90001,0xE401B900,0xB91B9006,
+    0x01B90001,0xE46E4000,0x06E40006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x1B9006E4,0x06E40000,0x6E46FF90,0xFFFFF900,0xB90001BF,0x6E46FF91,
+    0x0001B900,0xB90001B9,0x9006E401,0x0001B91B,0x400001B9,0x0006E46E,0x000006E4,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06E40000,0x00001B90,0x000006E4,
+    0x00006E40,0x00001B90,0x0001B900,0xB9000000,0x01B90001,0xE401B900,0xB91B9006,0xFFF90001,
+    0x0001B91B,0x401BFFF9,0x6FFFFFFE,0x006E4000,0xB9006E40,0x6E400001,0x1BFE4000,0x001B91B9,
+    0x0006E400,0xE46FF900,0xF9006FFF,0x01BFFFFF,0x1B900000,0x06E40000,0x00000000,0x006FFFE4,
+    0xB90001B9,0x9006E401,0x0000001B,0x00000000,0x00000000,0x00000000,0xB9000000,0x01B91B91,
+    0x0001B900,0xB9006E40,0x9006E401,0x1B90001B,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x1B91B900,0xB90001B9,0x6E400001,0x1B9006E4,0x401B91B9,0x0000006E,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xFFFE4000,0xB9006FFF,0x90000001,0x0001B91B,0x401B9000,0x0006E46E,0x0001B900,
+    0x06E46E40,0x91B91B90,0x0001B91B,0x00000000,0x90001B90,0x1BFFFFFF,0x06E46E40,0x00001B90,
+    0xFFFE4000,0xFFFF9006,0x90001BFF,0xE40006FF,0xB9006FFF,0x90000001,0xE401B91B,0xB91B9006,
+    0x90000001,0xE400001B,0xB9006E46,0x6E400001,0x006E46E4,0xBFFF91B9,0x00000001,0x1B9006E4,
+    0x001B9000,0x00000000,0x1B900000,0xB9000000,0x01B90001,0x1B900000,0x00006E40,0x90001B90,
+    0xFF91B91B,0xB91B9006,0x9006E401,0x006E401B,0x00006E40,0x91B91B90,0x0001B91B,0x46E46E40,
+    0x91B9006E,0x006E401B,0x46E40000,0x9000006E,0x0000001B,0x06FFFE40,0x6FFFFF90,0x0001B900,
+    0x400001B9,0x01B9006E,0x1B900000,0xB91B9000,0x91B91B91,0x1B91B91B,0x401B91B9,0x6E40006E,
+    0x1B900000,0xB91B91B9,0x6E400001,0xE401B900,0x001B9006,0x00001B90,0x006E4000,0xFFFF9000,
+    0x0000006F,0x1B91B900,0xB91B9000,0x01B90001,0x006E4000,0x06FFFFF9,0x6FFFE400,0xFF91B900,
+    0xB91B9006,0x91B91B91,0x1B90001B,0x400001B9,0x6E40006E,0xFFFE4000,0x46E401BF,0x90001BFE,
+    0xE400001B,0xB9000006,0x00000001,0x1B900000,0xBFFFFE40,0x90001B91,0xFFFE401B,0xB90001BF,
+    0x01B90001,0x1B91B900,0xB91B9000,0x91B91B91,0x1BFE401B,0x00006FF9,0x01B91B90,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B91B900,0x000001B9,0x01B91B90,
+    0xFF91B900,0x00006FFF,0x01B90000,0x0001B900,0xB90001B9,0x90001B91,0x0001B91B,0x401B9000,
+    0x6E40006E,0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x06E40000,0x91B91B90,0x1B90001B,0xB90001B9,0x00001B91,0xE4000000,0x06E40006,0x01B90000,
+    0x1B91B900,0x401B9000,0x6FFFFFFE,0x006E4000,0x00006E40,0x0006E400,0xFF900000,0xBFE40006,
+    0x91B90001,0x006FFFFF,0x00006E40,0x01B91B90,0x000006E4,0xFFE40000,0xFE40006F,0x1B91BFFF,
+    0x40000000,0x00001BFE,0x000006E4,0x06FFFE40,0x6FFFE400,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x40000000,0x01B9006E,0x0001BFE4,0x001B91B9,0x6E401B90,0x1B900000,0x000001B9,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0001B900,0x46E46E40,0x91B9006E,
+    0x1B90001B,0x00006E40,0x01B91B90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF900,0x001B9006,0x90000000,0xFF90001B,
+    0xB91BFFFF,0x6E400001,0x006E46E4,0xFFFF91B9,0xFE401BFF,0x1BFFFFFF,0x000001B9,0x9006E400,
+    0x0001B91B,0x001B91B9,0x01BFE400,0x006E4000,0xB91B9000,0xFFF90001,0xE46E401B,0xB91B9006,
+    0x91B90001,0x0000001B,0x00000000,0x00001B90,0x0001B900,0x06E46E40,0x91B91B90,0xE400001B,
+    0x00006E46,0x01B91B90,0x1BFFF900,0x00000000,0x00000000,0x1B900000,0xF9000000,0x00001BFF,
+    0xE4000000,0x06E40006,0x9006E400,0x0001B91B,0x001B91B9,0x90000000,0x1B90001B,0xB9000000,
+    0x6E400001,0x1B9006E4,0x001B91B9,0x6E46E400,0x1B900000,0x06E401B9,0x6E46FF90,0x006E4000,
+    0x001BFFF9,0x00001B90,0xE46E46E4,0xBFFF9006,0x00000001,0x006E46E4,0xB91B9000,0x91B90001,
+    0x0000001B,0x001B9000,0x6FFFFF90,0x006E4000,0x06E401B9,0x91BFE400,0xE400001B,0x00006E46,
+    0x00001B90,0xE46E46E4,0x40006E46,0x0006E46E,0xFFFE46E4,0x46E401BF,0x6E40006E,0x006E4000,
+    0x401BFE40,0x6E40006E,0xFFFFF900,0x001B9006,0x6E400000,0x1B900000,0x00000000,0x0006FF90,
+    0xE40006E4,0xFFFF91BF,0x6E401BFF,0x1B900000,0x46E401B9,0x6E46E46E,0xE46E4000,0x06E40006,
+    0x00001B90,0x006E46E4,0xFFFFFE40,0x0000006F,0xE46E46E4,0xB9000006,0x90000001,0x0000001B,
+    0x000001B9,0x00001B90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xE401BFE4,0x40006E46,0x0006E46E,0x1B9006E4,0x46E40000,0x6E46E46E,0x00000000,0x46E40000,
+    0x0006E46E,0x0001B900,0x001B9000,0x01B90000,0x1B91B900,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xF9000000,0x6E401BFF,0xE46E4000,0x46E40006,0x0000006E,
+    0x1BFFF900,0x40006E40,0x0006E46E,0x006E46E4,0xB9000000,0x90000001,0x1BFFFFFF,0x06FFFE40,
+    0xFFFFFF90,0xFFFE401B,0xFFFF9006,0x90001BFF,0xE400001B,0x40006FFF,0x0006FFFE,0x000006E4,
+    0xFFFF9000,0xFFF9006F,0xFFFE401B,0x40006FFF,0x9000006E,0x0001BFFF,0x401BFFF9,0x0000006E,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xB9000000,0x91B90001,0x0000001B,0x001BFE40,
+    0x90001B90,0x0001B91B,0x000001B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x001B91B9,0x91B90000,0x1B90001B,0x001B9000,0x01B90000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0006E400,0x006E4000,
+    0x06FFFFF9,0x6E400000,0x00000000,0x001BFE40,0x9006E400,0x006FFFFF,0x001B9000,0x91B91B90,
+    0xE400001B,0xFFE40006,0x90001BFF,0xE401BFFF,0x001BFE46,0x01BFFF90,0x1BFFF900,0x40006E40,
+    0x0006E46E,0x006E46E4,0xBFFFFFF9,0x01B90001,0x0001B900,0x00006E40,0x01BFE400,0x1B900000,
+    0x001B9000,0x90000000,0x1B90001B,0x001B91B9,0x00001B90,0xE40006E4,0x40006E46,0x01BFE46E,
+    0x006E46E4,0x06E46E40,0x6E46E400,0xE46E4000,0x46E40006,0x01B9006E,0x0001B900,0x400001B9,
+    0xFFFFE46E,0x1BFE46FF,0x00000000,0x90001B90,0x0000001B,0x001B9000,0x90001B90,0x006E401B,
+    0x06E40000,0x6E46E400,0xE4000000,0x40000006,0x6E40006E,0xFFFFFFE4,0xB91B9006,0x0006E401,
+    0x006E46E4,0xB90001B9,0xFFFFE401,0x006E401B,0x00006E40,0x01BFE400,0x00000000,0x001B9000,
+    0x90000000,0x1B90001B,0xB91B9000,0x00000001,0xE40006E4,0x00006E46,0x0006E400,0x006E4000,
+    0x06E46E40,0x90000000,0xE401B91B,0x06E40006,0x01B90000,0x0001B900,0x400001B9,0x6E40006E,
+    0x00000000,0x001BFE40,0x90001B90,0x0000001B,0xBFFFFFF9,0x6FFFE401,0xFFFFF900,0x06E401BF,
+    0x6E46E400,0xE46E4000,0x40000006,0x6E40006E,0xE40006E4,0x06E40006,0x0006E400,0x000006E4,
+    0xBFFFFFF9,0x01B90001,0x0001B900,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xE40006E4,0xBFFF9006,0x0006E401,0xFF900000,0xF90001BF,
+    0x00001BFF,0x000006E4,0x06FFFFF9,0x0006E400,0x006E4000,0x06FFFFF9,0xFFFFE400,0x000006FF,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xFE46FF90,0x006E401B,0x46E40000,0xFE46FFFE,0xFF90001B,
+    0x401BFE46,0x0006FFFE,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x46E401B9,
+    0x01B9006E,0x006E46E4,0x46E401B9,0x01B9006E,0x000006E4,0x400001B9,0x6E40006E,0x006E4000,
+    0x46FFFFF9,0x00001BFE,0x1B900000,0x001B91B9,0x90001B90,0x0000001B,0x000001B9,0x90001B90,
+    0x0001B91B,0x06FFFFF9,0xFFFFFF90,0x006E46FF,0x46E401B9,0x01B9006E,0x006E46E4,0x06FFFFF9,
+    0x0006E400,0x006E4000,0xB91B9000,0x0006E401,0xE4000000,0x400001BF,0x0006E46E,0x006E46E4,
+    0x06FFFE40,0x01B90000,0x1B91B900,0x46E401B9,0x0000006E,0x006E46E4,0x400001B9,0x6E46E46E,
+    0x006E46E4,0x46E401B9,0x01B9006E,0x1B900000,0xB9000000,0x00001B91,0x000006E4,0x00006FF9,
+    0xFE400000,0x1B91B91B,0xB9000000,0xFFF90001,0xFF91BFFF,0x401BFFFF,0x0006FFFE,0x1B91B900,
+    0x46E40000,0x01B9006E,0xFF9006E4,0x401BFE46,0x01B9006E,0x006E46E4,0x46E401B9,0x01BFFFFE,
+    0x1B91B900,0x06E40000,0x90000000,0xE400001B,0x400001BF,0x0006E46E,0x006E46E4,0x06FFFE40,
+    0x01B90000,0x1B91B900,0x46E401B9,0x0000006E,0xFF9006E4,0x001BFFFF,0x90001B90,0x006E401B,
+    0x06E401B9,0xFE46FF90,0x0000001B,0x06E40000,0x9006E400,0x0001B91B,0x46E40000,0x00001BFE,
+    0x1B900000,0x001B91B9,0x90001B90,0x0000001B,0x000001B9,0x90001B90,0x0001B91B,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,
+    0x40006E46,0xFFFFE46E,0x0000001B,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xFF900000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x000006FF,0x00000000,0x00000000,0x00000000,0x001B9000,0x01BFE400,
+    0x006FFFE4,0x000001B9,0x6E401B90,0x1BFFF900,0x401BFFF9,0x01B9006E,0x00000000,0x00000000,
+    0x00000000,0xFF900000,0x46E40006,0x6FFFE46E,0xE46E46E4,0x46E40006,0xFFFFE46E,0xE46FFFFF,
+    0x06FFFFFF,0x00000000,0x00000000,0x00006E40,0x6E401B90,0x006E4000,0x40006FF9,0xFFF9006E,
+    0x006E401B,0xFFE401B9,0x9006FFFF,0x0001BFFF,0x401B91B9,0x01B9006E,0xE46E46E4,0x46E46FFF,
+    0x91B9006E,0x006E401B,0x00000000,0x00000000,0x00000000,0xBFFFFFF9,0x6FFFE401,0x006FF900,
+    0xB91B9000,0x6E400001,0x006E4000,0x401B91B9,0x01B9006E,0xE4000000,0x40000006,0x91B9006E,
+    0x006E401B,0xB91B91B9,0x6FFFE401,0x006E46E4,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x1B900000,0x00006E40,0x6E401B90,0x006E4000,0x40006E40,0x91B9006E,0xFF90001B,
+    0x00000006,0x90001B90,0x006FFFFF,0x06E401B9,0x0006FF90,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x91B91B90,0x1B91B91B,0x001B9000,0x6FFFE400,0x006FFFE4,0x000001B9,
+    0xFFF91B90,0x0000001B,0x00000000,0x00000000,0x006E4000,0x40006E40,0x0006E46E,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xB9000000,0xFFFFFF91,0x0001BFFF,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xB9000000,
+    0x6E400001,0x006E4000,0x00000000,0x90000000,0xE401B91B,0xB9006E46,0x6E46E401,0x000006E4,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xFFFFF900,0x40006FFF,0x0000006E,0xFFFFFFE4,0xFFFF9006,0x0000006F,0x006FFFE4,0xB91B91B9,
+    0x6E46E401,0x1B91B900,0x000001B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B91B900,0x00000000,0x00000000,
+    0x00000000,0x401B9000,0x0006FFFE,0xE46E46E4,0x06E46E46,0x00000000,0xFFFFFFE4,0x00006FFF,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF900,
+    0x06E46FFF,0x0006E400
+};
+
+#endif /* NK_INCLUDE_DEFAULT_FONT_ATLAS */
+
+
+
+
 #ifdef NK_INCLUDE_FONT_BAKING
 /* -------------------------------------------------------------
  *
@@ -10919,6 +14316,110 @@ nk_rp_pack_rects(struct nk_rp_context *context, struct nk_rp_rect *rects, int nu
     for (i=0; i < num_rects; ++i)
         rects[i].was_packed = !(rects[i].x == NK_RP__MAXVAL && rects[i].y == NK_RP__MAXVAL);
 }
+/* MaxRects packer with best area fit. Keeps a list of maximal free
+ * rectangles which may overlap each other. Slower than the skyline packer
+ * but often packs tighter since space below skyline overhangs is reused. */
+struct nk_rp_space {
+    int x, y, w, h;
+};
+NK_INTERN int
+nk_rp__space_contains(const struct nk_rp_space *a, const struct nk_rp_space *b)
+{
+    return b->x >= a->x && b->y >= a->y &&
+        b->x + b->w <= a->x + a->w && b->y + b->h <= a->y + a->h;
+}
+NK_INTERN int
+nk_rp__maxrects_place(struct nk_rp_space *spaces, int *count, int capacity,
+    const struct nk_rp_space *used)
+{
+    int i, j, n = *count, end = *count;
+
+    /* split every free rect overlapping the used rect into up to four */
+    for (i = 0; i < n; ++i) {
+        struct nk_rp_space s = spaces[i];
+        if (used->x >= s.x + s.w || used->x + used->w <= s.x ||
+            used->y >= s.y + s.h || used->y + used->h <= s.y)
+            continue;
+        if (end + 4 > capacity) return nk_false;
+        spaces[i].w = 0;
+        if (used->x > s.x) {
+            spaces[end] = s; spaces[end].w = used->x - s.x; end++;
+        }
+        if (used->x + used->w < s.x + s.w) {
+            spaces[end] = s; spaces[end].x = used->x + used->w;
+            spaces[end].w = s.x + s.w - spaces[end].x; end++;
+        }
+        if (used->y > s.y) {
+            spaces[end] = s; spaces[end].h = used->y - s.y; end++;
+        }
+        if (used->y + used->h < s.y + s.h) {
+            spaces[end] = s; spaces[end].y = used->y + used->h;
+            spaces[end].h = s.y + s.h - spaces[end].y; end++;
+        }
+    }
+
+    /* only new free rects can be contained in or contain other free rects */
+    for (i = n; i < end; ++i) {
+        for (j = 0; j < end && spaces[i].w; ++j) {
+            if (i == j || !spaces[j].w) continue;
+            if (nk_rp__space_contains(&spaces[j], &spaces[i]))
+                spaces[i].w = 0;
+            else if (j < n && nk_rp__space_contains(&spaces[i], &spaces[j]))
+                spaces[j].w = 0;
+        }
+    }
+    for (i = 0, j = 0; i < end; ++i)
+        if (spaces[i].w) spaces[j++] = spaces[i];
+    *count = j;
+    return nk_true;
+}
+NK_INTERN int
+nk_rp_pack_rects_maxrects(struct nk_rp_rect *rects, int num_rects, int width,
+    int height, struct nk_rp_space *spaces, int capacity)
+{
+    int i, j, count = 1, result = nk_true;
+    NK_ASSERT(capacity > 0);
+    spaces[0].x = spaces[0].y = 0;
+    spaces[0].w = width;
+    spaces[0].h = height;
+
+    for (i=0; i < num_rects; ++i) {
+        rects[i].was_packed = i;
+        rects[i].x = rects[i].y = NK_RP__MAXVAL;
+    }
+    nk_rp_qsort(rects, (unsigned)num_rects, nk_rect_height_compare);
+
+    for (i=0; i < num_rects; ++i) {
+        int best = -1, best_area = 0, best_short = 0;
+        struct nk_rp_space used;
+        used.w = rects[i].w;
+        used.h = rects[i].h;
+
+        /* best area fit with shortest leftover side as tie breaker */
+        for (j = 0; j < count; ++j) {
+            int area, dw = spaces[j].w - used.w, dh = spaces[j].h - used.h;
+            if (dw < 0 || dh < 0) continue;
+            area = spaces[j].w * spaces[j].h - used.w * used.h;
+            if (best < 0 || area < best_area ||
+                (area == best_area && NK_MIN(dw, dh) < best_short)) {
+                best = j; best_area = area; best_short = NK_MIN(dw, dh);
+            }
+        }
+        if (best < 0) {result = nk_false; continue;}
+        used.x = spaces[best].x;
+        used.y = spaces[best].y;
+        if (!nk_rp__maxrects_place(spaces, &count, capacity, &used)) {
+            result = nk_false;
+            break;
+        }
+        rects[i].x = (nk_rp_coord)used.x;
+        rects[i].y = (nk_rp_coord)used.y;
+    }
+    nk_rp_qsort(rects, (unsigned)num_rects, nk_rect_original_order);
+    for (i=0; i < num_rects; ++i)
+        rects[i].was_packed = !(rects[i].x == NK_RP__MAXVAL && rects[i].y == NK_RP__MAXVAL);
+    return result;
+}
 
 /*
  * ==============================================================
@@ -10968,6 +14469,7 @@ struct nk_tt_pack_context {
     int   stride_in_bytes;
     int   padding;
     unsigned int   h_oversample, v_oversample;
+    int   sdf_spread;
     unsigned char *pixels;
     void  *nodes;
 };
@@ -10997,21 +14499,16 @@ struct nk_tt__bitmap{
    unsigned char *pixels;
 };
 
-struct nk_tt__hheap_chunk {
-    struct nk_tt__hheap_chunk *next;
-};
-struct nk_tt__hheap {
-    struct nk_allocator alloc;
-    struct nk_tt__hheap_chunk *head;
-    void   *first_free;
-    int    num_remaining_in_head_chunk;
-};
-
 struct nk_tt__edge {
     float x0,y0, x1,y1;
     int invert;
 };
 
+struct nk_tt__edge_key {
+    float y0;
+    int index;
+};
+
 struct nk_tt__active_edge {
     struct nk_tt__active_edge *next;
     float fx,fdx,fdy;
@@ -11019,6 +14516,8 @@ struct nk_tt__active_edge {
     float sy;
     float ey;
 };
+/* unsorted edges are stored in the memory later used for active edges */
+NK_STATIC_ASSERT(sizeof(struct nk_tt__active_edge) >= sizeof(struct nk_tt__edge));
 struct nk_tt__point {float x,y;};
 
 #define NK_TT_MACSTYLE_DONTCARE     0
@@ -11609,53 +15108,12 @@ nk_tt_GetGlyphBitmapBox(const struct nk_tt_fontinfo *font, int glyph,
 /*-------------------------------------------------------------
  *                          Rasterizer
  * --------------------------------------------------------------*/
-NK_INTERN void*
-nk_tt__hheap_alloc(struct nk_tt__hheap *hh, nk_size size)
-{
-    if (hh->first_free) {
-        void *p = hh->first_free;
-        hh->first_free = * (void **) p;
-        return p;
-    } else {
-        if (hh->num_remaining_in_head_chunk == 0) {
-            int count = (size < 32 ? 2000 : size < 128 ? 800 : 100);
-            struct nk_tt__hheap_chunk *c = (struct nk_tt__hheap_chunk *)
-                hh->alloc.alloc(hh->alloc.userdata, 0,
-                sizeof(struct nk_tt__hheap_chunk) + size * (nk_size)count);
-            if (c == 0) return 0;
-            c->next = hh->head;
-            hh->head = c;
-            hh->num_remaining_in_head_chunk = count;
-        }
-        --hh->num_remaining_in_head_chunk;
-        return (char *) (hh->head) + size * (nk_size)hh->num_remaining_in_head_chunk;
-    }
-}
-NK_INTERN void
-nk_tt__hheap_free(struct nk_tt__hheap *hh, void *p)
-{
-    *(void **) p = hh->first_free;
-    hh->first_free = p;
-}
-NK_INTERN void
-nk_tt__hheap_cleanup(struct nk_tt__hheap *hh)
-{
-    struct nk_tt__hheap_chunk *c = hh->head;
-    while (c) {
-        struct nk_tt__hheap_chunk *n = c->next;
-        hh->alloc.free(hh->alloc.userdata, c);
-        c = n;
-    }
-}
 NK_INTERN struct nk_tt__active_edge*
-nk_tt__new_active(struct nk_tt__hheap *hh, struct nk_tt__edge *e,
+nk_tt__new_active(struct nk_tt__active_edge *z, struct nk_tt__edge *e,
     int off_x, float start_point)
 {
-    struct nk_tt__active_edge *z = (struct nk_tt__active_edge *)
-        nk_tt__hheap_alloc(hh, sizeof(*z));
     float dxdy = (e->x1 - e->x0) / (e->y1 - e->y0);
     /*STBTT_assert(e->y0 <= start_point); */
-    if (!z) return z;
     z->fdx = dxdy;
     z->fdy = (dxdy != 0) ? (1/dxdy): 0;
     z->fx = e->x0 + dxdy * (start_point - e->y0);
@@ -11860,106 +15318,105 @@ nk_tt__fill_active_edges_new(float *scanline, float *scanline_fill, int len,
     }
 }
 NK_INTERN void
+nk_tt__resolve_scanline(unsigned char *out, const float *scanline,
+    float *scanline2, int len)
+{
+    /* The prefix sum of the fill has to stay sequential to produce identical
+     * rounding. Converting accumulated area into coverage is independent per
+     * pixel and done eight pixels at a time if SSE2 is enabled. */
+    int i = 0;
+    float sum = 0;
+    for (i=0; i < len; ++i) {
+        sum += scanline2[i];
+        scanline2[i] = sum;
+    }
+    i = 0;
+#ifdef NK_INCLUDE_SSE2
+    {const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 8 <= len; i += 8) {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(scanline + i), _mm_loadu_ps(scanline2 + i));
+        __m128 b = _mm_add_ps(_mm_loadu_ps(scanline + i + 4), _mm_loadu_ps(scanline2 + i + 4));
+        __m128i ia = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign, a), scale), half));
+        __m128i ib = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign, b), scale), half));
+        /* saturating packs clamp to 255 */
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(ia, ib), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i*)(void*)(out + i), packed);
+    }}
+#endif
+    for (; i < len; ++i) {
+        float k = scanline[i] + scanline2[i];
+        int m = (int)(NK_ABS(k) * 255.0f + 0.5f);
+        out[i] = (unsigned char)((m > 255) ? 255: m);
+    }
+}
+NK_INTERN void
 nk_tt__rasterize_sorted_edges(struct nk_tt__bitmap *result, struct nk_tt__edge *e,
-    int n, int vsubsample, int off_x, int off_y, struct nk_allocator *alloc)
+    int n, struct nk_tt__active_edge *pool, float *scanline, int off_x, int off_y)
 {
     /* directly AA rasterize edges w/o supersampling */
-    struct nk_tt__hheap hh;
     struct nk_tt__active_edge *active = 0;
-    int y,j=0, i;
-    float scanline_data[129], *scanline, *scanline2;
+    float *scanline2 = scanline + result->w;
+    int y,j=0, used = 0;
 
-    NK_UNUSED(vsubsample);
-    nk_zero_struct(hh);
-    hh.alloc = *alloc;
-
-    if (result->w > 64)
-        scanline = (float *) alloc->alloc(alloc->userdata,0, (nk_size)(result->w*2+1) * sizeof(float));
-    else scanline = scanline_data;
-
-    scanline2 = scanline + result->w;
     y = off_y;
     e[n].y0 = (float) (off_y + result->h) + 1;
-
     while (j < result->h)
     {
         /* find center of pixel for this scanline */
         float scan_y_top    = (float)y + 0.0f;
         float scan_y_bottom = (float)y + 1.0f;
         struct nk_tt__active_edge **step = &active;
-
-        NK_MEMSET(scanline , 0, (nk_size)result->w*sizeof(scanline[0]));
-        NK_MEMSET(scanline2, 0, (nk_size)(result->w+1)*sizeof(scanline[0]));
-
-        /* update all active edges; */
-        /* remove all active edges that terminate before the top of this scanline */
-        while (*step) {
-            struct nk_tt__active_edge * z = *step;
-            if (z->ey <= scan_y_top) {
-                *step = z->next; /* delete from list */
-                NK_ASSERT(z->direction);
-                z->direction = 0;
-                nk_tt__hheap_free(&hh, z);
-            } else {
-                step = &((*step)->next); /* advance through list */
-            }
-        }
+        unsigned char *out = result->pixels + j*result->stride;
 
         /* insert all edges that start before the bottom of this scanline */
         while (e->y0 <= scan_y_bottom) {
             if (e->y0 != e->y1) {
-                struct nk_tt__active_edge *z = nk_tt__new_active(&hh, e, off_x, scan_y_top);
-                if (z != 0) {
-                    NK_ASSERT(z->ey >= scan_y_top);
-                    /* insert at front */
-                    z->next = active;
-                    active = z;
-                }
+                /* every edge becomes active at most once */
+                struct nk_tt__active_edge *z = nk_tt__new_active(&pool[used++], e, off_x, scan_y_top);
+                NK_ASSERT(used <= n);
+                NK_ASSERT(z->ey >= scan_y_top);
+                /* insert at front */
+                z->next = active;
+                active = z;
             }
             ++e;
         }
 
-        /* now process all active edges */
-        if (active)
+        if (active) {
+            NK_MEMSET(scanline , 0, (nk_size)result->w*sizeof(scanline[0]));
+            NK_MEMSET(scanline2, 0, (nk_size)(result->w+1)*sizeof(scanline[0]));
             nk_tt__fill_active_edges_new(scanline, scanline2+1, result->w, active, scan_y_top);
+            nk_tt__resolve_scanline(out, scanline, scanline2, result->w);
+        } else NK_MEMSET(out, 0, (nk_size)result->w);
 
-        {
-            float sum = 0;
-            for (i=0; i < result->w; ++i) {
-                float k;
-                int m;
-                sum += scanline2[i];
-                k = scanline[i] + sum;
-                k = (float) NK_ABS(k) * 255.0f + 0.5f;
-                m = (int) k;
-                if (m > 255) m = 255;
-                result->pixels[j*result->stride + i] = (unsigned char) m;
-            }
-        }
-        /* advance all the edges */
-        step = &active;
+        /* advance all edges and remove edges ending before the next scanline */
         while (*step) {
             struct nk_tt__active_edge *z = *step;
-            z->fx += z->fdx; /* advance to position for current scanline */
-            step = &((*step)->next); /* advance through list */
+            if (z->ey <= scan_y_bottom) {
+                *step = z->next; /* delete from list */
+                NK_ASSERT(z->direction);
+                z->direction = 0;
+            } else {
+                z->fx += z->fdx; /* advance to position for next scanline */
+                step = &z->next; /* advance through list */
+            }
         }
         ++y;
         ++j;
     }
-    nk_tt__hheap_cleanup(&hh);
-    if (scanline != scanline_data)
-        alloc->free(alloc->userdata, scanline);
 }
 NK_INTERN void
-nk_tt__sort_edges_ins_sort(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges_ins_sort(struct nk_tt__edge_key *p, int n)
 {
     int i,j;
     #define NK_TT__COMPARE(a,b)  ((a)->y0 < (b)->y0)
     for (i=1; i < n; ++i) {
-        struct nk_tt__edge t = p[i], *a = &t;
+        struct nk_tt__edge_key t = p[i], *a = &t;
         j = i;
         while (j > 0) {
-            struct nk_tt__edge *b = &p[j-1];
+            struct nk_tt__edge_key *b = &p[j-1];
             int c = NK_TT__COMPARE(a,b);
             if (!c) break;
             p[j] = p[j-1];
@@ -11970,11 +15427,11 @@ nk_tt__sort_edges_ins_sort(struct nk_tt__edge *p, int n)
     }
 }
 NK_INTERN void
-nk_tt__sort_edges_quicksort(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges_quicksort(struct nk_tt__edge_key *p, int n)
 {
     /* threshold for transitioning to insertion sort */
     while (n > 12) {
-        struct nk_tt__edge t;
+        struct nk_tt__edge_key t;
         int c01,c12,c,m,i,j;
 
         /* compute median of three */
@@ -12037,10 +15494,19 @@ nk_tt__sort_edges_quicksort(struct nk_tt__edge *p, int n)
     }
 }
 NK_INTERN void
-nk_tt__sort_edges(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges(struct nk_tt__edge *dst, const struct nk_tt__edge *src,
+    struct nk_tt__edge_key *keys, int n)
 {
-   nk_tt__sort_edges_quicksort(p, n);
-   nk_tt__sort_edges_ins_sort(p, n);
+    /* sort small keys instead of whole edges and gather edges afterwards */
+    int i;
+    for (i = 0; i < n; ++i) {
+        keys[i].y0 = src[i].y0;
+        keys[i].index = i;
+    }
+    nk_tt__sort_edges_quicksort(keys, n);
+    nk_tt__sort_edges_ins_sort(keys, n);
+    for (i = 0; i < n; ++i)
+        dst[i] = src[keys[i].index];
 }
 NK_INTERN void
 nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
@@ -12049,7 +15515,12 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     struct nk_allocator *alloc)
 {
     float y_scale_inv = invert ? -scale_y : scale_y;
-    struct nk_tt__edge *e;
+    struct nk_tt__edge *e, *sorted;
+    struct nk_tt__active_edge *pool;
+    struct nk_tt__edge_key *keys;
+    float *scanline;
+    void *memory;
+    nk_size size;
     int n,i,j,k,m;
     int vsubsample = 1;
     /* vsubsample should divide 255 evenly; otherwise we won't reach full opacity */
@@ -12059,9 +15530,17 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     for (i=0; i < windings; ++i)
         n += wcount[i];
 
-    e = (struct nk_tt__edge*)
-       alloc->alloc(alloc->userdata, 0,(sizeof(*e) * (nk_size)(n+1)));
-    if (e == 0) return;
+    /* one block for everything: unsorted edges are gathered into sorted
+     * order and then overwritten by active edges they turn into */
+    size = sizeof(*pool) * (nk_size)n + sizeof(*sorted) * (nk_size)(n+1) +
+        sizeof(*keys) * (nk_size)n + sizeof(float) * (nk_size)(result->w*2+1);
+    memory = alloc->alloc(alloc->userdata, 0, size);
+    if (memory == 0) return;
+    pool = (struct nk_tt__active_edge*)memory;
+    e = (struct nk_tt__edge*)(void*)pool;
+    sorted = (struct nk_tt__edge*)(void*)(pool + n);
+    keys = (struct nk_tt__edge_key*)(void*)(sorted + n + 1);
+    scanline = (float*)(void*)(keys + n);
     n = 0;
 
     m=0;
@@ -12091,11 +15570,10 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     }
 
     /* now sort the edges by their highest point (should snap to integer, and then by x) */
-    /*STBTT_sort(e, n, sizeof(e[0]), nk_tt__edge_compare); */
-    nk_tt__sort_edges(e, n);
+    nk_tt__sort_edges(sorted, e, keys, n);
     /* now, traverse the scanlines and find the intersections on each scanline, use xor winding rule */
-    nk_tt__rasterize_sorted_edges(result, e, n, vsubsample, off_x, off_y, alloc);
-    alloc->free(alloc->userdata, e);
+    nk_tt__rasterize_sorted_edges(result, sorted, n, pool, scanline, off_x, off_y);
+    alloc->free(alloc->userdata, memory);
 }
 NK_INTERN void
 nk_tt__add_point(struct nk_tt__point *points, int n, float x, float y)
@@ -12252,6 +15730,74 @@ nk_tt_MakeGlyphBitmapSubpixel(const struct nk_tt_fontinfo *info, unsigned char *
     alloc->free(alloc->userdata, vertices);
 }
 
+NK_INTERN void
+nk_tt_MakeGlyphSDF(const struct nk_tt_fontinfo *info, unsigned char *output,
+    int out_w, int out_h, int out_stride, float scale, int spread,
+    int glyph, struct nk_allocator *alloc)
+{
+    /* Signed distance field to the flattened glyph outline. Every texel stores
+     * 128 on the outline and +-127 at `spread` pixels inside/outside. */
+    int x, y, i, j, ix0, iy0, ix1, iy1;
+    int num_contours = 0, *contour_lengths = 0;
+    struct nk_tt_vertex *vertices;
+    struct nk_tt__point *points;
+    int num_verts = nk_tt_GetGlyphShape(info, alloc, glyph, &vertices);
+    float max_dist = (float)spread;
+
+    /* only write the glyph box plus spread, never into the packing padding */
+    nk_tt_GetGlyphBitmapBox(info, glyph, scale, scale, &ix0,&iy0,&ix1,&iy1);
+    out_w = NK_MIN(out_w, ix1 - ix0 + 2*spread);
+    out_h = NK_MIN(out_h, iy1 - iy0 + 2*spread);
+    points = nk_tt_FlattenCurves(vertices, num_verts, 0.35f / scale,
+        &contour_lengths, &num_contours, alloc);
+    alloc->free(alloc->userdata, vertices);
+    if (!points) return;
+
+    /* move outline into bitmap space */
+    for (i = 0, j = 0; i < num_contours; ++i) j += contour_lengths[i];
+    for (i = 0; i < j; ++i) {
+        points[i].x = points[i].x * scale - (float)(ix0 - spread);
+        points[i].y = -points[i].y * scale - (float)(iy0 - spread);
+    }
+    for (y = 0; y < out_h; ++y) {
+        for (x = 0; x < out_w; ++x) {
+            float px = (float)x + 0.5f, py = (float)y + 0.5f;
+            float best = max_dist * max_dist;
+            int winding = 0, start = 0, c;
+            for (c = 0; c < num_contours; ++c) {
+                int n = contour_lengths[c];
+                const struct nk_tt__point *pts = points + start;
+                for (i = 0, j = n-1; i < n; j = i++) {
+                    const struct nk_tt__point *a = &pts[j], *b = &pts[i];
+                    float ex = b->x - a->x, ey = b->y - a->y;
+                    float dx = px - a->x, dy = py - a->y;
+                    float len = ex*ex + ey*ey, t, d;
+
+                    /* nonzero winding rule for the sign */
+                    if ((a->y <= py) != (b->y <= py)) {
+                        float cross = ex * dy - ey * dx;
+                        if (b->y > a->y && cross > 0) winding++;
+                        else if (b->y <= a->y && cross < 0) winding--;
+                    }
+                    /* squared distance to segment */
+                    if (NK_MIN(a->x, b->x) - px >= max_dist || px - NK_MAX(a->x, b->x) >= max_dist ||
+                        NK_MIN(a->y, b->y) - py >= max_dist || py - NK_MAX(a->y, b->y) >= max_dist)
+                        continue;
+                    t = (len > 0) ? NK_CLAMP(0.0f, (dx*ex + dy*ey) / len, 1.0f): 0.0f;
+                    dx -= t * ex; dy -= t * ey;
+                    d = dx*dx + dy*dy;
+                    if (d < best) best = d;
+                }
+                start += n;
+            }
+            {float dist = NK_SQRT(best) * 127.0f / max_dist;
+            float v = (winding != 0) ? 128.0f + dist: 128.0f - dist;
+            output[y * out_stride + x] = (unsigned char)NK_CLAMP(0.0f, v + 0.5f, 255.0f);}
+        }
+    }
+    alloc->free(alloc->userdata, contour_lengths);
+    alloc->free(alloc->userdata, points);
+}
 /*-------------------------------------------------------------
  *                          Bitmap baking
  * --------------------------------------------------------------*/
@@ -12280,6 +15826,7 @@ nk_tt_PackBegin(struct nk_tt_pack_context *spc, unsigned char *pixels,
     spc->stride_in_bytes = (stride_in_bytes != 0) ? stride_in_bytes : pw;
     spc->h_oversample = 1;
     spc->v_oversample = 1;
+    spc->sdf_spread = 0;
 
     nk_rp_init_target(context, pw-padding, ph-padding, nodes, num_nodes);
     if (pixels)
@@ -12465,8 +16012,8 @@ nk_tt_PackFontRangesGatherRects(struct nk_tt_pack_context *spc,
             int glyph = nk_tt_FindGlyphIndex(info, codepoint);
             nk_tt_GetGlyphBitmapBoxSubpixel(info,glyph, scale * (float)spc->h_oversample,
                 scale * (float)spc->v_oversample, 0,0, &x0,&y0,&x1,&y1);
-            rects[k].w = (nk_rp_coord) (x1-x0 + spc->padding + (int)spc->h_oversample-1);
-            rects[k].h = (nk_rp_coord) (y1-y0 + spc->padding + (int)spc->v_oversample-1);
+            rects[k].w = (nk_rp_coord) (x1-x0 + spc->padding + (int)spc->h_oversample-1 + 2*spc->sdf_spread);
+            rects[k].h = (nk_rp_coord) (y1-y0 + spc->padding + (int)spc->v_oversample-1 + 2*spc->sdf_spread);
             ++k;
         }
     }
@@ -12522,7 +16069,15 @@ nk_tt_PackFontRangesRenderIntoRects(struct nk_tt_pack_context *spc,
                 nk_tt_GetGlyphHMetrics(info, glyph, &advance, &lsb);
                 nk_tt_GetGlyphBitmapBox(info, glyph, scale * (float)spc->h_oversample,
                         (scale * (float)spc->v_oversample), &x0,&y0,&x1,&y1);
-                nk_tt_MakeGlyphBitmapSubpixel(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
+                if (spc->sdf_spread) {
+                    /* distance fields are never oversampled and like bitmaps
+                     * only fill the rect without padding */
+                    nk_tt_MakeGlyphSDF(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
+                        (int)(r->w - spc->h_oversample+1), (int)(r->h - spc->v_oversample+1),
+                        spc->stride_in_bytes, scale, spc->sdf_spread, glyph, alloc);
+                    x0 -= spc->sdf_spread;
+                    y0 -= spc->sdf_spread;
+                } else nk_tt_MakeGlyphBitmapSubpixel(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
                     (int)(r->w - spc->h_oversample+1), (int)(r->h - spc->v_oversample+1),
                     spc->stride_in_bytes, scale * (float)spc->h_oversample,
                     scale * (float)spc->v_oversample, 0,0, glyph, alloc);
@@ -12680,6 +16235,14 @@ nk_font_korean_glyph_ranges(void)
     return ranges;
 }
 NK_INTERN void
+nk_font_bake_mode(struct nk_tt_pack_context *spc, const struct nk_font_config *cfg)
+{
+    /* distance field glyphs scale on their own and skip oversampling */
+    if (cfg->sdf) nk_tt_PackSetOversampling(spc, 1, 1);
+    else nk_tt_PackSetOversampling(spc, cfg->oversample_h, cfg->oversample_v);
+    spc->sdf_spread = cfg->sdf;
+}
+NK_INTERN void
 nk_font_baker_memory(nk_size *temp, int *glyph_count,
     struct nk_font_config *config_list, int count)
 {
@@ -12725,11 +16288,116 @@ nk_font_baker(void *memory, int glyph_count, int count, struct nk_allocator *all
     baker->alloc = *alloc;
     return baker;
 }
+enum nk_font_pack_heuristic {
+    NK_FONT_PACK_SKYLINE_BL = NK_RP_HEURISTIC_Skyline_BL_sortHeight,
+    NK_FONT_PACK_SKYLINE_BF = NK_RP_HEURISTIC_Skyline_BF_sortHeight,
+    NK_FONT_PACK_MAXRECTS,
+    NK_FONT_PACK_HEURISTIC_COUNT
+};
+NK_INTERN int
+nk_font_bake_pack_try(struct nk_rp_rect *rects, int count, int heuristic,
+    int width, int height, int padding, struct nk_rp_node *nodes,
+    struct nk_rp_space *spaces, int space_capacity)
+{
+    int i, result = 0;
+    if (heuristic == NK_FONT_PACK_MAXRECTS) {
+        if (!nk_rp_pack_rects_maxrects(rects, count, width - padding,
+            height - padding, spaces, space_capacity))
+            return 0;
+    } else {
+        struct nk_rp_context context;
+        nk_rp_init_target(&context, width - padding, height - padding,
+            nodes, width - padding);
+        context.heuristic = heuristic;
+        nk_rp_pack_rects(&context, rects, count);
+    }
+    for (i = 0; i < count; ++i) {
+        if (!rects[i].was_packed) return 0;
+        result = NK_MAX(result, rects[i].y + rects[i].h);
+    }
+    return result;
+}
+NK_INTERN int
+nk_font_bake_pack_tight(struct nk_rp_rect *glyphs, int glyph_count,
+    struct nk_recti *custom, int padding, int default_width,
+    int *width, int *height, struct nk_allocator *alloc)
+{
+    NK_STORAGE const float scales[] = {1.0f, 1.125f, 1.25f, 1.5f, 2.0f, 0.0f};
+    NK_STORAGE const int max_size = 1024 * 32;
+    struct nk_rp_rect *rects, *trial;
+    struct nk_rp_node *nodes = 0;
+    struct nk_rp_space *spaces = 0;
+    int i, s, first = custom ? 1: 0;
+    int count = glyph_count + first;
+    int space_capacity = 8 * count + 64;
+    int min_width = 0, best_width = 0, best_height = 0;
+    float area = 0;
+
+    /* pack glyphs and custom data together so all heuristics see every rect */
+    rects = (struct nk_rp_rect*)alloc->alloc(alloc->userdata, 0,
+        sizeof(struct nk_rp_rect) * (nk_size)(count * 2));
+    if (!rects) return nk_false;
+    trial = rects + count;
+    if (custom) {
+        nk_zero(rects, sizeof(struct nk_rp_rect));
+        rects[0].w = (nk_rp_coord)custom->w;
+        rects[0].h = (nk_rp_coord)custom->h;
+    }
+    NK_MEMCPY(rects + first, glyphs, sizeof(struct nk_rp_rect) * (nk_size)glyph_count);
+    for (i = 0; i < count; ++i) {
+        area += (float)rects[i].w * (float)rects[i].h;
+        min_width = NK_MAX(min_width, rects[i].w + padding);
+    }
+    nodes = (struct nk_rp_node*)alloc->alloc(alloc->userdata, 0,
+        sizeof(struct nk_rp_node) * (nk_size)max_size);
+    if (count <= NK_FONT_PACK_MAXRECTS_LIMIT)
+        spaces = (struct nk_rp_space*)alloc->alloc(alloc->userdata, 0,
+            sizeof(struct nk_rp_space) * (nk_size)space_capacity);
+    if (!nodes) goto cleanup;
+
+    /* try widths around a square atlas as well as the default width and keep
+     * the combination of width and heuristic with the smallest area */
+    for (s = 0; s < (int)NK_LEN(scales); ++s) {
+        int heuristic, w, h, limit;
+        if (scales[s] > 0)
+            w = (int)(NK_SQRT(area) * scales[s]) + 1;
+        else w = default_width;
+        w = NK_CLAMP(min_width, (w + 7) & ~7, max_size);
+        for (heuristic = 0; heuristic < NK_FONT_PACK_HEURISTIC_COUNT; ++heuristic) {
+            if (heuristic == NK_FONT_PACK_MAXRECTS && !spaces) continue;
+            /* no need to search beyond the best area found so far */
+            limit = best_width ? NK_MIN(max_size, best_width * best_height / w + 1): max_size;
+            if (limit <= padding) continue;
+            NK_MEMCPY(trial, rects, sizeof(struct nk_rp_rect) * (nk_size)count);
+            h = nk_font_bake_pack_try(trial, count, heuristic, w, limit, padding,
+                    nodes, spaces, space_capacity);
+            if (!h) continue;
+            if (!best_width || w * h < best_width * best_height ||
+                (w * h == best_width * best_height && w + h < best_width + best_height)) {
+                best_width = w;
+                best_height = h;
+                NK_MEMCPY(glyphs, trial + first, sizeof(struct nk_rp_rect) * (nk_size)glyph_count);
+                if (custom) {
+                    custom->x = (short)trial[0].x;
+                    custom->y = (short)trial[0].y;
+                }
+            }
+        }
+    }
+    *width = best_width;
+    *height = best_height;
+
+cleanup:
+    if (spaces) alloc->free(alloc->userdata, spaces);
+    if (nodes) alloc->free(alloc->userdata, nodes);
+    alloc->free(alloc->userdata, rects);
+    return best_width != 0;
+}
 NK_INTERN int
 nk_font_bake_pack(struct nk_font_baker *baker,
     nk_size *image_memory, int *width, int *height, struct nk_recti *custom,
     const struct nk_font_config *config_list, int count,
-    struct nk_allocator *alloc)
+    enum nk_font_atlas_packing packing, struct nk_allocator *alloc)
 {
     NK_STORAGE const nk_size max_height = 1024 * 32;
     const struct nk_font_config *config_iter, *it;
@@ -12769,7 +16437,7 @@ nk_font_bake_pack(struct nk_font_baker *baker,
         int rect_n = 0;
         int char_n = 0;
 
-        if (custom) {
+        if (custom && packing == NK_FONT_ATLAS_PACK_DEFAULT) {
             /* pack custom user data first so it will be in the upper left corner*/
             struct nk_rp_rect custom_space;
             nk_zero(&custom_space, sizeof(custom_space));
@@ -12819,9 +16487,10 @@ nk_font_bake_pack(struct nk_font_baker *baker,
                 /* pack */
                 tmp->rects = baker->rects + rect_n;
                 rect_n += glyph_count;
-                nk_tt_PackSetOversampling(&baker->spc, cfg->oversample_h, cfg->oversample_v);
+                nk_font_bake_mode(&baker->spc, cfg);
                 n = nk_tt_PackFontRangesGatherRects(&baker->spc, &tmp->info,
                     tmp->ranges, (int)tmp->range_count, tmp->rects);
+                if (packing != NK_FONT_ATLAS_PACK_DEFAULT) continue;
                 nk_rp_pack_rects((struct nk_rp_context*)baker->spc.pack_info, tmp->rects, (int)n);
 
                 /* texture height */
@@ -12835,7 +16504,11 @@ nk_font_bake_pack(struct nk_font_baker *baker,
         NK_ASSERT(char_n == total_glyph_count);
         NK_ASSERT(range_n == total_range_count);
     }
-    *height = (int)nk_round_up_pow2((nk_uint)*height);
+    if (packing == NK_FONT_ATLAS_PACK_TIGHT) {
+        if (!nk_font_bake_pack_tight(baker->rects, total_glyph_count, custom,
+            baker->spc.padding, *width, width, height, alloc))
+            return nk_false;
+    } else *height = (int)nk_round_up_pow2((nk_uint)*height);
     *image_memory = (nk_size)(*width) * (nk_size)(*height);
     return nk_true;
 }
@@ -12863,13 +16536,15 @@ nk_font_bake(struct nk_font_baker *baker, void *image_memory, int width, int hei
     /* second font pass: render glyphs */
     nk_zero(image_memory, (nk_size)((nk_size)width * (nk_size)height));
     baker->spc.pixels = (unsigned char*)image_memory;
+    baker->spc.width = (int)width;
     baker->spc.height = (int)height;
+    baker->spc.stride_in_bytes = (int)width;
     for (input_i = 0, config_iter = config_list; input_i < font_count && config_iter;
         config_iter = config_iter->next) {
         it = config_iter;
         do {const struct nk_font_config *cfg = it;
             struct nk_font_bake_data *tmp = &baker->build[input_i++];
-            nk_tt_PackSetOversampling(&baker->spc, cfg->oversample_h, cfg->oversample_v);
+            nk_font_bake_mode(&baker->spc, cfg);
             nk_tt_PackFontRangesRenderIntoRects(&baker->spc, &tmp->info, tmp->ranges,
                 (int)tmp->range_count, tmp->rects, &baker->alloc);
         } while ((it = it->n) != config_iter);
@@ -12898,8 +16573,8 @@ nk_font_bake(struct nk_font_baker *baker, void *image_memory, int width, int hei
                 dst_font->ascent = ((float)unscaled_ascent * font_scale);
                 dst_font->descent = ((float)unscaled_descent * font_scale);
                 dst_font->glyph_offset = glyph_n;
-                // Need to zero this, or it will carry over from a previous
-                // bake, and cause a segfault when accessing glyphs[].
+                /* Need to zero this, or it will carry over from a previous
+                 * bake, and cause a segfault when accessing glyphs[]. */
                 dst_font->glyph_count = 0;
             }
 
@@ -13005,6 +16680,7 @@ nk_font_bake_convert(void *out_memory, int img_width, int img_height,
  *                          FONT
  *
  * --------------------------------------------------------------*/
+NK_INTERN const struct nk_font_glyph* nk_font_dynamic_find_locked(struct nk_font*, nk_rune);
 NK_INTERN float
 nk_font_text_width(nk_handle handle, float height, const char *text, int len)
 {
@@ -13016,7 +16692,7 @@ nk_font_text_width(nk_handle handle, float height, const char *text, int len)
 
     struct nk_font *font = (struct nk_font*)handle.ptr;
     NK_ASSERT(font);
-    NK_ASSERT(font->glyphs);
+    NK_ASSERT(font->glyphs || font->dynamic);
     if (!font || !text || !len)
         return 0;
 
@@ -13051,7 +16727,7 @@ nk_font_query_font_glyph(nk_handle handle, float height,
 
     font = (struct nk_font*)handle.ptr;
     NK_ASSERT(font);
-    NK_ASSERT(font->glyphs);
+    NK_ASSERT(font->glyphs || font->dynamic);
     if (!font || !glyph)
         return;
 
@@ -13075,6 +16751,8 @@ nk_font_find_glyph(struct nk_font *font, nk_rune unicode)
     const struct nk_font_config *iter = 0;
 
     NK_ASSERT(font);
+    if (font && font->dynamic)
+        return nk_font_dynamic_find_locked(font, unicode);
     NK_ASSERT(font->glyphs);
     NK_ASSERT(font->info.ranges);
     if (!font || !font->glyphs) return 0;
@@ -13710,15 +17388,55 @@ nk_font_atlas_add_default(struct nk_font_atlas *atlas,
         nk_proggy_clean_ttf_compressed_data_base85, pixel_height, config);
 }
 #endif
-NK_API const void*
-nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
-    enum nk_font_atlas_format fmt)
+NK_INTERN void
+nk_font_atlas_setup_cursors(struct nk_font_atlas *atlas)
 {
     int i = 0;
-    void *tmp = 0;
-    nk_size tmp_size, img_size;
+    {NK_STORAGE const struct nk_vec2 nk_cursor_data[NK_CURSOR_COUNT][3] = {
+        /* Pos      Size        Offset */
+        {{ 0, 3},   {12,19},    { 0, 0}},
+        {{13, 0},   { 7,16},    { 4, 8}},
+        {{31, 0},   {23,23},    {11,11}},
+        {{21, 0},   { 9, 23},   { 5,11}},
+        {{55,18},   {23, 9},    {11, 5}},
+        {{73, 0},   {17,17},    { 9, 9}},
+        {{55, 0},   {17,17},    { 9, 9}}
+    };
+    for (i = 0; i < NK_CURSOR_COUNT; ++i) {
+        struct nk_cursor *cursor = &atlas->cursors[i];
+        cursor->img.w = (unsigned short)atlas->tex_width;
+        cursor->img.h = (unsigned short)atlas->tex_height;
+        cursor->img.region[0] = (unsigned short)(atlas->custom.x + nk_cursor_data[i][0].x);
+        cursor->img.region[1] = (unsigned short)(atlas->custom.y + nk_cursor_data[i][0].y);
+        cursor->img.region[2] = (unsigned short)nk_cursor_data[i][1].x;
+        cursor->img.region[3] = (unsigned short)nk_cursor_data[i][1].y;
+        cursor->size = nk_cursor_data[i][1];
+        cursor->offset = nk_cursor_data[i][2];
+    }}
+}
+NK_INTERN void
+nk_font_atlas_setup(struct nk_font_atlas *atlas)
+{
     struct nk_font *font_iter;
-    struct nk_font_baker *baker;
+
+    /* initialize each font */
+    for (font_iter = atlas->fonts; font_iter; font_iter = font_iter->next) {
+        struct nk_font *font = font_iter;
+        struct nk_font_config *config = font->config;
+        nk_font_init(font, config->size, config->fallback_glyph, atlas->glyphs,
+            config->font, nk_handle_ptr(0));
+    }
+    nk_font_atlas_setup_cursors(atlas);
+}
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+NK_API const void*
+nk_font_atlas_bake_default(struct nk_font_atlas *atlas, int *width, int *height,
+    enum nk_font_atlas_format fmt)
+{
+    int i;
+    nk_size pixel_count;
+    struct nk_font *font;
+    struct nk_font_config *config;
 
     NK_ASSERT(atlas);
     NK_ASSERT(atlas->temporary.alloc);
@@ -13728,21 +17446,113 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
 
     NK_ASSERT(width);
     NK_ASSERT(height);
-    if (!atlas || !width || !height ||
+    NK_ASSERT(!atlas->font_num);
+    if (!atlas || !width || !height || atlas->font_num ||
         !atlas->temporary.alloc || !atlas->temporary.free ||
         !atlas->permanent.alloc || !atlas->permanent.free)
         return 0;
 
-#ifdef NK_INCLUDE_DEFAULT_FONT
-    /* no font added so just use default font */
-    if (!atlas->font_num)
-        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
-#endif
-    NK_ASSERT(atlas->font_num);
-    if (!atlas->font_num) return 0;
+    /* add default font without any font data since glyphs are already baked */
+    config = (struct nk_font_config*)atlas->permanent.alloc(atlas->permanent.userdata,0, sizeof(*config));
+    NK_ASSERT(config);
+    if (!config) return 0;
+    *config = nk_font_config(13.0f);
+    config->range = nk_default_font_atlas_ranges;
+    config->n = config->p = config;
+    atlas->config = config;
 
-    /* allocate temporary baker memory required for the baking process */
-    nk_font_baker_memory(&tmp_size, &atlas->glyph_count, atlas->config, atlas->font_num);
+    font = (struct nk_font*)atlas->permanent.alloc(atlas->permanent.userdata,0, sizeof(*font));
+    NK_ASSERT(font);
+    if (!font) return 0;
+    nk_zero(font, sizeof(*font));
+    font->config = config;
+    config->font = &font->info;
+    atlas->fonts = font;
+    atlas->font_num = 1;
+    atlas->default_font = font;
+
+    font->info.height = nk_default_font_atlas_metrics[0];
+    font->info.ascent = nk_default_font_atlas_metrics[1];
+    font->info.descent = nk_default_font_atlas_metrics[2];
+    font->info.glyph_offset = 0;
+    font->info.glyph_count = NK_DEFAULT_FONT_ATLAS_GLYPHS;
+    font->info.ranges = config->range;
+
+    /* copy glyphs and expand palette indices into the atlas image */
+    atlas->glyph_count = NK_DEFAULT_FONT_ATLAS_GLYPHS;
+    atlas->glyphs = (struct nk_font_glyph*)atlas->permanent.alloc(
+        atlas->permanent.userdata,0, sizeof(nk_default_font_atlas_glyphs));
+    NK_ASSERT(atlas->glyphs);
+    if (!atlas->glyphs) return 0;
+    NK_MEMCPY(atlas->glyphs, nk_default_font_atlas_glyphs, sizeof(nk_default_font_atlas_glyphs));
+
+    pixel_count = (nk_size)NK_DEFAULT_FONT_ATLAS_WIDTH * (nk_size)NK_DEFAULT_FONT_ATLAS_HEIGHT;
+    atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0,
+        (fmt == NK_FONT_ATLAS_RGBA32) ? pixel_count * 4: pixel_count);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas->pixel) return 0;
+    if (fmt == NK_FONT_ATLAS_RGBA32) {
+        nk_rune *dst = (nk_rune*)atlas->pixel;
+        for (i = 0; i < (int)pixel_count; ++i) {
+            nk_uint index = (nk_default_font_atlas_pixels[i >> 4] >> ((i & 15) * 2)) & 3;
+            dst[i] = ((nk_rune)nk_default_font_atlas_palette[index] << 24) | 0x00FFFFFF;
+        }
+    } else {
+        nk_byte *dst = (nk_byte*)atlas->pixel;
+        for (i = 0; i < (int)pixel_count; ++i) {
+            nk_uint index = (nk_default_font_atlas_pixels[i >> 4] >> ((i & 15) * 2)) & 3;
+            dst[i] = nk_default_font_atlas_palette[index];
+        }
+    }
+    atlas->custom.x = nk_default_font_atlas_custom[0];
+    atlas->custom.y = nk_default_font_atlas_custom[1];
+    atlas->custom.w = nk_default_font_atlas_custom[2];
+    atlas->custom.h = nk_default_font_atlas_custom[3];
+    atlas->tex_width = *width = NK_DEFAULT_FONT_ATLAS_WIDTH;
+    atlas->tex_height = *height = NK_DEFAULT_FONT_ATLAS_HEIGHT;
+    atlas->used_pixels = NK_DEFAULT_FONT_ATLAS_USED;
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
+    return atlas->pixel;
+}
+#endif
+NK_API const void*
+nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
+    enum nk_font_atlas_format fmt)
+{
+    int i;
+    void *tmp = 0;
+    nk_size tmp_size, img_size;
+    struct nk_font_baker *baker;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+
+    NK_ASSERT(width);
+    NK_ASSERT(height);
+    if (!atlas || !width || !height ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+    /* no font added so just use the pre-baked default font */
+    if (!atlas->font_num)
+        return nk_font_atlas_bake_default(atlas, width, height, fmt);
+#elif defined(NK_INCLUDE_DEFAULT_FONT)
+    /* no font added so just use default font */
+    if (!atlas->font_num)
+        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
+#endif
+    NK_ASSERT(atlas->font_num);
+    if (!atlas->font_num) return 0;
+    NK_PROFILE_BEGIN(atlas->profiler, NK_PROFILE_FONT_BAKE);
+
+    /* allocate temporary baker memory required for the baking process */
+    nk_font_baker_memory(&tmp_size, &atlas->glyph_count, atlas->config, atlas->font_num);
     tmp = atlas->temporary.alloc(atlas->temporary.userdata,0, tmp_size);
     NK_ASSERT(tmp);
     if (!tmp) goto failed;
@@ -13759,8 +17569,11 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
     atlas->custom.w = (NK_CURSOR_DATA_W*2)+1;
     atlas->custom.h = NK_CURSOR_DATA_H + 1;
     if (!nk_font_bake_pack(baker, &img_size, width, height, &atlas->custom,
-        atlas->config, atlas->font_num, &atlas->temporary))
+        atlas->config, atlas->font_num, atlas->packing, &atlas->temporary))
         goto failed;
+    atlas->used_pixels = (nk_size)atlas->custom.w * (nk_size)atlas->custom.h;
+    for (i = 0; i < atlas->glyph_count; ++i)
+        atlas->used_pixels += (nk_size)baker->rects[i].w * (nk_size)baker->rects[i].h;
 
     /* allocate memory for the baked image font atlas */
     atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0, img_size);
@@ -13786,39 +17599,12 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
     }
     atlas->tex_width = *width;
     atlas->tex_height = *height;
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
 
-    /* initialize each font */
-    for (font_iter = atlas->fonts; font_iter; font_iter = font_iter->next) {
-        struct nk_font *font = font_iter;
-        struct nk_font_config *config = font->config;
-        nk_font_init(font, config->size, config->fallback_glyph, atlas->glyphs,
-            config->font, nk_handle_ptr(0));
-    }
-
-    /* initialize each cursor */
-    {NK_STORAGE const struct nk_vec2 nk_cursor_data[NK_CURSOR_COUNT][3] = {
-        /* Pos      Size        Offset */
-        {{ 0, 3},   {12,19},    { 0, 0}},
-        {{13, 0},   { 7,16},    { 4, 8}},
-        {{31, 0},   {23,23},    {11,11}},
-        {{21, 0},   { 9, 23},   { 5,11}},
-        {{55,18},   {23, 9},    {11, 5}},
-        {{73, 0},   {17,17},    { 9, 9}},
-        {{55, 0},   {17,17},    { 9, 9}}
-    };
-    for (i = 0; i < NK_CURSOR_COUNT; ++i) {
-        struct nk_cursor *cursor = &atlas->cursors[i];
-        cursor->img.w = (unsigned short)*width;
-        cursor->img.h = (unsigned short)*height;
-        cursor->img.region[0] = (unsigned short)(atlas->custom.x + nk_cursor_data[i][0].x);
-        cursor->img.region[1] = (unsigned short)(atlas->custom.y + nk_cursor_data[i][0].y);
-        cursor->img.region[2] = (unsigned short)nk_cursor_data[i][1].x;
-        cursor->img.region[3] = (unsigned short)nk_cursor_data[i][1].y;
-        cursor->size = nk_cursor_data[i][1];
-        cursor->offset = nk_cursor_data[i][2];
-    }}
     /* free temporary memory */
     atlas->temporary.free(atlas->temporary.userdata, tmp);
+    NK_PROFILE_END(atlas->profiler, NK_PROFILE_FONT_BAKE);
     return atlas->pixel;
 
 failed:
@@ -13832,8 +17618,894 @@ failed:
         atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
         atlas->pixel = 0;
     }
+    NK_PROFILE_END(atlas->profiler, NK_PROFILE_FONT_BAKE);
+    return 0;
+}
+NK_API int
+nk_font_atlas_get_stats(const struct nk_font_atlas *atlas,
+    struct nk_font_atlas_stats *stats)
+{
+    nk_size pixel_size;
+    NK_ASSERT(atlas);
+    NK_ASSERT(stats);
+    if (!stats) return 0;
+    nk_zero_struct(*stats);
+    if (!atlas || atlas->dynamic || !atlas->tex_width || !atlas->tex_height)
+        return 0;
+
+    pixel_size = (atlas->format == NK_FONT_ATLAS_RGBA32) ? 4: 1;
+    stats->width = atlas->tex_width;
+    stats->height = atlas->tex_height;
+    stats->texture_bytes = (nk_size)atlas->tex_width * (nk_size)atlas->tex_height * pixel_size;
+    stats->used_bytes = NK_MIN(atlas->used_pixels * pixel_size, stats->texture_bytes);
+    stats->wasted_bytes = stats->texture_bytes - stats->used_bytes;
+    stats->utilization = (float)stats->used_bytes / (float)stats->texture_bytes;
+    return 1;
+}
+/* -------------------------------------------------------------
+ *
+ *                          FONT ATLAS CACHE
+ *
+ * --------------------------------------------------------------*/
+/* Baked atlas blob layout, all values in native byte order:
+ *  header      nk_uint[NK_FONT_CACHE_HEADER]
+ *  fonts       nk_uint[5] (height, ascent, descent, glyph offset, glyph count)
+ *  ranges      nk_rune[] of each font config including zero terminator
+ *  glyphs      struct nk_font_glyph[glyph count]
+ *  pixels      nk_byte[width * height * (1 or 4)] */
+#define NK_FONT_CACHE_MAGIC 0x41464B4E
+#define NK_FONT_ATLAS_CACHE_VERSION 2
+enum nk_font_cache_header {
+    NK_FONT_CACHE_MAGIC_ID, NK_FONT_CACHE_VERSION_ID, NK_FONT_CACHE_HASH,
+    NK_FONT_CACHE_FORMAT, NK_FONT_CACHE_WIDTH, NK_FONT_CACHE_HEIGHT,
+    NK_FONT_CACHE_CUSTOM_X, NK_FONT_CACHE_CUSTOM_Y,
+    NK_FONT_CACHE_CUSTOM_W, NK_FONT_CACHE_CUSTOM_H,
+    NK_FONT_CACHE_FONTS, NK_FONT_CACHE_RANGES, NK_FONT_CACHE_GLYPHS,
+    NK_FONT_CACHE_USED, NK_FONT_CACHE_HEADER
+};
+NK_INTERN void
+nk_font_cache_layout(nk_size *offsets, int font_count, int range_count,
+    int glyph_count, int width, int height, enum nk_font_atlas_format fmt)
+{
+    /* offsets of fonts, ranges, glyphs, pixels and end of blob */
+    offsets[0] = sizeof(nk_uint) * NK_FONT_CACHE_HEADER;
+    offsets[1] = offsets[0] + sizeof(nk_uint) * 5 * (nk_size)font_count;
+    offsets[2] = offsets[1] + sizeof(nk_rune) * (nk_size)range_count;
+    offsets[3] = offsets[2] + sizeof(struct nk_font_glyph) * (nk_size)glyph_count;
+    offsets[4] = offsets[3] + (nk_size)width * (nk_size)height *
+        ((fmt == NK_FONT_ATLAS_RGBA32) ? 4: 1);
+}
+NK_INTERN int
+nk_font_cache_ranges(const struct nk_font_atlas *atlas)
+{
+    int count = 0;
+    const struct nk_font_config *iter, *it;
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {count += nk_range_count(it->range) * 2 + 1;
+        } while ((it = it->n) != iter);
+    }
+    return count;
+}
+NK_INTERN int
+nk_font_cache_glyphs(const struct nk_font_atlas *atlas)
+{
+    int count = 0;
+    const struct nk_font *font;
+    for (font = atlas->fonts; font; font = font->next)
+        count = NK_MAX(count, (int)(font->info.glyph_offset + font->info.glyph_count));
+    return count;
+}
+NK_API nk_hash
+nk_font_atlas_hash(const struct nk_font_atlas *atlas, enum nk_font_atlas_format fmt)
+{
+    nk_hash hash = NK_FONT_ATLAS_CACHE_VERSION;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    if (!atlas) return 0;
+    hash = nk_murmur_hash(&fmt, (int)sizeof(fmt), hash);
+    hash = nk_murmur_hash(&atlas->packing, (int)sizeof(atlas->packing), hash);
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {/* font data and every config value that changes the baked output */
+            hash = nk_murmur_hash(it->ttf_blob, (int)it->ttf_size, hash);
+            hash = nk_murmur_hash(&it->merge_mode, 1, hash);
+            hash = nk_murmur_hash(&it->pixel_snap, 1, hash);
+            hash = nk_murmur_hash(&it->oversample_v, 1, hash);
+            hash = nk_murmur_hash(&it->oversample_h, 1, hash);
+            hash = nk_murmur_hash(&it->sdf, 1, hash);
+            hash = nk_murmur_hash(&it->size, (int)sizeof(it->size), hash);
+            hash = nk_murmur_hash(&it->coord_type, (int)sizeof(it->coord_type), hash);
+            hash = nk_murmur_hash(&it->spacing, (int)sizeof(it->spacing), hash);
+            hash = nk_murmur_hash(&it->fallback_glyph, (int)sizeof(it->fallback_glyph), hash);
+            hash = nk_murmur_hash(it->range, (int)sizeof(nk_rune) *
+                (nk_range_count(it->range) * 2 + 1), hash);
+        } while ((it = it->n) != iter);
+    }
+    return hash;
+}
+NK_API nk_size
+nk_font_atlas_save(const struct nk_font_atlas *atlas, void *memory, nk_size size)
+{
+    int i = 0;
+    nk_uint header[NK_FONT_CACHE_HEADER];
+    nk_size offsets[5];
+    int font_count = 0;
+    int range_count;
+    int glyph_count;
+    nk_byte *dst = (nk_byte*)memory;
+    const struct nk_font *font;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas || !atlas->pixel || !atlas->glyphs) return 0;
+
+    for (font = atlas->fonts; font; font = font->next)
+        font_count++;
+    range_count = nk_font_cache_ranges(atlas);
+    glyph_count = nk_font_cache_glyphs(atlas);
+    nk_font_cache_layout(offsets, font_count, range_count, glyph_count,
+        atlas->tex_width, atlas->tex_height, atlas->format);
+    if (!memory || size < offsets[4])
+        return offsets[4];
+
+    header[NK_FONT_CACHE_MAGIC_ID] = NK_FONT_CACHE_MAGIC;
+    header[NK_FONT_CACHE_VERSION_ID] = NK_FONT_ATLAS_CACHE_VERSION;
+    header[NK_FONT_CACHE_HASH] = nk_font_atlas_hash(atlas, atlas->format);
+    header[NK_FONT_CACHE_FORMAT] = (nk_uint)atlas->format;
+    header[NK_FONT_CACHE_WIDTH] = (nk_uint)atlas->tex_width;
+    header[NK_FONT_CACHE_HEIGHT] = (nk_uint)atlas->tex_height;
+    header[NK_FONT_CACHE_CUSTOM_X] = (nk_uint)atlas->custom.x;
+    header[NK_FONT_CACHE_CUSTOM_Y] = (nk_uint)atlas->custom.y;
+    header[NK_FONT_CACHE_CUSTOM_W] = (nk_uint)atlas->custom.w;
+    header[NK_FONT_CACHE_CUSTOM_H] = (nk_uint)atlas->custom.h;
+    header[NK_FONT_CACHE_FONTS] = (nk_uint)font_count;
+    header[NK_FONT_CACHE_RANGES] = (nk_uint)range_count;
+    header[NK_FONT_CACHE_GLYPHS] = (nk_uint)glyph_count;
+    header[NK_FONT_CACHE_USED] = (nk_uint)atlas->used_pixels;
+    NK_MEMCPY(dst, header, sizeof(header));
+
+    for (font = atlas->fonts; font; font = font->next, ++i) {
+        nk_uint info[5];
+        NK_MEMCPY(&info[0], &font->info.height, sizeof(nk_uint));
+        NK_MEMCPY(&info[1], &font->info.ascent, sizeof(nk_uint));
+        NK_MEMCPY(&info[2], &font->info.descent, sizeof(nk_uint));
+        info[3] = font->info.glyph_offset;
+        info[4] = font->info.glyph_count;
+        NK_MEMCPY(dst + offsets[0] + sizeof(info) * (nk_size)i, info, sizeof(info));
+    }
+    dst += offsets[1];
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {nk_size n = sizeof(nk_rune) * (nk_size)(nk_range_count(it->range) * 2 + 1);
+            NK_MEMCPY(dst, it->range, n);
+            dst += n;
+        } while ((it = it->n) != iter);
+    }
+    dst = (nk_byte*)memory;
+    NK_MEMCPY(dst + offsets[2], atlas->glyphs, offsets[3] - offsets[2]);
+    NK_MEMCPY(dst + offsets[3], atlas->pixel, offsets[4] - offsets[3]);
+    return offsets[4];
+}
+NK_API const void*
+nk_font_atlas_load(struct nk_font_atlas *atlas, const void *memory, nk_size size,
+    int *width, int *height, enum nk_font_atlas_format fmt)
+{
+    int i = 0;
+    nk_uint header[NK_FONT_CACHE_HEADER];
+    nk_size offsets[5];
+    int font_count = 0;
+    const nk_byte *src = (const nk_byte*)memory;
+    struct nk_font *font;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+
+    NK_ASSERT(width);
+    NK_ASSERT(height);
+    if (!atlas || !width || !height || !memory ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+#ifdef NK_INCLUDE_DEFAULT_FONT
+    /* no font added so just use default font */
+    if (!atlas->font_num)
+        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
+#endif
+    if (!atlas->font_num || size < sizeof(header)) return 0;
+
+    /* validate blob against currently added fonts */
+    NK_MEMCPY(header, src, sizeof(header));
+    for (font = atlas->fonts; font; font = font->next)
+        font_count++;
+    if (header[NK_FONT_CACHE_MAGIC_ID] != NK_FONT_CACHE_MAGIC ||
+        header[NK_FONT_CACHE_VERSION_ID] != NK_FONT_ATLAS_CACHE_VERSION ||
+        header[NK_FONT_CACHE_FORMAT] != (nk_uint)fmt ||
+        header[NK_FONT_CACHE_FONTS] != (nk_uint)font_count ||
+        header[NK_FONT_CACHE_RANGES] != (nk_uint)nk_font_cache_ranges(atlas) ||
+        header[NK_FONT_CACHE_HASH] != nk_font_atlas_hash(atlas, fmt))
+        return 0;
+    nk_font_cache_layout(offsets, font_count, (int)header[NK_FONT_CACHE_RANGES],
+        (int)header[NK_FONT_CACHE_GLYPHS], (int)header[NK_FONT_CACHE_WIDTH],
+        (int)header[NK_FONT_CACHE_HEIGHT], fmt);
+    if (size < offsets[4]) return 0;
+    {const nk_byte *ranges = src + offsets[1];
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {int n = nk_range_count(it->range) * 2 + 1;
+            int j;
+            for (j = 0; j < n; ++j) {
+                nk_rune r;
+                NK_MEMCPY(&r, ranges, sizeof(r));
+                if (r != it->range[j]) return 0;
+                ranges += sizeof(r);
+            }
+        } while ((it = it->n) != iter);
+    }}
+
+    /* glyph ranges of each font and the custom rectangle have to lie inside
+     * the glyphs and texture of the blob */
+    for (i = 0; i < font_count; ++i) {
+        nk_uint info[5];
+        NK_MEMCPY(info, src + offsets[0] + sizeof(info) * (nk_size)i, sizeof(info));
+        if (info[3] > header[NK_FONT_CACHE_GLYPHS] ||
+            info[4] > header[NK_FONT_CACHE_GLYPHS] - info[3])
+            return 0;
+    }
+    if (header[NK_FONT_CACHE_CUSTOM_X] > header[NK_FONT_CACHE_WIDTH] ||
+        header[NK_FONT_CACHE_CUSTOM_W] > header[NK_FONT_CACHE_WIDTH] - header[NK_FONT_CACHE_CUSTOM_X] ||
+        header[NK_FONT_CACHE_CUSTOM_Y] > header[NK_FONT_CACHE_HEIGHT] ||
+        header[NK_FONT_CACHE_CUSTOM_H] > header[NK_FONT_CACHE_HEIGHT] - header[NK_FONT_CACHE_CUSTOM_Y])
+        return 0;
+
+    /* replace glyphs and pixels of an earlier bake or load */
+    if (atlas->glyphs) {
+        atlas->permanent.free(atlas->permanent.userdata, atlas->glyphs);
+        atlas->glyphs = 0;
+    }
+    if (atlas->pixel) {
+        atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
+        atlas->pixel = 0;
+    }
+
+    /* copy glyphs and pixels into the same memory as baking would */
+    atlas->glyph_count = (int)header[NK_FONT_CACHE_GLYPHS];
+    atlas->glyphs = (struct nk_font_glyph*)atlas->permanent.alloc(atlas->permanent.userdata,0,
+        NK_MAX(offsets[3] - offsets[2], sizeof(struct nk_font_glyph)));
+    NK_ASSERT(atlas->glyphs);
+    if (!atlas->glyphs) return 0;
+    atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0, offsets[4] - offsets[3]);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas->pixel) {
+        atlas->permanent.free(atlas->permanent.userdata, atlas->glyphs);
+        atlas->glyphs = 0;
+        return 0;
+    }
+    NK_MEMCPY(atlas->glyphs, src + offsets[2], offsets[3] - offsets[2]);
+    NK_MEMCPY(atlas->pixel, src + offsets[3], offsets[4] - offsets[3]);
+
+    for (i = 0, font = atlas->fonts; font; font = font->next, ++i) {
+        nk_uint info[5];
+        struct nk_baked_font *baked = font->config->font;
+        NK_MEMCPY(info, src + offsets[0] + sizeof(info) * (nk_size)i, sizeof(info));
+        NK_MEMCPY(&baked->height, &info[0], sizeof(nk_uint));
+        NK_MEMCPY(&baked->ascent, &info[1], sizeof(nk_uint));
+        NK_MEMCPY(&baked->descent, &info[2], sizeof(nk_uint));
+        baked->glyph_offset = info[3];
+        baked->glyph_count = info[4];
+        baked->ranges = font->config->range;
+    }
+    atlas->custom.x = (short)header[NK_FONT_CACHE_CUSTOM_X];
+    atlas->custom.y = (short)header[NK_FONT_CACHE_CUSTOM_Y];
+    atlas->custom.w = (short)header[NK_FONT_CACHE_CUSTOM_W];
+    atlas->custom.h = (short)header[NK_FONT_CACHE_CUSTOM_H];
+    atlas->tex_width = *width = (int)header[NK_FONT_CACHE_WIDTH];
+    atlas->tex_height = *height = (int)header[NK_FONT_CACHE_HEIGHT];
+    atlas->used_pixels = (nk_size)header[NK_FONT_CACHE_USED];
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
+    return atlas->pixel;
+}
+#ifdef NK_INCLUDE_STANDARD_IO
+NK_API int
+nk_font_atlas_save_to_file(const struct nk_font_atlas *atlas, const char *file_path)
+{
+    FILE *fd;
+    void *memory;
+    nk_size size;
+    int ret;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(file_path);
+    if (!atlas || !file_path) return 0;
+    size = nk_font_atlas_save(atlas, 0, 0);
+    if (!size) return 0;
+    memory = atlas->temporary.alloc(atlas->temporary.userdata,0, size);
+    NK_ASSERT(memory);
+    if (!memory) return 0;
+    nk_font_atlas_save(atlas, memory, size);
+
+    fd = fopen(file_path, "wb");
+    ret = fd && fwrite(memory, 1, size, fd) == size;
+    if (fd && fclose(fd)) ret = 0;
+    atlas->temporary.free(atlas->temporary.userdata, memory);
+    return ret;
+}
+NK_API const void*
+nk_font_atlas_load_from_file(struct nk_font_atlas *atlas, const char *file_path,
+    int *width, int *height, enum nk_font_atlas_format fmt)
+{
+    nk_size size;
+    char *memory;
+    const void *pixel;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(file_path);
+    if (!atlas || !file_path) return 0;
+    memory = nk_file_load(file_path, &size, &atlas->temporary);
+    if (!memory) return 0;
+    pixel = nk_font_atlas_load(atlas, memory, size, width, height, fmt);
+    atlas->temporary.free(atlas->temporary.userdata, memory);
+    return pixel;
+}
+#endif
+
+/* -------------------------------------------------------------
+ *
+ *                          DYNAMIC GLYPHS
+ *
+ * --------------------------------------------------------------*/
+/* The dynamic atlas texture is split into horizontal pages each packed with
+ * its own skyline. Glyphs are rasterized on first use. Texture space is
+ * reclaimed a page at a time starting with the least recently used page,
+ * while running out of glyph slots only evicts the least recently used glyph.
+ * Glyphs used in the current frame are never evicted. Cached glyphs are kept
+ * in a list ordered by last use and removed from the open addressing table by
+ * shifting following entries back, so eviction never rebuilds the table. */
+struct nk_font_dynamic_source {
+    const struct nk_font_config *config;
+    struct nk_tt_fontinfo info;
+};
+struct nk_font_dynamic_glyph {
+    struct nk_font_glyph glyph;
+    const struct nk_font *font;
+    unsigned int used;
+    int page;
+    int failed;
+    int prev, next;
+};
+struct nk_font_dynamic_page {
+    struct nk_rp_context pack;
+    struct nk_rp_node *nodes;
+    int y, h;
+    int rect_count;
+    unsigned int used;
+    int dirty;
+    int dirty_x0, dirty_y0, dirty_x1, dirty_y1;
+};
+struct nk_font_dynamic {
+    struct nk_font_atlas *atlas;
+    struct nk_font_dynamic_source *sources;
+    int source_count;
+    struct nk_font_dynamic_glyph *glyphs;
+    int glyph_capacity;
+    int glyph_count;
+    int free_list;
+    int lru_first, lru_last;
+    int *table;
+    int table_size;
+    struct nk_font_dynamic_page pages[NK_FONT_DYNAMIC_PAGES];
+    nk_byte *alpha;
+    unsigned int frame;
+    struct nk_font_glyph empty;
+};
+NK_INTERN nk_hash
+nk_font_dynamic_hash(const struct nk_font *font, nk_rune unicode)
+{
+    return ((nk_hash)unicode * 2654435761u) ^ (nk_hash)((nk_ptr)font >> 4);
+}
+NK_INTERN void
+nk_font_dynamic_mark(struct nk_font_dynamic_page *page, int x, int y, int w, int h)
+{
+    if (!page->dirty) {
+        page->dirty_x0 = x; page->dirty_y0 = y;
+        page->dirty_x1 = x + w; page->dirty_y1 = y + h;
+        page->dirty = nk_true;
+    } else {
+        page->dirty_x0 = NK_MIN(page->dirty_x0, x);
+        page->dirty_y0 = NK_MIN(page->dirty_y0, y);
+        page->dirty_x1 = NK_MAX(page->dirty_x1, x + w);
+        page->dirty_y1 = NK_MAX(page->dirty_y1, y + h);
+    }
+}
+NK_INTERN void
+nk_font_dynamic_upload(struct nk_font_dynamic *dyn, int x, int y, int w, int h)
+{
+    /* copy rasterized alpha values into the rgba texture */
+    int i, j;
+    struct nk_font_atlas *atlas = dyn->atlas;
+    if (atlas->format != NK_FONT_ATLAS_RGBA32) return;
+    for (j = y; j < y + h; ++j) {
+        nk_rune *dst = (nk_rune*)atlas->pixel + j * atlas->tex_width + x;
+        const nk_byte *src = dyn->alpha + j * atlas->tex_width + x;
+        for (i = 0; i < w; ++i)
+            *dst++ = ((nk_rune)(*src++) << 24) | 0x00FFFFFF;
+    }
+}
+NK_INTERN void
+nk_font_dynamic_reset_page(struct nk_font_dynamic *dyn, int index)
+{
+    struct nk_font_atlas *atlas = dyn->atlas;
+    struct nk_font_dynamic_page *page = &dyn->pages[index];
+    int width = atlas->tex_width;
+
+    page->rect_count = 0;
+    NK_MEMSET(dyn->alpha + page->y * width, 0, (nk_size)(page->h * width));
+    nk_rp_init_target(&page->pack, width - 1, page->h - 1, page->nodes, width - 1);
+    if (index == 0) {
+        /* custom cursor data always stays in the upper left corner */
+        struct nk_rp_rect custom;
+        nk_zero(&custom, sizeof(custom));
+        custom.w = (nk_rp_coord)atlas->custom.w;
+        custom.h = (nk_rp_coord)atlas->custom.h;
+        nk_rp_pack_rects(&page->pack, &custom, 1);
+        atlas->custom.x = (short)custom.x;
+        atlas->custom.y = (short)custom.y;
+        nk_font_bake_custom_data(dyn->alpha, width, atlas->tex_height, atlas->custom,
+            nk_custom_cursor_data, NK_CURSOR_DATA_W, NK_CURSOR_DATA_H, '.', 'X');
+    }
+    nk_font_dynamic_upload(dyn, 0, page->y, width, page->h);
+    nk_font_dynamic_mark(page, 0, page->y, width, page->h);
+}
+NK_INTERN void
+nk_font_dynamic_insert(struct nk_font_dynamic *dyn, int slot)
+{
+    const struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_hash i = nk_font_dynamic_hash(g->font, g->glyph.codepoint);
+    nk_hash mask = (nk_hash)dyn->table_size - 1;
+    while (dyn->table[i & mask] >= 0) i++;
+    dyn->table[i & mask] = slot;
+}
+NK_INTERN void
+nk_font_dynamic_erase(struct nk_font_dynamic *dyn, int slot)
+{
+    const struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_hash mask = (nk_hash)dyn->table_size - 1;
+    nk_hash hole = nk_font_dynamic_hash(g->font, g->glyph.codepoint) & mask;
+    nk_hash i;
+    while (dyn->table[hole] != slot)
+        hole = (hole + 1) & mask;
+
+    /* move following entries of the probe sequence back into the hole unless
+     * their own hash position lies between the hole and their position */
+    for (i = (hole + 1) & mask; dyn->table[i] >= 0; i = (i + 1) & mask) {
+        const struct nk_font_dynamic_glyph *o = &dyn->glyphs[dyn->table[i]];
+        nk_hash home = nk_font_dynamic_hash(o->font, o->glyph.codepoint) & mask;
+        if (((i - home) & mask) < ((i - hole) & mask)) continue;
+        dyn->table[hole] = dyn->table[i];
+        hole = i;
+    }
+    dyn->table[hole] = -1;
+}
+NK_INTERN void
+nk_font_dynamic_unlink(struct nk_font_dynamic *dyn, int slot)
+{
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    if (g->prev >= 0) dyn->glyphs[g->prev].next = g->next;
+    else dyn->lru_first = g->next;
+    if (g->next >= 0) dyn->glyphs[g->next].prev = g->prev;
+    else dyn->lru_last = g->prev;
+}
+NK_INTERN void
+nk_font_dynamic_append(struct nk_font_dynamic *dyn, int slot)
+{
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    g->prev = dyn->lru_last;
+    g->next = -1;
+    if (dyn->lru_last >= 0) dyn->glyphs[dyn->lru_last].next = slot;
+    else dyn->lru_first = slot;
+    dyn->lru_last = slot;
+}
+NK_INTERN void
+nk_font_dynamic_touch(struct nk_font_dynamic *dyn, int slot)
+{
+    /* glyphs used in the current frame end up behind all others */
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    g->used = dyn->frame;
+    dyn->pages[g->page].used = dyn->frame;
+    if (dyn->lru_last == slot) return;
+    nk_font_dynamic_unlink(dyn, slot);
+    nk_font_dynamic_append(dyn, slot);
+}
+NK_INTERN void
+nk_font_dynamic_remove(struct nk_font_dynamic *dyn, int slot)
+{
+    /* glyph pixels stay until their page is reused */
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_font_dynamic_erase(dyn, slot);
+    nk_font_dynamic_unlink(dyn, slot);
+    g->page = -1;
+    g->prev = -1;
+    g->next = dyn->free_list;
+    dyn->free_list = slot;
+    dyn->glyph_count--;
+}
+NK_INTERN int
+nk_font_dynamic_evict(struct nk_font_dynamic *dyn)
+{
+    int i, next, page = -1;
+    /* never evict glyphs already handed out during the current frame */
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        if (dyn->pages[i].used == dyn->frame || !dyn->pages[i].rect_count) continue;
+        if (page < 0 || dyn->pages[i].used < dyn->pages[page].used)
+            page = i;
+    }
+    if (page < 0) return -1;
+    for (i = dyn->lru_first; i >= 0; i = next) {
+        next = dyn->glyphs[i].next;
+        if (dyn->glyphs[i].page == page)
+            nk_font_dynamic_remove(dyn, i);
+    }
+    nk_font_dynamic_reset_page(dyn, page);
+    return page;
+}
+NK_INTERN int
+nk_font_dynamic_evict_glyph(struct nk_font_dynamic *dyn)
+{
+    int slot = dyn->lru_first;
+    if (slot < 0 || dyn->glyphs[slot].used == dyn->frame)
+        return nk_false;
+    nk_font_dynamic_remove(dyn, slot);
+    return nk_true;
+}
+NK_INTERN const struct nk_font_dynamic_source*
+nk_font_dynamic_source_for(const struct nk_font_dynamic *dyn,
+    const struct nk_font *font, nk_rune unicode)
+{
+    int i, j;
+    const struct nk_font_config *iter = font->config;
+    do {const nk_rune *range = iter->range;
+        for (i = 0; range[i] && range[i+1]; i += 2) {
+            if (unicode < range[i] || unicode > range[i+1]) continue;
+            for (j = 0; j < dyn->source_count; ++j)
+                if (dyn->sources[j].config == iter)
+                    return &dyn->sources[j];
+        }
+    } while ((iter = iter->n) != font->config);
     return 0;
 }
+NK_INTERN int
+nk_font_dynamic_rasterize(struct nk_font_dynamic *dyn, const struct nk_font *font,
+    const struct nk_font_dynamic_source *src, nk_rune unicode,
+    struct nk_font_glyph *glyph, int *packed)
+{
+    int i, page = -1;
+    float dummy_x = 0, dummy_y = 0;
+    struct nk_font_atlas *atlas = dyn->atlas;
+    const struct nk_font_config *cfg = src->config;
+    struct nk_tt_pack_context spc;
+    struct nk_tt_pack_range range;
+    struct nk_tt_packedchar pc;
+    struct nk_tt_aligned_quad q;
+    struct nk_rp_rect rect;
+
+    nk_zero(&spc, sizeof(spc));
+    spc.width = atlas->tex_width;
+    spc.height = atlas->tex_height;
+    spc.stride_in_bytes = atlas->tex_width;
+    spc.padding = 1;
+    spc.pixels = dyn->alpha;
+    nk_font_bake_mode(&spc, cfg);
+
+    nk_zero(&range, sizeof(range));
+    nk_zero(&pc, sizeof(pc));
+    nk_zero(&rect, sizeof(rect));
+    range.font_size = cfg->size;
+    range.first_unicode_codepoint_in_range = (int)unicode;
+    range.num_chars = 1;
+    range.chardata_for_range = &pc;
+    nk_tt_PackFontRangesGatherRects(&spc, (struct nk_tt_fontinfo*)&src->info, &range, 1, &rect);
+
+    /* pack into any page with free skyline space or evict the oldest page */
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES && page < 0; ++i) {
+        nk_rp_pack_rects(&dyn->pages[i].pack, &rect, 1);
+        if (rect.was_packed) page = i;
+    }
+    while (page < 0) {
+        i = nk_font_dynamic_evict(dyn);
+        if (i < 0) return nk_false;
+        nk_rp_pack_rects(&dyn->pages[i].pack, &rect, 1);
+        if (rect.was_packed) page = i;
+    }
+    *packed = page;
+    rect.y = (nk_rp_coord)(rect.y + dyn->pages[page].y);
+    nk_tt_PackFontRangesRenderIntoRects(&spc, (struct nk_tt_fontinfo*)&src->info,
+        &range, 1, &rect, &atlas->temporary);
+    if (!pc.x0 && !pc.x1 && !pc.y0 && !pc.y1) return nk_false;
+    dyn->pages[page].rect_count++;
+    nk_font_dynamic_upload(dyn, rect.x, rect.y, rect.w, rect.h);
+    nk_font_dynamic_mark(&dyn->pages[page], rect.x, rect.y, rect.w, rect.h);
+
+    /* same glyph setup as the static baker */
+    nk_tt_GetPackedQuad(&pc, atlas->tex_width, atlas->tex_height, 0, &dummy_x, &dummy_y, &q, 0);
+    glyph->codepoint = unicode;
+    glyph->x0 = q.x0; glyph->y0 = q.y0;
+    glyph->x1 = q.x1; glyph->y1 = q.y1;
+    glyph->y0 += (font->info.ascent + 0.5f);
+    glyph->y1 += (font->info.ascent + 0.5f);
+    glyph->w = glyph->x1 - glyph->x0 + 0.5f;
+    glyph->h = glyph->y1 - glyph->y0;
+    if (cfg->coord_type == NK_COORD_PIXEL) {
+        glyph->u0 = q.s0 * (float)atlas->tex_width;
+        glyph->v0 = q.t0 * (float)atlas->tex_height;
+        glyph->u1 = q.s1 * (float)atlas->tex_width;
+        glyph->v1 = q.t1 * (float)atlas->tex_height;
+    } else {
+        glyph->u0 = q.s0;
+        glyph->v0 = q.t0;
+        glyph->u1 = q.s1;
+        glyph->v1 = q.t1;
+    }
+    glyph->xadvance = (pc.xadvance + cfg->spacing.x);
+    if (cfg->pixel_snap)
+        glyph->xadvance = (float)(int)(glyph->xadvance + 0.5f);
+    return nk_true;
+}
+NK_INTERN const struct nk_font_glyph*
+nk_font_dynamic_find(struct nk_font *font, nk_rune unicode, int fallback)
+{
+    int slot, page = -1, rendered;
+    nk_hash i, mask;
+    struct nk_font_dynamic_glyph *g;
+    struct nk_font_dynamic *dyn = font->dynamic;
+    const struct nk_font_dynamic_source *src;
+
+    /* look up cached glyph */
+    mask = (nk_hash)dyn->table_size - 1;
+    for (i = nk_font_dynamic_hash(font, unicode); dyn->table[i & mask] >= 0; ++i) {
+        g = &dyn->glyphs[dyn->table[i & mask]];
+        if (g->font == font && g->glyph.codepoint == unicode) {
+            nk_font_dynamic_touch(dyn, dyn->table[i & mask]);
+            return (g->failed) ? &dyn->empty: &g->glyph;
+        }
+    }
+
+    /* rasterize glyph on first use */
+    src = nk_font_dynamic_source_for(dyn, font, unicode);
+    if (!src) return (fallback && font->fallback_codepoint != unicode) ?
+        nk_font_dynamic_find(font, font->fallback_codepoint, 0): &dyn->empty;
+    if (dyn->free_list < 0 && !nk_font_dynamic_evict_glyph(dyn))
+        return &dyn->empty;
+
+    slot = dyn->free_list;
+    g = &dyn->glyphs[slot];
+    dyn->free_list = g->next;
+    NK_PROFILE_BEGIN(dyn->atlas->profiler, NK_PROFILE_FONT_BAKE);
+    rendered = nk_font_dynamic_rasterize(dyn, font, src, unicode, &g->glyph, &page);
+    NK_PROFILE_END(dyn->atlas->profiler, NK_PROFILE_FONT_BAKE);
+    if (page < 0) {
+        /* no texture space left in this frame so try again later */
+        g->next = dyn->free_list;
+        dyn->free_list = slot;
+        return &dyn->empty;
+    }
+    /* glyphs without pixels are cached as well so their skyline space is
+     * only taken once until the page is reused */
+    if (!rendered) g->glyph = dyn->empty;
+    g->glyph.codepoint = unicode;
+    g->failed = !rendered;
+    g->font = font;
+    g->page = page;
+    dyn->glyph_count++;
+    nk_font_dynamic_append(dyn, slot);
+    nk_font_dynamic_touch(dyn, slot);
+    nk_font_dynamic_insert(dyn, slot);
+    return (g->failed) ? &dyn->empty: &g->glyph;
+}
+NK_INTERN const struct nk_font_glyph*
+nk_font_dynamic_find_locked(struct nk_font *font, nk_rune unicode)
+{
+    const struct nk_font_glyph *glyph;
+    struct nk_font_atlas *atlas = font->dynamic->atlas;
+    if (atlas->lock) atlas->lock(atlas->lock_userdata);
+    glyph = nk_font_dynamic_find(font, unicode, nk_true);
+    if (atlas->unlock) atlas->unlock(atlas->lock_userdata);
+    return glyph;
+}
+/* -------------------------------------------------------------
+ *
+ *                          DYNAMIC FONT ATLAS
+ *
+ * --------------------------------------------------------------*/
+NK_INTERN void
+nk_font_dynamic_free(struct nk_font_atlas *atlas)
+{
+    int i;
+    struct nk_font_dynamic *dyn = atlas->dynamic;
+    struct nk_allocator *a = &atlas->permanent;
+    if (!dyn) return;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i)
+        if (dyn->pages[i].nodes) a->free(a->userdata, dyn->pages[i].nodes);
+    if (dyn->sources) a->free(a->userdata, dyn->sources);
+    if (dyn->glyphs) a->free(a->userdata, dyn->glyphs);
+    if (dyn->table) a->free(a->userdata, dyn->table);
+    if (dyn->alpha && dyn->alpha != atlas->pixel) a->free(a->userdata, dyn->alpha);
+    if (atlas->pixel) a->free(a->userdata, atlas->pixel);
+    a->free(a->userdata, dyn);
+    atlas->pixel = 0;
+    atlas->dynamic = 0;
+}
+NK_API const void*
+nk_font_atlas_bake_dynamic(struct nk_font_atlas *atlas, int width, int height,
+    int glyph_capacity, enum nk_font_atlas_format fmt)
+{
+    int i = 0;
+    nk_size pixel_size;
+    struct nk_allocator *a;
+    struct nk_font *font;
+    struct nk_font_config *iter, *it;
+    struct nk_font_dynamic *dyn;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+    NK_ASSERT(height >= NK_FONT_DYNAMIC_PAGES * (NK_CURSOR_DATA_H + 2));
+    if (!atlas || width <= 0 || glyph_capacity <= 0 || width > 0xffff || height > 0xffff ||
+        height < NK_FONT_DYNAMIC_PAGES * (NK_CURSOR_DATA_H + 2) ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+#ifdef NK_INCLUDE_DEFAULT_FONT
+    /* no font added so just use default font */
+    if (!atlas->font_num)
+        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
+#endif
+    NK_ASSERT(atlas->font_num);
+    if (!atlas->font_num) return 0;
+    nk_font_dynamic_free(atlas);
+
+    /* allocate persistent glyph cache, pages and texture memory */
+    a = &atlas->permanent;
+    dyn = (struct nk_font_dynamic*)a->alloc(a->userdata,0, sizeof(*dyn));
+    NK_ASSERT(dyn);
+    if (!dyn) return 0;
+    nk_zero(dyn, sizeof(*dyn));
+    atlas->dynamic = dyn;
+    dyn->atlas = atlas;
+    dyn->frame = 1;
+    dyn->free_list = -1;
+    dyn->lru_first = dyn->lru_last = -1;
+    dyn->glyph_capacity = glyph_capacity;
+    dyn->table_size = (int)nk_round_up_pow2((nk_uint)glyph_capacity * 2);
+    dyn->source_count = atlas->font_num;
+    pixel_size = (nk_size)width * (nk_size)height;
+    dyn->sources = (struct nk_font_dynamic_source*)a->alloc(a->userdata,0,
+        sizeof(struct nk_font_dynamic_source) * (nk_size)atlas->font_num);
+    dyn->glyphs = (struct nk_font_dynamic_glyph*)a->alloc(a->userdata,0,
+        sizeof(struct nk_font_dynamic_glyph) * (nk_size)glyph_capacity);
+    dyn->table = (int*)a->alloc(a->userdata,0, sizeof(int) * (nk_size)dyn->table_size);
+    atlas->pixel = a->alloc(a->userdata,0, (fmt == NK_FONT_ATLAS_RGBA32) ? pixel_size * 4: pixel_size);
+    dyn->alpha = (fmt == NK_FONT_ATLAS_RGBA32) ?
+        (nk_byte*)a->alloc(a->userdata,0, pixel_size): (nk_byte*)atlas->pixel;
+    if (!dyn->sources || !dyn->glyphs || !dyn->table || !atlas->pixel || !dyn->alpha)
+        goto failed;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        dyn->pages[i].nodes = (struct nk_rp_node*)a->alloc(a->userdata,0,
+            sizeof(struct nk_rp_node) * (nk_size)width);
+        if (!dyn->pages[i].nodes) goto failed;
+    }
+    for (i = 0; i < glyph_capacity; ++i) {
+        dyn->glyphs[i].page = -1;
+        dyn->glyphs[i].next = dyn->free_list;
+        dyn->free_list = i;
+    }
+    for (i = 0; i < dyn->table_size; ++i)
+        dyn->table[i] = -1;
+
+    /* parse all fonts once and keep them around for rasterization */
+    i = 0;
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {if (!it->range) it->range = nk_font_default_glyph_ranges();
+            dyn->sources[i].config = it;
+            if (!nk_tt_InitFont(&dyn->sources[i++].info, (const unsigned char*)it->ttf_blob, 0))
+                goto failed;
+        } while ((it = it->n) != iter);
+    }
+
+    /* split texture into pages */
+    atlas->tex_width = width;
+    atlas->tex_height = height;
+    atlas->format = fmt;
+    atlas->custom.w = (NK_CURSOR_DATA_W*2)+1;
+    atlas->custom.h = NK_CURSOR_DATA_H + 1;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        dyn->pages[i].y = (height / NK_FONT_DYNAMIC_PAGES) * i;
+        dyn->pages[i].h = (i == NK_FONT_DYNAMIC_PAGES-1) ?
+            height - dyn->pages[i].y: height / NK_FONT_DYNAMIC_PAGES;
+        nk_font_dynamic_reset_page(dyn, i);
+    }
+
+    /* initialize fonts without any glyphs */
+    for (font = atlas->fonts; font; font = font->next) {
+        struct nk_font_config *config = font->config;
+        const struct nk_font_dynamic_source *src = 0;
+        int ascent, descent, line_gap;
+        float scale;
+        for (i = 0; i < dyn->source_count; ++i)
+            if (dyn->sources[i].config == config) src = &dyn->sources[i];
+        NK_ASSERT(src);
+        if (!src) goto failed;
+
+        scale = nk_tt_ScaleForPixelHeight(&src->info, config->size);
+        nk_tt_GetFontVMetrics(&src->info, &ascent, &descent, &line_gap);
+        config->font->ranges = config->range;
+        config->font->height = config->size;
+        config->font->ascent = (float)ascent * scale;
+        config->font->descent = (float)descent * scale;
+        config->font->glyph_offset = 0;
+        config->font->glyph_count = 0;
+        font->dynamic = dyn;
+        nk_font_init(font, config->size, config->fallback_glyph, &dyn->empty,
+            config->font, nk_handle_ptr(0));
+        font->glyphs = 0;
+        font->fallback = 0;
+    }
+    nk_font_atlas_setup_cursors(atlas);
+    return atlas->pixel;
+
+failed:
+    nk_font_dynamic_free(atlas);
+    return 0;
+}
+NK_API int
+nk_font_atlas_dirty(struct nk_font_atlas *atlas, struct nk_recti *rect)
+{
+    int i;
+    struct nk_font_dynamic *dyn;
+    NK_ASSERT(atlas);
+    NK_ASSERT(rect);
+    if (!atlas || !rect || !atlas->dynamic) return 0;
+
+    dyn = atlas->dynamic;
+    if (atlas->lock) atlas->lock(atlas->lock_userdata);
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        struct nk_font_dynamic_page *page = &dyn->pages[i];
+        if (!page->dirty) continue;
+        rect->x = (short)page->dirty_x0;
+        rect->y = (short)page->dirty_y0;
+        rect->w = (short)(page->dirty_x1 - page->dirty_x0);
+        rect->h = (short)(page->dirty_y1 - page->dirty_y0);
+        page->dirty = nk_false;
+        break;
+    }
+    /* all regions uploaded so glyphs used until now may be evicted */
+    if (i == NK_FONT_DYNAMIC_PAGES)
+        dyn->frame++;
+    if (atlas->unlock) atlas->unlock(atlas->lock_userdata);
+    return i < NK_FONT_DYNAMIC_PAGES;
+}
+NK_API void
+nk_font_atlas_set_lock(struct nk_font_atlas *atlas, nk_handle userdata,
+    void(*lock)(nk_handle), void(*unlock)(nk_handle))
+{
+    NK_ASSERT(atlas);
+    NK_ASSERT(!lock == !unlock);
+    if (!atlas) return;
+    atlas->lock_userdata = userdata;
+    atlas->lock = lock;
+    atlas->unlock = unlock;
+}
 NK_API void
 nk_font_atlas_end(struct nk_font_atlas *atlas, nk_handle texture,
     struct nk_draw_null_texture *null)
@@ -13860,6 +18532,8 @@ nk_font_atlas_end(struct nk_font_atlas *atlas, nk_handle texture,
     for (i = 0; i < NK_CURSOR_COUNT; ++i)
         atlas->cursors[i].img.handle = texture;
 
+    /* dynamic atlas keeps its texture memory for later glyphs */
+    if (atlas->dynamic) return;
     atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
     atlas->pixel = 0;
     atlas->tex_width = 0;
@@ -13878,15 +18552,18 @@ nk_font_atlas_cleanup(struct nk_font_atlas *atlas)
     NK_ASSERT(atlas->permanent.alloc);
     NK_ASSERT(atlas->permanent.free);
     if (!atlas || !atlas->permanent.alloc || !atlas->permanent.free) return;
+    if (atlas->dynamic) return;
     if (atlas->config) {
         struct nk_font_config *iter;
         for (iter = atlas->config; iter; iter = iter->next) {
             struct nk_font_config *i;
             for (i = iter->n; i != iter; i = i->n) {
-                atlas->permanent.free(atlas->permanent.userdata, i->ttf_blob);
+                if (i->ttf_blob)
+                    atlas->permanent.free(atlas->permanent.userdata, i->ttf_blob);
                 i->ttf_blob = 0;
             }
-            atlas->permanent.free(atlas->permanent.userdata, iter->ttf_blob);
+            if (iter->ttf_blob)
+                atlas->permanent.free(atlas->permanent.userdata, iter->ttf_blob);
             iter->ttf_blob = 0;
         }
     }
@@ -13901,6 +18578,7 @@ nk_font_atlas_clear(struct nk_font_atlas *atlas)
     NK_ASSERT(atlas->permanent.free);
     if (!atlas || !atlas->permanent.alloc || !atlas->permanent.free) return;
 
+    nk_font_dynamic_free(atlas);
     if (atlas->config) {
         struct nk_font_config *iter, *next;
         for (iter = atlas->config; iter; iter = next) {
@@ -13948,6 +18626,8 @@ nk_input_begin(struct nk_context *ctx)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder)
+        nk_input_record_op(ctx, NK_INPUT_RECORD_BEGIN);
     in = &ctx->input;
     for (i = 0; i < NK_BUTTON_MAX; ++i)
         in->mouse.buttons[i].clicked = 0;
@@ -13961,6 +18641,93 @@ nk_input_begin(struct nk_context *ctx)
     for (i = 0; i < NK_KEY_MAX; i++)
         in->keyboard.keys[i].clicked = 0;
 }
+NK_INTERN int
+nk_input_is_modifier(enum nk_keys key)
+{
+    return key == NK_KEY_SHIFT || key == NK_KEY_CTRL;
+}
+NK_INTERN int
+nk_input_text_key_changed(const struct nk_input *in)
+{
+    int i;
+    for (i = 0; i < NK_KEY_MAX; ++i)
+        if (in->keyboard.keys[i].clicked && !nk_input_is_modifier((enum nk_keys)i))
+            return nk_true;
+    return nk_false;
+}
+NK_INTERN int
+nk_input_apply_event(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    /* state is only latched once per frame so an event is deferred to the
+     * next frame if it would overwrite or reorder a change of this frame */
+    int i, buttons_changed = nk_false;
+    struct nk_input *in = &ctx->input;
+    for (i = 0; i < NK_BUTTON_MAX; ++i)
+        buttons_changed |= in->mouse.buttons[i].clicked != 0;
+
+    switch (evt->type) {
+    case NK_INPUT_EVENT_MOTION:
+        if (buttons_changed) return nk_false;
+        nk_input_motion(ctx, evt->data.motion.x, evt->data.motion.y);
+        break;
+    case NK_INPUT_EVENT_BUTTON: {
+        /* a left button press close enough in time to the last one also
+         * presses the double click button until the left one is released */
+        int dbl = nk_false;
+        if (evt->data.button.id == NK_BUTTON_LEFT && evt->data.button.down)
+            dbl = ctx->input_click_armed &&
+                evt->time - ctx->input_click_time <= NK_INPUT_DOUBLE_CLICK_TIME;
+        else if (evt->data.button.id == NK_BUTTON_LEFT)
+            dbl = in->mouse.buttons[NK_BUTTON_DOUBLE].down;
+        if (in->mouse.buttons[evt->data.button.id].clicked ||
+            (dbl && in->mouse.buttons[NK_BUTTON_DOUBLE].clicked))
+            return nk_false;
+        if (evt->data.button.id == NK_BUTTON_LEFT && evt->data.button.down) {
+            ctx->input_click_armed = !dbl;
+            ctx->input_click_time = evt->time;
+        }
+        nk_input_button(ctx, evt->data.button.id, evt->data.button.x,
+            evt->data.button.y, evt->data.button.down);
+        if (dbl)
+            nk_input_button(ctx, NK_BUTTON_DOUBLE, evt->data.button.x,
+                evt->data.button.y, evt->data.button.down);
+    } break;
+    case NK_INPUT_EVENT_KEY:
+        if (in->keyboard.keys[evt->data.key.key].clicked || buttons_changed ||
+            (in->keyboard.text_len && !nk_input_is_modifier(evt->data.key.key)))
+            return nk_false;
+        nk_input_key(ctx, evt->data.key.key, evt->data.key.down);
+        break;
+    case NK_INPUT_EVENT_SCROLL:
+        if (buttons_changed) return nk_false;
+        nk_input_scroll(ctx, evt->data.scroll);
+        break;
+    case NK_INPUT_EVENT_UNICODE: {
+        nk_glyph glyph;
+        int len = nk_utf_encode(evt->data.unicode, glyph, NK_UTF_SIZE);
+        if (!len) break;
+        if (buttons_changed || nk_input_text_key_changed(in) ||
+            in->keyboard.text_len + len >= NK_INPUT_MAX)
+            return nk_false;
+        nk_input_glyph(ctx, glyph);
+    } break;
+    default: break;
+    }
+    return nk_true;
+}
+NK_INTERN void
+nk_input_queue_apply(struct nk_context *ctx)
+{
+    int i, applied = 0;
+    while (applied < ctx->input_queue_count &&
+        nk_input_apply_event(ctx, &ctx->input_queue[applied]))
+        applied++;
+    if (!applied) return;
+
+    ctx->input_queue_count -= applied;
+    for (i = 0; i < ctx->input_queue_count; ++i)
+        ctx->input_queue[i] = ctx->input_queue[i + applied];
+}
 NK_API void
 nk_input_end(struct nk_context *ctx)
 {
@@ -13968,6 +18735,7 @@ nk_input_end(struct nk_context *ctx)
     NK_ASSERT(ctx);
     if (!ctx) return;
     in = &ctx->input;
+    nk_input_queue_apply(ctx);
     if (in->mouse.grab)
         in->mouse.grab = 0;
     if (in->mouse.ungrab) {
@@ -13975,6 +18743,9 @@ nk_input_end(struct nk_context *ctx)
         in->mouse.ungrab = 0;
         in->mouse.grab = 0;
     }
+    /* recorded after queued events so a replay applies them first */
+    if (ctx->recorder)
+        nk_input_record_op(ctx, NK_INPUT_RECORD_END);
 }
 NK_API void
 nk_input_motion(struct nk_context *ctx, int x, int y)
@@ -13982,6 +18753,13 @@ nk_input_motion(struct nk_context *ctx, int x, int y)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_MOTION;
+        evt.data.motion.x = x;
+        evt.data.motion.y = y;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
     in->mouse.pos.x = (float)x;
     in->mouse.pos.y = (float)y;
@@ -13994,6 +18772,13 @@ nk_input_key(struct nk_context *ctx, enum nk_keys key, int down)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_KEY;
+        evt.data.key.key = key;
+        evt.data.key.down = down;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
 #ifdef NK_KEYSTATE_BASED_INPUT
     if (in->keyboard.keys[key].down != down)
@@ -14010,6 +18795,15 @@ nk_input_button(struct nk_context *ctx, enum nk_buttons id, int x, int y, int do
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_BUTTON;
+        evt.data.button.id = id;
+        evt.data.button.x = x;
+        evt.data.button.y = y;
+        evt.data.button.down = down;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
     if (in->mouse.buttons[id].down == down) return;
 
@@ -14024,6 +18818,12 @@ nk_input_scroll(struct nk_context *ctx, struct nk_vec2 val)
 {
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_SCROLL;
+        evt.data.scroll = val;
+        nk_input_record(ctx, &evt);
+    }
     ctx->input.mouse.scroll_delta.x += val.x;
     ctx->input.mouse.scroll_delta.y += val.y;
 }
@@ -14039,6 +18839,13 @@ nk_input_glyph(struct nk_context *ctx, const nk_glyph glyph)
     in = &ctx->input;
 
     len = nk_utf_decode(glyph, &unicode, NK_UTF_SIZE);
+    if (len && ctx->recorder) {
+        /* characters and runes are recorded as the rune they add */
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_UNICODE;
+        evt.data.unicode = unicode;
+        nk_input_record(ctx, &evt);
+    }
     if (len && ((in->keyboard.text_len + len) < NK_INPUT_MAX)) {
         nk_utf_encode(unicode, &in->keyboard.text[in->keyboard.text_len],
             NK_INPUT_MAX - in->keyboard.text_len);
@@ -14064,6 +18871,100 @@ nk_input_unicode(struct nk_context *ctx, nk_rune unicode)
     nk_input_glyph(ctx, rune);
 }
 NK_API int
+nk_input_push(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    struct nk_input_event *last;
+    NK_ASSERT(ctx);
+    NK_ASSERT(evt);
+    if (!ctx || !evt) return nk_false;
+    if ((evt->type == NK_INPUT_EVENT_BUTTON &&
+        ((unsigned)evt->data.button.id >= NK_BUTTON_MAX)) ||
+        (evt->type == NK_INPUT_EVENT_KEY &&
+        ((unsigned)evt->data.key.key >= NK_KEY_MAX)))
+        return nk_false;
+
+    /* merge with previous event of the same type */
+    last = (ctx->input_queue_count) ? &ctx->input_queue[ctx->input_queue_count-1]: 0;
+    if (last && last->type == evt->type && evt->type == NK_INPUT_EVENT_MOTION) {
+        *last = *evt;
+        return nk_true;
+    } else if (last && last->type == evt->type && evt->type == NK_INPUT_EVENT_SCROLL) {
+        last->time = evt->time;
+        last->data.scroll.x += evt->data.scroll.x;
+        last->data.scroll.y += evt->data.scroll.y;
+        return nk_true;
+    }
+    if (ctx->input_queue_count >= NK_INPUT_QUEUE_SIZE)
+        return nk_false;
+    ctx->input_queue[ctx->input_queue_count++] = *evt;
+    return nk_true;
+}
+NK_API int
+nk_input_push_motion(struct nk_context *ctx, nk_uint time, int x, int y)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_MOTION;
+    evt.time = time;
+    evt.data.motion.x = x;
+    evt.data.motion.y = y;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_button(struct nk_context *ctx, nk_uint time, enum nk_buttons id,
+    int x, int y, int down)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_BUTTON;
+    evt.time = time;
+    evt.data.button.id = id;
+    evt.data.button.x = x;
+    evt.data.button.y = y;
+    evt.data.button.down = down;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_key(struct nk_context *ctx, nk_uint time, enum nk_keys key, int down)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_KEY;
+    evt.time = time;
+    evt.data.key.key = key;
+    evt.data.key.down = down;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_scroll(struct nk_context *ctx, nk_uint time, struct nk_vec2 val)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_SCROLL;
+    evt.time = time;
+    evt.data.scroll = val;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_unicode(struct nk_context *ctx, nk_uint time, nk_rune unicode)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_UNICODE;
+    evt.time = time;
+    evt.data.unicode = unicode;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_queue_count(const struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    return ctx->input_queue_count;
+}
+NK_API void
+nk_input_queue_clear(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->input_queue_count = 0;
+}
+NK_API int
 nk_input_has_mouse_click(const struct nk_input *i, enum nk_buttons id)
 {
     const struct nk_mouse_button *btn;
@@ -14125,75 +19026,344 @@ nk_input_is_mouse_hovering_rect(const struct nk_input *i, struct nk_rect rect)
     if (!i) return nk_false;
     return NK_INBOX(i->mouse.pos.x, i->mouse.pos.y, rect.x, rect.y, rect.w, rect.h);
 }
-NK_API int
-nk_input_is_mouse_prev_hovering_rect(const struct nk_input *i, struct nk_rect rect)
+NK_API int
+nk_input_is_mouse_prev_hovering_rect(const struct nk_input *i, struct nk_rect rect)
+{
+    if (!i) return nk_false;
+    return NK_INBOX(i->mouse.prev.x, i->mouse.prev.y, rect.x, rect.y, rect.w, rect.h);
+}
+NK_API int
+nk_input_mouse_clicked(const struct nk_input *i, enum nk_buttons id, struct nk_rect rect)
+{
+    if (!i) return nk_false;
+    if (!nk_input_is_mouse_hovering_rect(i, rect)) return nk_false;
+    return nk_input_is_mouse_click_in_rect(i, id, rect);
+}
+NK_API int
+nk_input_is_mouse_down(const struct nk_input *i, enum nk_buttons id)
+{
+    if (!i) return nk_false;
+    return i->mouse.buttons[id].down;
+}
+NK_API int
+nk_input_is_mouse_pressed(const struct nk_input *i, enum nk_buttons id)
+{
+    const struct nk_mouse_button *b;
+    if (!i) return nk_false;
+    b = &i->mouse.buttons[id];
+    if (b->down && b->clicked)
+        return nk_true;
+    return nk_false;
+}
+NK_API int
+nk_input_is_mouse_released(const struct nk_input *i, enum nk_buttons id)
+{
+    if (!i) return nk_false;
+    return (!i->mouse.buttons[id].down && i->mouse.buttons[id].clicked);
+}
+NK_API int
+nk_input_is_key_pressed(const struct nk_input *i, enum nk_keys key)
+{
+    const struct nk_key *k;
+    if (!i) return nk_false;
+    k = &i->keyboard.keys[key];
+    if ((k->down && k->clicked) || (!k->down && k->clicked >= 2))
+        return nk_true;
+    return nk_false;
+}
+NK_API int
+nk_input_is_key_released(const struct nk_input *i, enum nk_keys key)
+{
+    const struct nk_key *k;
+    if (!i) return nk_false;
+    k = &i->keyboard.keys[key];
+    if ((!k->down && k->clicked) || (k->down && k->clicked >= 2))
+        return nk_true;
+    return nk_false;
+}
+NK_API int
+nk_input_is_key_down(const struct nk_input *i, enum nk_keys key)
+{
+    const struct nk_key *k;
+    if (!i) return nk_false;
+    k = &i->keyboard.keys[key];
+    if (k->down) return nk_true;
+    return nk_false;
+}
+
+
+
+
+
+/* ===============================================================
+ *
+ *                          INPUT RECORDING
+ *
+ * ===============================================================*/
+/*  A recording starts with 'N' 'K' 'I' version followed by operations.
+    Each operation is a byte holding either a `nk_input_event_type` for
+    one mirroring call or a `nk_input_record_op`. Arguments are packed as
+    variable length integers and raw floats the same way as packed draw
+    commands. Every frame ends with `NK_INPUT_RECORD_FRAME` followed by
+    `delta_time_seconds` and the hash of all draw commands packed with a
+    handle table local to the frame, so hashes do not depend on font
+    pointers. */
+#define NK_INPUT_RECORD_VERSION 1
+#define NK_INPUT_REPLAY_PADDING 32
+
+NK_INTERN void
+nk_input_record_write(struct nk_input_recorder *rec, const nk_byte *data, nk_size size)
+{
+    void *memory = nk_buffer_alloc(&rec->data, NK_BUFFER_FRONT, size, 1);
+    if (!memory) return;
+    NK_MEMCPY(memory, data, size);
+}
+NK_INTERN nk_hash
+nk_input_command_hash(struct nk_context *ctx, struct nk_command_packing *packing)
+{
+    const struct nk_command *cmd;
+    nk_hash hash = 0;
+    nk_buffer_clear(&packing->table);
+    nk_foreach(cmd, ctx) {
+        nk_size size = nk_command_packed_size(cmd);
+        nk_byte *p;
+        nk_buffer_clear(&packing->scratch);
+        p = (nk_byte*)nk_buffer_alloc(&packing->scratch, NK_BUFFER_FRONT, size, 1);
+        if (!p) break;
+        size = (nk_size)(nk_pack_command(packing, p, cmd) - p);
+        hash = nk_murmur_hash(p, (int)size, hash);
+    }
+    return hash;
+}
+NK_LIB void
+nk_input_record(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    nk_byte tmp[32], *p = tmp;
+    *p++ = (nk_byte)evt->type;
+    switch (evt->type) {
+    case NK_INPUT_EVENT_MOTION:
+        p = nk_pack_int(p, evt->data.motion.x);
+        p = nk_pack_int(p, evt->data.motion.y);
+        break;
+    case NK_INPUT_EVENT_BUTTON:
+        p = nk_pack_uint(p, (nk_uint)evt->data.button.id);
+        p = nk_pack_int(p, evt->data.button.x);
+        p = nk_pack_int(p, evt->data.button.y);
+        p = nk_pack_int(p, evt->data.button.down);
+        break;
+    case NK_INPUT_EVENT_KEY:
+        p = nk_pack_uint(p, (nk_uint)evt->data.key.key);
+        p = nk_pack_int(p, evt->data.key.down);
+        break;
+    case NK_INPUT_EVENT_SCROLL:
+        p = nk_pack_float(p, evt->data.scroll.x);
+        p = nk_pack_float(p, evt->data.scroll.y);
+        break;
+    case NK_INPUT_EVENT_UNICODE:
+        p = nk_pack_uint(p, evt->data.unicode);
+        break;
+    default: return;
+    }
+    nk_input_record_write(ctx->recorder, tmp, (nk_size)(p - tmp));
+}
+NK_LIB void
+nk_input_record_op(struct nk_context *ctx, enum nk_input_record_op op)
+{
+    nk_byte tmp = (nk_byte)op;
+    nk_input_record_write(ctx->recorder, &tmp, 1);
+}
+NK_LIB void
+nk_input_record_frame(struct nk_context *ctx)
+{
+    nk_byte tmp[16], *p = tmp;
+    struct nk_input_recorder *rec = ctx->recorder;
+    *p++ = (nk_byte)NK_INPUT_RECORD_FRAME;
+    p = nk_pack_float(p, ctx->delta_time_seconds);
+    p = nk_pack_uint(p, nk_input_command_hash(ctx, &rec->packing));
+    nk_input_record_write(rec, tmp, (nk_size)(p - tmp));
+    rec->frames++;
+}
+NK_API void
+nk_input_recorder_init(struct nk_input_recorder *rec, const struct nk_allocator *alloc)
+{
+    NK_ASSERT(rec);
+    NK_ASSERT(alloc);
+    if (!rec || !alloc) return;
+    nk_zero(rec, sizeof(*rec));
+    nk_buffer_init(&rec->data, alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_command_packing_init(&rec->packing, alloc);
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_input_recorder_init_default(struct nk_input_recorder *rec)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_input_recorder_init(rec, &alloc);
+}
+#endif
+NK_API void
+nk_input_recorder_free(struct nk_input_recorder *rec)
 {
-    if (!i) return nk_false;
-    return NK_INBOX(i->mouse.prev.x, i->mouse.prev.y, rect.x, rect.y, rect.w, rect.h);
+    NK_ASSERT(rec);
+    if (!rec) return;
+    if (rec->data.pool.alloc)
+        nk_buffer_free(&rec->data);
+    nk_command_packing_free(&rec->packing);
+    nk_zero(rec, sizeof(*rec));
 }
-NK_API int
-nk_input_mouse_clicked(const struct nk_input *i, enum nk_buttons id, struct nk_rect rect)
+NK_API void
+nk_input_record_begin(struct nk_context *ctx, struct nk_input_recorder *rec)
 {
-    if (!i) return nk_false;
-    if (!nk_input_is_mouse_hovering_rect(i, rect)) return nk_false;
-    return nk_input_is_mouse_click_in_rect(i, id, rect);
+    nk_byte header[4];
+    NK_ASSERT(ctx);
+    NK_ASSERT(rec);
+    NK_ASSERT(!ctx->current && "input can only be recorded from the start of a frame");
+    if (!ctx || !rec) return;
+    header[0] = 'N'; header[1] = 'K'; header[2] = 'I';
+    header[3] = NK_INPUT_RECORD_VERSION;
+    nk_buffer_clear(&rec->data);
+    rec->frames = 0;
+    ctx->recorder = rec;
+    nk_input_record_write(rec, header, sizeof(header));
 }
-NK_API int
-nk_input_is_mouse_down(const struct nk_input *i, enum nk_buttons id)
+NK_API void
+nk_input_record_end(struct nk_context *ctx)
 {
-    if (!i) return nk_false;
-    return i->mouse.buttons[id].down;
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->recorder = 0;
 }
 NK_API int
-nk_input_is_mouse_pressed(const struct nk_input *i, enum nk_buttons id)
+nk_input_replay_init(struct nk_input_replay *replay, const struct nk_allocator *alloc,
+    const void *memory, nk_size size)
 {
-    const struct nk_mouse_button *b;
-    if (!i) return nk_false;
-    b = &i->mouse.buttons[id];
-    if (b->down && b->clicked)
-        return nk_true;
-    return nk_false;
+    const nk_byte *header = (const nk_byte*)memory;
+    nk_byte *data;
+
+    NK_ASSERT(replay);
+    NK_ASSERT(alloc);
+    NK_ASSERT(memory || !size);
+    if (!replay || !alloc) return nk_false;
+    nk_zero(replay, sizeof(*replay));
+    nk_buffer_init(&replay->data, alloc, size + NK_INPUT_REPLAY_PADDING);
+    nk_command_packing_init(&replay->packing, alloc);
+    if (!memory || size < 4 || header[0] != 'N' || header[1] != 'K' ||
+        header[2] != 'I' || header[3] != NK_INPUT_RECORD_VERSION)
+        return nk_false;
+
+    /* zero padding lets operations cut off at the end decode without
+     * reading past the copy */
+    data = (nk_byte*)nk_buffer_alloc(&replay->data, NK_BUFFER_FRONT,
+        size + NK_INPUT_REPLAY_PADDING, 1);
+    if (!data) return nk_false;
+    NK_MEMCPY(data, memory, size);
+    NK_MEMSET(data + size, 0, NK_INPUT_REPLAY_PADDING);
+    replay->offset = 4;
+    return nk_true;
 }
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 NK_API int
-nk_input_is_mouse_released(const struct nk_input *i, enum nk_buttons id)
+nk_input_replay_init_default(struct nk_input_replay *replay,
+    const void *memory, nk_size size)
 {
-    if (!i) return nk_false;
-    return (!i->mouse.buttons[id].down && i->mouse.buttons[id].clicked);
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    return nk_input_replay_init(replay, &alloc, memory, size);
 }
-NK_API int
-nk_input_is_key_pressed(const struct nk_input *i, enum nk_keys key)
+#endif
+NK_API void
+nk_input_replay_free(struct nk_input_replay *replay)
 {
-    const struct nk_key *k;
-    if (!i) return nk_false;
-    k = &i->keyboard.keys[key];
-    if ((k->down && k->clicked) || (!k->down && k->clicked >= 2))
-        return nk_true;
-    return nk_false;
+    NK_ASSERT(replay);
+    if (!replay) return;
+    if (replay->data.pool.alloc)
+        nk_buffer_free(&replay->data);
+    nk_command_packing_free(&replay->packing);
+    nk_zero(replay, sizeof(*replay));
 }
 NK_API int
-nk_input_is_key_released(const struct nk_input *i, enum nk_keys key)
+nk_input_replay_frame(struct nk_context *ctx, struct nk_input_replay *replay)
 {
-    const struct nk_key *k;
-    if (!i) return nk_false;
-    k = &i->keyboard.keys[key];
-    if ((!k->down && k->clicked) || (k->down && k->clicked >= 2))
-        return nk_true;
+    const nk_byte *begin, *end, *p;
+    NK_ASSERT(ctx);
+    NK_ASSERT(replay);
+    if (!ctx || !replay || replay->data.allocated < NK_INPUT_REPLAY_PADDING)
+        return nk_false;
+
+    begin = (const nk_byte*)nk_buffer_memory_const(&replay->data);
+    end = begin + replay->data.allocated - NK_INPUT_REPLAY_PADDING;
+    p = begin + replay->offset;
+    while (p < end) {
+        nk_uint id;
+        int x, y;
+        switch (*p++) {
+        case NK_INPUT_EVENT_MOTION:
+            x = nk_unpack_int(&p);
+            y = nk_unpack_int(&p);
+            nk_input_motion(ctx, x, y);
+            break;
+        case NK_INPUT_EVENT_BUTTON:
+            id = nk_unpack_uint(&p);
+            x = nk_unpack_int(&p);
+            y = nk_unpack_int(&p);
+            if (id >= NK_BUTTON_MAX) goto corrupt;
+            nk_input_button(ctx, (enum nk_buttons)id, x, y, nk_unpack_int(&p));
+            break;
+        case NK_INPUT_EVENT_KEY:
+            id = nk_unpack_uint(&p);
+            if (id >= NK_KEY_MAX) goto corrupt;
+            nk_input_key(ctx, (enum nk_keys)id, nk_unpack_int(&p));
+            break;
+        case NK_INPUT_EVENT_SCROLL: {
+            struct nk_vec2 scroll;
+            scroll.x = nk_unpack_float(&p);
+            scroll.y = nk_unpack_float(&p);
+            nk_input_scroll(ctx, scroll);
+        } break;
+        case NK_INPUT_EVENT_UNICODE:
+            nk_input_unicode(ctx, nk_unpack_uint(&p));
+            break;
+        case NK_INPUT_RECORD_BEGIN:
+            nk_input_begin(ctx);
+            break;
+        case NK_INPUT_RECORD_END:
+            nk_input_end(ctx);
+            break;
+        case NK_INPUT_RECORD_FRAME:
+            ctx->delta_time_seconds = nk_unpack_float(&p);
+            replay->hash = nk_unpack_uint(&p);
+            if (p > end) goto corrupt;
+            replay->offset = (nk_size)(p - begin);
+            replay->frame++;
+            return nk_true;
+        default: goto corrupt;
+        }
+    }
+corrupt:
+    replay->offset = (nk_size)(end - begin);
     return nk_false;
 }
 NK_API int
-nk_input_is_key_down(const struct nk_input *i, enum nk_keys key)
+nk_input_replay_verify(struct nk_context *ctx, struct nk_input_replay *replay)
 {
-    const struct nk_key *k;
-    if (!i) return nk_false;
-    k = &i->keyboard.keys[key];
-    if (k->down) return nk_true;
+    NK_ASSERT(ctx);
+    NK_ASSERT(replay);
+    if (!ctx || !replay || !replay->frame) return nk_false;
+    if (nk_input_command_hash(ctx, &replay->packing) == replay->hash)
+        return nk_true;
+    if (!replay->diverged)
+        replay->diverged = replay->frame;
     return nk_false;
 }
 
 
 
 
-
 /* ===============================================================
  *
  *                              STYLE
@@ -14973,6 +20143,7 @@ nk_setup(struct nk_context *ctx, const struct nk_user_font *font)
     nk_zero_struct(*ctx);
     nk_style_default(ctx);
     ctx->seq = 1;
+    ctx->frame_deadline = -1.0f;
     if (font) ctx->style.font = font;
 #ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
     nk_draw_list_init(&ctx->draw_list);
@@ -15064,6 +20235,7 @@ nk_free(struct nk_context *ctx)
     ctx->current = 0;
     ctx->freelist = 0;
     ctx->count = 0;
+    ctx->recorder = 0;
 }
 NK_API void
 nk_clear(struct nk_context *ctx)
@@ -15073,6 +20245,10 @@ nk_clear(struct nk_context *ctx)
     NK_ASSERT(ctx);
 
     if (!ctx) return;
+    if (ctx->recorder)
+        nk_input_record_frame(ctx);
+    ctx->memory_stats.command_high_water = NK_MAX(
+        ctx->memory_stats.command_high_water, ctx->memory.allocated);
     if (ctx->use_pool)
         nk_buffer_clear(&ctx->memory);
     else nk_buffer_reset(&ctx->memory, NK_BUFFER_FRONT);
@@ -15080,6 +20256,7 @@ nk_clear(struct nk_context *ctx)
     ctx->build = 0;
     ctx->memory.calls = 0;
     ctx->last_widget_state = 0;
+    ctx->frame_deadline = -1.0f;
     ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_ARROW];
     NK_MEMSET(&ctx->overlay, 0, sizeof(ctx->overlay));
 
@@ -15131,6 +20308,160 @@ nk_clear(struct nk_context *ctx)
     }
     ctx->seq++;
 }
+NK_INTERN unsigned int
+nk_memory_table_count(const struct nk_window *win)
+{
+    unsigned int count = 0;
+    const struct nk_table *it;
+    for (it = win->tables; it; it = it->next)
+        count++;
+    return count;
+}
+NK_API void
+nk_memory_get_stats(const struct nk_context *ctx, struct nk_memory_stats *stats)
+{
+    const struct nk_window *win;
+    const struct nk_page_element *elem;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(stats);
+    if (!ctx || !stats) return;
+
+    *stats = ctx->memory_stats;
+    stats->command_bytes = ctx->memory.allocated;
+    stats->command_capacity = ctx->memory.memory.size;
+    stats->command_needed = ctx->memory.needed;
+    stats->command_high_water = NK_MAX(stats->command_high_water, ctx->memory.allocated);
+    stats->command_count = ctx->overlay.count;
+
+    /* windows, popups and their state tables */
+    for (win = ctx->begin; win; win = win->next) {
+        stats->window_count++;
+        stats->table_count += nk_memory_table_count(win);
+        if (win->seq == ctx->seq)
+            stats->command_count += win->buffer.count;
+        if (win->popup.win) {
+            stats->window_count++;
+            stats->table_count += nk_memory_table_count(win->popup.win);
+        }
+    }
+
+    /* page elements come either from the pool or the back of a fixed buffer */
+    if (ctx->use_pool) {
+        const struct nk_page *page;
+        for (page = ctx->pool.pages; page; page = page->next) {
+            stats->pool_pages++;
+            stats->page_elements += page->size;
+        }
+        stats->pool_page_capacity = (ctx->pool.type == NK_BUFFER_FIXED) ?
+            ctx->pool.capacity: NK_POOL_DEFAULT_CAPACITY;
+    } else {
+        stats->page_elements = (unsigned int)((ctx->memory.memory.size - ctx->memory.size) /
+            sizeof(struct nk_page_element));
+    }
+    for (elem = ctx->freelist; elem; elem = elem->next)
+        stats->page_elements_free++;
+    if (ctx->use_pool && ctx->pool.type != NK_BUFFER_FIXED) {
+        /* pages left over once live elements are packed as tight as possible */
+        unsigned int live = stats->page_elements - stats->page_elements_free;
+        unsigned int pages = (live + ctx->pool.capacity - 1) / ctx->pool.capacity;
+        stats->pool_reclaimable = (nk_size)(stats->pool_pages - pages) *
+            nk_pool_page_size(&ctx->pool);
+    }
+}
+NK_API int
+nk_memory_get_window_stats(const struct nk_context *ctx,
+    struct nk_window_memory_stats *stats, int max)
+{
+    int count = 0;
+    const struct nk_window *win;
+
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    for (win = ctx->begin; win; win = win->next, ++count) {
+        struct nk_window_memory_stats *s;
+        if (!stats || count >= max) continue;
+        s = &stats[count];
+        s->name = win->name_string;
+        s->table_count = nk_memory_table_count(win);
+        if (win->seq == ctx->seq) {
+            s->command_bytes = win->buffer.end - win->buffer.begin;
+            s->command_count = win->buffer.count;
+        } else {
+            s->command_bytes = 0;
+            s->command_count = 0;
+        }
+    }
+    return count;
+}
+NK_API void
+nk_memory_reset_stats(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    nk_zero_struct(ctx->memory_stats);
+}
+NK_INTERN int
+nk_frame_has_input(const struct nk_input *in)
+{
+    int i;
+    if (in->mouse.delta.x != 0 || in->mouse.delta.y != 0 ||
+        in->mouse.scroll_delta.x != 0 || in->mouse.scroll_delta.y != 0 ||
+        in->mouse.grab || in->mouse.ungrab || in->keyboard.text_len)
+        return nk_true;
+    /* held mouse buttons drive repeating buttons and drags every frame */
+    for (i = 0; i < NK_BUTTON_MAX; ++i)
+        if (in->mouse.buttons[i].down || in->mouse.buttons[i].clicked)
+            return nk_true;
+    for (i = 0; i < NK_KEY_MAX; ++i)
+        if (in->keyboard.keys[i].clicked)
+            return nk_true;
+    return nk_false;
+}
+NK_API nk_flags
+nk_frame_status(struct nk_context *ctx, float *timeout)
+{
+    nk_hash hash;
+    nk_flags status = NK_FRAME_IDLE;
+    NK_ASSERT(ctx);
+    if (timeout) *timeout = 0;
+    if (!ctx) return NK_FRAME_IDLE;
+
+    /* link window buffers first so command memory is the same as drawn */
+    if (!ctx->build) {
+        nk_build(ctx);
+        ctx->build = nk_true;
+    }
+    if (ctx->memory.type == NK_BUFFER_SEGMENTED) {
+        nk_size offset, size = (nk_size)1 << ctx->memory.segment_shift;
+        for (hash = 0, offset = 0; offset < ctx->memory.allocated; offset += size)
+            hash = nk_murmur_hash(nk_buffer_at(&ctx->memory, offset),
+                (int)NK_MIN(size, ctx->memory.allocated - offset), hash);
+    } else hash = nk_murmur_hash(ctx->memory.memory.ptr, (int)ctx->memory.allocated, 0);
+    if (hash != ctx->frame_hash) {
+        /* state changed by the last frame is often only visible one frame later */
+        status |= NK_FRAME_REDRAW|NK_FRAME_PENDING;
+        ctx->frame_hash = hash;
+    }
+    if (nk_frame_has_input(&ctx->input) || ctx->input_queue_count)
+        status |= NK_FRAME_PENDING;
+    if (ctx->frame_deadline == 0)
+        status |= NK_FRAME_PENDING;
+    else if (ctx->frame_deadline > 0) {
+        status |= NK_FRAME_TIMED;
+        if (timeout) *timeout = ctx->frame_deadline;
+    }
+    return status;
+}
+NK_API void
+nk_frame_schedule(struct nk_context *ctx, float seconds)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    seconds = NK_MAX(seconds, 0);
+    if (ctx->frame_deadline < 0 || seconds < ctx->frame_deadline)
+        ctx->frame_deadline = seconds;
+}
 NK_LIB void
 nk_start_buffer(struct nk_context *ctx, struct nk_command_buffer *buffer)
 {
@@ -15140,7 +20471,11 @@ nk_start_buffer(struct nk_context *ctx, struct nk_command_buffer *buffer)
     buffer->begin = ctx->memory.allocated;
     buffer->end = buffer->begin;
     buffer->last = buffer->begin;
+    buffer->count = 0;
     buffer->clip = nk_null_rect;
+#ifdef NK_INCLUDE_PROFILER
+    buffer->profiler = ctx->profiler;
+#endif
 }
 NK_LIB void
 nk_start(struct nk_context *ctx, struct nk_window *win)
@@ -15157,6 +20492,9 @@ nk_start_popup(struct nk_context *ctx, struct nk_window *win)
     NK_ASSERT(win);
     if (!ctx || !win) return;
 
+    /* popup bounds are set every frame and change what is under the mouse */
+    nk_window_index_invalidate(ctx);
+
     /* save buffer fill state for popup */
     buf = &win->popup.buf;
     buf->begin = win->buffer.end;
@@ -15173,6 +20511,7 @@ nk_finish_popup(struct nk_context *ctx, struct nk_window *win)
     NK_ASSERT(win);
     if (!ctx || !win) return;
 
+    nk_window_index_invalidate(ctx);
     buf = &win->popup.buf;
     buf->last = win->buffer.last;
     buf->end = win->buffer.end;
@@ -15190,7 +20529,6 @@ nk_finish(struct nk_context *ctx, struct nk_window *win)
 {
     struct nk_popup_buffer *buf;
     struct nk_command *parent_last;
-    void *memory;
 
     NK_ASSERT(ctx);
     NK_ASSERT(win);
@@ -15199,8 +20537,7 @@ nk_finish(struct nk_context *ctx, struct nk_window *win)
     if (!win->popup.buf.active) return;
 
     buf = &win->popup.buf;
-    memory = ctx->memory.memory.ptr;
-    parent_last = nk_ptr_add(struct nk_command, memory, buf->parent);
+    parent_last = (struct nk_command*)nk_buffer_at(&ctx->memory, buf->parent);
     parent_last->next = buf->end;
 }
 NK_LIB void
@@ -15208,8 +20545,8 @@ nk_build(struct nk_context *ctx)
 {
     struct nk_window *it = 0;
     struct nk_command *cmd = 0;
-    nk_byte *buffer = 0;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_BUILD);
     /* draw cursor overlay */
     if (!ctx->style.cursor_active)
         ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_ARROW];
@@ -15229,14 +20566,13 @@ nk_build(struct nk_context *ctx)
     }
     /* build one big draw command list out of all window buffers */
     it = ctx->begin;
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
     while (it != 0) {
         struct nk_window *next = it->next;
         if (it->buffer.last == it->buffer.begin || (it->flags & NK_WINDOW_HIDDEN)||
             it->seq != ctx->seq)
             goto cont;
 
-        cmd = nk_ptr_add(struct nk_command, buffer, it->buffer.last);
+        cmd = (struct nk_command*)nk_buffer_at(&ctx->memory, it->buffer.last);
         while (next && ((next->buffer.last == next->buffer.begin) ||
             (next->flags & NK_WINDOW_HIDDEN) || next->seq != ctx->seq))
             next = next->next; /* skip empty command buffers */
@@ -15254,53 +20590,677 @@ nk_build(struct nk_context *ctx)
 
         buf = &it->popup.buf;
         cmd->next = buf->begin;
-        cmd = nk_ptr_add(struct nk_command, buffer, buf->last);
+        cmd = (struct nk_command*)nk_buffer_at(&ctx->memory, buf->last);
         buf->active = nk_false;
         skip: it = next;
     }
-    if (cmd) {
-        /* append overlay commands */
-        if (ctx->overlay.end != ctx->overlay.begin)
-            cmd->next = ctx->overlay.begin;
-        else cmd->next = ctx->memory.allocated;
+    if (cmd) {
+        /* append overlay commands */
+        if (ctx->overlay.end != ctx->overlay.begin)
+            cmd->next = ctx->overlay.begin;
+        else cmd->next = ctx->memory.allocated;
+    }
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_BUILD);
+}
+NK_LIB int
+nk_command_list_begin(struct nk_context *ctx, nk_size *offset)
+{
+    struct nk_window *iter;
+    if (!ctx->build) {
+        nk_build(ctx);
+        ctx->build = nk_true;
+    }
+    iter = ctx->begin;
+    while (iter && ((iter->buffer.begin == iter->buffer.end) ||
+        (iter->flags & NK_WINDOW_HIDDEN) || iter->seq != ctx->seq))
+        iter = iter->next;
+    if (!iter) return 0;
+    *offset = iter->buffer.begin;
+    return 1;
+}
+NK_LIB const struct nk_command*
+nk_command_list_at(const struct nk_buffer *memory, nk_size offset)
+{
+    if (offset >= memory->allocated) return 0;
+    return (const struct nk_command*)nk_buffer_at(memory, offset);
+}
+NK_LIB const struct nk_command*
+nk_command_list_next(const struct nk_buffer *memory, const struct nk_command *cmd)
+{
+    return nk_command_list_at(memory, cmd->next);
+}
+NK_API const struct nk_command*
+nk__begin(struct nk_context *ctx)
+{
+    nk_size offset;
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    if (!ctx->count) return 0;
+    if (!nk_command_list_begin(ctx, &offset)) return 0;
+    return nk_command_list_at(&ctx->memory, offset);
+}
+
+NK_API const struct nk_command*
+nk__next(struct nk_context *ctx, const struct nk_command *cmd)
+{
+    NK_ASSERT(ctx);
+    if (!ctx || !cmd || !ctx->count) return 0;
+    return nk_command_list_next(&ctx->memory, cmd);
+}
+NK_API const struct nk_command*
+nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index)
+{
+    NK_ASSERT(ctxs || !count);
+    NK_ASSERT(index);
+    if (!ctxs || !index) return 0;
+    for (*index = 0; *index < count; ++(*index)) {
+        const struct nk_command *cmd = nk__begin(ctxs[*index]);
+        if (cmd) return cmd;
+    }
+    return 0;
+}
+NK_API const struct nk_command*
+nk__next_contexts(struct nk_context *const *ctxs, int count, int *index,
+    const struct nk_command *cmd)
+{
+    const struct nk_command *next;
+    NK_ASSERT(ctxs);
+    NK_ASSERT(index);
+    if (!ctxs || !index || *index >= count) return 0;
+    next = nk__next(ctxs[*index], cmd);
+    while (!next && ++(*index) < count)
+        next = nk__begin(ctxs[*index]);
+    return next;
+}
+NK_API int
+nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos)
+{
+    /* contexts are drawn back to front so the last one is on top */
+    int i;
+    NK_ASSERT(ctxs || !count);
+    if (!ctxs) return -1;
+    for (i = count-1; i >= 0; --i)
+        if (nk_window_is_any_at(ctxs[i], pos))
+            return i;
+    return -1;
+}
+NK_API void
+nk_frame_init(struct nk_frame *frame, struct nk_buffer *memory)
+{
+    NK_ASSERT(frame);
+    NK_ASSERT(memory);
+    if (!frame || !memory) return;
+    nk_zero(frame, sizeof(*frame));
+    frame->memory = *memory;
+    frame->begin = frame->memory.allocated;
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    nk_draw_list_init(&frame->draw_list);
+#endif
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_frame_init_default(struct nk_frame *frame)
+{
+    struct nk_buffer memory;
+    struct nk_allocator alloc;
+    NK_ASSERT(frame);
+    if (!frame) return;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_buffer_init(&memory, &alloc, NK_DEFAULT_COMMAND_BUFFER_SIZE);
+    nk_frame_init(frame, &memory);
+}
+#endif
+NK_API void
+nk_frame_free(struct nk_frame *frame)
+{
+    NK_ASSERT(frame);
+    if (!frame) return;
+    nk_buffer_free(&frame->memory);
+    nk_zero(frame, sizeof(*frame));
+}
+NK_API int
+nk_frame_swap(struct nk_context *ctx, struct nk_frame *frame)
+{
+    struct nk_input_recorder *recorder;
+    struct nk_buffer memory;
+    nk_size begin = 0;
+    int commands = 0;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(frame);
+    NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
+    NK_ASSERT(ctx->use_pool && "windows inside the command buffer cannot be handed off");
+    if (!ctx || !frame || ctx->current || !ctx->use_pool) return 0;
+
+    /* link window command buffers into one list before handing it over */
+    if (ctx->count)
+        commands = nk_command_list_begin(ctx, &begin);
+    frame->begin = (commands) ? begin: ctx->memory.allocated;
+    frame->seq = ctx->seq;
+    ctx->memory_stats.command_high_water = NK_MAX(
+        ctx->memory_stats.command_high_water, ctx->memory.allocated);
+    /* the recorder has to hash the commands before they are handed over */
+    recorder = ctx->recorder;
+    if (recorder)
+        nk_input_record_frame(ctx);
+
+    /* exchange buffers instead of copying and start over with the old one */
+    memory = frame->memory;
+    frame->memory = ctx->memory;
+    ctx->memory = memory;
+    ctx->recorder = 0;
+    nk_clear(ctx);
+    ctx->recorder = recorder;
+    return commands;
+}
+NK_API const struct nk_command*
+nk__frame_begin(const struct nk_frame *frame)
+{
+    NK_ASSERT(frame);
+    if (!frame) return 0;
+    return nk_command_list_at(&frame->memory, frame->begin);
+}
+NK_API const struct nk_command*
+nk__frame_next(const struct nk_frame *frame, const struct nk_command *cmd)
+{
+    NK_ASSERT(frame);
+    if (!frame || !cmd) return 0;
+    return nk_command_list_next(&frame->memory, cmd);
+}
+
+
+
+
+/* ===============================================================
+ *
+ *                          COMMAND STREAM
+ *
+ * ===============================================================*/
+/*  A stream message holds one frame:
+
+        'N' 'K' version flags
+        sequence number
+        number of new handle table entries followed by the entries
+        number of window ranges followed by the ranges
+
+    Handle table entries are appended to the table of the previous message
+    unless the message is a key frame which starts with an empty table.
+    Each entry is a kind byte followed by a font index and height, an image
+    or a userdata handle. Handles are copied as raw bytes.
+    Window ranges start with the window name hash and a tag. Bit zero of the
+    tag marks a range that is unchanged from the range with the same name
+    inside the previous message. Otherwise the tag holds the size of the
+    range shifted left by one followed by the packed commands described in
+    the command packing section. */
+#define NK_STREAM_VERSION 1
+enum nk_stream_flags {
+    NK_STREAM_KEY_FRAME = NK_FLAG(0)
+};
+enum nk_stream_entry {
+    NK_STREAM_ENTRY_FONT,
+    NK_STREAM_ENTRY_IMAGE,
+    NK_STREAM_ENTRY_HANDLE
+};
+struct nk_stream_range {
+    nk_hash key;
+    nk_size offset;
+    nk_size size;
+};
+NK_INTERN void
+nk_stream_history_init(struct nk_stream_history *history,
+    const struct nk_allocator *alloc)
+{
+    int i;
+    nk_zero(history, sizeof(*history));
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_init(&history->ranges[i], alloc, 16 * sizeof(struct nk_stream_range));
+        nk_buffer_init(&history->data[i], alloc, NK_DEFAULT_COMMAND_BUFFER_SIZE);
+    }
+}
+NK_INTERN void
+nk_stream_history_free(struct nk_stream_history *history)
+{
+    int i;
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_free(&history->ranges[i]);
+        nk_buffer_free(&history->data[i]);
+    }
+    nk_zero(history, sizeof(*history));
+}
+NK_INTERN void
+nk_stream_history_clear(struct nk_stream_history *history)
+{
+    int i;
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_clear(&history->ranges[i]);
+        nk_buffer_clear(&history->data[i]);
+    }
+}
+NK_INTERN struct nk_stream_range*
+nk_stream_history_add(struct nk_stream_history *history, nk_hash key)
+{
+    struct nk_buffer *ranges = &history->ranges[history->current ^ 1];
+    struct nk_stream_range *range = (struct nk_stream_range*)nk_buffer_alloc(ranges,
+        NK_BUFFER_FRONT, sizeof(*range), NK_ALIGNOF(struct nk_stream_range));
+    if (!range) return 0;
+    range->key = key;
+    range->offset = history->data[history->current ^ 1].allocated;
+    range->size = 0;
+    return range;
+}
+NK_INTERN const struct nk_stream_range*
+nk_stream_history_find(const struct nk_stream_history *history, nk_hash key)
+{
+    /* encoder and decoder have to agree on the first range with a name */
+    const struct nk_buffer *ranges = &history->ranges[history->current];
+    const struct nk_stream_range *range = (const struct nk_stream_range*)ranges->memory.ptr;
+    nk_size count = ranges->allocated / sizeof(*range);
+    nk_size i;
+    for (i = 0; i < count; ++i) {
+        if (range[i].key == key)
+            return &range[i];
+    }
+    return 0;
+}
+NK_INTERN int
+nk_stream_write(struct nk_buffer *out, const void *data, nk_size size)
+{
+    void *memory;
+    if (!size) return 1;
+    memory = nk_buffer_alloc(out, NK_BUFFER_FRONT, size, 1);
+    if (!memory) return 0;
+    NK_MEMCPY(memory, data, size);
+    return 1;
+}
+NK_INTERN int
+nk_stream_write_uint(struct nk_buffer *out, nk_uint v)
+{
+    nk_byte tmp[8];
+    return nk_stream_write(out, tmp, (nk_size)(nk_pack_uint(tmp, v) - tmp));
+}
+NK_INTERN int
+nk_stream_write_entry(const struct nk_stream_encoder *enc, struct nk_buffer *out,
+    const struct nk_packed_ref *ref)
+{
+    nk_byte tmp[64];
+    nk_byte *p = tmp;
+    int i;
+    if (ref->font) {
+        /* fonts are sent as index into the font list shared with the decoder */
+        for (i = 0; i < enc->font_count && enc->fonts[i] != ref->font; ++i);
+        NK_ASSERT(i < enc->font_count && "font used by a text command was not registered");
+        *p++ = NK_STREAM_ENTRY_FONT;
+        p = nk_pack_uint(p, (nk_uint)((i < enc->font_count) ? i: 0));
+        p = nk_pack_float(p, ref->height);
+    } else if (ref->handle.ptr) {
+        *p++ = NK_STREAM_ENTRY_HANDLE;
+        NK_MEMCPY(p, &ref->handle, sizeof(ref->handle));
+        p += sizeof(ref->handle);
+    } else {
+        *p++ = NK_STREAM_ENTRY_IMAGE;
+        NK_MEMCPY(p, &ref->img.handle, sizeof(ref->img.handle));
+        p += sizeof(ref->img.handle);
+        p = nk_pack_uint(p, ref->img.w);
+        p = nk_pack_uint(p, ref->img.h);
+        for (i = 0; i < 4; ++i)
+            p = nk_pack_uint(p, ref->img.region[i]);
+    }
+    return nk_stream_write(out, tmp, (nk_size)(p - tmp));
+}
+NK_INTERN int
+nk_stream_read(const nk_byte **p, const nk_byte *end, void *data, nk_size size)
+{
+    if ((nk_size)(end - *p) < size) return 0;
+    NK_MEMCPY(data, *p, size);
+    *p += size;
+    return 1;
+}
+NK_INTERN int
+nk_stream_read_uint(const nk_byte **p, const nk_byte *end, nk_uint *v)
+{
+    const nk_byte *in = *p;
+    int shift = 0;
+    *v = 0;
+    while (in < end && shift < 32) {
+        *v |= (nk_uint)(*in & 0x7F) << shift;
+        shift += 7;
+        if (!(*in++ & 0x80)) {
+            *p = in;
+            return 1;
+        }
     }
+    return 0;
 }
-NK_API const struct nk_command*
-nk__begin(struct nk_context *ctx)
+NK_INTERN int
+nk_stream_read_entry(const struct nk_stream_decoder *dec, const nk_byte **p,
+    const nk_byte *end, struct nk_packed_ref *ref)
 {
-    struct nk_window *iter;
-    nk_byte *buffer;
+    nk_byte kind;
+    nk_uint v;
+    int i;
+    nk_zero(ref, sizeof(*ref));
+    if (!nk_stream_read(p, end, &kind, 1)) return 0;
+    switch (kind) {
+    case NK_STREAM_ENTRY_FONT:
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        if (!nk_stream_read(p, end, &ref->height, sizeof(ref->height))) return 0;
+        if (v < (nk_uint)dec->font_count)
+            ref->font = dec->fonts[v];
+        return 1;
+    case NK_STREAM_ENTRY_HANDLE:
+        return nk_stream_read(p, end, &ref->handle, sizeof(ref->handle));
+    case NK_STREAM_ENTRY_IMAGE:
+        if (!nk_stream_read(p, end, &ref->img.handle, sizeof(ref->img.handle))) return 0;
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        ref->img.w = (unsigned short)v;
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        ref->img.h = (unsigned short)v;
+        for (i = 0; i < 4; ++i) {
+            if (!nk_stream_read_uint(p, end, &v)) return 0;
+            ref->img.region[i] = (unsigned short)v;
+        }
+        return 1;
+    default: return 0;
+    }
+}
+NK_API void
+nk_stream_encoder_init(struct nk_stream_encoder *enc, const struct nk_allocator *alloc,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    NK_ASSERT(enc);
+    NK_ASSERT(alloc);
+    NK_ASSERT(fonts || !font_count);
+    if (!enc || !alloc) return;
+    nk_zero(enc, sizeof(*enc));
+    nk_command_packing_init(&enc->packing, alloc);
+    nk_stream_history_init(&enc->history, alloc);
+    enc->fonts = fonts;
+    enc->font_count = font_count;
+    enc->key = nk_true;
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_stream_encoder_init_default(struct nk_stream_encoder *enc,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_stream_encoder_init(enc, &alloc, fonts, font_count);
+}
+#endif
+NK_API void
+nk_stream_encoder_free(struct nk_stream_encoder *enc)
+{
+    NK_ASSERT(enc);
+    if (!enc) return;
+    nk_command_packing_free(&enc->packing);
+    nk_stream_history_free(&enc->history);
+    nk_zero(enc, sizeof(*enc));
+}
+NK_API void
+nk_stream_encoder_reset(struct nk_stream_encoder *enc)
+{
+    NK_ASSERT(enc);
+    if (!enc) return;
+    enc->key = nk_true;
+}
+NK_API nk_size
+nk_stream_encode(struct nk_stream_encoder *enc, struct nk_context *ctx,
+    struct nk_buffer *out)
+{
+    /* handle table entries before the table is sent again from scratch */
+    NK_STORAGE const nk_size table_limit = 1024;
+    struct nk_stream_history *history;
+    struct nk_buffer *data;
+    struct nk_stream_range *range = 0;
+    const struct nk_stream_range *ranges, *prev;
+    const struct nk_packed_ref *table;
+    const struct nk_command *cmd;
+    struct nk_window *win;
+    nk_size offset = 0, begin, count, i;
+    nk_uint entries;
+    nk_byte header[4];
+    int key;
+
+    NK_ASSERT(enc);
     NK_ASSERT(ctx);
-    if (!ctx) return 0;
-    if (!ctx->count) return 0;
+    NK_ASSERT(out);
+    NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
+    if (!enc || !ctx || !out || ctx->current) return 0;
+
+    history = &enc->history;
+    key = enc->key || enc->packing.table.allocated > table_limit * sizeof(struct nk_packed_ref);
+    if (key) {
+        nk_buffer_clear(&enc->packing.table);
+        enc->sent = 0;
+    }
+
+    /* pack commands of each window into its own range */
+    data = &history->data[history->current ^ 1];
+    nk_buffer_clear(data);
+    nk_buffer_clear(&history->ranges[history->current ^ 1]);
+    if (ctx->count && nk_command_list_begin(ctx, &offset)) {
+        win = ctx->begin;
+        for (;;) {
+            nk_size size, used;
+            nk_byte *memory;
+            cmd = nk_command_list_at(&ctx->memory, offset);
+            if (!cmd) break;
+
+            /* windows are visited in the order linked by `nk_build`, popups
+             * and the cursor overlay follow as part of the last range */
+            for (; win; win = win->next) {
+                nk_size start = win->buffer.begin;
+                if (win->buffer.last == win->buffer.begin ||
+                    (win->flags & NK_WINDOW_HIDDEN) || win->seq != ctx->seq)
+                    continue;
+                if (start != offset) break;
+                range = nk_stream_history_add(history, win->name);
+                if (!range) return 0;
+            }
+            if (!range && !(range = nk_stream_history_add(history, 0)))
+                return 0;
 
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
-    if (!ctx->build) {
-        nk_build(ctx);
-        ctx->build = nk_true;
+            /* callbacks cannot be called by another process */
+            offset = cmd->next;
+            if (cmd->type == NK_COMMAND_NOP || cmd->type == NK_COMMAND_CUSTOM)
+                continue;
+            size = nk_command_packed_size(cmd);
+            memory = (nk_byte*)nk_buffer_alloc(data, NK_BUFFER_FRONT, size, 1);
+            if (!memory) return 0;
+            used = (nk_size)(nk_pack_command(&enc->packing, memory, cmd) - memory);
+            data->allocated -= size - used;
+            data->needed -= size - used;
+            range->size += used;
+        }
     }
-    iter = ctx->begin;
-    while (iter && ((iter->buffer.begin == iter->buffer.end) ||
-        (iter->flags & NK_WINDOW_HIDDEN) || iter->seq != ctx->seq))
-        iter = iter->next;
-    if (!iter) return 0;
-    return nk_ptr_add_const(struct nk_command, buffer, iter->buffer.begin);
-}
 
-NK_API const struct nk_command*
-nk__next(struct nk_context *ctx, const struct nk_command *cmd)
+    /* header and handle table entries added by this frame */
+    begin = out->allocated;
+    header[0] = 'N';
+    header[1] = 'K';
+    header[2] = NK_STREAM_VERSION;
+    header[3] = (nk_byte)((key) ? NK_STREAM_KEY_FRAME: 0);
+    table = (const struct nk_packed_ref*)enc->packing.table.memory.ptr;
+    entries = (nk_uint)(enc->packing.table.allocated / sizeof(*table));
+    if (!nk_stream_write(out, header, sizeof(header)) ||
+        !nk_stream_write_uint(out, ctx->seq) ||
+        !nk_stream_write_uint(out, entries - enc->sent))
+        goto fail;
+    for (i = enc->sent; i < entries; ++i) {
+        if (!nk_stream_write_entry(enc, out, &table[i]))
+            goto fail;
+    }
+
+    /* ranges equal to the previous frame are sent as reference */
+    ranges = (const struct nk_stream_range*)history->ranges[history->current ^ 1].memory.ptr;
+    count = history->ranges[history->current ^ 1].allocated / sizeof(*ranges);
+    if (!nk_stream_write_uint(out, (nk_uint)count))
+        goto fail;
+    for (i = 0; i < count; ++i) {
+        const nk_byte *bytes = (const nk_byte*)nk_buffer_at(data, ranges[i].offset);
+        prev = (key) ? 0: nk_stream_history_find(history, ranges[i].key);
+        if (!nk_stream_write_uint(out, ranges[i].key))
+            goto fail;
+        if (prev && prev->size == ranges[i].size) {
+            const nk_byte *old = (const nk_byte*)nk_buffer_at(&history->data[history->current], prev->offset);
+            nk_size n = 0;
+            while (n < prev->size && old[n] == bytes[n]) n++;
+            if (n == prev->size) {
+                if (!nk_stream_write_uint(out, 1)) goto fail;
+                continue;
+            }
+        }
+        if (!nk_stream_write_uint(out, (nk_uint)(ranges[i].size << 1)) ||
+            !nk_stream_write(out, bytes, ranges[i].size))
+            goto fail;
+    }
+    history->current ^= 1;
+    enc->sent = entries;
+    enc->key = nk_false;
+    return out->allocated - begin;
+
+fail:
+    /* nothing was sent so the next message has to include this frame's entries */
+    out->allocated = begin;
+    out->needed = begin;
+    return 0;
+}
+NK_API void
+nk_stream_decoder_init(struct nk_stream_decoder *dec, const struct nk_allocator *alloc,
+    const struct nk_user_font *const *fonts, int font_count)
 {
-    nk_byte *buffer;
-    const struct nk_command *next;
-    NK_ASSERT(ctx);
-    if (!ctx || !cmd || !ctx->count) return 0;
-    if (cmd->next >= ctx->memory.allocated) return 0;
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
-    next = nk_ptr_add_const(struct nk_command, buffer, cmd->next);
-    return next;
+    NK_ASSERT(dec);
+    NK_ASSERT(alloc);
+    NK_ASSERT(fonts || !font_count);
+    if (!dec || !alloc) return;
+    nk_zero(dec, sizeof(*dec));
+    nk_command_packing_init(&dec->packing, alloc);
+    nk_stream_history_init(&dec->history, alloc);
+    dec->fonts = fonts;
+    dec->font_count = font_count;
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_stream_decoder_init_default(struct nk_stream_decoder *dec,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_stream_decoder_init(dec, &alloc, fonts, font_count);
 }
+#endif
+NK_API void
+nk_stream_decoder_free(struct nk_stream_decoder *dec)
+{
+    NK_ASSERT(dec);
+    if (!dec) return;
+    nk_command_packing_free(&dec->packing);
+    nk_stream_history_free(&dec->history);
+    nk_zero(dec, sizeof(*dec));
+}
+NK_API int
+nk_stream_decode(struct nk_stream_decoder *dec, struct nk_frame *frame,
+    const void *message, nk_size size)
+{
+    /* upper bound of a packed command without text or points so reading a
+     * truncated command never leaves the range memory */
+    NK_STORAGE const nk_size slack = 64;
+    struct nk_stream_history *history;
+    struct nk_buffer *data;
+    const struct nk_stream_range *ranges;
+    const nk_byte *p = (const nk_byte*)message;
+    const nk_byte *end = p + size;
+    nk_byte header[4];
+    nk_uint seq, entries, count, key, tag, i;
+    void *memory;
 
+    NK_ASSERT(dec);
+    NK_ASSERT(frame);
+    NK_ASSERT(message || !size);
+    if (!dec || !frame || !message) return 0;
+    if (!nk_stream_read(&p, end, header, sizeof(header)) ||
+        header[0] != 'N' || header[1] != 'K' || header[2] != NK_STREAM_VERSION)
+        goto fail;
+
+    /* messages after a decoding error reference state the decoder lost */
+    history = &dec->history;
+    if (header[3] & NK_STREAM_KEY_FRAME) {
+        nk_buffer_clear(&dec->packing.table);
+        nk_stream_history_clear(history);
+        dec->valid = nk_true;
+    } else if (!dec->valid) return 0;
+
+    if (!nk_stream_read_uint(&p, end, &seq) || !nk_stream_read_uint(&p, end, &entries))
+        goto fail;
+    for (i = 0; i < entries; ++i) {
+        struct nk_packed_ref ref, *entry;
+        if (!nk_stream_read_entry(dec, &p, end, &ref)) goto fail;
+        entry = (struct nk_packed_ref*)nk_buffer_alloc(&dec->packing.table,
+            NK_BUFFER_FRONT, sizeof(ref), NK_ALIGNOF(struct nk_packed_ref));
+        if (!entry) goto fail;
+        *entry = ref;
+    }
+
+    /* gather packed commands of all ranges */
+    data = &history->data[history->current ^ 1];
+    nk_buffer_clear(data);
+    nk_buffer_clear(&history->ranges[history->current ^ 1]);
+    if (!nk_stream_read_uint(&p, end, &count)) goto fail;
+    for (i = 0; i < count; ++i) {
+        struct nk_stream_range *range;
+        const nk_byte *bytes;
+        nk_size n;
+        if (!nk_stream_read_uint(&p, end, &key) || !nk_stream_read_uint(&p, end, &tag))
+            goto fail;
+        if (tag & 1) {
+            const struct nk_stream_range *prev = nk_stream_history_find(history, key);
+            if (!prev) goto fail;
+            bytes = (const nk_byte*)nk_buffer_at(&history->data[history->current], prev->offset);
+            n = prev->size;
+        } else {
+            bytes = p;
+            n = (nk_size)(tag >> 1);
+            if ((nk_size)(end - p) < n) goto fail;
+            p += n;
+        }
+        range = nk_stream_history_add(history, key);
+        if (!range || !nk_stream_write(data, bytes, n)) goto fail;
+        range->size = n;
+    }
+    memory = nk_buffer_alloc(data, NK_BUFFER_FRONT, slack, 1);
+    if (!memory) goto fail;
+    NK_MEMSET(memory, 0, slack);
+
+    /* unpack into a native command list */
+    nk_buffer_clear(&frame->memory);
+    frame->begin = frame->memory.allocated;
+    frame->seq = seq;
+    ranges = (const struct nk_stream_range*)history->ranges[history->current ^ 1].memory.ptr;
+    for (i = 0; i < count; ++i) {
+        const nk_byte *in = (const nk_byte*)nk_buffer_at(data, ranges[i].offset);
+        const nk_byte *last = in + ranges[i].size;
+        while (in < last) {
+            struct nk_command *cmd = nk_unpack_command(&dec->packing, &in, last, &frame->memory);
+            if (!cmd || in > last) goto fail;
+            cmd->next = frame->memory.allocated;
+        }
+    }
+    history->current ^= 1;
+    return 1;
 
+fail:
+    nk_buffer_clear(&frame->memory);
+    frame->begin = frame->memory.allocated;
+    dec->valid = nk_false;
+    return 0;
+}
 
 
 
@@ -15343,6 +21303,13 @@ nk_pool_init_fixed(struct nk_pool *pool, void *memory, nk_size size)
     pool->type = NK_BUFFER_FIXED;
     pool->size = size;
 }
+NK_LIB nk_size
+nk_pool_page_size(const struct nk_pool *pool)
+{
+    if (pool->type == NK_BUFFER_FIXED)
+        return pool->size;
+    return sizeof(struct nk_page) + NK_POOL_DEFAULT_CAPACITY * sizeof(union nk_page_data);
+}
 NK_LIB struct nk_page_element*
 nk_pool_alloc(struct nk_pool *pool)
 {
@@ -15355,8 +21322,7 @@ nk_pool_alloc(struct nk_pool *pool)
             NK_ASSERT(pool->pages->size < pool->capacity);
             return 0;
         } else {
-            nk_size size = sizeof(struct nk_page);
-            size += NK_POOL_DEFAULT_CAPACITY * sizeof(union nk_page_data);
+            nk_size size = nk_pool_page_size(pool);
             page = (struct nk_page*)pool->alloc.alloc(pool->alloc.userdata,0, size);
             page->next = pool->pages;
             pool->pages = page;
@@ -15428,6 +21394,138 @@ nk_free_page_element(struct nk_context *ctx, struct nk_page_element *elem)
     else nk_link_page_element_into_freelist(ctx, elem);}
 }
 
+NK_INTERN struct nk_page_element*
+nk_page_element_of(void *data)
+{
+    union nk_page_data *pd = (union nk_page_data*)data;
+    return NK_CONTAINER_OF(pd, struct nk_page_element, data);
+}
+NK_INTERN void*
+nk_page_element_moved(void *data)
+{
+    /* moved elements point to their new location */
+    struct nk_page_element *elem;
+    if (!data) return 0;
+    elem = nk_page_element_of(data);
+    if (elem->prev && elem->prev != elem)
+        return &elem->prev->data;
+    return data;
+}
+NK_INTERN void
+nk_page_element_fix_window(struct nk_window *win)
+{
+    struct nk_table *it;
+    for (; win; win = win->popup.win) {
+        win->next = (struct nk_window*)nk_page_element_moved(win->next);
+        win->prev = (struct nk_window*)nk_page_element_moved(win->prev);
+        win->parent = (struct nk_window*)nk_page_element_moved(win->parent);
+        win->popup.win = (struct nk_window*)nk_page_element_moved(win->popup.win);
+        win->tables = (struct nk_table*)nk_page_element_moved(win->tables);
+        /* panels only live between `nk_begin` and `nk_end` */
+        win->layout = 0;
+        for (it = win->tables; it; it = it->next) {
+            it->next = (struct nk_table*)nk_page_element_moved(it->next);
+            it->prev = (struct nk_table*)nk_page_element_moved(it->prev);
+        }
+    }
+}
+NK_API nk_size
+nk_memory_compact(struct nk_context *ctx)
+{
+    struct nk_pool *pool;
+    struct nk_page **pages, *page;
+    struct nk_page_element *elem, *slot;
+    struct nk_window *win;
+    unsigned int *live;
+    unsigned int count = 0, keep, total = 0, i, j, k, n;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(!ctx->current && "page elements can only be compacted outside of a frame");
+    if (!ctx || ctx->current || !ctx->use_pool) return 0;
+    pool = &ctx->pool;
+    if (pool->type == NK_BUFFER_FIXED || !pool->pages) return 0;
+
+    /* free elements are marked by pointing to themselves, live elements
+     * always have a null `prev` pointer since only the free list links them */
+    for (page = pool->pages; page; page = page->next)
+        count++;
+    pages = (struct nk_page**)pool->alloc.alloc(pool->alloc.userdata, 0,
+        count * (sizeof(*pages) + sizeof(*live)));
+    if (!pages) return 0;
+    live = (unsigned int*)(void*)(pages + count);
+    for (elem = ctx->freelist; elem; elem = elem->next)
+        elem->prev = elem;
+
+    /* sort pages by number of live elements, fullest first */
+    for (i = 0, page = pool->pages; page; page = page->next, ++i) {
+        n = 0;
+        for (j = 0; j < page->size; ++j)
+            if (page->win[j].prev != &page->win[j]) n++;
+        total += n;
+        for (k = i; k > 0 && live[k-1] < n; --k) {
+            live[k] = live[k-1];
+            pages[k] = pages[k-1];
+        }
+        live[k] = n;
+        pages[k] = page;
+    }
+    keep = (total + pool->capacity - 1) / pool->capacity;
+    if (keep >= count) {
+        for (elem = ctx->freelist; elem; elem = elem->next)
+            elem->prev = 0;
+        pool->alloc.free(pool->alloc.userdata, pages);
+        return 0;
+    }
+
+    /* move live elements from the emptiest pages into free slots of the others */
+    for (i = 0; i < keep; ++i) {
+        for (j = pages[i]->size; j < pool->capacity; ++j)
+            pages[i]->win[j].prev = &pages[i]->win[j];
+        pages[i]->size = pool->capacity;
+    }
+    k = 0; n = 0;
+    for (i = keep; i < count; ++i) {
+        for (j = 0; j < pages[i]->size; ++j) {
+            elem = &pages[i]->win[j];
+            if (elem->prev == elem) continue;
+            while (pages[k]->win[n].prev != &pages[k]->win[n]) {
+                if (++n == pool->capacity) {n = 0; k++;}
+                NK_ASSERT(k < keep);
+            }
+            slot = &pages[k]->win[n];
+            *slot = *elem;
+            elem->prev = slot;
+        }
+    }
+
+    /* fix up pointers while forward pointers inside the old pages are intact */
+    ctx->begin = (struct nk_window*)nk_page_element_moved(ctx->begin);
+    ctx->end = (struct nk_window*)nk_page_element_moved(ctx->end);
+    ctx->active = (struct nk_window*)nk_page_element_moved(ctx->active);
+    ctx->hovered = (struct nk_window*)nk_page_element_moved(ctx->hovered);
+    for (win = ctx->begin; win; win = win->next)
+        nk_page_element_fix_window(win);
+    nk_window_index_invalidate(ctx);
+
+    /* rebuild page list and free list out of the kept pages */
+    pool->pages = 0;
+    ctx->freelist = 0;
+    for (i = keep; i-- > 0;) {
+        pages[i]->next = pool->pages;
+        pool->pages = pages[i];
+        for (j = pool->capacity; j-- > 0;) {
+            elem = &pages[i]->win[j];
+            if (elem->prev != elem) continue;
+            elem->prev = 0;
+            elem->next = 0;
+            nk_link_page_element_into_freelist(ctx, elem);
+        }
+    }
+    for (i = keep; i < count; ++i)
+        pool->alloc.free(pool->alloc.userdata, pages[i]);
+    pool->alloc.free(pool->alloc.userdata, pages);
+    return (nk_size)(count - keep) * nk_pool_page_size(pool);
+}
 
 
 
@@ -15622,10 +21720,12 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
     NK_ASSERT(ctx->current);
     NK_ASSERT(ctx->current->layout);
     if (!ctx || !ctx->current || !ctx->current->layout) return 0;
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
     nk_zero(ctx->current->layout, sizeof(*ctx->current->layout));
     if ((ctx->current->flags & NK_WINDOW_HIDDEN) || (ctx->current->flags & NK_WINDOW_CLOSED)) {
         nk_zero(ctx->current->layout, sizeof(struct nk_panel));
         ctx->current->layout->type = panel_type;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
         return 0;
     }
     /* pull state into local stack */
@@ -15666,6 +21766,7 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
         if (left_mouse_down && left_mouse_click_in_cursor && !left_mouse_clicked) {
             win->bounds.x = win->bounds.x + in->mouse.delta.x;
             win->bounds.y = win->bounds.y + in->mouse.delta.y;
+            nk_window_index_invalidate(ctx);
             in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x += in->mouse.delta.x;
             in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.y += in->mouse.delta.y;
             ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_MOVE];
@@ -15787,9 +21888,12 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
             if (nk_do_button_symbol(&ws, &win->buffer, button, (layout->flags & NK_WINDOW_MINIMIZED)?
                 style->window.header.maximize_symbol: style->window.header.minimize_symbol,
                 NK_BUTTON_DEFAULT, &style->window.header.minimize_button, in, style->font) && !(win->flags & NK_WINDOW_ROM))
+            {
                 layout->flags = (layout->flags & NK_WINDOW_MINIMIZED) ?
                     layout->flags & (nk_flags)~NK_WINDOW_MINIMIZED:
                     layout->flags | NK_WINDOW_MINIMIZED;
+                nk_window_index_invalidate(ctx);
+            }
         }}
 
         {/* window header title */
@@ -15826,6 +21930,7 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
         layout->clip.x + layout->clip.w, layout->clip.y + layout->clip.h);
     nk_push_scissor(out, clip);
     layout->clip = clip;}
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
     return !(layout->flags & NK_WINDOW_HIDDEN) && !(layout->flags & NK_WINDOW_MINIMIZED);
 }
 NK_LIB void
@@ -15839,6 +21944,7 @@ nk_panel_end(struct nk_context *ctx)
 
     struct nk_vec2 scrollbar_size;
     struct nk_vec2 panel_padding;
+    int scrollbars_visible;
 
     NK_ASSERT(ctx);
     NK_ASSERT(ctx->current);
@@ -15846,6 +21952,7 @@ nk_panel_end(struct nk_context *ctx)
     if (!ctx || !ctx->current || !ctx->current->layout)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_PANEL_END);
     window = ctx->current;
     layout = window->layout;
     style = &ctx->style;
@@ -15903,9 +22010,10 @@ nk_panel_end(struct nk_context *ctx)
     }
 
     /* scrollbars */
-    if (!(layout->flags & NK_WINDOW_NO_SCROLLBAR) &&
+    scrollbars_visible = !(layout->flags & NK_WINDOW_NO_SCROLLBAR) &&
         !(layout->flags & NK_WINDOW_MINIMIZED) &&
-        window->scrollbar_hiding_timer < NK_SCROLLBAR_HIDING_TIMEOUT)
+        window->scrollbar_hiding_timer < NK_SCROLLBAR_HIDING_TIMEOUT;
+    if (scrollbars_visible)
     {
         struct nk_rect scroll;
         int scroll_has_scrolling;
@@ -15997,6 +22105,10 @@ nk_panel_end(struct nk_context *ctx)
         if ((!has_input && is_window_hovered) || (!is_window_hovered && !any_item_active))
             window->scrollbar_hiding_timer += ctx->delta_time_seconds;
         else window->scrollbar_hiding_timer = 0;
+
+        /* scrollbars drawn this frame disappear once the timer runs out */
+        if (scrollbars_visible)
+            nk_frame_schedule(ctx, NK_SCROLLBAR_HIDING_TIMEOUT - window->scrollbar_hiding_timer);
     } else window->scrollbar_hiding_timer = 0;
 
     /* window border */
@@ -16071,6 +22183,7 @@ nk_panel_end(struct nk_context *ctx)
                         }
                     }
                 }
+                nk_window_index_invalidate(ctx);
                 ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_RESIZE_TOP_RIGHT_DOWN_LEFT];
                 in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x = scaler.x + scaler.w/2.0f;
                 in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.y = scaler.y + scaler.h/2.0f;
@@ -16122,6 +22235,7 @@ nk_panel_end(struct nk_context *ctx)
     window->popup.combo_count = 0;
     /* helper to make sure you have a 'nk_tree_push' for every 'nk_tree_pop' */
     NK_ASSERT(!layout->row.tree_depth);
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_END);
 }
 
 
@@ -16202,6 +22316,7 @@ nk_insert_window(struct nk_context *ctx, struct nk_window *win,
         iter = iter->next;
     }
 
+    nk_window_index_invalidate(ctx);
     if (!ctx->begin) {
         win->next = 0;
         win->prev = 0;
@@ -16233,6 +22348,7 @@ nk_insert_window(struct nk_context *ctx, struct nk_window *win,
 NK_LIB void
 nk_remove_window(struct nk_context *ctx, struct nk_window *win)
 {
+    nk_window_index_invalidate(ctx);
     if (win == ctx->begin || win == ctx->end) {
         if (win == ctx->begin) {
             ctx->begin = win->next;
@@ -16282,6 +22398,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
     if (!ctx || ctx->current || !title || !name)
         return 0;
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
 
     /* find or create window */
     style = &ctx->style;
@@ -16293,7 +22410,10 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         nk_size name_length = (nk_size)name_len;
         win = (struct nk_window*)nk_create_window(ctx);
         NK_ASSERT(win);
-        if (!win) return 0;
+        if (!win) {
+            NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
+            return 0;
+        }
 
         if (flags & NK_WINDOW_BACKGROUND)
             nk_insert_window(ctx, win, NK_INSERT_FRONT);
@@ -16313,8 +22433,12 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         /* update window */
         win->flags &= ~(nk_flags)(NK_WINDOW_PRIVATE-1);
         win->flags |= flags;
-        if (!(win->flags & (NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE)))
+        if (!(win->flags & (NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE)) &&
+            (win->bounds.x != bounds.x || win->bounds.y != bounds.y ||
+            win->bounds.w != bounds.w || win->bounds.h != bounds.h)) {
             win->bounds = bounds;
+            nk_window_index_invalidate(ctx);
+        }
         /* If this assert triggers you either:
          *
          * I.) Have more than one window with the same name or
@@ -16325,6 +22449,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         NK_ASSERT(win->seq != ctx->seq);
         win->seq = ctx->seq;
         if (!ctx->active && !(win->flags & NK_WINDOW_HIDDEN)) {
+            nk_window_index_invalidate(ctx);
             ctx->active = win;
             ctx->end = win;
         }
@@ -16332,6 +22457,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     if (win->flags & NK_WINDOW_HIDDEN) {
         ctx->current = win;
         win->layout = 0;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
         return 0;
     } else nk_start(ctx, win);
 
@@ -16350,8 +22476,13 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         inpanel = inpanel && ctx->input.mouse.buttons[NK_BUTTON_LEFT].clicked;
         ishovered = nk_input_is_mouse_hovering_rect(&ctx->input, win_bounds);
         if ((win != ctx->active) && ishovered && !ctx->input.mouse.buttons[NK_BUTTON_LEFT].down) {
+            /* a window above this one under the mouse always overlaps it, so
+             * only the topmost hovered window has to look at all windows above */
+            struct nk_window *top = nk_window_at_mouse(ctx);
             iter = win->next;
-            while (iter) {
+            if (top && top != win && top->order > win->order && !(win->flags & NK_WINDOW_BACKGROUND))
+                iter = top;
+            else while (iter) {
                 struct nk_rect iter_bounds = (!(iter->flags & NK_WINDOW_MINIMIZED))?
                     iter->bounds: nk_rect(iter->bounds.x, iter->bounds.y, iter->bounds.w, h);
                 if (NK_INTERSECT(win_bounds.x, win_bounds.y, win_bounds.w, win_bounds.h,
@@ -16370,8 +22501,11 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
 
         /* activate window if clicked */
         if (iter && inpanel && (win != ctx->end)) {
+            struct nk_window *top = nk_window_at_mouse(ctx);
             iter = win->next;
-            while (iter) {
+            if (top && top != win && top->order > win->order && !(win->flags & NK_WINDOW_BACKGROUND))
+                iter = top;
+            else while (iter) {
                 /* try to find a panel with higher priority in the same position */
                 struct nk_rect iter_bounds = (!(iter->flags & NK_WINDOW_MINIMIZED))?
                 iter->bounds: nk_rect(iter->bounds.x, iter->bounds.y, iter->bounds.w, h);
@@ -16417,6 +22551,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     ret = nk_panel_begin(ctx, title, NK_PANEL_WINDOW);
     win->layout->offset_x = &win->scrollbar.x;
     win->layout->offset_y = &win->scrollbar.y;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
     return ret;
 }
 NK_API void
@@ -16428,14 +22563,17 @@ nk_end(struct nk_context *ctx)
     if (!ctx || !ctx->current)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_WINDOW_END);
     layout = ctx->current->layout;
     if (!layout || (layout->type == NK_PANEL_WINDOW && (ctx->current->flags & NK_WINDOW_HIDDEN))) {
         ctx->current = 0;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_END);
         return;
     }
     nk_panel_end(ctx);
     nk_free_panel(ctx, ctx->current->layout);
     ctx->current = 0;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_END);
 }
 NK_API struct nk_rect
 nk_window_get_bounds(const struct nk_context *ctx)
@@ -16563,33 +22701,81 @@ nk_window_is_hovered(struct nk_context *ctx)
         return 0;
     return nk_input_is_mouse_hovering_rect(&ctx->input, ctx->current->bounds);
 }
-NK_API int
-nk_window_is_any_hovered(struct nk_context *ctx)
+NK_INTERN int
+nk_window_is_at(const struct nk_context *ctx, const struct nk_window *win,
+    struct nk_vec2 pos)
 {
-    struct nk_window *iter;
+    struct nk_rect r;
+    if (win->flags & NK_WINDOW_HIDDEN)
+        return 0;
+    /* check if window popup is being hovered */
+    if (win->popup.active && win->popup.win) {
+        r = win->popup.win->bounds;
+        if (NK_INBOX(pos.x, pos.y, r.x, r.y, r.w, r.h))
+            return 1;
+    }
+    r = win->bounds;
+    if (win->flags & NK_WINDOW_MINIMIZED)
+        r.h = ctx->style.font->height + 2 * ctx->style.window.header.padding.y;
+    return NK_INBOX(pos.x, pos.y, r.x, r.y, r.w, r.h);
+}
+NK_LIB int
+nk_window_is_any_at(const struct nk_context *ctx, struct nk_vec2 pos)
+{
+    const struct nk_window *iter;
     NK_ASSERT(ctx);
     if (!ctx) return 0;
     iter = ctx->begin;
     while (iter) {
-        /* check if window is being hovered */
-        if(!(iter->flags & NK_WINDOW_HIDDEN)) {
-            /* check if window popup is being hovered */
-            if (iter->popup.active && iter->popup.win && nk_input_is_mouse_hovering_rect(&ctx->input, iter->popup.win->bounds))
-                return 1;
-
-            if (iter->flags & NK_WINDOW_MINIMIZED) {
-                struct nk_rect header = iter->bounds;
-                header.h = ctx->style.font->height + 2 * ctx->style.window.header.padding.y;
-                if (nk_input_is_mouse_hovering_rect(&ctx->input, header))
-                    return 1;
-            } else if (nk_input_is_mouse_hovering_rect(&ctx->input, iter->bounds)) {
-                return 1;
-            }
-        }
+        if (nk_window_is_at(ctx, iter, pos))
+            return 1;
         iter = iter->next;
     }
     return 0;
 }
+NK_LIB void
+nk_window_index_invalidate(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->hovered_seq = 0;
+}
+NK_LIB struct nk_window*
+nk_window_at_mouse(struct nk_context *ctx)
+{
+    unsigned int order = 0;
+    struct nk_window *iter;
+    struct nk_vec2 pos;
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+
+    /* the index stays valid for the frame unless windows were added, removed,
+     * reordered or resized. Windows that moved away or got hidden are caught
+     * by checking the cached window again */
+    pos = ctx->input.mouse.pos;
+    if (ctx->hovered_seq == ctx->seq && ctx->hovered_pos.x == pos.x &&
+        ctx->hovered_pos.y == pos.y && (!ctx->hovered ||
+        nk_window_is_at(ctx, ctx->hovered, pos)))
+        return ctx->hovered;
+
+    /* number windows from back to front and keep the last one under the mouse */
+    ctx->hovered = 0;
+    for (iter = ctx->begin; iter; iter = iter->next) {
+        iter->order = ++order;
+        if (nk_window_is_at(ctx, iter, pos))
+            ctx->hovered = iter;
+    }
+    ctx->hovered_pos = pos;
+    ctx->hovered_seq = ctx->seq;
+    return ctx->hovered;
+}
+NK_API int
+nk_window_is_any_hovered(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    return nk_window_at_mouse(ctx) != 0;
+}
 NK_API int
 nk_item_is_any_active(struct nk_context *ctx)
 {
@@ -16690,6 +22876,7 @@ nk_window_set_bounds(struct nk_context *ctx,
     if (!win) return;
     NK_ASSERT(ctx->current != win && "You cannot update a currently in procecss window");
     win->bounds = bounds;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_position(struct nk_context *ctx,
@@ -16699,6 +22886,7 @@ nk_window_set_position(struct nk_context *ctx,
     if (!win) return;
     win->bounds.x = pos.x;
     win->bounds.y = pos.y;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_size(struct nk_context *ctx,
@@ -16708,6 +22896,7 @@ nk_window_set_size(struct nk_context *ctx,
     if (!win) return;
     win->bounds.w = size.x;
     win->bounds.h = size.y;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_scroll(struct nk_context *ctx, nk_uint offset_x, nk_uint offset_y)
@@ -16738,6 +22927,7 @@ nk_window_collapse(struct nk_context *ctx, const char *name,
     if (c == NK_MINIMIZED)
         win->flags |= NK_WINDOW_MINIMIZED;
     else win->flags &= ~(nk_flags)NK_WINDOW_MINIMIZED;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_collapse_if(struct nk_context *ctx, const char *name,
@@ -16763,6 +22953,7 @@ nk_window_show(struct nk_context *ctx, const char *name, enum nk_show_states s)
     if (s == NK_HIDDEN) {
         win->flags |= NK_WINDOW_HIDDEN;
     } else win->flags &= ~(nk_flags)NK_WINDOW_HIDDEN;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_show_if(struct nk_context *ctx, const char *name,
@@ -17700,6 +23891,7 @@ nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt,
     if (!ctx || !ctx->current || !ctx->current->layout)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_LAYOUT);
     win = ctx->current;
     nk_panel_layout(ctx, win, height, cols);
     if (fmt == NK_DYNAMIC)
@@ -17710,6 +23902,7 @@ nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt,
     win->layout->row.filled = 0;
     win->layout->row.item_offset = 0;
     win->layout->row.item_width = (float)width;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_LAYOUT);
 }
 NK_API float
 nk_layout_ratio_from_pixel(struct nk_context *ctx, float pixel_width)
@@ -17929,12 +24122,10 @@ nk_layout_row_template_push_static(struct nk_context *ctx, float width)
     if (layout->row.columns >= NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS) return;
     layout->row.templates[layout->row.columns++] = width;
 }
-NK_API void
-nk_layout_row_template_end(struct nk_context *ctx)
+NK_INTERN void
+nk_layout_template_resolve(const float *templates, float *widths, int columns,
+    float space)
 {
-    struct nk_window *win;
-    struct nk_panel *layout;
-
     int i = 0;
     int variable_count = 0;
     int min_variable_count = 0;
@@ -17942,18 +24133,9 @@ nk_layout_row_template_end(struct nk_context *ctx)
     float total_fixed_width = 0.0f;
     float max_variable_width = 0.0f;
 
-    NK_ASSERT(ctx);
-    NK_ASSERT(ctx->current);
-    NK_ASSERT(ctx->current->layout);
-    if (!ctx || !ctx->current || !ctx->current->layout)
-        return;
-
-    win = ctx->current;
-    layout = win->layout;
-    NK_ASSERT(layout->row.type == NK_LAYOUT_TEMPLATE);
-    if (layout->row.type != NK_LAYOUT_TEMPLATE) return;
-    for (i = 0; i < layout->row.columns; ++i) {
-        float width = layout->row.templates[i];
+    for (i = 0; i < columns; ++i) {
+        float width = templates[i];
+        widths[i] = width;
         if (width >= 0.0f) {
             total_fixed_width += width;
             min_fixed_width += width;
@@ -17968,19 +24150,147 @@ nk_layout_row_template_end(struct nk_context *ctx)
         }
     }
     if (variable_count) {
-        float space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
-                            layout->bounds.w, layout->row.columns);
         float var_width = (NK_MAX(space-min_fixed_width,0.0f)) / (float)variable_count;
         int enough_space = var_width >= max_variable_width;
         if (!enough_space)
             var_width = (NK_MAX(space-total_fixed_width,0)) / (float)min_variable_count;
-        for (i = 0; i < layout->row.columns; ++i) {
-            float *width = &layout->row.templates[i];
+        for (i = 0; i < columns; ++i) {
+            float *width = &widths[i];
             *width = (*width >= 0.0f)? *width: (*width < -1.0f && !enough_space)? -(*width): var_width;
         }
     }
 }
 NK_API void
+nk_layout_row_template_end(struct nk_context *ctx)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+    float space;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout)
+        return;
+
+    win = ctx->current;
+    layout = win->layout;
+    NK_ASSERT(layout->row.type == NK_LAYOUT_TEMPLATE);
+    if (layout->row.type != NK_LAYOUT_TEMPLATE) return;
+
+    space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
+                layout->bounds.w, layout->row.columns);
+    nk_layout_template_resolve(layout->row.templates, layout->row.templates,
+        layout->row.columns, space);
+}
+NK_API void
+nk_layout_template_init(struct nk_layout_template *tmpl)
+{
+    NK_ASSERT(tmpl);
+    if (!tmpl) return;
+    nk_zero(tmpl, sizeof(*tmpl));
+}
+NK_INTERN void
+nk_layout_template_push(struct nk_layout_template *tmpl, float width)
+{
+    NK_ASSERT(tmpl);
+    NK_ASSERT(tmpl->columns < NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS);
+    if (!tmpl || tmpl->columns >= NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS) return;
+    tmpl->templates[tmpl->columns++] = width;
+    tmpl->resolved = nk_false;
+}
+NK_API void
+nk_layout_template_push_dynamic(struct nk_layout_template *tmpl)
+{
+    nk_layout_template_push(tmpl, -1.0f);
+}
+NK_API void
+nk_layout_template_push_variable(struct nk_layout_template *tmpl, float min_width)
+{
+    nk_layout_template_push(tmpl, -min_width);
+}
+NK_API void
+nk_layout_template_push_static(struct nk_layout_template *tmpl, float width)
+{
+    nk_layout_template_push(tmpl, width);
+}
+NK_API void
+nk_layout_row_template(struct nk_context *ctx, float height,
+    struct nk_layout_template *tmpl)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+    float space;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    NK_ASSERT(tmpl);
+    if (!ctx || !ctx->current || !ctx->current->layout || !tmpl)
+        return;
+
+    win = ctx->current;
+    layout = win->layout;
+    nk_layout_row_template_begin(ctx, height);
+    space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
+                layout->bounds.w, tmpl->columns);
+    if (!tmpl->resolved || tmpl->space != space) {
+        nk_layout_template_resolve(tmpl->templates, tmpl->widths, tmpl->columns, space);
+        tmpl->space = space;
+        tmpl->resolved = nk_true;
+    }
+    layout->row.columns = tmpl->columns;
+    NK_MEMCPY(layout->row.templates, tmpl->widths,
+        sizeof(float) * (nk_size)tmpl->columns);
+}
+NK_API void
+nk_layout_row_skip(struct nk_context *ctx, float height, int rows)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout || rows <= 0)
+        return;
+
+    /* allocate the first skipped row like any other row to finish the
+     * previous row, then jump over all remaining rows at once */
+    win = ctx->current;
+    layout = win->layout;
+    nk_panel_layout(ctx, win, height, 1);
+    layout->row.type = NK_LAYOUT_DYNAMIC_FIXED;
+    layout->row.ratio = 0;
+    layout->row.filled = 0;
+    layout->row.item_width = 0;
+    layout->row.item_offset = 0;
+    layout->row.index = layout->row.columns;
+    if (rows > 1) {
+        float skipped = layout->row.height * (float)(rows - 1);
+        if (layout->flags & NK_WINDOW_DYNAMIC) {
+            /* draw background for skipped rows of dynamic panels */
+            struct nk_rect background;
+            background.x = win->bounds.x;
+            background.w = win->bounds.w;
+            background.y = layout->at_y + layout->row.height;
+            background.h = skipped;
+            nk_fill_rect(&win->buffer, background, 0, ctx->style.window.background);
+        }
+        layout->at_y += skipped;
+    }
+}
+NK_API int
+nk_layout_row_is_visible(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout)
+        return 0;
+    return !nk_panel_row_is_culled(ctx->current->layout);
+}
+NK_API void
 nk_layout_space_begin(struct nk_context *ctx, enum nk_layout_format fmt,
     float height, int widget_count)
 {
@@ -18287,7 +24597,22 @@ nk_layout_widget_space(struct nk_rect *bounds, const struct nk_context *ctx,
         layout->max_x = bounds->x + bounds->w;
     bounds->x -= (float)*layout->offset_x;
 }
-NK_LIB void
+NK_LIB int
+nk_panel_row_is_culled(const struct nk_panel *layout)
+{
+    /* free layouts can place widgets anywhere so they are never culled */
+    float y;
+    if (layout->row.type == NK_LAYOUT_DYNAMIC_FREE ||
+        layout->row.type == NK_LAYOUT_STATIC_FREE)
+        return nk_false;
+
+    /* one pixel of slack to stay conservative with the integer
+     * rounding done by `nk_widget` */
+    y = layout->at_y - (float)*layout->offset_y;
+    return ((y + layout->row.height + 1.0f) < layout->clip.y) ||
+        (y > (layout->clip.y + layout->clip.h + 1.0f));
+}
+NK_LIB int
 nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx)
 {
     struct nk_window *win;
@@ -18297,17 +24622,21 @@ nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx)
     NK_ASSERT(ctx->current);
     NK_ASSERT(ctx->current->layout);
     if (!ctx || !ctx->current || !ctx->current->layout)
-        return;
+        return 0;
 
     /* check if the end of the row has been hit and begin new row if so */
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_LAYOUT);
     win = ctx->current;
     layout = win->layout;
     if (layout->row.index >= layout->row.columns)
         nk_panel_alloc_row(ctx, win);
 
-    /* calculate widget position and size */
+    /* calculate widget position and size. Still required for culled rows
+     * since the horizontal scrollbar depends on `max_x` of every row */
     nk_layout_widget_space(bounds, ctx, win, nk_true);
     layout->row.index++;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_LAYOUT);
+    return !nk_panel_row_is_culled(layout);
 }
 NK_LIB void
 nk_layout_peek(struct nk_rect *bounds, struct nk_context *ctx)
@@ -18979,6 +25308,47 @@ nk_list_view_begin(struct nk_context *ctx, struct nk_list_view *view,
     view->count = NK_MIN(view->count, row_count - view->begin);
     view->end = view->begin + view->count;
     view->ctx = ctx;
+    view->index = 0;
+    return result;
+}
+NK_API int
+nk_list_view_begin_variable(struct nk_context *ctx, struct nk_list_view *view,
+    const char *title, nk_flags flags, const struct nk_list_view_index *index)
+{
+    int result;
+    float spacing;
+    float visible_begin;
+    float visible_end;
+    struct nk_window *win;
+    struct nk_panel *layout;
+    struct nk_vec2 panel_padding;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(view);
+    NK_ASSERT(title);
+    NK_ASSERT(index);
+    if (!ctx || !view || !title || !index) return 0;
+
+    nk_zero(view, sizeof(*view));
+    result = nk_group_begin(ctx, title, flags);
+    if (!result) return result;
+
+    /* unlike fixed height list views the real scroll offset is kept, and all
+     * rows above the visible area are skipped by moving the layout cursor */
+    win = ctx->current;
+    layout = win->layout;
+    spacing = ctx->style.window.spacing.y;
+    panel_padding = nk_panel_get_padding(&ctx->style, NK_PANEL_GROUP);
+    visible_begin = NK_MAX((float)*layout->offset_y - panel_padding.y, 0.0f);
+    visible_end = visible_begin + layout->clip.h;
+
+    view->begin = nk_list_view_index_find(index, visible_begin, spacing);
+    view->end = NK_MIN(nk_list_view_index_find(index, visible_end, spacing) + 1, index->count);
+    view->count = NK_MAX(view->end - view->begin, 0);
+    view->total_height = (int)nk_list_view_index_offset(index, index->count, spacing);
+    view->index = index;
+    view->ctx = ctx;
+    layout->at_y += nk_list_view_index_offset(index, view->begin, spacing);
     return result;
 }
 NK_API void
@@ -18990,17 +25360,559 @@ nk_list_view_end(struct nk_list_view *view)
 
     NK_ASSERT(view);
     NK_ASSERT(view->ctx);
-    NK_ASSERT(view->scroll_pointer);
     if (!view || !view->ctx) return;
 
     ctx = view->ctx;
     win = ctx->current;
     layout = win->layout;
+    if (view->index) {
+        /* extend content height over all rows below the visible area */
+        struct nk_vec2 panel_padding = nk_panel_get_padding(&ctx->style, NK_PANEL_GROUP);
+        layout->at_y = layout->bounds.y + panel_padding.y + nk_list_view_index_offset(view->index,
+            view->index->count, ctx->style.window.spacing.y);
+        layout->row.height = 0;
+        nk_group_end(ctx);
+        return;
+    }
+    NK_ASSERT(view->scroll_pointer);
     layout->at_y = layout->bounds.y + (float)view->total_height;
     *view->scroll_pointer = *view->scroll_pointer + view->scroll_value;
     nk_group_end(view->ctx);
 }
 
+NK_API void
+nk_list_view_index_init(struct nk_list_view_index *index,
+    struct nk_list_view_row *memory, int capacity)
+{
+    NK_ASSERT(index);
+    NK_ASSERT(memory || !capacity);
+    if (!index) return;
+    index->rows = memory;
+    index->count = 0;
+    index->capacity = capacity;
+}
+NK_API int
+nk_list_view_index_build(struct nk_list_view_index *index,
+    nk_list_view_row_height height, nk_handle userdata, int row_count)
+{
+    /* O(n) construction: every node passes its sum on to its parent */
+    int i;
+    NK_ASSERT(index);
+    NK_ASSERT(height);
+    NK_ASSERT(row_count <= index->capacity);
+    if (!index || !height || row_count < 0) return 0;
+
+    row_count = NK_MIN(row_count, index->capacity);
+    for (i = 0; i < row_count; ++i) {
+        float row_height = height(userdata, i);
+        NK_ASSERT(row_height >= 0);
+        index->rows[i].height = NK_MAX(row_height, 0);
+        index->rows[i].sum = index->rows[i].height;
+    }
+    for (i = 1; i <= row_count; ++i) {
+        int parent = i + (i & -i);
+        if (parent <= row_count)
+            index->rows[parent-1].sum += index->rows[i-1].sum;
+    }
+    index->count = row_count;
+    return row_count;
+}
+NK_API float
+nk_list_view_index_height(const struct nk_list_view_index *index, int row)
+{
+    NK_ASSERT(index);
+    if (!index || row < 0 || row >= index->count) return 0;
+    return index->rows[row].height;
+}
+NK_API void
+nk_list_view_index_set(struct nk_list_view_index *index, int row, float height)
+{
+    /* the delta is taken from the stored height and not from the tree sums
+     * so rounding errors of earlier updates are not fed back */
+    int i;
+    double delta;
+    NK_ASSERT(index);
+    NK_ASSERT(row >= 0 && row < index->count);
+    NK_ASSERT(height >= 0);
+    if (!index || row < 0 || row >= index->count) return;
+
+    height = NK_MAX(height, 0);
+    delta = (double)height - (double)index->rows[row].height;
+    index->rows[row].height = height;
+    for (i = row + 1; i <= index->count; i += (i & -i))
+        index->rows[i-1].sum += delta;
+}
+NK_API float
+nk_list_view_index_offset(const struct nk_list_view_index *index, int row, float spacing)
+{
+    /* sum of all row heights in front of `row` */
+    int i;
+    double offset = 0;
+    NK_ASSERT(index);
+    if (!index) return 0;
+
+    row = NK_CLAMP(0, row, index->count);
+    for (i = row; i > 0; i -= (i & -i))
+        offset += index->rows[i-1].sum;
+    return (float)(offset + (double)row * (double)spacing);
+}
+NK_API int
+nk_list_view_index_find(const struct nk_list_view_index *index, float offset,
+    float spacing)
+{
+    /* descend the implicit tree to find the row containing `offset` */
+    int row = 0;
+    int step = 1;
+    double left = offset;
+    NK_ASSERT(index);
+    if (!index || index->count <= 0 || offset <= 0) return 0;
+
+    while ((step << 1) <= index->count)
+        step <<= 1;
+    for (; step; step >>= 1) {
+        int next = row + step;
+        double size;
+        if (next > index->count) continue;
+        size = index->rows[next-1].sum + (double)step * (double)spacing;
+        if (size <= left) {
+            row = next;
+            left -= size;
+        }
+    }
+    return NK_MIN(row, index->count - 1);
+}
+
+
+
+
+/* ===============================================================
+ *
+ *                              GRID
+ *
+ * ===============================================================*/
+NK_INTERN void
+nk_grid_header(struct nk_grid *grid)
+{
+    int i;
+    struct nk_context *ctx = grid->ctx;
+    struct nk_window *win = ctx->current;
+    struct nk_panel *layout = win->layout;
+    const struct nk_style *style = &ctx->style;
+    const struct nk_user_font *font = style->font;
+    struct nk_command_buffer *out = &win->buffer;
+    struct nk_input *in;
+    struct nk_rect header;
+    struct nk_text text;
+
+    in = ((win->flags|layout->flags) & NK_WINDOW_ROM) ? 0: &ctx->input;
+    header.x = layout->bounds.x;
+    header.y = layout->bounds.y;
+    header.w = layout->bounds.w;
+    header.h = grid->row_height;
+    nk_fill_rect(out, header, 0, style->window.header.normal.data.color);
+
+    text.padding = style->text.padding;
+    text.background = style->window.header.normal.data.color;
+    for (i = grid->col_begin; i < grid->col_end; ++i) {
+        nk_flags ws = 0;
+        struct nk_rect cell, handle;
+        struct nk_grid_column *col = &grid->columns[i];
+        cell.x = grid->origin.x + col->offset;
+        cell.y = header.y;
+        cell.w = col->width;
+        cell.h = header.h;
+
+        /* column resizing by dragging the right column border */
+        handle.x = cell.x + cell.w - style->window.spacing.x;
+        handle.y = cell.y;
+        handle.w = 2 * style->window.spacing.x;
+        handle.h = cell.h;
+        if (in && (grid->flags & NK_GRID_RESIZABLE) && in->mouse.buttons[NK_BUTTON_LEFT].down &&
+            nk_input_has_mouse_click_down_in_rect(in, NK_BUTTON_LEFT, handle, nk_true)) {
+            col->width = NK_MAX(col->width + in->mouse.delta.x, col->min_width);
+            in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x = cell.x + col->width;
+            ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_RESIZE_HORIZONTAL];
+        } else if ((grid->flags & NK_GRID_SORTABLE) && nk_button_behavior(&ws,
+            nk_shrink_rect(cell, (grid->flags & NK_GRID_RESIZABLE) ? style->window.spacing.x: 0),
+            (in && nk_input_is_mouse_hovering_rect(in, layout->clip)) ? in: 0, NK_BUTTON_DEFAULT)) {
+            /* clicking a column header cycles sort order and resets all other columns */
+            int j;
+            enum nk_grid_sort sort = (col->sort == NK_GRID_SORT_ASCENDING) ?
+                NK_GRID_SORT_DESCENDING: NK_GRID_SORT_ASCENDING;
+            for (j = 0; j < grid->column_count; ++j)
+                grid->columns[j].sort = NK_GRID_SORT_NONE;
+            col->sort = sort;
+            grid->sorted = nk_true;
+        }
+        if (ws & NK_WIDGET_STATE_HOVER) {
+            text.text = style->window.header.label_hover;
+            text.background = style->window.header.hover.data.color;
+            nk_fill_rect(out, cell, 0, text.background);
+        } else {
+            text.text = style->window.header.label_normal;
+            text.background = style->window.header.normal.data.color;
+        }
+
+        /* sort indicator */
+        if (col->sort != NK_GRID_SORT_NONE) {
+            struct nk_rect sym;
+            sym.w = sym.h = font->height * 0.5f;
+            sym.x = cell.x + cell.w - (sym.w + style->text.padding.x + style->window.spacing.x);
+            sym.y = cell.y + (cell.h - sym.h) * 0.5f;
+            nk_draw_symbol(out, (col->sort == NK_GRID_SORT_ASCENDING) ?
+                NK_SYMBOL_TRIANGLE_UP: NK_SYMBOL_TRIANGLE_DOWN, sym,
+                text.background, text.text, 0, font);
+            cell.w -= sym.w + style->window.spacing.x;
+        }
+        if (col->title)
+            nk_widget_text(out, cell, col->title, nk_strlen(col->title),
+                &text, col->align, font);
+        nk_stroke_line(out, grid->origin.x + col->offset + col->width, header.y,
+            grid->origin.x + col->offset + col->width, header.y + header.h, 1.0f,
+            style->window.border_color);
+    }
+}
+NK_API int
+nk_grid_begin(struct nk_context *ctx, struct nk_grid *grid, const char *id,
+    nk_flags flags, struct nk_grid_column *columns, int column_count,
+    float row_height, int row_count)
+{
+    int i;
+    float offset;
+    float visible_begin;
+    float visible_end;
+    struct nk_window *win;
+    struct nk_panel *layout;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(grid);
+    NK_ASSERT(id);
+    NK_ASSERT(columns || !column_count);
+    if (!ctx || !grid || !id || (!columns && column_count)) return 0;
+
+    nk_zero(grid, sizeof(*grid));
+    if (!nk_group_begin(ctx, id, flags & ~(nk_flags)(NK_GRID_SORTABLE|NK_GRID_RESIZABLE)))
+        return 0;
+
+    win = ctx->current;
+    layout = win->layout;
+    if (row_height <= 0)
+        row_height = ctx->style.font->height + 2 * ctx->style.text.padding.y;
+
+    grid->ctx = ctx;
+    grid->flags = flags;
+    grid->columns = columns;
+    grid->column_count = column_count;
+    grid->row_count = NK_MAX(row_count, 0);
+    grid->row_height = row_height;
+    grid->origin.x = layout->bounds.x - (float)*layout->offset_x;
+    grid->origin.y = layout->bounds.y + row_height;
+    grid->scroll_y = *layout->offset_y;
+
+    /* resolve column offsets once instead of laying out every cell */
+    for (offset = 0, i = 0; i < column_count; ++i) {
+        struct nk_grid_column *col = &columns[i];
+        col->width = NK_MAX(col->width, col->min_width);
+        col->offset = offset;
+        col->text_width = NK_MAX(col->width - 2 * ctx->style.text.padding.x, 0);
+        offset += col->width;
+
+        /* measured texts only stay valid for the same font and width */
+        if (col->font != ctx->style.font || col->font_height != ctx->style.font->height ||
+            col->measured_width != col->text_width) {
+            nk_zero(col->texts, sizeof(col->texts));
+            col->font = ctx->style.font;
+            col->font_height = ctx->style.font->height;
+            col->measured_width = col->text_width;
+        }
+    }
+    grid->total_width = offset;
+
+    /* visible columns */
+    visible_begin = (float)*layout->offset_x;
+    visible_end = visible_begin + layout->clip.w;
+    for (i = 0; i < column_count && columns[i].offset + columns[i].width <= visible_begin; ++i);
+    grid->col_begin = i;
+    for (; i < column_count && columns[i].offset < visible_end; ++i);
+    grid->col_end = i;
+
+    /* visible rows */
+    visible_begin = (float)*layout->offset_y;
+    visible_end = visible_begin + NK_MAX(layout->clip.h - row_height, 0);
+    grid->row_begin = NK_MIN((int)(visible_begin / row_height), grid->row_count);
+    grid->row_end = NK_MIN(nk_iceilf(visible_end / row_height) + 1, grid->row_count);
+    return 1;
+}
+NK_API struct nk_rect
+nk_grid_cell_bounds(const struct nk_grid *grid, int row, int col)
+{
+    struct nk_rect bounds;
+    NK_ASSERT(grid);
+    NK_ASSERT(col >= 0 && col < grid->column_count);
+    if (!grid || col < 0 || col >= grid->column_count)
+        return nk_rect(0,0,0,0);
+
+    /* row offsets in huge grids exceed float precision so subtract scrolling first */
+    bounds.x = grid->origin.x + grid->columns[col].offset;
+    bounds.y = grid->origin.y + (float)((double)row * (double)grid->row_height - (double)grid->scroll_y);
+    bounds.w = grid->columns[col].width;
+    bounds.h = grid->row_height;
+    return bounds;
+}
+NK_API void
+nk_grid_cell_text(struct nk_grid *grid, int row, int col,
+    const char *str, int len)
+{
+    float text_width;
+    struct nk_rect cell;
+    struct nk_rect label;
+    const struct nk_user_font *font;
+    struct nk_grid_column *column;
+    struct nk_grid_text *text;
+    struct nk_command_buffer *out;
+    const struct nk_style *style;
+    nk_hash hash;
+
+    NK_ASSERT(grid);
+    NK_ASSERT(grid->ctx);
+    if (!grid || !grid->ctx || !str || !len) return;
+    if (row < grid->row_begin || row >= grid->row_end) return;
+    if (col < grid->col_begin || col >= grid->col_end) return;
+
+    style = &grid->ctx->style;
+    font = style->font;
+    out = &grid->ctx->current->buffer;
+    column = &grid->columns[col];
+    cell = nk_grid_cell_bounds(grid, row, col);
+    if (cell.y + cell.h <= out->clip.y || cell.y >= out->clip.y + out->clip.h)
+        return;
+
+    /* visible cells mostly show the same text as in the last frame so the
+     * measured and clamped width is looked up by text hash first */
+    hash = nk_murmur_hash(str, len, 0);
+    text = &column->texts[hash % NK_GRID_TEXT_CACHE_SIZE];
+    if (text->length != len || text->hash != hash) {
+        text->hash = hash;
+        text->length = len;
+        text->clamped = len;
+        text->width = font->width(font->userdata, font->height, str, len);
+        if (text->width > column->text_width) {
+            int glyphs = 0;
+            text->clamped = nk_text_clamp(font, str, len, column->text_width,
+                &glyphs, &text->width, 0,0);
+        }
+    }
+    len = text->clamped;
+    text_width = text->width;
+    if (!len) return;
+    label.y = cell.y + (cell.h - font->height) * 0.5f;
+    label.h = font->height;
+    label.w = text_width;
+    if (column->align & NK_TEXT_ALIGN_RIGHT)
+        label.x = cell.x + cell.w - (style->text.padding.x + text_width);
+    else if (column->align & NK_TEXT_ALIGN_CENTERED)
+        label.x = cell.x + (cell.w - text_width) * 0.5f;
+    else label.x = cell.x + style->text.padding.x;
+    nk_push_text(out, label, str, len, font, style->window.background, style->text.color);
+}
+NK_API void
+nk_grid_cell_label(struct nk_grid *grid, int row, int col, const char *str)
+{
+    nk_grid_cell_text(grid, row, col, str, nk_strlen(str));
+}
+NK_API int
+nk_grid_end(struct nk_grid *grid)
+{
+    struct nk_context *ctx;
+    struct nk_panel *layout;
+
+    NK_ASSERT(grid);
+    NK_ASSERT(grid->ctx);
+    if (!grid || !grid->ctx) return 0;
+
+    /* header is drawn last so scrolled rows vanish below it */
+    ctx = grid->ctx;
+    layout = ctx->current->layout;
+    nk_grid_header(grid);
+
+    /* content size of all rows and columns for scrollbars, the height of
+     * huge grids is computed in double so it is only rounded once */
+    layout->at_y = (float)((double)layout->bounds.y +
+        (double)grid->row_height * (double)(grid->row_count + 1));
+    layout->row.height = 0;
+    layout->max_x = layout->bounds.x + grid->total_width;
+    nk_group_end(ctx);
+    return grid->sorted;
+}
+
+
+
+
+/* ===============================================================
+ *
+ *                          TREE VIEW
+ *
+ * ===============================================================*/
+NK_API void
+nk_tree_view_init(struct nk_tree_view_state *state,
+    const struct nk_tree_view_node *nodes, int node_count,
+    nk_byte *expanded, int *rows)
+{
+    NK_ASSERT(state);
+    NK_ASSERT((nodes && expanded && rows) || !node_count);
+    if (!state) return;
+    nk_zero(state, sizeof(*state));
+    state->nodes = nodes;
+    state->node_count = NK_MAX(node_count, 0);
+    state->expanded = expanded;
+    state->rows = rows;
+    state->dirty = nk_true;
+}
+NK_API void
+nk_tree_view_set_expanded(struct nk_tree_view_state *state, int node, int expanded)
+{
+    NK_ASSERT(state);
+    NK_ASSERT(node >= 0 && node < state->node_count);
+    if (!state || node < 0 || node >= state->node_count) return;
+    if (!state->expanded[node] == !expanded) return;
+    state->expanded[node] = (nk_byte)(expanded != 0);
+    state->dirty = nk_true;
+}
+NK_API int
+nk_tree_view_is_expanded(const struct nk_tree_view_state *state, int node)
+{
+    NK_ASSERT(state);
+    if (!state || node < 0 || node >= state->node_count) return 0;
+    return state->expanded[node] != 0;
+}
+NK_API int
+nk_tree_view_update(struct nk_tree_view_state *state)
+{
+    int i = 0;
+    NK_ASSERT(state);
+    if (!state) return 0;
+    if (!state->dirty) return state->row_count;
+
+    /* flatten expanded nodes into visible rows and jump over the descendants
+     * of collapsed nodes, so collapsed subtrees are never visited */
+    state->row_count = 0;
+    while (i < state->node_count) {
+        const struct nk_tree_view_node *node = &state->nodes[i];
+        state->rows[state->row_count++] = i;
+        if (!state->expanded[i])
+            i += NK_MAX(node->descendants, 0);
+        i++;
+    }
+    state->dirty = nk_false;
+    return state->row_count;
+}
+NK_API int
+nk_tree_view_begin(struct nk_context *ctx, struct nk_tree_view *view,
+    const char *id, nk_flags flags, struct nk_tree_view_state *state)
+{
+    int result;
+    const struct nk_style *style;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(view);
+    NK_ASSERT(id);
+    NK_ASSERT(state);
+    if (!ctx || !view || !id || !state) return 0;
+
+    nk_zero(view, sizeof(*view));
+    style = &ctx->style;
+    nk_tree_view_update(state);
+    view->row_height = (float)nk_iceilf(style->font->height + 2 * style->tab.padding.y);
+    result = nk_list_view_begin(ctx, &view->list, id, flags,
+        (int)view->row_height, state->row_count);
+    if (!result) return result;
+
+    view->begin = view->list.begin;
+    view->end = view->list.end;
+    view->state = state;
+    return result;
+}
+NK_API int
+nk_tree_view_node(struct nk_tree_view *view, int row)
+{
+    int node;
+    struct nk_context *ctx;
+    struct nk_window *win;
+    struct nk_panel *layout;
+    struct nk_tree_view_state *state;
+    const struct nk_tree_view_node *data;
+    const struct nk_style *style;
+    const struct nk_input *in;
+    enum nk_widget_layout_states widget_state;
+
+    nk_flags ws = 0;
+    struct nk_rect header;
+    struct nk_rect sym;
+    struct nk_rect label;
+    struct nk_text text;
+    float indent;
+
+    NK_ASSERT(view);
+    NK_ASSERT(view->list.ctx);
+    if (!view || !view->list.ctx) return -1;
+
+    state = view->state;
+    NK_ASSERT(row >= 0 && row < state->row_count);
+    if (row < 0 || row >= state->row_count) return -1;
+
+    ctx = view->list.ctx;
+    win = ctx->current;
+    layout = win->layout;
+    style = &ctx->style;
+    node = state->rows[row];
+    data = &state->nodes[node];
+
+    nk_layout_row_dynamic(ctx, view->row_height, 1);
+    widget_state = nk_widget(&header, ctx);
+    if (!widget_state) return node;
+
+    indent = (float)NK_MAX(data->depth, 0) * style->tab.indent;
+    header.x += indent;
+    header.w = NK_MAX(header.w - indent, 0);
+
+    /* update node state */
+    in = (!(layout->flags & NK_WINDOW_ROM)) ? &ctx->input: 0;
+    in = (in && widget_state == NK_WIDGET_VALID) ? &ctx->input : 0;
+    if (data->descendants > 0 && nk_button_behavior(&ws, header, in, NK_BUTTON_DEFAULT))
+        nk_tree_view_set_expanded(state, node, !state->expanded[node]);
+
+    /* draw triangle button for nodes with children */
+    sym.w = sym.h = style->font->height;
+    sym.y = header.y + style->tab.padding.y;
+    sym.x = header.x + style->tab.padding.x;
+    if (data->descendants > 0) {
+        int expanded = state->expanded[node] != 0;
+        nk_do_button_symbol(&ws, &win->buffer, sym,
+            expanded ? style->tab.sym_maximize: style->tab.sym_minimize, NK_BUTTON_DEFAULT,
+            expanded ? &style->tab.node_maximize_button: &style->tab.node_minimize_button,
+            0, style->font);
+    }
+
+    /* draw label */
+    label.x = sym.x + sym.w + style->window.spacing.x;
+    label.y = sym.y;
+    label.w = NK_MAX(header.x + header.w - label.x, 0);
+    label.h = style->font->height;
+    text.text = style->tab.text;
+    text.background = style->window.background;
+    text.padding = nk_vec2(0,0);
+    if (data->label)
+        nk_widget_text(&win->buffer, label, data->label, nk_strlen(data->label),
+            &text, NK_TEXT_LEFT, style->font);
+    return node;
+}
+NK_API void
+nk_tree_view_end(struct nk_tree_view *view)
+{
+    NK_ASSERT(view);
+    if (!view || !view->list.ctx) return;
+    nk_list_view_end(&view->list);
+}
 
 
 
@@ -19142,6 +26054,7 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
     struct nk_window *win;
     struct nk_panel *layout;
     const struct nk_input *in;
+    int visible;
 
     NK_ASSERT(ctx);
     NK_ASSERT(ctx->current);
@@ -19150,7 +26063,7 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
         return NK_WIDGET_INVALID;
 
     /* allocate space and check if the widget needs to be updated and drawn */
-    nk_panel_alloc_space(bounds, ctx);
+    visible = nk_panel_alloc_space(bounds, ctx);
     win = ctx->current;
     layout = win->layout;
     in = &ctx->input;
@@ -19171,6 +26084,10 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
     bounds->w = (float)((int)bounds->w);
     bounds->h = (float)((int)bounds->h);
 
+    /* whole row is outside the visible area so skip clipping tests */
+    if (!visible)
+        return NK_WIDGET_INVALID;
+
     c.x = (float)((int)c.x);
     c.y = (float)((int)c.y);
     c.w = (float)((int)c.w);
@@ -19313,7 +26230,7 @@ nk_widget_text_wrap(struct nk_command_buffer *o, struct nk_rect b,
     int done = 0;
     struct nk_rect line;
     struct nk_text text;
-    NK_INTERN nk_rune seperator[] = {' '};
+    NK_STORAGE const nk_rune seperator[] = {' '};
 
     NK_ASSERT(o);
     NK_ASSERT(t);
@@ -19359,7 +26276,8 @@ nk_text_colored(struct nk_context *ctx, const char *str, int len,
 
     win = ctx->current;
     style = &ctx->style;
-    nk_panel_alloc_space(&bounds, ctx);
+    if (!nk_panel_alloc_space(&bounds, ctx))
+        return;
     item_padding = style->text.padding;
 
     text.padding.x = item_padding.x;
@@ -19386,7 +26304,8 @@ nk_text_wrap_colored(struct nk_context *ctx, const char *str,
 
     win = ctx->current;
     style = &ctx->style;
-    nk_panel_alloc_space(&bounds, ctx);
+    if (!nk_panel_alloc_space(&bounds, ctx))
+        return;
     item_padding = style->text.padding;
 
     text.padding.x = item_padding.x;
@@ -19856,11 +26775,13 @@ nk_do_button_text(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font || !string)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_text(out, &bounds, &content, *state, style, string, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -19901,11 +26822,13 @@ nk_do_button_symbol(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style || !font || !state)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_symbol(out, &bounds, &content, *state, style, symbol, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -19930,6 +26853,7 @@ nk_do_button_image(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style || !state)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, b, &content);
     content.x += style->image_padding.x;
@@ -19940,6 +26864,7 @@ nk_do_button_image(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_image(out, &bounds, &content, *state, style, &img);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -19991,6 +26916,7 @@ nk_do_button_text_symbol(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     tri.y = content.y + (content.h/2) - font->height/2;
@@ -20005,6 +26931,7 @@ nk_do_button_text_symbol(nk_flags *state,
     nk_draw_button_text_symbol(out, &bounds, &content, &tri,
         *state, style, str, len, symbol, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -20049,6 +26976,7 @@ nk_do_button_text_image(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !font || !style || !str)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     icon.y = bounds.y + style->padding.y;
@@ -20066,6 +26994,7 @@ nk_do_button_text_image(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_text_image(out, &bounds, &content, &icon, *state, style, str, len, font, &img);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_API void
@@ -20186,9 +27115,11 @@ nk_button_color(struct nk_context *ctx, struct nk_color color)
     button.normal = nk_style_item_color(color);
     button.hover = nk_style_item_color(color);
     button.active = nk_style_item_color(color);
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_BUTTON);
     ret = nk_do_button(&ctx->last_widget_state, &win->buffer, bounds,
                 &button, in, ctx->button_behavior, &content);
     nk_draw_button(&win->buffer, &bounds, ctx->last_widget_state, &button);
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_API int
@@ -20475,6 +27406,7 @@ nk_do_toggle(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font || !active)
         return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_TOGGLE);
 
     r.w = NK_MAX(r.w, font->height + 2 * style->padding.x);
     r.h = NK_MAX(r.h, font->height + 2 * style->padding.y);
@@ -20517,6 +27449,7 @@ nk_do_toggle(nk_flags *state,
     }
     if (style->draw_end)
         style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_TOGGLE);
     return (was_active != *active);
 }
 /*----------------------------------------------------------------
@@ -20746,6 +27679,7 @@ nk_do_selectable(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* remove padding */
@@ -20762,6 +27696,7 @@ nk_do_selectable(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, 0,0,NK_SYMBOL_NONE, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 NK_LIB int
@@ -20783,6 +27718,7 @@ nk_do_selectable_image(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* toggle behavior */
@@ -20809,6 +27745,7 @@ nk_do_selectable_image(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, &icon, img, NK_SYMBOL_NONE, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 NK_LIB int
@@ -20830,6 +27767,7 @@ nk_do_selectable_symbol(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* toggle behavior */
@@ -20856,6 +27794,7 @@ nk_do_selectable_symbol(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, &icon, 0, sym, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 
@@ -21124,6 +28063,7 @@ nk_do_slider(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style)
         return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SLIDER);
 
     /* remove padding from slider bounds */
     bounds.x = bounds.x + style->padding.x;
@@ -21190,6 +28130,7 @@ nk_do_slider(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_slider(out, *state, style, &bounds, &visual_cursor, slider_min, slider_value, slider_max);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SLIDER);
     return slider_value;
 }
 NK_API int
@@ -21335,6 +28276,7 @@ nk_do_progress(nk_flags *state,
     NK_ASSERT(style);
     NK_ASSERT(out);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_PROGRESS);
 
     /* calculate progressbar cursor */
     cursor.w = NK_MAX(bounds.w, 2 * style->padding.x + 2 * style->border);
@@ -21351,6 +28293,7 @@ nk_do_progress(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_progress(out, *state, style, &bounds, &cursor, value, max);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_PROGRESS);
     return prog_value;
 }
 NK_API int
@@ -21530,10 +28473,14 @@ nk_do_scrollbarv(nk_flags *state,
     NK_ASSERT(style);
     NK_ASSERT(state);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SCROLLBAR);
 
     scroll.w = NK_MAX(scroll.w, 1);
     scroll.h = NK_MAX(scroll.h, 0);
-    if (target <= scroll.h) return 0;
+    if (target <= scroll.h) {
+        NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
+        return 0;
+    }
 
     /* optional scrollbar buttons */
     if (style->show_buttons) {
@@ -21597,6 +28544,7 @@ nk_do_scrollbarv(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_scrollbar(out, *state, style, &scroll, &cursor);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
     return scroll_offset;
 }
 NK_LIB float
@@ -21618,11 +28566,15 @@ nk_do_scrollbarh(nk_flags *state,
     NK_ASSERT(out);
     NK_ASSERT(style);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SCROLLBAR);
 
     /* scrollbar background */
     scroll.h = NK_MAX(scroll.h, 1);
     scroll.w = NK_MAX(scroll.w, 2 * scroll.h);
-    if (target <= scroll.w) return 0;
+    if (target <= scroll.w) {
+        NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
+        return 0;
+    }
 
     /* optional scrollbar buttons */
     if (style->show_buttons) {
@@ -21685,6 +28637,7 @@ nk_do_scrollbarh(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_scrollbar(out, *state, style, &scroll, &cursor);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
     return scroll_offset;
 }
 
@@ -22890,6 +29843,7 @@ nk_do_edit(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(style);
     if (!state || !out || !style)
         return ret;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_EDIT);
 
     /* visible text area calculation */
     area.x = bounds.x + style->padding.x + style->border;
@@ -23366,6 +30320,7 @@ nk_do_edit(nk_flags *state, struct nk_command_buffer *out,
             background_color, text_color, nk_false);
     }
     nk_push_scissor(out, old_clip);}
+    NK_PROFILE_END(out->profiler, NK_PROFILE_EDIT);
     return ret;
 }
 NK_API void
@@ -23655,6 +30610,7 @@ nk_do_property(nk_flags *ws,
     struct nk_rect edit;
     struct nk_rect empty;
 
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_PROPERTY);
     /* left decrement button */
     left.h = font->height/2;
     left.w = left.h;
@@ -23801,6 +30757,7 @@ nk_do_property(nk_flags *ws,
             break;
         }
     }
+    NK_PROFILE_END(out->profiler, NK_PROFILE_PROPERTY);
 }
 NK_LIB struct nk_property_variant
 nk_property_variant_int(int value, int min_value, int max_value, int step)
@@ -24479,6 +31436,7 @@ nk_do_color_picker(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !col || !state || !font)
         return ret;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_COLOR_PICKER);
 
     bar_w = font->height;
     bounds.x += padding.x;
@@ -24504,6 +31462,7 @@ nk_do_color_picker(nk_flags *state,
     ret = nk_color_picker_behavior(state, &bounds, &matrix, &hue_bar,
         (fmt == NK_RGBA) ? &alpha_bar:0, col, in);
     nk_draw_color_picker(out, &matrix, &hue_bar, (fmt == NK_RGBA) ? &alpha_bar:0, *col);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_COLOR_PICKER);
     return ret;
 }
 NK_API int
@@ -25475,6 +32434,56 @@ nk_tooltipfv(struct nk_context *ctx, const char *fmt, va_list args)
 ///    - [yy]: Minor version with non-breaking API and library changes
 ///    - [zz]: Bug fix version with no direct changes to API
 ///
+/// - 2026/10/19 (4.25.0) - Added `curve_tolerance` to `nk_convert_config` to pick circle, arc, curve and rounded
+///                        corner segment counts from shape size with a 48 point unit circle table.
+/// - 2026/10/19 (4.24.0) - Added `NK_PROFILE_BEGIN`/`NK_PROFILE_END` profiling zones and the `NK_INCLUDE_PROFILER`
+///                        collector with per zone call counts and time.
+/// - 2026/10/19 (4.23.0) - Added `nk_input_record_begin` and `nk_input_replay_frame` to record input calls
+///                        and replay them with draw command verification.
+/// - 2026/10/19 (4.22.0) - Added `nk_memory_compact` to give unused pool pages back to the allocator
+///                        and `pool_reclaimable` to `nk_memory_stats`
+/// - 2026/10/19 (4.21.0) - Added `nk_stream_encode` and `nk_stream_decode` to serialize draw commands
+///                        into delta encoded messages for rendering in another process.
+/// - 2026/10/19 (4.20.0) - Added a compact variable length draw command encoding with a side table for
+///                        fonts and images and added the example/command_bench.c benchmark.
+/// - 2026/10/19 (4.19.0) - Added `nk_frame` with `nk_frame_swap` to hand finished command lists to a render
+///                        thread without copying and `nk_frame_convert` to convert them there.
+/// - 2026/10/19 (4.18.0) - Added segmented buffers with `nk_buffer_init_segmented` so command memory
+///                        grows by fixed size segments without reallocating and copying.
+/// - 2026/10/19 (4.17.0) - Resolve the topmost window under the mouse once per frame for window
+///                        overlap checks in `nk_begin`, `nk_window_is_any_hovered` and `nk_item_is_any_active`.
+/// - 2026/10/19 (4.16.0) - Added `NK_INCLUDE_DEFAULT_FONT_ATLAS` and `nk_font_atlas_bake_default` with the
+///                        default font pre-baked into a tightly packed 2 bit palette atlas.
+/// - 2026/10/19 (4.15.0) - Added timestamped input event queue `nk_input_push` with motion and scroll
+///                        coalescing that spreads fast clicks and typing over multiple frames.
+/// - 2026/10/19 (4.14.0) - Added `nk_frame_status` and `nk_frame_schedule` to skip rendering unchanged
+///                        frames and wait for input or the next timed change when idle.
+/// - 2026/10/19 (4.13.0) - Added `nk_foreach_contexts`, `nk_convert_contexts` and `nk_contexts_hovered`
+///                        to compose contexts built on different threads and
+///                        `nk_font_atlas_set_lock` for sharing dynamic font atlases.
+/// - 2026/10/19 (4.12.0) - Added `nk_memory_get_stats` and `nk_memory_get_window_stats` for command,
+///                        vertex and pool memory telemetry with high-water marks.
+/// - 2026/10/19 (4.11.0) - Added `nk_font_atlas::packing` with `NK_FONT_ATLAS_PACK_TIGHT` to search
+///                        widths and heuristics for the smallest atlas and added
+///                        `nk_font_atlas_get_stats` to query texture utilization.
+/// - 2026/10/19 (4.10.0) - Sped up the font rasterizer with pooled active edges, key based edge
+///                        sorting and optional `NK_INCLUDE_SSE2` coverage conversion.
+/// - 2026/10/19 (4.09.0) - Added `nk_font_config::sdf` to bake glyphs as signed distance field
+///                        which can be drawn at any scale from a single bake.
+/// - 2026/10/19 (4.08.0) - Added `nk_font_atlas_bake_dynamic` and `nk_font_atlas_dirty` for a
+///                        fixed size font atlas rasterizing glyphs on demand.
+/// - 2026/10/19 (4.07.0) - Added `nk_font_atlas_save` and `nk_font_atlas_load` to store a
+///                        baked font atlas and skip baking on later runs.
+/// - 2026/10/19 (4.06.0) - Added `nk_layout_template` to declare a row template once and only
+///                        resolve its column widths again when the panel width changes.
+/// - 2026/10/19 (4.05.0) - Added virtualized `nk_tree_view` which only visits expanded nodes
+///                        and keeps expansion state in caller provided memory.
+/// - 2026/10/19 (4.04.0) - Added virtualized `nk_grid` table with cached column widths,
+///                        sticky header, column resizing and sort indicators.
+/// - 2026/10/19 (4.03.0) - Added `nk_list_view_begin_variable` for list views with rows of
+///                        different height backed by `nk_list_view_index`.
+/// - 2026/10/19 (4.02.0) - Added `nk_layout_row_skip` and `nk_layout_row_is_visible` and
+///                        skip widgets inside rows completely outside the visible area.
 /// - 2019/09/20 (4.01.3) - Fixed a bug wherein combobox cannot be closed by clicking the header
 ///                        when NK_BUTTON_TRIGGER_ON_RELEASE is defined.
 /// - 2019/09/10 (4.01.2) - Fixed the nk_cos function, which deviated significantly.
@@ -17,12 +17,21 @@ extern "C" {
 #ifndef NK_INPUT_MAX
   #define NK_INPUT_MAX 16
 #endif
+#ifndef NK_INPUT_QUEUE_SIZE
+  #define NK_INPUT_QUEUE_SIZE 64
+#endif
+#ifndef NK_INPUT_DOUBLE_CLICK_TIME
+  #define NK_INPUT_DOUBLE_CLICK_TIME 500
+#endif
 #ifndef NK_MAX_NUMBER_BUFFER
   #define NK_MAX_NUMBER_BUFFER 64
 #endif
 #ifndef NK_SCROLLBAR_HIDING_TIMEOUT
   #define NK_SCROLLBAR_HIDING_TIMEOUT 4.0f
 #endif
+#ifndef NK_GRID_TEXT_CACHE_SIZE
+  #define NK_GRID_TEXT_CACHE_SIZE 64
+#endif
 /*
  * ==============================================================
  *
@@ -219,6 +228,16 @@ struct nk_draw_list;
 struct nk_user_font;
 struct nk_panel;
 struct nk_context;
+struct nk_frame;
+struct nk_stream_encoder;
+struct nk_stream_decoder;
+struct nk_input_recorder;
+struct nk_input_replay;
+struct nk_layout_template;
+struct nk_memory_stats;
+struct nk_window_memory_stats;
+struct nk_profile;
+struct nk_profiler;
 struct nk_draw_vertex_layout_element;
 struct nk_style_button;
 struct nk_style_toggle;
@@ -324,6 +343,14 @@ enum nk_symbol_type {
 /// __nk_clear__        | Called at the end of the frame to reset and prepare the context for the next frame
 /// __nk_free__         | Shutdown and free all memory allocated inside the context
 /// __nk_set_user_data__| Utility function to pass user data to draw command
+/// __nk_memory_get_stats__         | Queries memory usage of the context including high-water marks
+/// __nk_memory_get_window_stats__  | Queries draw command memory of each window
+/// __nk_memory_reset_stats__       | Resets high-water marks
+/// __nk_memory_compact__           | Moves windows and tables into fewer pool pages and frees empty pages
+/// __nk_frame_status__             | Returns if the frame has to be rendered and when the next frame is needed
+/// __nk_frame_schedule__           | Requests another frame after a number of seconds
+/// __nk_profile_zone_name__        | Returns the name of a profiling zone
+/// __nk_profile_collect__          | Returns and resets call counts and time of all profiling zones
  */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 /*/// #### nk_init_default
@@ -447,6 +474,214 @@ NK_API void nk_free(struct nk_context*);
 */
 NK_API void nk_set_user_data(struct nk_context*, nk_handle handle);
 #endif
+/*/// #### nk_memory_get_stats
+/// Queries memory usage of the context. Command and table numbers describe the
+/// current frame so should be queried after all windows are finished and before
+/// `nk_clear`. High-water marks track the biggest command, vertex and element
+/// buffer usage of any frame since initialization or `nk_memory_reset_stats`.
+/// Vertex and element usage is taken from the last `nk_convert` call. If
+/// `needed` values exceed the buffer capacity a fixed size buffer has overflowed.
+/// Counters are updated as part of normal bookkeeping so querying is cheap
+/// enough to be done every frame.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_memory_get_stats(const struct nk_context *ctx, struct nk_memory_stats *stats);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __stats__   | Must point to a `nk_memory_stats` struct to fill
+*/
+NK_API void nk_memory_get_stats(const struct nk_context*, struct nk_memory_stats*);
+/*/// #### nk_memory_get_window_stats
+/// Queries number of draw commands and bytes generated by each window in the
+/// current frame. Popups are accounted to their parent window.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_memory_get_window_stats(const struct nk_context *ctx, struct nk_window_memory_stats *stats, int max);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __stats__   | Array of `nk_window_memory_stats` to fill or `NULL` to only query the window count
+/// __max__     | Maximum number of windows to write into `stats`
+///
+/// Returns the number of windows which can be bigger than `max`.
+*/
+NK_API int nk_memory_get_window_stats(const struct nk_context*, struct nk_window_memory_stats*, int max);
+/*/// #### nk_memory_reset_stats
+/// Resets command, vertex and element buffer high-water marks.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_memory_reset_stats(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_memory_reset_stats(struct nk_context*);
+/*/// #### nk_memory_compact
+/// Page elements holding windows, panels and tables are never given back to
+/// the allocator but kept in a free list. After a spike of windows or popups
+/// this moves all live page elements into as few pool pages as possible and
+/// frees the pages left empty. Pointers between windows and tables are fixed
+/// up, but window pointers kept by the user, for example from `nk_window_find`,
+/// are invalid afterwards. Has to be called outside of a frame.
+/// `pool_reclaimable` of `nk_memory_get_stats` tells how many bytes a call
+/// gives back, so compaction can be skipped while it would free little.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_size nk_memory_compact(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a context allocating page elements from a dynamic pool
+///
+/// Returns the number of bytes given back to the allocator
+*/
+NK_API nk_size nk_memory_compact(struct nk_context*);
+enum nk_frame_status {
+    NK_FRAME_IDLE       = 0,
+    NK_FRAME_REDRAW     = NK_FLAG(0), /* draw commands differ from the previously checked frame */
+    NK_FRAME_PENDING    = NK_FLAG(1), /* input or state changes may alter the next frame so it should be built right away */
+    NK_FRAME_TIMED      = NK_FLAG(2)  /* a timed change like scrollbar hiding is due after the returned timeout */
+};
+/*/// #### nk_frame_status
+/// Checks if the frame has to be rendered and if another frame has to be built.
+/// Has to be called after all windows are finished and before `nk_clear`.
+/// Draw commands are compared against the frame of the previous call so
+/// unchanged frames do not need to be rendered again. If neither
+/// `NK_FRAME_PENDING` nor `NK_FRAME_TIMED` are set nothing can change until
+/// the next input event and applications can block until one arrives. Since
+/// time based state is advanced by `nk_context::delta_time_seconds` it has to be
+/// set to the real time passed since the last frame including time spent waiting.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_frame_status(struct nk_context *ctx, float *timeout);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct at the end of a frame
+/// __timeout__ | Optional output with the number of seconds until the next timed change if `NK_FRAME_TIMED` is set
+///
+/// Returns a combination of `nk_frame_status` flags
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// float timeout;
+/// nk_flags status = nk_frame_status(&ctx, &timeout);
+/// if (status & NK_FRAME_REDRAW)
+///     render(&ctx);
+/// nk_clear(&ctx);
+/// if (status & NK_FRAME_PENDING)
+///     continue;
+/// else if (status & NK_FRAME_TIMED)
+///     wait_for_event_timeout(timeout);
+/// else wait_for_event();
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+NK_API nk_flags nk_frame_status(struct nk_context*, float *timeout);
+/*/// #### nk_frame_schedule
+/// Requests another frame after a number of seconds for application driven
+/// animations. Has to be called every frame the request should stay active
+/// since requests are reset by `nk_clear`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_schedule(struct nk_context *ctx, float seconds);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __seconds__ | Time until the next frame is needed or 0 for the next frame right away
+*/
+NK_API void nk_frame_schedule(struct nk_context*, float seconds);
+/*/// #### Profiling
+/// The library marks the begin and end of its most expensive parts with the
+/// `NK_PROFILE_BEGIN(profiler, zone)` and `NK_PROFILE_END(profiler, zone)`
+/// macros. Both expand to nothing by default. They can be defined before
+/// including the implementation to forward zones to an external profiler, or
+/// `NK_INCLUDE_PROFILER` can be defined to use the built-in collector. Zones of
+/// the same kind can nest, for example a property contains buttons and an edit
+/// field, so nested zones are part of the time of their parent zone.
+///
+/// The built-in collector keeps its state in a `nk_profiler` struct owned by
+/// the caller. It is zero initialized and attached by setting the `profiler`
+/// member of a context, font atlas or frame. Zones are only collected for
+/// objects with a profiler attached, and objects used on different threads
+/// need different profilers. Command buffers and the draw list of a context
+/// take the profiler of their context. The `profiler` argument of the macros
+/// is the attached `nk_profiler` pointer and only exists together with
+/// `NK_INCLUDE_PROFILER`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define NK_PROFILE_BEGIN(profiler, zone) profiler_push(nk_profile_zone_name(zone))
+/// #define NK_PROFILE_END(profiler, zone) profiler_pop()
+/// #define NK_IMPLEMENTATION
+/// #include "nuklear.h"
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+*/
+enum nk_profile_zone {
+    NK_PROFILE_WINDOW_BEGIN,    /* nk_begin */
+    NK_PROFILE_WINDOW_END,      /* nk_end */
+    NK_PROFILE_PANEL_BEGIN,     /* panel setup of windows, groups, popups and menus */
+    NK_PROFILE_PANEL_END,       /* panel scrollbars, borders and resizing */
+    NK_PROFILE_LAYOUT,          /* row layout and widget space allocation */
+    NK_PROFILE_BUTTON,
+    NK_PROFILE_TOGGLE,
+    NK_PROFILE_SELECTABLE,
+    NK_PROFILE_SLIDER,
+    NK_PROFILE_PROGRESS,
+    NK_PROFILE_SCROLLBAR,
+    NK_PROFILE_EDIT,
+    NK_PROFILE_PROPERTY,
+    NK_PROFILE_COLOR_PICKER,
+    NK_PROFILE_BUILD,           /* linking window draw commands in nk__begin */
+    NK_PROFILE_CONVERT,         /* converting draw commands into vertices */
+    NK_PROFILE_PATH,            /* arc and curve path generation */
+    NK_PROFILE_STROKE,          /* stroke tessellation */
+    NK_PROFILE_FILL,            /* convex fill tessellation */
+    NK_PROFILE_FONT_BAKE,       /* font atlas baking and dynamic glyph rasterization */
+    NK_PROFILE_ZONE_MAX
+};
+/*/// #### nk_profile_zone_name
+/// Returns the name of a profiling zone for reports or external profilers.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const char *nk_profile_zone_name(enum nk_profile_zone zone);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __zone__    | Profiling zone
+///
+/// Returns a static string or `NULL` for an invalid zone
+*/
+NK_API const char *nk_profile_zone_name(enum nk_profile_zone);
+#ifdef NK_INCLUDE_PROFILER
+/*/// #### nk_profile_collect
+/// Copies call counts and time of all zones collected by a profiler since the
+/// last call and resets them. Calling it once per frame gives per frame
+/// numbers. Time is taken with `NK_PROFILE_CLOCK`. Without a user defined
+/// `NK_PROFILE_CLOCK` only the coarse window, build, convert and font bake
+/// zones are timed while all other zones just count calls, since the default
+/// `clock` is too slow and too coarse to be taken for every widget.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_profile_collect(struct nk_profiler *profiler, struct nk_profile *profile);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __profiler__| Must point to a zero initialized or previously collected `nk_profiler` struct
+/// __profile__ | Must point to a `nk_profile` struct to fill
+*/
+NK_API void nk_profile_collect(struct nk_profiler*, struct nk_profile*);
+#endif
 /* =============================================================================
  *
  *                                  INPUT
@@ -512,6 +747,73 @@ NK_API void nk_set_user_data(struct nk_context*, nk_handle handle);
 /// __nk_input_glyph__  | Adds a single multi-byte UTF-8 character into an internal text buffer
 /// __nk_input_unicode__| Adds a single unicode rune into an internal text buffer
 /// __nk_input_end__    | Ends the input mirroring process by calculating state changes. Don't call any `nk_input_xxx` function referenced above after this call
+/// __nk_input_push__   | Adds a timestamped event to the input queue
+/// __nk_input_push_xxx__ | Helpers to add motion, button, key, scroll and text events to the input queue
+/// __nk_input_queue_count__ | Returns the number of events not yet applied
+/// __nk_input_queue_clear__ | Removes all queued events
+/// __nk_input_record_begin__ | Starts recording input and frame timing of a context
+/// __nk_input_record_end__ | Stops recording
+/// __nk_input_replay_frame__ | Applies the recorded input of the next frame
+/// __nk_input_replay_verify__ | Compares draw commands of a replayed frame with the recording
+///
+/// #### Input queue
+/// State mirroring only keeps one state per key and button and `NK_INPUT_MAX`
+/// bytes of text for each frame. At low frame rates fast clicks, drags or
+/// typing between two frames get merged or lost. Alternatively events can be
+/// added at any time with `nk_input_push` and its helper functions. Each event
+/// carries a timestamp and events are kept in order. Consecutive motion and
+/// scroll events are merged. `nk_input_end` applies queued events in order
+/// until an event would change state already changed in the same frame, like a
+/// second click of the same button or text after a key press. Remaining events
+/// stay queued for the next frame which is signaled by `NK_FRAME_PENDING`
+/// from `nk_frame_status`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// while (GetEvent(&evt)) {
+///     if (evt.type == MOUSE_MOVE)
+///         nk_input_push_motion(&ctx, evt.time, evt.motion.x, evt.motion.y);
+///     else if (evt.type == TEXT)
+///         nk_input_push_unicode(&ctx, evt.time, evt.text.rune);
+///     // [...]
+/// }
+/// nk_input_begin(&ctx);
+/// nk_input_end(&ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Input recording
+/// Slow frames often depend on interaction like dragging a property, typing
+/// or scrolling a long group. `nk_input_record_begin` attaches a recorder to
+/// a context which stores every `nk_input_xxx` mirroring call, including
+/// events applied from the input queue, together with
+/// `nk_context::delta_time_seconds` and a hash of the draw commands of each
+/// frame. A frame ends with `nk_clear` or `nk_frame_swap`, which hash the
+/// commands before clearing or handing them over. The recording is a compact
+/// byte stream inside `nk_input_recorder::data` that can be written to a file.
+///
+/// `nk_input_replay_frame` feeds the input of one recorded frame into a
+/// context in place of the platform input. Building the same UI from the same
+/// state then reproduces the same draw commands, which is checked by
+/// `nk_input_replay_verify`. Recordings can be used as repeatable benchmark
+/// workloads or to find the first frame whose draw commands differ between
+/// two versions. Fonts are hashed by the order they are used in a frame,
+/// image and userdata handles by value.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// // record
+/// nk_input_recorder_init_default(&rec);
+/// nk_input_record_begin(&ctx, &rec);
+/// // ... frames ...
+/// nk_input_record_end(&ctx);
+/// fwrite(nk_buffer_memory(&rec.data), 1, rec.data.allocated, file);
+/// // replay
+/// nk_input_replay_init_default(&replay, data, size);
+/// while (nk_input_replay_frame(&ctx, &replay)) {
+///     // ... UI ...
+///     if (!nk_input_replay_verify(&ctx, &replay))
+///         printf("frame %u differs\n", replay.frame);
+///     nk_clear(&ctx);
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 */
 enum nk_keys {
     NK_KEY_NONE,
@@ -691,6 +993,244 @@ NK_API void nk_input_unicode(struct nk_context*, nk_rune);
 /// __ctx__     | Must point to a previously initialized `nk_context` struct
 */
 NK_API void nk_input_end(struct nk_context*);
+enum nk_input_event_type {
+    NK_INPUT_EVENT_MOTION,
+    NK_INPUT_EVENT_BUTTON,
+    NK_INPUT_EVENT_KEY,
+    NK_INPUT_EVENT_SCROLL,
+    NK_INPUT_EVENT_UNICODE
+};
+struct nk_input_event {
+    enum nk_input_event_type type;
+    nk_uint time;
+    /* platform timestamp in milliseconds */
+    union {
+        struct {int x, y;} motion;
+        struct {enum nk_buttons id; int x, y, down;} button;
+        struct {enum nk_keys key; int down;} key;
+        struct nk_vec2 scroll;
+        nk_rune unicode;
+    } data;
+};
+/*/// #### nk_input_push
+/// Adds an event to the input queue. If the last queued event is of the same
+/// type motion events are replaced and scroll events are summed up.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_push(struct nk_context *ctx, const struct nk_input_event *evt);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __evt__     | Event to add which is copied into the queue
+///
+/// Returns `nk_false` if the queue holding `NK_INPUT_QUEUE_SIZE` events is full
+/// or the button or key of the event is out of range and `nk_true` otherwise
+*/
+NK_API int nk_input_push(struct nk_context*, const struct nk_input_event*);
+/*/// #### nk_input_push_xxx
+/// Helper functions to fill out and add an event to the input queue
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_push_motion(struct nk_context*, nk_uint time, int x, int y);
+/// int nk_input_push_button(struct nk_context*, nk_uint time, enum nk_buttons, int x, int y, int down);
+/// int nk_input_push_key(struct nk_context*, nk_uint time, enum nk_keys, int down);
+/// int nk_input_push_scroll(struct nk_context*, nk_uint time, struct nk_vec2 val);
+/// int nk_input_push_unicode(struct nk_context*, nk_uint time, nk_rune);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __time__    | Platform timestamp of the event in milliseconds
+///
+/// Remaining arguments are the same as for `nk_input_motion`, `nk_input_button`,
+/// `nk_input_key`, `nk_input_scroll` and `nk_input_unicode`.
+/// Two left button presses queued less than `NK_INPUT_DOUBLE_CLICK_TIME`
+/// milliseconds apart additionally press `NK_BUTTON_DOUBLE` until the left
+/// button is released again.
+/// Returns `nk_false` if the event was rejected by `nk_input_push` and `nk_true` otherwise
+*/
+NK_API int nk_input_push_motion(struct nk_context*, nk_uint time, int x, int y);
+NK_API int nk_input_push_button(struct nk_context*, nk_uint time, enum nk_buttons, int x, int y, int down);
+NK_API int nk_input_push_key(struct nk_context*, nk_uint time, enum nk_keys, int down);
+NK_API int nk_input_push_scroll(struct nk_context*, nk_uint time, struct nk_vec2 val);
+NK_API int nk_input_push_unicode(struct nk_context*, nk_uint time, nk_rune);
+/*/// #### nk_input_queue_count
+/// Returns the number of queued events which have not been applied by `nk_input_end` yet
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_queue_count(const struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API int nk_input_queue_count(const struct nk_context*);
+/*/// #### nk_input_queue_clear
+/// Removes all queued events, for example if the application window lost focus
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_queue_clear(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_input_queue_clear(struct nk_context*);
+/*/// #### nk_input_recorder_init
+/// Initializes an input recorder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_init(struct nk_input_recorder *rec, const struct nk_allocator *alloc);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to an either stack or heap allocated `nk_input_recorder` struct
+/// __alloc__   | Must point to a previously initialized memory allocator
+*/
+NK_API void nk_input_recorder_init(struct nk_input_recorder*, const struct nk_allocator*);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_input_recorder_init_default
+/// Initializes an input recorder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_init_default(struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to an either stack or heap allocated `nk_input_recorder` struct
+*/
+NK_API void nk_input_recorder_init_default(struct nk_input_recorder*);
+#endif
+/*/// #### nk_input_recorder_free
+/// Frees all memory held by an input recorder including the recording
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_recorder_free(struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __rec__     | Must point to a previously initialized `nk_input_recorder` not attached to any context
+*/
+NK_API void nk_input_recorder_free(struct nk_input_recorder*);
+/*/// #### nk_input_record_begin
+/// Clears the recording and attaches the recorder to a context. Has to be
+/// called between `nk_clear` and the next `nk_input_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_record_begin(struct nk_context *ctx, struct nk_input_recorder *rec);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __rec__     | Must point to a previously initialized `nk_input_recorder` struct
+*/
+NK_API void nk_input_record_begin(struct nk_context*, struct nk_input_recorder*);
+/*/// #### nk_input_record_end
+/// Detaches the recorder from a context. The recording stays inside
+/// `nk_input_recorder::data` until the next `nk_input_record_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_record_end(struct nk_context *ctx);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+*/
+NK_API void nk_input_record_end(struct nk_context*);
+/*/// #### nk_input_replay_init
+/// Initializes a replay from a copy of a recording
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_init(struct nk_input_replay *replay, const struct nk_allocator *alloc,
+///     const void *memory, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to an either stack or heap allocated `nk_input_replay` struct
+/// __alloc__   | Must point to a previously initialized memory allocator
+/// __memory__  | Must point to a recording from `nk_input_recorder::data`
+/// __size__    | Size of the recording in bytes
+///
+/// Returns `nk_false` if the memory does not hold a recording and `nk_true` otherwise.
+/// The replay has to be freed with `nk_input_replay_free` in both cases
+*/
+NK_API int nk_input_replay_init(struct nk_input_replay*, const struct nk_allocator*, const void *memory, nk_size size);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_input_replay_init_default
+/// Initializes a replay from a copy of a recording using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_init_default(struct nk_input_replay *replay, const void *memory, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to an either stack or heap allocated `nk_input_replay` struct
+/// __memory__  | Must point to a recording from `nk_input_recorder::data`
+/// __size__    | Size of the recording in bytes
+///
+/// Returns `nk_false` if the memory does not hold a recording and `nk_true` otherwise
+*/
+NK_API int nk_input_replay_init_default(struct nk_input_replay*, const void *memory, nk_size size);
+#endif
+/*/// #### nk_input_replay_free
+/// Frees all memory held by a replay
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_input_replay_free(struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __replay__  | Must point to a previously initialized `nk_input_replay` struct
+*/
+NK_API void nk_input_replay_free(struct nk_input_replay*);
+/*/// #### nk_input_replay_frame
+/// Replaces `nk_input_begin`, all input mirroring and `nk_input_end` of a
+/// frame by the recorded calls and sets `nk_context::delta_time_seconds`.
+/// Has to be called where the recorded frame called `nk_input_begin`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_frame(struct nk_context *ctx, struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __replay__  | Must point to a previously initialized `nk_input_replay` struct
+///
+/// Returns `nk_false` after the last recorded frame or if the recording is
+/// corrupt and `nk_true` otherwise
+*/
+NK_API int nk_input_replay_frame(struct nk_context*, struct nk_input_replay*);
+/*/// #### nk_input_replay_verify
+/// Compares the draw commands of the replayed frame with the recorded frame.
+/// Has to be called after the last `nk_end` and before `nk_clear`.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_input_replay_verify(struct nk_context *ctx, struct nk_input_replay *replay);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a previously initialized `nk_context` struct
+/// __replay__  | Must point to a `nk_input_replay` struct the frame was replayed from
+///
+/// Returns `nk_true` if the draw commands are the same as recorded and
+/// `nk_false` otherwise. The first differing frame is kept in `nk_input_replay::diverged`
+*/
+NK_API int nk_input_replay_verify(struct nk_context*, struct nk_input_replay*);
 /* =============================================================================
  *
  *                                  DRAWING
@@ -888,6 +1428,7 @@ NK_API void nk_input_end(struct nk_context*);
 /// cfg.circle_segment_count = 22;
 /// cfg.curve_segment_count = 22;
 /// cfg.arc_segment_count = 22;
+/// cfg.curve_tolerance = 0.25f; // optional: adapt segment counts to shape size
 /// cfg.global_alpha = 1.0f;
 /// cfg.null = dev->null;
 /// //
@@ -919,6 +1460,118 @@ NK_API void nk_input_end(struct nk_context*);
 /// __nk__draw_next__   | Increments the vertex command iterator to the next command inside the context vertex command list
 /// __nk__draw_end__    | Returns the end of the vertex draw list
 /// __nk_draw_foreach__ | Iterates over each vertex draw command inside the vertex draw list
+/// __nk__begin_contexts__  | Returns the first draw command of multiple contexts drawn back to front
+/// __nk__next_contexts__   | Increments the draw command iterator over multiple contexts
+/// __nk_foreach_contexts__ | Iterates over each draw command of multiple contexts drawn back to front
+/// __nk_contexts_hovered__ | Returns the topmost context with a window at a screen position
+/// __nk_convert_contexts__ | Converts the draw commands of multiple contexts into one vertex draw list
+/// __nk_frame_init__       | Initializes a frame object holding finished draw commands from a buffer
+/// __nk_frame_free__       | Frees the command memory of a frame object
+/// __nk_frame_swap__       | Hands the finished draw commands of a context to a frame and clears the context
+/// __nk__frame_begin__     | Returns the first draw command of a frame object
+/// __nk__frame_next__      | Increments the draw command iterator of a frame object
+/// __nk_frame_foreach__    | Iterates over each draw command of a frame object
+/// __nk_frame_convert__    | Converts the draw commands of a frame object into a vertex draw list
+/// __nk_stream_encoder_init__  | Initializes an encoder serializing draw commands into stream messages
+/// __nk_stream_encoder_free__  | Frees the memory of a stream encoder
+/// __nk_stream_encoder_reset__ | Makes the next message a key frame without references to previous messages
+/// __nk_stream_encode__        | Appends a message with the draw commands of a context to a buffer
+/// __nk_stream_decoder_init__  | Initializes a decoder rebuilding draw commands from stream messages
+/// __nk_stream_decoder_free__  | Frees the memory of a stream decoder
+/// __nk_stream_decode__        | Decodes a message into the draw command list of a frame object
+///
+/// #### Multiple contexts
+/// Multiple contexts can be built in parallel, one context per thread, and
+/// composed into one frame afterwards. Each context owns its input, windows,
+/// command buffer and style. Styles can be shared by plain assignment
+/// (`ctx_b->style = ctx_a->style`) since all style data is copied by value.
+/// Fonts and baked font atlases are only read while building the UI and can be
+/// shared between contexts on different threads. A dynamic font atlas
+/// rasterizes glyphs on demand and therefore requires a lock set by
+/// `nk_font_atlas_set_lock` if it is used by multiple threads at once.
+///
+/// Contexts are passed as an array ordered back to front. Input should be
+/// routed to the context returned by `nk_contexts_hovered` and the other
+/// contexts should only receive mouse motion, so windows of different contexts
+/// overlapping each other do not both react to a click.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// struct nk_context *layers[2] = {&background, &foreground};
+/// int top = nk_contexts_hovered(layers, 2, mouse);
+/// // ... build each context on its own thread ...
+/// const struct nk_command *cmd;
+/// int index;
+/// nk_foreach_contexts(cmd, layers, 2, index) {
+///     switch (cmd->type) {
+///     //...
+///     }
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Pipelined frames
+/// `nk_clear` reuses the command memory right away, so drawing has to finish
+/// before the next frame is built. Rendering on another thread can instead
+/// overlap with building the next frame by handing finished frames off.
+/// `nk_frame_swap` replaces `nk_clear` at the end of a frame: it links all
+/// window commands, exchanges the command buffer of the context with the one
+/// held by a `nk_frame` without copying and then clears the context. The frame
+/// is immutable afterwards and owned by the render thread, which iterates it with
+/// `nk_frame_foreach` or converts it with `nk_frame_convert` into its own
+/// vertex draw list. Before the next swap the render thread has to be done with
+/// the frame since its memory becomes the command buffer of the context again.
+/// The context has to allocate windows from a pool (`nk_init`, `nk_init_default`
+/// or `nk_init_custom`) so only command memory is exchanged.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// struct nk_frame frame;
+/// nk_frame_init_default(&frame);
+/// while (1) {
+///     // ... input and UI ...
+///     wait_for_render_thread();
+///     nk_frame_swap(&ctx, &frame);
+///     signal_render_thread(&frame);
+/// }
+/// // render thread
+/// nk_frame_foreach(cmd, &frame) {
+///     // ...
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// #### Command streams
+/// Draw commands can be rendered by another process, for example a viewer
+/// displaying the UI of a headless service. `nk_stream_encode` serializes the
+/// draw commands of a context into a binary message including text and a
+/// table of font, image and userdata handles. Messages are delta encoded:
+/// window command lists unchanged from the previous message are sent as a
+/// reference to it. On the receiving side `nk_stream_decode` rebuilds the
+/// command list inside a `nk_frame` that is iterated with `nk_frame_foreach`
+/// or converted with `nk_frame_convert`.
+///
+/// Messages have to be decoded in order. After a lost or corrupt message
+/// the decoder only accepts key frames, so the sender has to call
+/// `nk_stream_encoder_reset`. Fonts are sent as index into the font list
+/// passed to both encoder and decoder. Image and userdata handles are
+/// copied as is, so both sides have to agree on their meaning and use the
+/// same byte order and pointer size. Custom draw callbacks are not sent.
+/// Popup and cursor commands are sent as part of the last window.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_user_font *fonts[] = {&font->handle};
+/// // sender
+/// nk_stream_encoder_init_default(&enc, fonts, 1);
+/// // ... input and UI ...
+/// nk_buffer_clear(&msg);
+/// if (nk_stream_encode(&enc, &ctx, &msg))
+///     send(socket, nk_buffer_memory(&msg), msg.allocated);
+/// nk_clear(&ctx);
+/// // viewer
+/// nk_stream_decoder_init_default(&dec, fonts, 1);
+/// if (nk_stream_decode(&dec, &frame, data, size)) {
+///     nk_frame_foreach(cmd, &frame) {
+///         // ...
+///     }
+/// } else request_key_frame();
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 */
 enum nk_anti_aliasing {NK_ANTI_ALIASING_OFF, NK_ANTI_ALIASING_ON};
 enum nk_convert_result {
@@ -943,52 +1596,360 @@ struct nk_convert_config {
     const struct nk_draw_vertex_layout_element *vertex_layout; /* describes the vertex output format and packing */
     nk_size vertex_size; /* sizeof one vertex for vertex packing */
     nk_size vertex_alignment; /* vertex alignment: Can be obtained by NK_ALIGNOF */
+    float curve_tolerance; /* if bigger than 0 segment counts of circles, arcs, curves and rounded corners are picked by shape size instead of the counts above so the tessellation stays within this distance of the exact shape. Given in draw coordinates so it has to be divided by the framebuffer scale on high DPI displays */
 };
 /*/// #### nk__begin
 /// Returns a draw command list iterator to iterate all draw
 /// commands accumulated over one frame.
 ///
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// const struct nk_command* nk__begin(struct nk_context*);
+/// const struct nk_command* nk__begin(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | must point to an previously initialized `nk_context` struct at the end of a frame
+///
+/// Returns draw command pointer pointing to the first command inside the draw command list
+*/
+NK_API const struct nk_command* nk__begin(struct nk_context*);
+/*/// #### nk__next
+/// Returns draw command pointer pointing to the next command inside the draw command list
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__next(struct nk_context*, const struct nk_command*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
+/// __cmd__     | Must point to an previously a draw command either returned by `nk__begin` or `nk__next`
+///
+/// Returns draw command pointer pointing to the next command inside the draw command list
+*/
+NK_API const struct nk_command* nk__next(struct nk_context*, const struct nk_command*);
+/*/// #### nk_foreach
+/// Iterates over each draw command inside the context draw command list
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define nk_foreach(c, ctx)
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
+/// __cmd__     | Command pointer initialized to NULL
+///
+/// Iterates over each draw command inside the context draw command list
+*/
+#define nk_foreach(c, ctx) for((c) = nk__begin(ctx); (c) != 0; (c) = nk__next(ctx,c))
+/*/// #### nk__begin_contexts
+/// Returns the first draw command of multiple contexts. Contexts are
+/// iterated in array order which is back to front.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | Output index of the context the returned command belongs to
+///
+/// Returns draw command pointer pointing to the first command of the first non-empty context
+*/
+NK_API const struct nk_command* nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index);
+/*/// #### nk__next_contexts
+/// Returns the draw command following `cmd` and advances to the next context
+/// once all commands of the current context have been returned
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__next_contexts(struct nk_context *const *ctxs, int count, int *index, const struct nk_command*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | Index of the context `cmd` belongs to and is updated to the context of the returned command
+/// __cmd__     | Must point to a draw command returned by `nk__begin_contexts` or `nk__next_contexts`
+///
+/// Returns draw command pointer pointing to the next command or NULL at the end of the last context
+*/
+NK_API const struct nk_command* nk__next_contexts(struct nk_context *const *ctxs, int count, int *index, const struct nk_command*);
+/*/// #### nk_foreach_contexts
+/// Iterates over each draw command of multiple contexts in back to front order
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define nk_foreach_contexts(c, ctxs, count, index)
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __c__       | Command pointer initialized to NULL
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __index__   | `int` variable holding the index of the context the current command belongs to
+*/
+#define nk_foreach_contexts(c, ctxs, count, index) for((c) = nk__begin_contexts(ctxs, count, &(index)); (c) != 0; (c) = nk__next_contexts(ctxs, count, &(index), c))
+/*/// #### nk_contexts_hovered
+/// Returns the topmost context with a visible window at a screen position,
+/// which is the context that should receive mouse button input
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of `nk_context` structs ordered back to front
+/// __count__   | Number of contexts inside the array
+/// __pos__     | Screen position to test, usually the mouse position
+///
+/// Returns the array index of the topmost context with a window at `pos` or -1 otherwise
+*/
+NK_API int nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos);
+/*/// #### nk_frame_init
+/// Initializes a frame object that takes over ownership of a buffer used
+/// to exchange draw command memory with a context
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_init(struct nk_frame *frame, struct nk_buffer *memory);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to an either stack or heap allocated `nk_frame` struct
+/// __memory__  | Must point to a previously initialized buffer. Fixed size buffers should have the same size as the context command buffer
+*/
+NK_API void nk_frame_init(struct nk_frame*, struct nk_buffer *memory);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_frame_init_default
+/// Initializes a frame object with a buffer using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_init_default(struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to an either stack or heap allocated `nk_frame` struct
+*/
+NK_API void nk_frame_init_default(struct nk_frame*);
+#endif
+/*/// #### nk_frame_free
+/// Frees the command memory currently held by a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_frame_free(struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a previously initialized `nk_frame` struct
+*/
+NK_API void nk_frame_free(struct nk_frame*);
+/*/// #### nk_frame_swap
+/// Hands the draw commands of a finished frame over to a frame object by
+/// exchanging command buffers and clears the context like `nk_clear`
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_frame_swap(struct nk_context *ctx, struct nk_frame *frame);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to a context at the end of a frame that allocates windows from a pool
+/// __frame__   | Must point to a previously initialized `nk_frame` struct no longer used by the renderer
+///
+/// Returns `true(1)` if the frame holds any draw commands or `false(0)` otherwise
+*/
+NK_API int nk_frame_swap(struct nk_context*, struct nk_frame*);
+/*/// #### nk__frame_begin
+/// Returns the first draw command of a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__frame_begin(const struct nk_frame*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+///
+/// Returns draw command pointer pointing to the first command or NULL if the frame is empty
+*/
+NK_API const struct nk_command* nk__frame_begin(const struct nk_frame*);
+/*/// #### nk__frame_next
+/// Returns the draw command following `cmd` inside a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// const struct nk_command* nk__frame_next(const struct nk_frame*, const struct nk_command*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+/// __cmd__     | Must point to a draw command returned by `nk__frame_begin` or `nk__frame_next`
+///
+/// Returns draw command pointer pointing to the next command or NULL at the end
+*/
+NK_API const struct nk_command* nk__frame_next(const struct nk_frame*, const struct nk_command*);
+/*/// #### nk_frame_foreach
+/// Iterates over each draw command of a frame object
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// #define nk_frame_foreach(c, frame)
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __c__       | Command pointer initialized to NULL
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+*/
+#define nk_frame_foreach(c, frame) for((c) = nk__frame_begin(frame); (c) != 0; (c) = nk__frame_next(frame, c))
+/*/// #### nk_stream_encoder_init
+/// Initializes an encoder that serializes the draw commands of a context
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_init(struct nk_stream_encoder *enc, const struct nk_allocator *alloc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __enc__         | Must point to an either stack or heap allocated `nk_stream_encoder` struct
+/// __alloc__       | Must point to a previously initialized memory allocator
+/// __fonts__       | Fonts used by text commands in the same order as passed to the decoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_encoder_init(struct nk_stream_encoder*, const struct nk_allocator*, const struct nk_user_font *const *fonts, int font_count);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_stream_encoder_init_default
+/// Initializes a stream encoder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_init_default(struct nk_stream_encoder *enc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __enc__         | Must point to an either stack or heap allocated `nk_stream_encoder` struct
+/// __fonts__       | Fonts used by text commands in the same order as passed to the decoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_encoder_init_default(struct nk_stream_encoder*, const struct nk_user_font *const *fonts, int font_count);
+#endif
+/*/// #### nk_stream_encoder_free
+/// Frees all memory held by a stream encoder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_free(struct nk_stream_encoder *enc);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | must point to an previously initialized `nk_context` struct at the end of a frame
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
+*/
+NK_API void nk_stream_encoder_free(struct nk_stream_encoder*);
+/*/// #### nk_stream_encoder_reset
+/// Makes the next message a key frame that can be decoded without any
+/// previous message, for example after a viewer connected or lost a message
 ///
-/// Returns draw command pointer pointing to the first command inside the draw command list
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_encoder_reset(struct nk_stream_encoder *enc);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
 */
-NK_API const struct nk_command* nk__begin(struct nk_context*);
-/*/// #### nk__next
-/// Returns draw command pointer pointing to the next command inside the draw command list
+NK_API void nk_stream_encoder_reset(struct nk_stream_encoder*);
+/*/// #### nk_stream_encode
+/// Appends a message holding all draw commands of a finished frame to a buffer.
+/// Has to be called after the last `nk_end` and before `nk_clear`.
 ///
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// const struct nk_command* nk__next(struct nk_context*, const struct nk_command*);
+/// nk_size nk_stream_encode(struct nk_stream_encoder *enc, struct nk_context *ctx, struct nk_buffer *out);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
+/// __enc__     | Must point to a previously initialized `nk_stream_encoder` struct
 /// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
-/// __cmd__     | Must point to an previously a draw command either returned by `nk__begin` or `nk__next`
+/// __out__     | Must point to a previously initialized buffer the message is appended to
 ///
-/// Returns draw command pointer pointing to the next command inside the draw command list
+/// Returns the size of the message in bytes or 0 if `out` is full. Nothing is appended on failure
 */
-NK_API const struct nk_command* nk__next(struct nk_context*, const struct nk_command*);
-/*/// #### nk_foreach
-/// Iterates over each draw command inside the context draw command list
+NK_API nk_size nk_stream_encode(struct nk_stream_encoder*, struct nk_context*, struct nk_buffer *out);
+/*/// #### nk_stream_decoder_init
+/// Initializes a decoder that rebuilds draw commands from stream messages
 ///
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
-/// #define nk_foreach(c, ctx)
+/// void nk_stream_decoder_init(struct nk_stream_decoder *dec, const struct nk_allocator *alloc,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __dec__         | Must point to an either stack or heap allocated `nk_stream_decoder` struct
+/// __alloc__       | Must point to a previously initialized memory allocator
+/// __fonts__       | Fonts for text commands in the same order as passed to the encoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_decoder_init(struct nk_stream_decoder*, const struct nk_allocator*, const struct nk_user_font *const *fonts, int font_count);
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+/*/// #### nk_stream_decoder_init_default
+/// Initializes a stream decoder using the default allocator
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_decoder_init_default(struct nk_stream_decoder *dec,
+///     const struct nk_user_font *const *fonts, int font_count);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter       | Description
+/// ----------------|-----------------------------------------------------------
+/// __dec__         | Must point to an either stack or heap allocated `nk_stream_decoder` struct
+/// __fonts__       | Fonts for text commands in the same order as passed to the encoder
+/// __font_count__  | Number of fonts inside the array
+*/
+NK_API void nk_stream_decoder_init_default(struct nk_stream_decoder*, const struct nk_user_font *const *fonts, int font_count);
+#endif
+/*/// #### nk_stream_decoder_free
+/// Frees all memory held by a stream decoder
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_stream_decoder_free(struct nk_stream_decoder *dec);
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
 /// Parameter   | Description
 /// ------------|-----------------------------------------------------------
-/// __ctx__     | Must point to an previously initialized `nk_context` struct at the end of a frame
-/// __cmd__     | Command pointer initialized to NULL
+/// __dec__     | Must point to a previously initialized `nk_stream_decoder` struct
+*/
+NK_API void nk_stream_decoder_free(struct nk_stream_decoder*);
+/*/// #### nk_stream_decode
+/// Decodes a message created by `nk_stream_encode` into the draw command
+/// list of a frame object. Messages have to be decoded in the order they
+/// were encoded.
 ///
-/// Iterates over each draw command inside the context draw command list
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_stream_decode(struct nk_stream_decoder *dec, struct nk_frame *frame,
+///     const void *message, nk_size size);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __dec__     | Must point to a previously initialized `nk_stream_decoder` struct
+/// __frame__   | Must point to a previously initialized `nk_frame` struct not used by the renderer
+/// __message__ | Must point to a complete message
+/// __size__    | Size of the message in bytes
+///
+/// Returns `true(1)` on success or `false(0)` if the message is corrupt or
+/// references a message the decoder did not see. Only key frames are
+/// accepted after a failure.
 */
-#define nk_foreach(c, ctx) for((c) = nk__begin(ctx); (c) != 0; (c) = nk__next(ctx,c))
+NK_API int nk_stream_decode(struct nk_stream_decoder*, struct nk_frame*, const void *message, nk_size size);
 #ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
 /*/// #### nk_convert
 /// Converts all internal draw commands into vertex draw commands and fills
@@ -1020,6 +1981,57 @@ NK_API const struct nk_command* nk__next(struct nk_context*, const struct nk_com
 /// NK_CONVERT_ELEMENT_BUFFER_FULL  | The provided buffer for storing indicies is full or failed to allocate more memory
 */
 NK_API nk_flags nk_convert(struct nk_context*, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/*/// #### nk_convert_contexts
+/// Converts the draw commands of multiple contexts back to front into one set
+/// of vertex, element and vertex draw command buffers. The converted draw list
+/// is stored inside the first context and has to be iterated with it.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_convert_contexts(struct nk_context *const *ctxs, int count, struct nk_buffer *cmds,
+///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctxs__    | Array of previously initialized `nk_context` structs at the end of a frame
+/// __count__   | Number of contexts inside the array
+/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
+/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
+/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
+/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+///
+/// Returns one of enum nk_convert_result error codes like `nk_convert`.
+/// Vertex draw commands are iterated with `nk_draw_foreach(cmd, ctxs[0], cmds)`.
+*/
+NK_API nk_flags nk_convert_contexts(struct nk_context *const *ctxs, int count, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/*/// #### nk_frame_convert
+/// Converts the draw commands of a frame object into vertex draw commands.
+/// The vertex draw list is stored inside the frame, so conversion can run on
+/// the render thread while the context builds the next frame.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// nk_flags nk_frame_convert(struct nk_frame *frame, struct nk_buffer *cmds,
+///     struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __frame__   | Must point to a frame object filled by `nk_frame_swap`
+/// __cmds__    | Must point to a previously initialized buffer to hold converted vertex draw commands
+/// __vertices__| Must point to a previously initialized buffer to hold all produced vertices
+/// __elements__| Must point to a previously initialized buffer to hold all produced vertex indices
+/// __config__  | Must point to a filled out `nk_config` struct to configure the conversion process
+///
+/// Returns one of enum nk_convert_result error codes like `nk_convert`.
+/// Vertex draw commands are iterated with `nk_draw_list_foreach(cmd, &frame->draw_list, cmds)`.
+///
+/// !!! WARNING
+///     With `NK_INCLUDE_PROFILER` conversion and tessellation zones go to the
+///     profiler attached to `frame->profiler`. Converting on another thread than
+///     the one building the next frame needs a different profiler than the one
+///     attached to the context, or none at all.
+*/
+NK_API nk_flags nk_frame_convert(struct nk_frame*, struct nk_buffer *cmds, struct nk_buffer *vertices, struct nk_buffer *elements, const struct nk_convert_config*);
 /*/// #### nk__draw_begin
 /// Returns a draw vertex command buffer iterator to iterate over the vertex draw command buffer
 ///
@@ -1803,6 +2815,13 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 /// row height for you and. This means if you change the font but still want
 /// a minimum row height smaller than the font you have to repush your value. <br /><br />
 ///
+/// Widgets inside rows that lie completely outside the visible area of a window
+/// or group are detected by a constant time check and skipped without being
+/// clipped, measured or drawn. For long lists of rows it is however still
+/// faster to not call widgets for invisible rows at all. `nk_layout_row_skip`
+/// jumps over any number of rows in one call while keeping the scrollbar
+/// extents the same as if all rows had been filled. <br /><br />
+///
 /// For actually more advanced UI I would even recommend using the `nk_layout_space_xxx`
 /// layouting method in combination with a cassowary constraint solver (there are
 /// some versions on github with permissive license model) to take over all control over widget
@@ -1978,6 +2997,29 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 ///     nk_end(...);
 ///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
+///     Templates repeated for a lot of rows can also be declared once as
+///     `nk_layout_template` and referenced by pointer. Column widths are
+///     then only resolved again if the panel width changes.
+///
+///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+///     // declared once
+///     struct nk_layout_template row;
+///     nk_layout_template_init(&row);
+///     nk_layout_template_push_dynamic(&row);
+///     nk_layout_template_push_variable(&row, 80);
+///     nk_layout_template_push_static(&row, 80);
+///
+///     if (nk_begin_xxx(...) {
+///         for (i = 0; i < count; ++i) {
+///             nk_layout_row_template(ctx, 30, &row);
+///             nk_widget(...);
+///             nk_widget(...);
+///             nk_widget(...);
+///         }
+///     }
+///     nk_end(...);
+///     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
 /// 6.  __nk_layout_space_xxx__<br /><br />
 ///     Finally the most flexible API directly allows you to place widgets inside the
 ///     window. The space layout API is an immediate mode API which does not support
@@ -2021,12 +3063,19 @@ NK_API void nk_window_show_if(struct nk_context*, const char *name, enum nk_show
 /// nk_layout_row_push                      | Pushes another column with given size or window ratio
 /// nk_layout_row_end                       | Finished previously started row
 /// nk_layout_row                           | Specifies row columns in array as either window ratio or size
+/// nk_layout_row_skip                      | Jumps over a number of rows without allocating any widgets
+/// nk_layout_row_is_visible                | Returns if the current row is at least partially inside the visible area
 //
 /// nk_layout_row_template_begin            | Begins the row template declaration
 /// nk_layout_row_template_push_dynamic     | Adds a dynamic column that dynamically grows and can go to zero if not enough space
 /// nk_layout_row_template_push_variable    | Adds a variable column that dynamically grows but does not shrink below specified pixel width
 /// nk_layout_row_template_push_static      | Adds a static column that does not grow and will always have the same size
 /// nk_layout_row_template_end              | Marks the end of the row template
+/// nk_layout_row_template                  | Begins a new row with a template declared once with nk_layout_template_xxx
+/// nk_layout_template_init                 | Initializes a reusable row template
+/// nk_layout_template_push_dynamic         | Adds a dynamic column to a reusable row template
+/// nk_layout_template_push_variable        | Adds a variable column to a reusable row template
+/// nk_layout_template_push_static          | Adds a static column to a reusable row template
 //
 /// nk_layout_space_begin                   | Begins a new layouting space that allows to specify each widgets position and size
 /// nk_layout_space_push                    | Pushes position and size of the next widget in own coordinate space either as pixel or ratio
@@ -2174,6 +3223,39 @@ NK_API void nk_layout_row_end(struct nk_context*);
 /// __columns__ | Number of widget inside row
 */
 NK_API void nk_layout_row(struct nk_context*, enum nk_layout_format, float height, int cols, const float *ratio);
+/*/// #### nk_layout_row_skip
+/// Finishes the current row and jumps over @rows number of rows with given height
+/// without allocating any widgets. Content height and therefore scrollbars are
+/// calculated as if each skipped row had been filled with widgets.
+/// Useful to skip over long lists of rows not visible inside the current window or group.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_row_skip(struct nk_context*, float height, int rows);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+/// __height__  | Holds height of each skipped row or zero for auto layouting
+/// __rows__    | Number of rows to skip
+*/
+NK_API void nk_layout_row_skip(struct nk_context*, float height, int rows);
+/*/// #### nk_layout_row_is_visible
+/// Checks if the currently allocated row is at least partially inside the visible
+/// area of the current window or group. Widgets inside invisible rows are not
+/// drawn or updated, so callers can use this to skip expensive widget preparation.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// int nk_layout_row_is_visible(struct nk_context*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+///
+/// Returns `true(1)` if the current row can be seen and `false(0)` if it is completely out of view
+*/
+NK_API int nk_layout_row_is_visible(struct nk_context*);
 /*/// #### nk_layout_row_template_begin
 /// Begins the row template declaration
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
@@ -2233,6 +3315,66 @@ NK_API void nk_layout_row_template_push_static(struct nk_context*, float width);
 /// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
 */
 NK_API void nk_layout_row_template_end(struct nk_context*);
+/*/// #### nk_layout_template_init
+/// Initializes a row template that is declared once and used for many rows
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_template_init(struct nk_layout_template*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __tmpl__    | Must point to a `nk_layout_template` struct
+*/
+NK_API void nk_layout_template_init(struct nk_layout_template*);
+/*/// #### nk_layout_template_push_dynamic
+/// Adds a dynamic column that dynamically grows and can go to zero if not enough space
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_template_push_dynamic(struct nk_layout_template*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
+*/
+NK_API void nk_layout_template_push_dynamic(struct nk_layout_template*);
+/*/// #### nk_layout_template_push_variable
+/// Adds a variable column that dynamically grows but does not shrink below specified pixel width
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_template_push_variable(struct nk_layout_template*, float min_width);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
+/// __width__   | Holds the minimum pixel width the next column must always be
+*/
+NK_API void nk_layout_template_push_variable(struct nk_layout_template*, float min_width);
+/*/// #### nk_layout_template_push_static
+/// Adds a static column that does not grow and will always have the same size
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_template_push_static(struct nk_layout_template*, float width);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __tmpl__    | Must point to a previously initialized `nk_layout_template` struct
+/// __width__   | Holds the absolute pixel width value the next column must be
+*/
+NK_API void nk_layout_template_push_static(struct nk_layout_template*, float width);
+/*/// #### nk_layout_row_template
+/// Starts a new row using a previously declared template. Column widths are
+/// resolved once and only recalculated if the usable panel width changes.
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
+/// void nk_layout_row_template(struct nk_context*, float height, struct nk_layout_template*);
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+///
+/// Parameter   | Description
+/// ------------|-----------------------------------------------------------
+/// __ctx__     | Must point to an previously initialized `nk_context` struct after call `nk_begin_xxx`
+/// __height__  | Holds height of each widget in row or zero for auto layouting
+/// __tmpl__    | Must point to a template filled with `nk_layout_template_push_xxx`
+*/
+NK_API void nk_layout_row_template(struct nk_context*, float height, struct nk_layout_template*);
 /*/// #### nk_layout_space_begin
 /// Begins a new layouting space that allows to specify each widgets position and size.
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~c
@@ -2803,6 +3945,44 @@ NK_API void nk_tree_element_pop(struct nk_context*);
  *                                  LIST VIEW
  *
  * ============================================================================= */
+/* Index over rows of different height for `nk_list_view_begin_variable`.
+ * Row heights are stored inside a fenwick tree in caller provided memory
+ * (one `nk_list_view_row` per row) which allows to find the first visible
+ * row, the offset of a row and update a single row height in O(log n).
+ * Sums are kept as doubles next to the exact height of each row, so offsets
+ * do not drift over many updates. Offsets are still returned as float and
+ * lose sub-pixel precision once lists grow beyond 2^24 pixels.
+ * Row heights must not be negative and rows shorter than the minimum row
+ * height of the panel (font height plus text and row padding) are not
+ * supported, since the row layout grows them and the drawn rows would no
+ * longer match the offsets inside the index:
+ *
+ *      struct nk_list_view_row memory[ROW_COUNT];
+ *      struct nk_list_view_index index;
+ *      nk_list_view_index_init(&index, memory, ROW_COUNT);
+ *      nk_list_view_index_build(&index, row_height_callback, userdata, ROW_COUNT);
+ *
+ *      if (nk_list_view_begin_variable(ctx, &view, "log", NK_WINDOW_BORDER, &index)) {
+ *          for (i = view.begin; i < view.end; ++i) {
+ *              nk_layout_row_dynamic(ctx, nk_list_view_index_height(&index, i), 1);
+ *              nk_label_wrap(ctx, lines[i]);
+ *          }
+ *          nk_list_view_end(&view);
+ *      }
+ */
+struct nk_list_view_row {
+    double sum;
+    /* fenwick tree node */
+    float height;
+    /* height of the row itself */
+};
+struct nk_list_view_index {
+    struct nk_list_view_row *rows;
+    int count;
+    int capacity;
+};
+typedef float(*nk_list_view_row_height)(nk_handle userdata, int row);
+
 struct nk_list_view {
 /* public: */
     int begin, end, count;
@@ -2811,9 +3991,150 @@ struct nk_list_view {
     struct nk_context *ctx;
     nk_uint *scroll_pointer;
     nk_uint scroll_value;
+    const struct nk_list_view_index *index;
 };
 NK_API int nk_list_view_begin(struct nk_context*, struct nk_list_view *out, const char *id, nk_flags, int row_height, int row_count);
+NK_API int nk_list_view_begin_variable(struct nk_context*, struct nk_list_view *out, const char *id, nk_flags, const struct nk_list_view_index*);
 NK_API void nk_list_view_end(struct nk_list_view*);
+
+NK_API void nk_list_view_index_init(struct nk_list_view_index*, struct nk_list_view_row *memory, int capacity);
+NK_API int nk_list_view_index_build(struct nk_list_view_index*, nk_list_view_row_height, nk_handle userdata, int row_count);
+NK_API void nk_list_view_index_set(struct nk_list_view_index*, int row, float height);
+NK_API float nk_list_view_index_height(const struct nk_list_view_index*, int row);
+NK_API float nk_list_view_index_offset(const struct nk_list_view_index*, int row, float spacing);
+NK_API int nk_list_view_index_find(const struct nk_list_view_index*, float offset, float spacing);
+/* =============================================================================
+ *
+ *                                  GRID
+ *
+ * ============================================================================= */
+/* Virtualized table with a fixed row height and a sticky header row. Only
+ * visible rows `[row_begin, row_end)` and visible columns `[col_begin, col_end)`
+ * have to be submitted and cells are drawn directly without going through the
+ * row layout, so grids with millions of rows cost the same as small ones.
+ * Column offsets and measured cell text widths are cached inside the caller
+ * owned columns, which also keep the width after resizing and the current
+ * sort order. Cached text widths are dropped if the font or column width
+ * changes:
+ *
+ *      static struct nk_grid_column columns[] = {
+ *          {"Name", 200, 40, NK_TEXT_LEFT},
+ *          {"Size", 80, 40, NK_TEXT_RIGHT}
+ *      };
+ *      struct nk_grid grid;
+ *      if (nk_grid_begin(ctx, &grid, "files", NK_WINDOW_BORDER|NK_GRID_SORTABLE|NK_GRID_RESIZABLE,
+ *          columns, 2, 0, ROW_COUNT)) {
+ *          for (row = grid.row_begin; row < grid.row_end; ++row)
+ *              for (col = grid.col_begin; col < grid.col_end; ++col)
+ *                  nk_grid_cell_label(&grid, row, col, cell_text(row, col));
+ *          if (nk_grid_end(&grid))
+ *              sort_rows(columns);
+ *      }
+ */
+enum nk_grid_flags {
+    NK_GRID_SORTABLE    = NK_FLAG(24), /* Clicking a column header toggles the column sort order */
+    NK_GRID_RESIZABLE   = NK_FLAG(25)  /* Dragging the right border of a column header resizes the column */
+};
+enum nk_grid_sort {
+    NK_GRID_SORT_NONE,
+    NK_GRID_SORT_ASCENDING,
+    NK_GRID_SORT_DESCENDING
+};
+struct nk_grid_text {
+    nk_hash hash;
+    int length;
+    /* hash and length of the measured text or zero length if unused */
+    int clamped;
+    float width;
+    /* length and width of the text after clamping to the column */
+};
+struct nk_grid_column {
+/* public: */
+    const char *title;
+    float width, min_width;
+    nk_flags align;
+    enum nk_grid_sort sort;
+/* private: */
+    float offset, text_width;
+    const struct nk_user_font *font;
+    float font_height, measured_width;
+    /* font and text width the cached cell texts were measured with */
+    struct nk_grid_text texts[NK_GRID_TEXT_CACHE_SIZE];
+};
+struct nk_grid {
+/* public: */
+    int row_begin, row_end;
+    int col_begin, col_end;
+/* private: */
+    struct nk_context *ctx;
+    struct nk_grid_column *columns;
+    int column_count, row_count;
+    float row_height, total_width;
+    struct nk_vec2 origin;
+    nk_uint scroll_y;
+    nk_flags flags;
+    int sorted;
+};
+NK_API int nk_grid_begin(struct nk_context*, struct nk_grid *out, const char *id, nk_flags, struct nk_grid_column*, int column_count, float row_height, int row_count);
+NK_API struct nk_rect nk_grid_cell_bounds(const struct nk_grid*, int row, int col);
+NK_API void nk_grid_cell_text(struct nk_grid*, int row, int col, const char*, int len);
+NK_API void nk_grid_cell_label(struct nk_grid*, int row, int col, const char*);
+NK_API int nk_grid_end(struct nk_grid*);
+/* =============================================================================
+ *
+ *                                  TREE VIEW
+ *
+ * ============================================================================= */
+/* Virtualized tree for large hierarchies. Nodes are provided by the caller in
+ * depth-first order together with the number of nodes inside their subtree.
+ * Expansion state lives in caller provided memory (one byte per node) and
+ * only expanded nodes are flattened into the visible row list, which is
+ * rebuilt after a node was toggled. Collapsed subtrees are skipped in one
+ * step and frame cost only depends on the number of visible rows:
+ *
+ *      static struct nk_tree_view_node nodes[NODE_COUNT] = {
+ *          {"assets", 0, 3}, {"textures", 1, 1}, {"stone.png", 2, 0}, {"shaders", 1, 0}
+ *      };
+ *      static nk_byte expanded[NODE_COUNT];
+ *      static int rows[NODE_COUNT];
+ *      static struct nk_tree_view_state tree;
+ *      nk_tree_view_init(&tree, nodes, NODE_COUNT, expanded, rows);
+ *
+ *      struct nk_tree_view view;
+ *      if (nk_tree_view_begin(ctx, &view, "assets", NK_WINDOW_BORDER, &tree)) {
+ *          for (i = view.begin; i < view.end; ++i)
+ *              nk_tree_view_node(&view, i);
+ *          nk_tree_view_end(&view);
+ *      }
+ */
+struct nk_tree_view_node {
+    const char *label;
+    int depth;
+    int descendants;
+};
+struct nk_tree_view_state {
+    const struct nk_tree_view_node *nodes;
+    int node_count;
+    nk_byte *expanded;
+    int *rows;
+    int row_count;
+    int dirty;
+};
+struct nk_tree_view {
+/* public: */
+    int begin, end;
+/* private: */
+    struct nk_list_view list;
+    struct nk_tree_view_state *state;
+    float row_height;
+};
+NK_API void nk_tree_view_init(struct nk_tree_view_state*, const struct nk_tree_view_node*, int node_count, nk_byte *expanded, int *rows);
+NK_API void nk_tree_view_set_expanded(struct nk_tree_view_state*, int node, int expanded);
+NK_API int nk_tree_view_is_expanded(const struct nk_tree_view_state*, int node);
+NK_API int nk_tree_view_update(struct nk_tree_view_state*);
+NK_API int nk_tree_view_begin(struct nk_context*, struct nk_tree_view *out, const char *id, nk_flags, struct nk_tree_view_state*);
+NK_API int nk_tree_view_node(struct nk_tree_view*, int row);
+NK_API void nk_tree_view_end(struct nk_tree_view*);
 /* =============================================================================
  *
  *                                  WIDGET
@@ -3672,6 +4993,92 @@ NK_API const char* nk_utf_at(const char *buffer, int length, int index, nk_rune
         cfg.coord_type = NK_COORD_PIXEL;
         nk_font *font = nk_font_atlas_add_from_file(&atlas, "Path/To/Your/TTF_Font.ttf", 13, &cfg);
 
+    Baking can be skipped on later runs by storing the baked atlas. After
+    `nk_font_atlas_bake` and before `nk_font_atlas_end` the glyphs, range tables,
+    cursor region and pixels can be written into one binary blob with
+    `nk_font_atlas_save`. After adding the same fonts with the same configuration
+    `nk_font_atlas_load` can be used instead of `nk_font_atlas_bake`. The blob is
+    keyed by a hash of all font data and configurations (`nk_font_atlas_hash`)
+    and loading returns `NULL` if it does not match anymore, in which case
+    the atlas has to be baked again:
+
+        const void *img = nk_font_atlas_load_from_file(&atlas, "fonts.cache", &w, &h, NK_FONT_ATLAS_RGBA32);
+        if (!img) {
+            img = nk_font_atlas_bake(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+            nk_font_atlas_save_to_file(&atlas, "fonts.cache");
+        }
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), 0);
+
+    UIs drawing text at many scales can bake each font once as signed distance
+    field by setting `nk_font_config::sdf` to the distance in pixels stored around
+    each glyph. Each texel then holds the distance to the glyph outline with 128
+    on the outline, so one large bake (32 pixel for example) renders smooth
+    text at any font height. The renderer has to convert distance into coverage,
+    for example with `smoothstep(0.5 - w, 0.5 + w, alpha)` in a fragment shader
+    where `w` is about half a pixel in distance units (`fwidth(alpha)`):
+
+        struct nk_font_config cfg = nk_font_config(0);
+        cfg.sdf = 4;
+        struct nk_font *font = nk_font_atlas_add_from_file(&atlas, "Path/To/Your/TTF_Font.ttf", 32, &cfg);
+        font->handle.height = 13;
+
+    Fonts with big character sets (CJK for example) do not fit into a reasonably
+    sized texture. For these `nk_font_atlas_bake_dynamic` creates an empty texture
+    of fixed size and rasterizes glyphs on first use instead. The texture is split
+    into `NK_FONT_DYNAMIC_PAGES` pages and if all pages are full the least
+    recently used page is cleared. Changed texture regions have to be uploaded
+    each frame after `nk_convert` or drawing and before rendering. Font data
+    is needed for rasterization so `nk_font_atlas_cleanup` does nothing for
+    dynamic atlases:
+
+        struct nk_recti r;
+        const void *img = nk_font_atlas_bake_dynamic(&atlas, 1024, 1024, 4096, NK_FONT_ATLAS_ALPHA8);
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), &null);
+        while (1) {
+            [...]
+            nk_convert(&ctx, &cmds, &verts, &idx, &cfg);
+            while (nk_font_atlas_dirty(&atlas, &r))
+                upload_texture_region(texture, r.x, r.y, r.w, r.h, img);
+            [...]
+        }
+
+    Baked fonts and atlases are never written to after `nk_font_atlas_end`
+    and can be used by multiple contexts on different threads at the same time.
+    Adding compressed fonts uses global state so atlases should be set up on a
+    single thread. Dynamic atlases rasterize glyphs while text is measured and
+    drawn, so if contexts using the same dynamic atlas are built on different
+    threads a lock has to be provided:
+
+        nk_font_atlas_set_lock(&atlas, nk_handle_ptr(&mutex), mutex_lock, mutex_unlock);
+
+    By default glyphs are packed in a single pass into a texture 512 or 1024
+    pixels wide and the height is rounded up to the next power of two. Setting
+    `nk_font_atlas::packing` to `NK_FONT_ATLAS_PACK_TIGHT` before baking tries
+    a number of widths around a square atlas with skyline and MaxRects packing
+    and keeps the smallest result without rounding the height. It is slower to
+    bake so combine it with `nk_font_atlas_save` for big glyph sets. How well
+    the texture is used can be checked with `nk_font_atlas_get_stats`:
+
+        struct nk_font_atlas_stats stats;
+        atlas.packing = NK_FONT_ATLAS_PACK_TIGHT;
+        img = nk_font_atlas_bake(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+        if (nk_font_atlas_get_stats(&atlas, &stats))
+            printf("%.1f%% used, %lu bytes wasted\n", stats.utilization * 100.0f,
+                (unsigned long)stats.wasted_bytes);
+
+    Applications only using the default font can define `NK_INCLUDE_DEFAULT_FONT_ATLAS`
+    to compile in the default font already baked into a tightly packed atlas
+    (13 pixel height, default configuration and glyph ranges). Baking an atlas
+    without any added font, or calling `nk_font_atlas_bake_default` directly,
+    then only expands the stored pixels instead of decompressing and rasterizing
+    the font. The baked data is generated by `example/font_atlas_embed.c`:
+
+        nk_font_atlas_init_default(&atlas);
+        nk_font_atlas_begin(&atlas);
+        img = nk_font_atlas_bake_default(&atlas, &w, &h, NK_FONT_ATLAS_RGBA32);
+        nk_font_atlas_end(&atlas, nk_handle_id(texture), &null);
+        nk_init_default(&ctx, &atlas.default_font->handle);
+
 */
 struct nk_user_font_glyph;
 typedef float(*nk_text_width_f)(nk_handle, float h, const char*, int len);
@@ -3713,7 +5120,12 @@ enum nk_font_coord_type {
     NK_COORD_PIXEL /* texture coordinates inside font glyphs are in absolute pixel */
 };
 
+#ifndef NK_FONT_DYNAMIC_PAGES
+#define NK_FONT_DYNAMIC_PAGES 4
+#endif
+
 struct nk_font;
+struct nk_font_dynamic;
 struct nk_baked_font {
     float height;
     /* height of the font  */
@@ -3745,7 +5157,9 @@ struct nk_font_config {
     /* align every character to pixel boundary (if true set oversample (1,1)) */
     unsigned char oversample_v, oversample_h;
     /* rasterize at hight quality for sub-pixel position */
-    unsigned char padding[3];
+    unsigned char sdf;
+    /* bake glyphs as signed distance field with given spread in pixels (ignores oversampling) */
+    unsigned char padding[2];
 
     float size;
     /* baked pixel height of the font */
@@ -3780,6 +5194,7 @@ struct nk_font {
     nk_rune fallback_codepoint;
     nk_handle texture;
     struct nk_font_config *config;
+    struct nk_font_dynamic *dynamic;
 };
 
 enum nk_font_atlas_format {
@@ -3787,10 +5202,30 @@ enum nk_font_atlas_format {
     NK_FONT_ATLAS_RGBA32
 };
 
+enum nk_font_atlas_packing {
+    NK_FONT_ATLAS_PACK_DEFAULT,
+    /* one skyline pass with fixed width and power of two height */
+    NK_FONT_ATLAS_PACK_TIGHT
+    /* tries multiple packing heuristics and widths for the smallest atlas */
+};
+
+struct nk_font_atlas_stats {
+    int width, height;
+    nk_size texture_bytes;
+    /* size of the texture in bytes */
+    nk_size used_bytes;
+    /* bytes covered by packed glyphs and cursor data */
+    nk_size wasted_bytes;
+    /* bytes not covered by anything */
+    float utilization;
+    /* used bytes divided by texture bytes */
+};
+
 struct nk_font_atlas {
     void *pixel;
     int tex_width;
     int tex_height;
+    enum nk_font_atlas_format format;
 
     struct nk_allocator permanent;
     struct nk_allocator temporary;
@@ -3804,6 +5239,18 @@ struct nk_font_atlas {
     struct nk_font *fonts;
     struct nk_font_config *config;
     int font_num;
+    struct nk_font_dynamic *dynamic;
+
+    enum nk_font_atlas_packing packing;
+    nk_size used_pixels;
+
+    nk_handle lock_userdata;
+    void(*lock)(nk_handle);
+    void(*unlock)(nk_handle);
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+    /* collector of the font bake zones or NULL */
+#endif
 };
 
 /* some language glyph codepoint ranges */
@@ -3830,6 +5277,20 @@ NK_API struct nk_font* nk_font_atlas_add_from_file(struct nk_font_atlas *atlas,
 NK_API struct nk_font *nk_font_atlas_add_compressed(struct nk_font_atlas*, void *memory, nk_size size, float height, const struct nk_font_config*);
 NK_API struct nk_font* nk_font_atlas_add_compressed_base85(struct nk_font_atlas*, const char *data, float height, const struct nk_font_config *config);
 NK_API const void* nk_font_atlas_bake(struct nk_font_atlas*, int *width, int *height, enum nk_font_atlas_format);
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+NK_API const void* nk_font_atlas_bake_default(struct nk_font_atlas*, int *width, int *height, enum nk_font_atlas_format);
+#endif
+NK_API nk_hash nk_font_atlas_hash(const struct nk_font_atlas*, enum nk_font_atlas_format);
+NK_API nk_size nk_font_atlas_save(const struct nk_font_atlas*, void *memory, nk_size size);
+NK_API const void* nk_font_atlas_load(struct nk_font_atlas*, const void *memory, nk_size size, int *width, int *height, enum nk_font_atlas_format);
+#ifdef NK_INCLUDE_STANDARD_IO
+NK_API int nk_font_atlas_save_to_file(const struct nk_font_atlas*, const char *file_path);
+NK_API const void* nk_font_atlas_load_from_file(struct nk_font_atlas*, const char *file_path, int *width, int *height, enum nk_font_atlas_format);
+#endif
+NK_API const void* nk_font_atlas_bake_dynamic(struct nk_font_atlas*, int width, int height, int glyph_capacity, enum nk_font_atlas_format);
+NK_API int nk_font_atlas_dirty(struct nk_font_atlas*, struct nk_recti *rect);
+NK_API void nk_font_atlas_set_lock(struct nk_font_atlas*, nk_handle userdata, void(*lock)(nk_handle), void(*unlock)(nk_handle));
+NK_API int nk_font_atlas_get_stats(const struct nk_font_atlas*, struct nk_font_atlas_stats*);
 NK_API void nk_font_atlas_end(struct nk_font_atlas*, nk_handle tex, struct nk_draw_null_texture*);
 NK_API const struct nk_font_glyph* nk_font_find_glyph(struct nk_font*, nk_rune unicode);
 NK_API void nk_font_atlas_cleanup(struct nk_font_atlas *atlas);
@@ -3869,6 +5330,26 @@ NK_API void nk_font_atlas_clear(struct nk_font_atlas*);
     NK_INCLUDE_DEFAULT_ALLOCATOR which uses the standard library memory
     allocation functions malloc and free and takes over complete control over
     memory in this library.
+
+    Dynamic buffers grow by allocating a bigger block and copying everything
+    over, which shows up as a frame spike whenever the UI grows. Draw command
+    memory can instead be a segmented buffer created by `nk_buffer_init_segmented`.
+    It allocates additional fixed size segments when full and never moves
+    commands that were already written. Commands are still linked by offsets,
+    so `nk__begin`, `nk__next` and `nk_foreach` work the same. A command not
+    fitting into the rest of a segment is placed into the next one and the gap
+    is bridged by a `NK_COMMAND_NOP` command. Segmented buffers only support
+    front allocations, so pass them as command buffer to `nk_init_custom`
+    together with a pool buffer. Segment sizes are rounded up to a power of
+    two of at least `NK_BUFFER_SEGMENT_MIN_SIZE` (4KB). A command larger than
+    a segment, like long text or a polygon with many points, gets a run of
+    consecutive segments backed by a single allocation which is kept and
+    reused by the following frames:
+
+        struct nk_buffer cmds, pool;
+        nk_buffer_init_segmented(&cmds, &alloc, 64 * 1024);
+        nk_buffer_init(&pool, &alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+        nk_init_custom(&ctx, &cmds, &pool, &font);
 */
 struct nk_memory_status {
     void *memory;
@@ -3879,9 +5360,64 @@ struct nk_memory_status {
     nk_size calls;
 };
 
+struct nk_memory_stats {
+    nk_size command_bytes;
+    /* bytes of draw commands in the current frame */
+    nk_size command_capacity;
+    /* size of the memory block holding draw commands */
+    nk_size command_needed;
+    /* all bytes requested from the command memory block */
+    nk_size command_high_water;
+    /* most draw command bytes in a single frame */
+    unsigned int command_count;
+    /* number of draw commands in the current frame */
+    nk_size vertex_bytes, vertex_capacity, vertex_high_water;
+    nk_size element_bytes, element_capacity, element_high_water;
+    /* vertex and element buffer usage of `nk_convert` */
+    unsigned int pool_pages;
+    /* number of pages allocated by the page element pool */
+    unsigned int pool_page_capacity;
+    /* number of page elements per page */
+    unsigned int page_elements;
+    /* page elements allocated for windows, panels and tables */
+    unsigned int page_elements_free;
+    /* allocated page elements currently unused in the free list */
+    nk_size pool_reclaimable;
+    /* bytes of pool pages `nk_memory_compact` would free */
+    unsigned int window_count;
+    unsigned int table_count;
+};
+
+struct nk_window_memory_stats {
+    const char *name;
+    nk_size command_bytes;
+    unsigned int command_count;
+    unsigned int table_count;
+};
+
+#ifdef NK_INCLUDE_PROFILER
+struct nk_profile_zone_stats {
+    unsigned int calls;
+    /* number of times the zone was entered */
+    double seconds;
+    /* time spent in the zone with nested zones of the same kind counted once */
+};
+struct nk_profile {
+    struct nk_profile_zone_stats zones[NK_PROFILE_ZONE_MAX];
+};
+struct nk_profiler {
+    struct nk_profile data;
+    /* zone stats since the last `nk_profile_collect` */
+    double start[NK_PROFILE_ZONE_MAX];
+    unsigned int depth[NK_PROFILE_ZONE_MAX];
+    /* begin time and nesting depth of open zones */
+};
+#endif
+
 enum nk_allocation_type {
     NK_BUFFER_FIXED,
-    NK_BUFFER_DYNAMIC
+    NK_BUFFER_DYNAMIC,
+    NK_BUFFER_SEGMENTED
 };
 
 enum nk_buffer_allocation_type {
@@ -3896,6 +5432,13 @@ struct nk_buffer_marker {
 };
 
 struct nk_memory {void *ptr;nk_size size;};
+struct nk_buffer_segment {
+    void *memory;
+    /* start of the segment memory */
+    unsigned int count;
+    /* number of consecutive segments sharing the allocation starting at this
+     * segment or zero if the memory belongs to a previous segment */
+};
 struct nk_buffer {
     struct nk_buffer_marker marker[NK_BUFFER_MAX];
     /* buffer marker to free a buffer to a certain offset */
@@ -3915,6 +5458,14 @@ struct nk_buffer {
     /* number of allocation calls */
     nk_size size;
     /* current size of the buffer */
+    struct nk_buffer_segment *segments;
+    /* memory blocks of a segmented buffer in offset order */
+    unsigned int segment_count;
+    /* number of memory blocks allocated for a segmented buffer */
+    unsigned int segment_capacity;
+    /* number of memory block pointers fitting into `segments` */
+    unsigned int segment_shift;
+    /* size of each memory block of a segmented buffer as power of two */
 };
 
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
@@ -3922,6 +5473,7 @@ NK_API void nk_buffer_init_default(struct nk_buffer*);
 #endif
 NK_API void nk_buffer_init(struct nk_buffer*, const struct nk_allocator*, nk_size size);
 NK_API void nk_buffer_init_fixed(struct nk_buffer*, void *memory, nk_size size);
+NK_API void nk_buffer_init_segmented(struct nk_buffer*, const struct nk_allocator*, nk_size segment_size);
 NK_API void nk_buffer_info(struct nk_memory_status*, struct nk_buffer*);
 NK_API void nk_buffer_push(struct nk_buffer*, enum nk_buffer_allocation_type type, const void *memory, nk_size size, nk_size align);
 NK_API void nk_buffer_mark(struct nk_buffer*, enum nk_buffer_allocation_type type);
@@ -4340,12 +5892,23 @@ enum nk_command_clipping {
     NK_CLIPPING_ON = nk_true
 };
 
+struct nk_command_packing {
+    struct nk_buffer table;
+    /* fonts, images, callbacks and userdata referenced by packed commands */
+    struct nk_buffer scratch;
+    /* command packed for hashing by the input recorder */
+};
+
 struct nk_command_buffer {
     struct nk_buffer *base;
     struct nk_rect clip;
     int use_clipping;
     nk_handle userdata;
     nk_size begin, end, last;
+    unsigned int count;
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+#endif
 };
 
 /* shape outlines */
@@ -4408,6 +5971,28 @@ struct nk_input {
     struct nk_mouse mouse;
 };
 
+struct nk_input_recorder {
+    struct nk_buffer data;
+    /* recorded input calls and frames */
+    struct nk_command_packing packing;
+    /* handle table to hash draw commands independent of pointers */
+    nk_uint frames;
+    /* number of recorded frames */
+};
+struct nk_input_replay {
+    struct nk_buffer data;
+    /* copy of the recording */
+    struct nk_command_packing packing;
+    nk_size offset;
+    /* read offset of the next frame */
+    nk_uint frame;
+    /* number of replayed frames */
+    nk_hash hash;
+    /* draw command hash of the current frame inside the recording */
+    nk_uint diverged;
+    /* first frame with different draw commands or zero */
+};
+
 NK_API int nk_input_has_mouse_click(const struct nk_input*, enum nk_buttons);
 NK_API int nk_input_has_mouse_click_in_rect(const struct nk_input*, enum nk_buttons, struct nk_rect);
 NK_API int nk_input_has_mouse_click_down_in_rect(const struct nk_input*, enum nk_buttons, struct nk_rect, int down);
@@ -4511,7 +6096,7 @@ struct nk_draw_command {
 
 struct nk_draw_list {
     struct nk_rect clip_rect;
-    struct nk_vec2 circle_vtx[12];
+    struct nk_vec2 circle_vtx[48];
     struct nk_convert_config config;
 
     struct nk_buffer *buffer;
@@ -4532,6 +6117,9 @@ struct nk_draw_list {
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     nk_handle userdata;
 #endif
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+#endif
 };
 
 /* draw list */
@@ -5090,6 +6678,16 @@ struct nk_row_layout {
     float templates[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
 };
 
+struct nk_layout_template {
+/* public: */
+    int columns;
+    float templates[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
+/* private: */
+    int resolved;
+    float space;
+    float widths[NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS];
+};
+
 struct nk_popup_buffer {
     nk_size begin;
     nk_size parent;
@@ -5211,6 +6809,8 @@ struct nk_window {
     struct nk_window *next;
     struct nk_window *prev;
     struct nk_window *parent;
+    /* position in window list when the hover index was last built */
+    unsigned int order;
 };
 
 /*==============================================================
@@ -5347,6 +6947,54 @@ struct nk_pool {
     nk_size cap;
 };
 
+struct nk_frame {
+    struct nk_buffer memory;
+    /* draw command memory exchanged with a context by `nk_frame_swap` */
+    nk_size begin;
+    /* offset of the first draw command inside `memory` */
+    unsigned int seq;
+    /* frame counter of the context the commands were built in */
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    struct nk_draw_list draw_list;
+    /* vertex draw list filled by `nk_frame_convert` */
+#endif
+#ifdef NK_INCLUDE_PROFILER
+    struct nk_profiler *profiler;
+    /* collector of the convert zones of `nk_frame_convert` or NULL */
+#endif
+};
+
+struct nk_stream_history {
+    struct nk_buffer ranges[2];
+    /* window ranges of the current and previous message */
+    struct nk_buffer data[2];
+    /* packed commands of the window ranges */
+    int current;
+    /* index of the buffers holding the previous message */
+};
+struct nk_stream_encoder {
+    struct nk_command_packing packing;
+    /* font, image and userdata handle table shared with the decoder */
+    struct nk_stream_history history;
+    const struct nk_user_font *const *fonts;
+    int font_count;
+    /* fonts in the same order as passed to the decoder */
+    nk_uint sent;
+    /* number of handle table entries already sent */
+    int key;
+    /* next message is a key frame */
+};
+struct nk_stream_decoder {
+    struct nk_command_packing packing;
+    /* handle table rebuilt from messages */
+    struct nk_stream_history history;
+    const struct nk_user_font *const *fonts;
+    int font_count;
+    /* fonts in the same order as passed to the encoder */
+    int valid;
+    /* cleared on errors until the next key frame */
+};
+
 struct nk_context {
 /* public: can be accessed freely */
     struct nk_input input;
@@ -5374,6 +7022,25 @@ struct nk_context {
     struct nk_text_edit text_edit;
     /* draw buffer used for overlay drawing operation like cursor */
     struct nk_command_buffer overlay;
+    /* high-water marks and last vertex output for memory telemetry */
+    struct nk_memory_stats memory_stats;
+    /* draw command hash of the last `nk_frame_status` call and time until
+     * the next requested frame or negative if none */
+    nk_hash frame_hash;
+    float frame_deadline;
+    /* timestamped input events not yet applied to `input` */
+    struct nk_input_event input_queue[NK_INPUT_QUEUE_SIZE];
+    int input_queue_count;
+    /* timestamp of the last queued left button press and whether it can
+     * still start a double click */
+    nk_uint input_click_time;
+    int input_click_armed;
+    /* recorder of input calls if `nk_input_record_begin` was called */
+    struct nk_input_recorder *recorder;
+#ifdef NK_INCLUDE_PROFILER
+    /* collector of all zones entered by this context or NULL */
+    struct nk_profiler *profiler;
+#endif
 
     /* windows */
     int build;
@@ -5386,6 +7053,11 @@ struct nk_context {
     struct nk_page_element *freelist;
     unsigned int count;
     unsigned int seq;
+    /* hover index: topmost window under `hovered_pos` resolved in frame
+     * `hovered_seq`, or zero `hovered_seq` if it has to be rebuilt */
+    struct nk_window *hovered;
+    struct nk_vec2 hovered_pos;
+    unsigned int hovered_seq;
 };
 
 /* ==============================================================
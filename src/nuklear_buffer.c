@@ -62,6 +62,178 @@ nk_buffer_init_fixed(struct nk_buffer *b, void *m, nk_size size)
     b->memory.size = size;
     b->size = size;
 }
+NK_INTERN int
+nk_buffer_reserve_segments(struct nk_buffer *b, unsigned int count)
+{
+    struct nk_buffer_segment *segments;
+    unsigned int capacity;
+    if (b->segment_count + count <= b->segment_capacity) return 1;
+
+    /* only segment pointers are copied, never segment memory */
+    capacity = NK_MAX(b->segment_capacity * 2, 8);
+    capacity = NK_MAX(capacity, b->segment_count + count);
+    segments = (struct nk_buffer_segment*)b->pool.alloc(b->pool.userdata, 0,
+        sizeof(struct nk_buffer_segment) * capacity);
+    NK_ASSERT(segments);
+    if (!segments) return 0;
+    if (b->segments) {
+        NK_MEMCPY(segments, b->segments, sizeof(struct nk_buffer_segment) * b->segment_count);
+        b->pool.free(b->pool.userdata, b->segments);
+    }
+    b->segments = segments;
+    b->segment_capacity = capacity;
+    return 1;
+}
+NK_INTERN unsigned int
+nk_buffer_segment_run(const struct nk_buffer *b, unsigned int index, unsigned int count)
+{
+    /* number of segments up to `count` starting at `index` which directly
+     * follow each other in memory. Runs are moved and cut by other runs, so
+     * this is checked on the memory and not on the allocations */
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    unsigned int run = 1;
+    while (run < count && index + run < b->segment_count &&
+        b->segments[index + run].memory == nk_ptr_add(void,
+            b->segments[index + run - 1].memory, segment_size))
+        run++;
+    return run;
+}
+NK_INTERN void
+nk_buffer_reverse_segments(struct nk_buffer_segment *segments,
+    unsigned int begin, unsigned int end)
+{
+    while (begin + 1 < end) {
+        struct nk_buffer_segment tmp = segments[begin];
+        segments[begin++] = segments[--end];
+        segments[end] = tmp;
+    }
+}
+NK_INTERN int
+nk_buffer_acquire_segments(struct nk_buffer *b, unsigned int index, unsigned int count)
+{
+    /* makes `count` segments starting at `index` contiguous, which is only
+     * valid as long as no memory was allocated from `index` onwards. Unused
+     * runs of segments further back are moved forward before allocating */
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    unsigned int i, run;
+    nk_byte *memory;
+
+    NK_ASSERT(index <= b->segment_count);
+    if (index < b->segment_count && nk_buffer_segment_run(b, index, count) >= count)
+        return 1;
+    for (i = index + 1; i < b->segment_count; i += run) {
+        run = nk_buffer_segment_run(b, i, count);
+        if (run < count) continue;
+        nk_buffer_reverse_segments(b->segments, index, i);
+        nk_buffer_reverse_segments(b->segments, i, i + count);
+        nk_buffer_reverse_segments(b->segments, index, i + count);
+        b->memory.ptr = b->segments[0].memory;
+        return 1;
+    }
+
+    NK_ASSERT(b->pool.alloc && b->pool.free);
+    if (!b->pool.alloc || !b->pool.free) return 0;
+    if (!nk_buffer_reserve_segments(b, count)) return 0;
+    memory = (nk_byte*)b->pool.alloc(b->pool.userdata, 0, segment_size * count);
+    NK_ASSERT(memory);
+    if (!memory) return 0;
+    for (i = b->segment_count; i > index; --i)
+        b->segments[i - 1 + count] = b->segments[i - 1];
+    for (i = 0; i < count; ++i) {
+        b->segments[index + i].memory = memory + segment_size * i;
+        b->segments[index + i].count = i ? 0 : count;
+    }
+    b->segment_count += count;
+    b->memory.ptr = b->segments[0].memory;
+    b->memory.size = (nk_size)b->segment_count << b->segment_shift;
+    b->size = b->memory.size;
+    return 1;
+}
+NK_API void
+nk_buffer_init_segmented(struct nk_buffer *b, const struct nk_allocator *a,
+    nk_size segment_size)
+{
+    NK_ASSERT(b);
+    NK_ASSERT(a);
+    NK_ASSERT(segment_size);
+    if (!b || !a || !segment_size) return;
+
+    nk_zero(b, sizeof(*b));
+    b->type = NK_BUFFER_SEGMENTED;
+    b->pool = *a;
+    b->grow_factor = 1.0f;
+    /* power of two segments turn offsets into segment and position by shifting */
+    segment_size = NK_MAX(segment_size, NK_BUFFER_SEGMENT_MIN_SIZE);
+    while (((nk_size)1 << b->segment_shift) < segment_size)
+        b->segment_shift++;
+    nk_buffer_acquire_segments(b, 0, 1);
+}
+NK_LIB void*
+nk_buffer_at(const struct nk_buffer *b, nk_size offset)
+{
+    nk_size mask;
+    if (b->type != NK_BUFFER_SEGMENTED)
+        return nk_ptr_add(void, b->memory.ptr, offset);
+    mask = ((nk_size)1 << b->segment_shift) - 1;
+    return nk_ptr_add(void, b->segments[offset >> b->segment_shift].memory, offset & mask);
+}
+NK_INTERN void*
+nk_buffer_alloc_segmented(struct nk_buffer *b, nk_size size, nk_size align)
+{
+    /* every segment keeps room for a command jumping to the next segment */
+    NK_STORAGE const nk_size jump_size = sizeof(struct nk_command) + NK_ALIGNOF(struct nk_command);
+    nk_size segment_size = (nk_size)1 << b->segment_shift;
+    nk_size index = b->allocated >> b->segment_shift;
+    nk_size offset = b->allocated & (segment_size - 1);
+    nk_size alignment;
+    void *unaligned;
+    void *memory;
+
+    unaligned = nk_ptr_add(void, b->segments[index].memory, offset);
+    memory = nk_buffer_align(unaligned, align, &alignment, NK_BUFFER_FRONT);
+    if (offset + alignment + size + jump_size > segment_size) {
+        /* commands larger than a segment need a run of consecutive segments
+         * from one allocation, which is kept for the following frames */
+        nk_size next = (offset) ? index + 1 : index;
+        nk_size count = 1;
+        if (size + align + jump_size > segment_size)
+            count = (size + 2 * align + 3 * jump_size + segment_size - 1) >> b->segment_shift;
+        if (!nk_buffer_acquire_segments(b, (unsigned int)next, (unsigned int)count))
+            return 0;
+        if (next != index) {
+            /* continue at the start of the next segment and clear the gap, so
+             * the same commands always result in the same segment content */
+            struct nk_command *jump;
+            nk_size gap = segment_size - offset;
+            jump = (struct nk_command*)NK_ALIGN_PTR(unaligned, NK_ALIGNOF(struct nk_command));
+            NK_MEMSET(unaligned, 0, gap);
+            jump->type = NK_COMMAND_NOP;
+            jump->next = next << b->segment_shift;
+            b->allocated += gap;
+            b->needed += gap;
+        }
+        unaligned = b->segments[next].memory;
+        memory = nk_buffer_align(unaligned, align, &alignment, NK_BUFFER_FRONT);
+        offset = (alignment + size) & (segment_size - 1);
+        if (offset + jump_size > segment_size) {
+            /* a command ending right before a segment border inside the run
+             * leaves no room for a jump, so it is moved behind a jump to end
+             * past the border */
+            struct nk_command *jump;
+            jump = (struct nk_command*)NK_ALIGN_PTR(unaligned, NK_ALIGNOF(struct nk_command));
+            memory = nk_buffer_align(nk_ptr_add(void, memory,
+                segment_size - offset + jump_size), align, &alignment, NK_BUFFER_FRONT);
+            alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
+            NK_MEMSET(unaligned, 0, alignment);
+            jump->type = NK_COMMAND_NOP;
+            jump->next = b->allocated + alignment;
+        }
+    }
+    b->allocated += size + alignment;
+    b->needed += alignment;
+    b->calls++;
+    return memory;
+}
 NK_LIB void*
 nk_buffer_align(void *unaligned,
     nk_size align, nk_size *alignment,
@@ -143,6 +315,11 @@ nk_buffer_alloc(struct nk_buffer *b, enum nk_buffer_allocation_type type,
     NK_ASSERT(size);
     if (!b || !size) return 0;
     b->needed += size;
+    if (b->type == NK_BUFFER_SEGMENTED) {
+        NK_ASSERT(type == NK_BUFFER_FRONT && "segmented buffers only support front allocations");
+        if (type != NK_BUFFER_FRONT) return 0;
+        return nk_buffer_alloc_segmented(b, size, align);
+    }
 
     /* calculate total size with needed alignment + size */
     if (type == NK_BUFFER_FRONT)
@@ -239,6 +416,14 @@ nk_buffer_free(struct nk_buffer *b)
     if (b->type == NK_BUFFER_FIXED) return;
     if (!b->pool.free) return;
     NK_ASSERT(b->pool.free);
+    if (b->type == NK_BUFFER_SEGMENTED) {
+        unsigned int i;
+        for (i = 0; i < b->segment_count; ++i)
+            if (b->segments[i].count)
+                b->pool.free(b->pool.userdata, b->segments[i].memory);
+        b->pool.free(b->pool.userdata, b->segments);
+        return;
+    }
     b->pool.free(b->pool.userdata, b->memory.ptr);
 }
 NK_API void
@@ -171,11 +171,13 @@ nk_do_button_text(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font || !string)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_text(out, &bounds, &content, *state, style, string, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -216,11 +218,13 @@ nk_do_button_symbol(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style || !font || !state)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_symbol(out, &bounds, &content, *state, style, symbol, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -245,6 +249,7 @@ nk_do_button_image(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style || !state)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, b, &content);
     content.x += style->image_padding.x;
@@ -255,6 +260,7 @@ nk_do_button_image(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_image(out, &bounds, &content, *state, style, &img);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -306,6 +312,7 @@ nk_do_button_text_symbol(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     tri.y = content.y + (content.h/2) - font->height/2;
@@ -320,6 +327,7 @@ nk_do_button_text_symbol(nk_flags *state,
     nk_draw_button_text_symbol(out, &bounds, &content, &tri,
         *state, style, str, len, symbol, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_LIB void
@@ -364,6 +372,7 @@ nk_do_button_text_image(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !font || !style || !str)
         return nk_false;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_BUTTON);
 
     ret = nk_do_button(state, out, bounds, style, in, behavior, &content);
     icon.y = bounds.y + style->padding.y;
@@ -381,6 +390,7 @@ nk_do_button_text_image(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_button_text_image(out, &bounds, &content, &icon, *state, style, str, len, font, &img);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_API void
@@ -501,9 +511,11 @@ nk_button_color(struct nk_context *ctx, struct nk_color color)
     button.normal = nk_style_item_color(color);
     button.hover = nk_style_item_color(color);
     button.active = nk_style_item_color(color);
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_BUTTON);
     ret = nk_do_button(&ctx->last_widget_state, &win->buffer, bounds,
                 &button, in, ctx->button_behavior, &content);
     nk_draw_button(&win->buffer, &bounds, ctx->last_widget_state, &button);
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_BUTTON);
     return ret;
 }
 NK_API int
@@ -136,6 +136,7 @@ nk_do_color_picker(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !col || !state || !font)
         return ret;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_COLOR_PICKER);
 
     bar_w = font->height;
     bounds.x += padding.x;
@@ -161,6 +162,7 @@ nk_do_color_picker(nk_flags *state,
     ret = nk_color_picker_behavior(state, &bounds, &matrix, &hue_bar,
         (fmt == NK_RGBA) ? &alpha_bar:0, col, in);
     nk_draw_color_picker(out, &matrix, &hue_bar, (fmt == NK_RGBA) ? &alpha_bar:0, *col);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_COLOR_PICKER);
     return ret;
 }
 NK_API int
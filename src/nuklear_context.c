@@ -14,6 +14,7 @@ nk_setup(struct nk_context *ctx, const struct nk_user_font *font)
     nk_zero_struct(*ctx);
     nk_style_default(ctx);
     ctx->seq = 1;
+    ctx->frame_deadline = -1.0f;
     if (font) ctx->style.font = font;
 #ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
     nk_draw_list_init(&ctx->draw_list);
@@ -105,6 +106,7 @@ nk_free(struct nk_context *ctx)
     ctx->current = 0;
     ctx->freelist = 0;
     ctx->count = 0;
+    ctx->recorder = 0;
 }
 NK_API void
 nk_clear(struct nk_context *ctx)
@@ -114,6 +116,10 @@ nk_clear(struct nk_context *ctx)
     NK_ASSERT(ctx);
 
     if (!ctx) return;
+    if (ctx->recorder)
+        nk_input_record_frame(ctx);
+    ctx->memory_stats.command_high_water = NK_MAX(
+        ctx->memory_stats.command_high_water, ctx->memory.allocated);
     if (ctx->use_pool)
         nk_buffer_clear(&ctx->memory);
     else nk_buffer_reset(&ctx->memory, NK_BUFFER_FRONT);
@@ -121,6 +127,7 @@ nk_clear(struct nk_context *ctx)
     ctx->build = 0;
     ctx->memory.calls = 0;
     ctx->last_widget_state = 0;
+    ctx->frame_deadline = -1.0f;
     ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_ARROW];
     NK_MEMSET(&ctx->overlay, 0, sizeof(ctx->overlay));
 
@@ -172,6 +179,160 @@ nk_clear(struct nk_context *ctx)
     }
     ctx->seq++;
 }
+NK_INTERN unsigned int
+nk_memory_table_count(const struct nk_window *win)
+{
+    unsigned int count = 0;
+    const struct nk_table *it;
+    for (it = win->tables; it; it = it->next)
+        count++;
+    return count;
+}
+NK_API void
+nk_memory_get_stats(const struct nk_context *ctx, struct nk_memory_stats *stats)
+{
+    const struct nk_window *win;
+    const struct nk_page_element *elem;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(stats);
+    if (!ctx || !stats) return;
+
+    *stats = ctx->memory_stats;
+    stats->command_bytes = ctx->memory.allocated;
+    stats->command_capacity = ctx->memory.memory.size;
+    stats->command_needed = ctx->memory.needed;
+    stats->command_high_water = NK_MAX(stats->command_high_water, ctx->memory.allocated);
+    stats->command_count = ctx->overlay.count;
+
+    /* windows, popups and their state tables */
+    for (win = ctx->begin; win; win = win->next) {
+        stats->window_count++;
+        stats->table_count += nk_memory_table_count(win);
+        if (win->seq == ctx->seq)
+            stats->command_count += win->buffer.count;
+        if (win->popup.win) {
+            stats->window_count++;
+            stats->table_count += nk_memory_table_count(win->popup.win);
+        }
+    }
+
+    /* page elements come either from the pool or the back of a fixed buffer */
+    if (ctx->use_pool) {
+        const struct nk_page *page;
+        for (page = ctx->pool.pages; page; page = page->next) {
+            stats->pool_pages++;
+            stats->page_elements += page->size;
+        }
+        stats->pool_page_capacity = (ctx->pool.type == NK_BUFFER_FIXED) ?
+            ctx->pool.capacity: NK_POOL_DEFAULT_CAPACITY;
+    } else {
+        stats->page_elements = (unsigned int)((ctx->memory.memory.size - ctx->memory.size) /
+            sizeof(struct nk_page_element));
+    }
+    for (elem = ctx->freelist; elem; elem = elem->next)
+        stats->page_elements_free++;
+    if (ctx->use_pool && ctx->pool.type != NK_BUFFER_FIXED) {
+        /* pages left over once live elements are packed as tight as possible */
+        unsigned int live = stats->page_elements - stats->page_elements_free;
+        unsigned int pages = (live + ctx->pool.capacity - 1) / ctx->pool.capacity;
+        stats->pool_reclaimable = (nk_size)(stats->pool_pages - pages) *
+            nk_pool_page_size(&ctx->pool);
+    }
+}
+NK_API int
+nk_memory_get_window_stats(const struct nk_context *ctx,
+    struct nk_window_memory_stats *stats, int max)
+{
+    int count = 0;
+    const struct nk_window *win;
+
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    for (win = ctx->begin; win; win = win->next, ++count) {
+        struct nk_window_memory_stats *s;
+        if (!stats || count >= max) continue;
+        s = &stats[count];
+        s->name = win->name_string;
+        s->table_count = nk_memory_table_count(win);
+        if (win->seq == ctx->seq) {
+            s->command_bytes = win->buffer.end - win->buffer.begin;
+            s->command_count = win->buffer.count;
+        } else {
+            s->command_bytes = 0;
+            s->command_count = 0;
+        }
+    }
+    return count;
+}
+NK_API void
+nk_memory_reset_stats(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    nk_zero_struct(ctx->memory_stats);
+}
+NK_INTERN int
+nk_frame_has_input(const struct nk_input *in)
+{
+    int i;
+    if (in->mouse.delta.x != 0 || in->mouse.delta.y != 0 ||
+        in->mouse.scroll_delta.x != 0 || in->mouse.scroll_delta.y != 0 ||
+        in->mouse.grab || in->mouse.ungrab || in->keyboard.text_len)
+        return nk_true;
+    /* held mouse buttons drive repeating buttons and drags every frame */
+    for (i = 0; i < NK_BUTTON_MAX; ++i)
+        if (in->mouse.buttons[i].down || in->mouse.buttons[i].clicked)
+            return nk_true;
+    for (i = 0; i < NK_KEY_MAX; ++i)
+        if (in->keyboard.keys[i].clicked)
+            return nk_true;
+    return nk_false;
+}
+NK_API nk_flags
+nk_frame_status(struct nk_context *ctx, float *timeout)
+{
+    nk_hash hash;
+    nk_flags status = NK_FRAME_IDLE;
+    NK_ASSERT(ctx);
+    if (timeout) *timeout = 0;
+    if (!ctx) return NK_FRAME_IDLE;
+
+    /* link window buffers first so command memory is the same as drawn */
+    if (!ctx->build) {
+        nk_build(ctx);
+        ctx->build = nk_true;
+    }
+    if (ctx->memory.type == NK_BUFFER_SEGMENTED) {
+        nk_size offset, size = (nk_size)1 << ctx->memory.segment_shift;
+        for (hash = 0, offset = 0; offset < ctx->memory.allocated; offset += size)
+            hash = nk_murmur_hash(nk_buffer_at(&ctx->memory, offset),
+                (int)NK_MIN(size, ctx->memory.allocated - offset), hash);
+    } else hash = nk_murmur_hash(ctx->memory.memory.ptr, (int)ctx->memory.allocated, 0);
+    if (hash != ctx->frame_hash) {
+        /* state changed by the last frame is often only visible one frame later */
+        status |= NK_FRAME_REDRAW|NK_FRAME_PENDING;
+        ctx->frame_hash = hash;
+    }
+    if (nk_frame_has_input(&ctx->input) || ctx->input_queue_count)
+        status |= NK_FRAME_PENDING;
+    if (ctx->frame_deadline == 0)
+        status |= NK_FRAME_PENDING;
+    else if (ctx->frame_deadline > 0) {
+        status |= NK_FRAME_TIMED;
+        if (timeout) *timeout = ctx->frame_deadline;
+    }
+    return status;
+}
+NK_API void
+nk_frame_schedule(struct nk_context *ctx, float seconds)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    seconds = NK_MAX(seconds, 0);
+    if (ctx->frame_deadline < 0 || seconds < ctx->frame_deadline)
+        ctx->frame_deadline = seconds;
+}
 NK_LIB void
 nk_start_buffer(struct nk_context *ctx, struct nk_command_buffer *buffer)
 {
@@ -181,7 +342,11 @@ nk_start_buffer(struct nk_context *ctx, struct nk_command_buffer *buffer)
     buffer->begin = ctx->memory.allocated;
     buffer->end = buffer->begin;
     buffer->last = buffer->begin;
+    buffer->count = 0;
     buffer->clip = nk_null_rect;
+#ifdef NK_INCLUDE_PROFILER
+    buffer->profiler = ctx->profiler;
+#endif
 }
 NK_LIB void
 nk_start(struct nk_context *ctx, struct nk_window *win)
@@ -198,6 +363,9 @@ nk_start_popup(struct nk_context *ctx, struct nk_window *win)
     NK_ASSERT(win);
     if (!ctx || !win) return;
 
+    /* popup bounds are set every frame and change what is under the mouse */
+    nk_window_index_invalidate(ctx);
+
     /* save buffer fill state for popup */
     buf = &win->popup.buf;
     buf->begin = win->buffer.end;
@@ -214,6 +382,7 @@ nk_finish_popup(struct nk_context *ctx, struct nk_window *win)
     NK_ASSERT(win);
     if (!ctx || !win) return;
 
+    nk_window_index_invalidate(ctx);
     buf = &win->popup.buf;
     buf->last = win->buffer.last;
     buf->end = win->buffer.end;
@@ -231,7 +400,6 @@ nk_finish(struct nk_context *ctx, struct nk_window *win)
 {
     struct nk_popup_buffer *buf;
     struct nk_command *parent_last;
-    void *memory;
 
     NK_ASSERT(ctx);
     NK_ASSERT(win);
@@ -240,8 +408,7 @@ nk_finish(struct nk_context *ctx, struct nk_window *win)
     if (!win->popup.buf.active) return;
 
     buf = &win->popup.buf;
-    memory = ctx->memory.memory.ptr;
-    parent_last = nk_ptr_add(struct nk_command, memory, buf->parent);
+    parent_last = (struct nk_command*)nk_buffer_at(&ctx->memory, buf->parent);
     parent_last->next = buf->end;
 }
 NK_LIB void
@@ -249,8 +416,8 @@ nk_build(struct nk_context *ctx)
 {
     struct nk_window *it = 0;
     struct nk_command *cmd = 0;
-    nk_byte *buffer = 0;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_BUILD);
     /* draw cursor overlay */
     if (!ctx->style.cursor_active)
         ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_ARROW];
@@ -270,14 +437,13 @@ nk_build(struct nk_context *ctx)
     }
     /* build one big draw command list out of all window buffers */
     it = ctx->begin;
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
     while (it != 0) {
         struct nk_window *next = it->next;
         if (it->buffer.last == it->buffer.begin || (it->flags & NK_WINDOW_HIDDEN)||
             it->seq != ctx->seq)
             goto cont;
 
-        cmd = nk_ptr_add(struct nk_command, buffer, it->buffer.last);
+        cmd = (struct nk_command*)nk_buffer_at(&ctx->memory, it->buffer.last);
         while (next && ((next->buffer.last == next->buffer.begin) ||
             (next->flags & NK_WINDOW_HIDDEN) || next->seq != ctx->seq))
             next = next->next; /* skip empty command buffers */
@@ -295,7 +461,7 @@ nk_build(struct nk_context *ctx)
 
         buf = &it->popup.buf;
         cmd->next = buf->begin;
-        cmd = nk_ptr_add(struct nk_command, buffer, buf->last);
+        cmd = (struct nk_command*)nk_buffer_at(&ctx->memory, buf->last);
         buf->active = nk_false;
         skip: it = next;
     }
@@ -305,17 +471,12 @@ nk_build(struct nk_context *ctx)
             cmd->next = ctx->overlay.begin;
         else cmd->next = ctx->memory.allocated;
     }
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_BUILD);
 }
-NK_API const struct nk_command*
-nk__begin(struct nk_context *ctx)
+NK_LIB int
+nk_command_list_begin(struct nk_context *ctx, nk_size *offset)
 {
     struct nk_window *iter;
-    nk_byte *buffer;
-    NK_ASSERT(ctx);
-    if (!ctx) return 0;
-    if (!ctx->count) return 0;
-
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
     if (!ctx->build) {
         nk_build(ctx);
         ctx->build = nk_true;
@@ -325,20 +486,157 @@ nk__begin(struct nk_context *ctx)
         (iter->flags & NK_WINDOW_HIDDEN) || iter->seq != ctx->seq))
         iter = iter->next;
     if (!iter) return 0;
-    return nk_ptr_add_const(struct nk_command, buffer, iter->buffer.begin);
+    *offset = iter->buffer.begin;
+    return 1;
+}
+NK_LIB const struct nk_command*
+nk_command_list_at(const struct nk_buffer *memory, nk_size offset)
+{
+    if (offset >= memory->allocated) return 0;
+    return (const struct nk_command*)nk_buffer_at(memory, offset);
+}
+NK_LIB const struct nk_command*
+nk_command_list_next(const struct nk_buffer *memory, const struct nk_command *cmd)
+{
+    return nk_command_list_at(memory, cmd->next);
+}
+NK_API const struct nk_command*
+nk__begin(struct nk_context *ctx)
+{
+    nk_size offset;
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    if (!ctx->count) return 0;
+    if (!nk_command_list_begin(ctx, &offset)) return 0;
+    return nk_command_list_at(&ctx->memory, offset);
 }
 
 NK_API const struct nk_command*
 nk__next(struct nk_context *ctx, const struct nk_command *cmd)
 {
-    nk_byte *buffer;
-    const struct nk_command *next;
     NK_ASSERT(ctx);
     if (!ctx || !cmd || !ctx->count) return 0;
-    if (cmd->next >= ctx->memory.allocated) return 0;
-    buffer = (nk_byte*)ctx->memory.memory.ptr;
-    next = nk_ptr_add_const(struct nk_command, buffer, cmd->next);
+    return nk_command_list_next(&ctx->memory, cmd);
+}
+NK_API const struct nk_command*
+nk__begin_contexts(struct nk_context *const *ctxs, int count, int *index)
+{
+    NK_ASSERT(ctxs || !count);
+    NK_ASSERT(index);
+    if (!ctxs || !index) return 0;
+    for (*index = 0; *index < count; ++(*index)) {
+        const struct nk_command *cmd = nk__begin(ctxs[*index]);
+        if (cmd) return cmd;
+    }
+    return 0;
+}
+NK_API const struct nk_command*
+nk__next_contexts(struct nk_context *const *ctxs, int count, int *index,
+    const struct nk_command *cmd)
+{
+    const struct nk_command *next;
+    NK_ASSERT(ctxs);
+    NK_ASSERT(index);
+    if (!ctxs || !index || *index >= count) return 0;
+    next = nk__next(ctxs[*index], cmd);
+    while (!next && ++(*index) < count)
+        next = nk__begin(ctxs[*index]);
     return next;
 }
+NK_API int
+nk_contexts_hovered(struct nk_context *const *ctxs, int count, struct nk_vec2 pos)
+{
+    /* contexts are drawn back to front so the last one is on top */
+    int i;
+    NK_ASSERT(ctxs || !count);
+    if (!ctxs) return -1;
+    for (i = count-1; i >= 0; --i)
+        if (nk_window_is_any_at(ctxs[i], pos))
+            return i;
+    return -1;
+}
+NK_API void
+nk_frame_init(struct nk_frame *frame, struct nk_buffer *memory)
+{
+    NK_ASSERT(frame);
+    NK_ASSERT(memory);
+    if (!frame || !memory) return;
+    nk_zero(frame, sizeof(*frame));
+    frame->memory = *memory;
+    frame->begin = frame->memory.allocated;
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    nk_draw_list_init(&frame->draw_list);
+#endif
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_frame_init_default(struct nk_frame *frame)
+{
+    struct nk_buffer memory;
+    struct nk_allocator alloc;
+    NK_ASSERT(frame);
+    if (!frame) return;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_buffer_init(&memory, &alloc, NK_DEFAULT_COMMAND_BUFFER_SIZE);
+    nk_frame_init(frame, &memory);
+}
+#endif
+NK_API void
+nk_frame_free(struct nk_frame *frame)
+{
+    NK_ASSERT(frame);
+    if (!frame) return;
+    nk_buffer_free(&frame->memory);
+    nk_zero(frame, sizeof(*frame));
+}
+NK_API int
+nk_frame_swap(struct nk_context *ctx, struct nk_frame *frame)
+{
+    struct nk_input_recorder *recorder;
+    struct nk_buffer memory;
+    nk_size begin = 0;
+    int commands = 0;
 
+    NK_ASSERT(ctx);
+    NK_ASSERT(frame);
+    NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
+    NK_ASSERT(ctx->use_pool && "windows inside the command buffer cannot be handed off");
+    if (!ctx || !frame || ctx->current || !ctx->use_pool) return 0;
+
+    /* link window command buffers into one list before handing it over */
+    if (ctx->count)
+        commands = nk_command_list_begin(ctx, &begin);
+    frame->begin = (commands) ? begin: ctx->memory.allocated;
+    frame->seq = ctx->seq;
+    ctx->memory_stats.command_high_water = NK_MAX(
+        ctx->memory_stats.command_high_water, ctx->memory.allocated);
+    /* the recorder has to hash the commands before they are handed over */
+    recorder = ctx->recorder;
+    if (recorder)
+        nk_input_record_frame(ctx);
 
+    /* exchange buffers instead of copying and start over with the old one */
+    memory = frame->memory;
+    frame->memory = ctx->memory;
+    ctx->memory = memory;
+    ctx->recorder = 0;
+    nk_clear(ctx);
+    ctx->recorder = recorder;
+    return commands;
+}
+NK_API const struct nk_command*
+nk__frame_begin(const struct nk_frame *frame)
+{
+    NK_ASSERT(frame);
+    if (!frame) return 0;
+    return nk_command_list_at(&frame->memory, frame->begin);
+}
+NK_API const struct nk_command*
+nk__frame_next(const struct nk_frame *frame, const struct nk_command *cmd)
+{
+    NK_ASSERT(frame);
+    if (!frame || !cmd) return 0;
+    return nk_command_list_next(&frame->memory, cmd);
+}
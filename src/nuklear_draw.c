@@ -18,6 +18,10 @@ nk_command_buffer_init(struct nk_command_buffer *cb,
     cb->begin = b->allocated;
     cb->end = b->allocated;
     cb->last = b->allocated;
+    cb->count = 0;
+#ifdef NK_INCLUDE_PROFILER
+    cb->profiler = 0;
+#endif
 }
 NK_LIB void
 nk_command_buffer_reset(struct nk_command_buffer *b)
@@ -27,6 +31,7 @@ nk_command_buffer_reset(struct nk_command_buffer *b)
     b->begin = 0;
     b->end = 0;
     b->last = 0;
+    b->count = 0;
     b->clip = nk_null_rect;
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     b->userdata.ptr = 0;
@@ -49,7 +54,7 @@ nk_command_buffer_push(struct nk_command_buffer* b,
     if (!cmd) return 0;
 
     /* make sure the offset to the next command is aligned */
-    b->last = (nk_size)((nk_byte*)cmd - (nk_byte*)b->base->memory.ptr);
+    b->last = b->base->allocated - size;
     unaligned = (nk_byte*)cmd + size;
     memory = NK_ALIGN_PTR(unaligned, align);
     alignment = (nk_size)((nk_byte*)memory - (nk_byte*)unaligned);
@@ -63,6 +68,7 @@ nk_command_buffer_push(struct nk_command_buffer* b,
     cmd->userdata = b->userdata;
 #endif
     b->end = cmd->next;
+    b->count++;
     return cmd;
 }
 NK_API void
@@ -443,7 +449,6 @@ nk_draw_text(struct nk_command_buffer *b, struct nk_rect r,
     struct nk_color bg, struct nk_color fg)
 {
     float text_width = 0;
-    struct nk_command_text *cmd;
 
     NK_ASSERT(b);
     NK_ASSERT(font);
@@ -462,7 +467,17 @@ nk_draw_text(struct nk_command_buffer *b, struct nk_rect r,
         length = nk_text_clamp(font, string, length, r.w, &glyphs, &txt_width, 0,0);
     }
 
-    if (!length) return;
+    nk_push_text(b, r, string, length, font, bg, fg);
+}
+NK_LIB void
+nk_push_text(struct nk_command_buffer *b, struct nk_rect r,
+    const char *string, int length, const struct nk_user_font *font,
+    struct nk_color bg, struct nk_color fg)
+{
+    struct nk_command_text *cmd;
+    NK_ASSERT(b);
+    NK_ASSERT(font);
+    if (!b || !string || !length) return;
     cmd = (struct nk_command_text*)
         nk_command_buffer_push(b, NK_COMMAND_TEXT, sizeof(*cmd) + (nk_size)(length + 1));
     if (!cmd) return;
@@ -169,6 +169,7 @@ nk_do_edit(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(style);
     if (!state || !out || !style)
         return ret;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_EDIT);
 
     /* visible text area calculation */
     area.x = bounds.x + style->padding.x + style->border;
@@ -645,6 +646,7 @@ nk_do_edit(nk_flags *state, struct nk_command_buffer *out,
             background_color, text_color, nk_false);
     }
     nk_push_scissor(out, old_clip);}
+    NK_PROFILE_END(out->profiler, NK_PROFILE_EDIT);
     return ret;
 }
 NK_API void
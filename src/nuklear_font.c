@@ -368,6 +368,110 @@ nk_rp_pack_rects(struct nk_rp_context *context, struct nk_rp_rect *rects, int nu
     for (i=0; i < num_rects; ++i)
         rects[i].was_packed = !(rects[i].x == NK_RP__MAXVAL && rects[i].y == NK_RP__MAXVAL);
 }
+/* MaxRects packer with best area fit. Keeps a list of maximal free
+ * rectangles which may overlap each other. Slower than the skyline packer
+ * but often packs tighter since space below skyline overhangs is reused. */
+struct nk_rp_space {
+    int x, y, w, h;
+};
+NK_INTERN int
+nk_rp__space_contains(const struct nk_rp_space *a, const struct nk_rp_space *b)
+{
+    return b->x >= a->x && b->y >= a->y &&
+        b->x + b->w <= a->x + a->w && b->y + b->h <= a->y + a->h;
+}
+NK_INTERN int
+nk_rp__maxrects_place(struct nk_rp_space *spaces, int *count, int capacity,
+    const struct nk_rp_space *used)
+{
+    int i, j, n = *count, end = *count;
+
+    /* split every free rect overlapping the used rect into up to four */
+    for (i = 0; i < n; ++i) {
+        struct nk_rp_space s = spaces[i];
+        if (used->x >= s.x + s.w || used->x + used->w <= s.x ||
+            used->y >= s.y + s.h || used->y + used->h <= s.y)
+            continue;
+        if (end + 4 > capacity) return nk_false;
+        spaces[i].w = 0;
+        if (used->x > s.x) {
+            spaces[end] = s; spaces[end].w = used->x - s.x; end++;
+        }
+        if (used->x + used->w < s.x + s.w) {
+            spaces[end] = s; spaces[end].x = used->x + used->w;
+            spaces[end].w = s.x + s.w - spaces[end].x; end++;
+        }
+        if (used->y > s.y) {
+            spaces[end] = s; spaces[end].h = used->y - s.y; end++;
+        }
+        if (used->y + used->h < s.y + s.h) {
+            spaces[end] = s; spaces[end].y = used->y + used->h;
+            spaces[end].h = s.y + s.h - spaces[end].y; end++;
+        }
+    }
+
+    /* only new free rects can be contained in or contain other free rects */
+    for (i = n; i < end; ++i) {
+        for (j = 0; j < end && spaces[i].w; ++j) {
+            if (i == j || !spaces[j].w) continue;
+            if (nk_rp__space_contains(&spaces[j], &spaces[i]))
+                spaces[i].w = 0;
+            else if (j < n && nk_rp__space_contains(&spaces[i], &spaces[j]))
+                spaces[j].w = 0;
+        }
+    }
+    for (i = 0, j = 0; i < end; ++i)
+        if (spaces[i].w) spaces[j++] = spaces[i];
+    *count = j;
+    return nk_true;
+}
+NK_INTERN int
+nk_rp_pack_rects_maxrects(struct nk_rp_rect *rects, int num_rects, int width,
+    int height, struct nk_rp_space *spaces, int capacity)
+{
+    int i, j, count = 1, result = nk_true;
+    NK_ASSERT(capacity > 0);
+    spaces[0].x = spaces[0].y = 0;
+    spaces[0].w = width;
+    spaces[0].h = height;
+
+    for (i=0; i < num_rects; ++i) {
+        rects[i].was_packed = i;
+        rects[i].x = rects[i].y = NK_RP__MAXVAL;
+    }
+    nk_rp_qsort(rects, (unsigned)num_rects, nk_rect_height_compare);
+
+    for (i=0; i < num_rects; ++i) {
+        int best = -1, best_area = 0, best_short = 0;
+        struct nk_rp_space used;
+        used.w = rects[i].w;
+        used.h = rects[i].h;
+
+        /* best area fit with shortest leftover side as tie breaker */
+        for (j = 0; j < count; ++j) {
+            int area, dw = spaces[j].w - used.w, dh = spaces[j].h - used.h;
+            if (dw < 0 || dh < 0) continue;
+            area = spaces[j].w * spaces[j].h - used.w * used.h;
+            if (best < 0 || area < best_area ||
+                (area == best_area && NK_MIN(dw, dh) < best_short)) {
+                best = j; best_area = area; best_short = NK_MIN(dw, dh);
+            }
+        }
+        if (best < 0) {result = nk_false; continue;}
+        used.x = spaces[best].x;
+        used.y = spaces[best].y;
+        if (!nk_rp__maxrects_place(spaces, &count, capacity, &used)) {
+            result = nk_false;
+            break;
+        }
+        rects[i].x = (nk_rp_coord)used.x;
+        rects[i].y = (nk_rp_coord)used.y;
+    }
+    nk_rp_qsort(rects, (unsigned)num_rects, nk_rect_original_order);
+    for (i=0; i < num_rects; ++i)
+        rects[i].was_packed = !(rects[i].x == NK_RP__MAXVAL && rects[i].y == NK_RP__MAXVAL);
+    return result;
+}
 
 /*
  * ==============================================================
@@ -417,6 +521,7 @@ struct nk_tt_pack_context {
     int   stride_in_bytes;
     int   padding;
     unsigned int   h_oversample, v_oversample;
+    int   sdf_spread;
     unsigned char *pixels;
     void  *nodes;
 };
@@ -446,21 +551,16 @@ struct nk_tt__bitmap{
    unsigned char *pixels;
 };
 
-struct nk_tt__hheap_chunk {
-    struct nk_tt__hheap_chunk *next;
-};
-struct nk_tt__hheap {
-    struct nk_allocator alloc;
-    struct nk_tt__hheap_chunk *head;
-    void   *first_free;
-    int    num_remaining_in_head_chunk;
-};
-
 struct nk_tt__edge {
     float x0,y0, x1,y1;
     int invert;
 };
 
+struct nk_tt__edge_key {
+    float y0;
+    int index;
+};
+
 struct nk_tt__active_edge {
     struct nk_tt__active_edge *next;
     float fx,fdx,fdy;
@@ -468,6 +568,8 @@ struct nk_tt__active_edge {
     float sy;
     float ey;
 };
+/* unsorted edges are stored in the memory later used for active edges */
+NK_STATIC_ASSERT(sizeof(struct nk_tt__active_edge) >= sizeof(struct nk_tt__edge));
 struct nk_tt__point {float x,y;};
 
 #define NK_TT_MACSTYLE_DONTCARE     0
@@ -1058,53 +1160,12 @@ nk_tt_GetGlyphBitmapBox(const struct nk_tt_fontinfo *font, int glyph,
 /*-------------------------------------------------------------
  *                          Rasterizer
  * --------------------------------------------------------------*/
-NK_INTERN void*
-nk_tt__hheap_alloc(struct nk_tt__hheap *hh, nk_size size)
-{
-    if (hh->first_free) {
-        void *p = hh->first_free;
-        hh->first_free = * (void **) p;
-        return p;
-    } else {
-        if (hh->num_remaining_in_head_chunk == 0) {
-            int count = (size < 32 ? 2000 : size < 128 ? 800 : 100);
-            struct nk_tt__hheap_chunk *c = (struct nk_tt__hheap_chunk *)
-                hh->alloc.alloc(hh->alloc.userdata, 0,
-                sizeof(struct nk_tt__hheap_chunk) + size * (nk_size)count);
-            if (c == 0) return 0;
-            c->next = hh->head;
-            hh->head = c;
-            hh->num_remaining_in_head_chunk = count;
-        }
-        --hh->num_remaining_in_head_chunk;
-        return (char *) (hh->head) + size * (nk_size)hh->num_remaining_in_head_chunk;
-    }
-}
-NK_INTERN void
-nk_tt__hheap_free(struct nk_tt__hheap *hh, void *p)
-{
-    *(void **) p = hh->first_free;
-    hh->first_free = p;
-}
-NK_INTERN void
-nk_tt__hheap_cleanup(struct nk_tt__hheap *hh)
-{
-    struct nk_tt__hheap_chunk *c = hh->head;
-    while (c) {
-        struct nk_tt__hheap_chunk *n = c->next;
-        hh->alloc.free(hh->alloc.userdata, c);
-        c = n;
-    }
-}
 NK_INTERN struct nk_tt__active_edge*
-nk_tt__new_active(struct nk_tt__hheap *hh, struct nk_tt__edge *e,
+nk_tt__new_active(struct nk_tt__active_edge *z, struct nk_tt__edge *e,
     int off_x, float start_point)
 {
-    struct nk_tt__active_edge *z = (struct nk_tt__active_edge *)
-        nk_tt__hheap_alloc(hh, sizeof(*z));
     float dxdy = (e->x1 - e->x0) / (e->y1 - e->y0);
     /*STBTT_assert(e->y0 <= start_point); */
-    if (!z) return z;
     z->fdx = dxdy;
     z->fdy = (dxdy != 0) ? (1/dxdy): 0;
     z->fx = e->x0 + dxdy * (start_point - e->y0);
@@ -1309,106 +1370,105 @@ nk_tt__fill_active_edges_new(float *scanline, float *scanline_fill, int len,
     }
 }
 NK_INTERN void
+nk_tt__resolve_scanline(unsigned char *out, const float *scanline,
+    float *scanline2, int len)
+{
+    /* The prefix sum of the fill has to stay sequential to produce identical
+     * rounding. Converting accumulated area into coverage is independent per
+     * pixel and done eight pixels at a time if SSE2 is enabled. */
+    int i = 0;
+    float sum = 0;
+    for (i=0; i < len; ++i) {
+        sum += scanline2[i];
+        scanline2[i] = sum;
+    }
+    i = 0;
+#ifdef NK_INCLUDE_SSE2
+    {const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 8 <= len; i += 8) {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(scanline + i), _mm_loadu_ps(scanline2 + i));
+        __m128 b = _mm_add_ps(_mm_loadu_ps(scanline + i + 4), _mm_loadu_ps(scanline2 + i + 4));
+        __m128i ia = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign, a), scale), half));
+        __m128i ib = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign, b), scale), half));
+        /* saturating packs clamp to 255 */
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(ia, ib), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i*)(void*)(out + i), packed);
+    }}
+#endif
+    for (; i < len; ++i) {
+        float k = scanline[i] + scanline2[i];
+        int m = (int)(NK_ABS(k) * 255.0f + 0.5f);
+        out[i] = (unsigned char)((m > 255) ? 255: m);
+    }
+}
+NK_INTERN void
 nk_tt__rasterize_sorted_edges(struct nk_tt__bitmap *result, struct nk_tt__edge *e,
-    int n, int vsubsample, int off_x, int off_y, struct nk_allocator *alloc)
+    int n, struct nk_tt__active_edge *pool, float *scanline, int off_x, int off_y)
 {
     /* directly AA rasterize edges w/o supersampling */
-    struct nk_tt__hheap hh;
     struct nk_tt__active_edge *active = 0;
-    int y,j=0, i;
-    float scanline_data[129], *scanline, *scanline2;
-
-    NK_UNUSED(vsubsample);
-    nk_zero_struct(hh);
-    hh.alloc = *alloc;
-
-    if (result->w > 64)
-        scanline = (float *) alloc->alloc(alloc->userdata,0, (nk_size)(result->w*2+1) * sizeof(float));
-    else scanline = scanline_data;
+    float *scanline2 = scanline + result->w;
+    int y,j=0, used = 0;
 
-    scanline2 = scanline + result->w;
     y = off_y;
     e[n].y0 = (float) (off_y + result->h) + 1;
-
     while (j < result->h)
     {
         /* find center of pixel for this scanline */
         float scan_y_top    = (float)y + 0.0f;
         float scan_y_bottom = (float)y + 1.0f;
         struct nk_tt__active_edge **step = &active;
-
-        NK_MEMSET(scanline , 0, (nk_size)result->w*sizeof(scanline[0]));
-        NK_MEMSET(scanline2, 0, (nk_size)(result->w+1)*sizeof(scanline[0]));
-
-        /* update all active edges; */
-        /* remove all active edges that terminate before the top of this scanline */
-        while (*step) {
-            struct nk_tt__active_edge * z = *step;
-            if (z->ey <= scan_y_top) {
-                *step = z->next; /* delete from list */
-                NK_ASSERT(z->direction);
-                z->direction = 0;
-                nk_tt__hheap_free(&hh, z);
-            } else {
-                step = &((*step)->next); /* advance through list */
-            }
-        }
+        unsigned char *out = result->pixels + j*result->stride;
 
         /* insert all edges that start before the bottom of this scanline */
         while (e->y0 <= scan_y_bottom) {
             if (e->y0 != e->y1) {
-                struct nk_tt__active_edge *z = nk_tt__new_active(&hh, e, off_x, scan_y_top);
-                if (z != 0) {
-                    NK_ASSERT(z->ey >= scan_y_top);
-                    /* insert at front */
-                    z->next = active;
-                    active = z;
-                }
+                /* every edge becomes active at most once */
+                struct nk_tt__active_edge *z = nk_tt__new_active(&pool[used++], e, off_x, scan_y_top);
+                NK_ASSERT(used <= n);
+                NK_ASSERT(z->ey >= scan_y_top);
+                /* insert at front */
+                z->next = active;
+                active = z;
             }
             ++e;
         }
 
-        /* now process all active edges */
-        if (active)
+        if (active) {
+            NK_MEMSET(scanline , 0, (nk_size)result->w*sizeof(scanline[0]));
+            NK_MEMSET(scanline2, 0, (nk_size)(result->w+1)*sizeof(scanline[0]));
             nk_tt__fill_active_edges_new(scanline, scanline2+1, result->w, active, scan_y_top);
+            nk_tt__resolve_scanline(out, scanline, scanline2, result->w);
+        } else NK_MEMSET(out, 0, (nk_size)result->w);
 
-        {
-            float sum = 0;
-            for (i=0; i < result->w; ++i) {
-                float k;
-                int m;
-                sum += scanline2[i];
-                k = scanline[i] + sum;
-                k = (float) NK_ABS(k) * 255.0f + 0.5f;
-                m = (int) k;
-                if (m > 255) m = 255;
-                result->pixels[j*result->stride + i] = (unsigned char) m;
-            }
-        }
-        /* advance all the edges */
-        step = &active;
+        /* advance all edges and remove edges ending before the next scanline */
         while (*step) {
             struct nk_tt__active_edge *z = *step;
-            z->fx += z->fdx; /* advance to position for current scanline */
-            step = &((*step)->next); /* advance through list */
+            if (z->ey <= scan_y_bottom) {
+                *step = z->next; /* delete from list */
+                NK_ASSERT(z->direction);
+                z->direction = 0;
+            } else {
+                z->fx += z->fdx; /* advance to position for next scanline */
+                step = &z->next; /* advance through list */
+            }
         }
         ++y;
         ++j;
     }
-    nk_tt__hheap_cleanup(&hh);
-    if (scanline != scanline_data)
-        alloc->free(alloc->userdata, scanline);
 }
 NK_INTERN void
-nk_tt__sort_edges_ins_sort(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges_ins_sort(struct nk_tt__edge_key *p, int n)
 {
     int i,j;
     #define NK_TT__COMPARE(a,b)  ((a)->y0 < (b)->y0)
     for (i=1; i < n; ++i) {
-        struct nk_tt__edge t = p[i], *a = &t;
+        struct nk_tt__edge_key t = p[i], *a = &t;
         j = i;
         while (j > 0) {
-            struct nk_tt__edge *b = &p[j-1];
+            struct nk_tt__edge_key *b = &p[j-1];
             int c = NK_TT__COMPARE(a,b);
             if (!c) break;
             p[j] = p[j-1];
@@ -1419,11 +1479,11 @@ nk_tt__sort_edges_ins_sort(struct nk_tt__edge *p, int n)
     }
 }
 NK_INTERN void
-nk_tt__sort_edges_quicksort(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges_quicksort(struct nk_tt__edge_key *p, int n)
 {
     /* threshold for transitioning to insertion sort */
     while (n > 12) {
-        struct nk_tt__edge t;
+        struct nk_tt__edge_key t;
         int c01,c12,c,m,i,j;
 
         /* compute median of three */
@@ -1486,10 +1546,19 @@ nk_tt__sort_edges_quicksort(struct nk_tt__edge *p, int n)
     }
 }
 NK_INTERN void
-nk_tt__sort_edges(struct nk_tt__edge *p, int n)
+nk_tt__sort_edges(struct nk_tt__edge *dst, const struct nk_tt__edge *src,
+    struct nk_tt__edge_key *keys, int n)
 {
-   nk_tt__sort_edges_quicksort(p, n);
-   nk_tt__sort_edges_ins_sort(p, n);
+    /* sort small keys instead of whole edges and gather edges afterwards */
+    int i;
+    for (i = 0; i < n; ++i) {
+        keys[i].y0 = src[i].y0;
+        keys[i].index = i;
+    }
+    nk_tt__sort_edges_quicksort(keys, n);
+    nk_tt__sort_edges_ins_sort(keys, n);
+    for (i = 0; i < n; ++i)
+        dst[i] = src[keys[i].index];
 }
 NK_INTERN void
 nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
@@ -1498,7 +1567,12 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     struct nk_allocator *alloc)
 {
     float y_scale_inv = invert ? -scale_y : scale_y;
-    struct nk_tt__edge *e;
+    struct nk_tt__edge *e, *sorted;
+    struct nk_tt__active_edge *pool;
+    struct nk_tt__edge_key *keys;
+    float *scanline;
+    void *memory;
+    nk_size size;
     int n,i,j,k,m;
     int vsubsample = 1;
     /* vsubsample should divide 255 evenly; otherwise we won't reach full opacity */
@@ -1508,9 +1582,17 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     for (i=0; i < windings; ++i)
         n += wcount[i];
 
-    e = (struct nk_tt__edge*)
-       alloc->alloc(alloc->userdata, 0,(sizeof(*e) * (nk_size)(n+1)));
-    if (e == 0) return;
+    /* one block for everything: unsorted edges are gathered into sorted
+     * order and then overwritten by active edges they turn into */
+    size = sizeof(*pool) * (nk_size)n + sizeof(*sorted) * (nk_size)(n+1) +
+        sizeof(*keys) * (nk_size)n + sizeof(float) * (nk_size)(result->w*2+1);
+    memory = alloc->alloc(alloc->userdata, 0, size);
+    if (memory == 0) return;
+    pool = (struct nk_tt__active_edge*)memory;
+    e = (struct nk_tt__edge*)(void*)pool;
+    sorted = (struct nk_tt__edge*)(void*)(pool + n);
+    keys = (struct nk_tt__edge_key*)(void*)(sorted + n + 1);
+    scanline = (float*)(void*)(keys + n);
     n = 0;
 
     m=0;
@@ -1540,11 +1622,10 @@ nk_tt__rasterize(struct nk_tt__bitmap *result, struct nk_tt__point *pts,
     }
 
     /* now sort the edges by their highest point (should snap to integer, and then by x) */
-    /*STBTT_sort(e, n, sizeof(e[0]), nk_tt__edge_compare); */
-    nk_tt__sort_edges(e, n);
+    nk_tt__sort_edges(sorted, e, keys, n);
     /* now, traverse the scanlines and find the intersections on each scanline, use xor winding rule */
-    nk_tt__rasterize_sorted_edges(result, e, n, vsubsample, off_x, off_y, alloc);
-    alloc->free(alloc->userdata, e);
+    nk_tt__rasterize_sorted_edges(result, sorted, n, pool, scanline, off_x, off_y);
+    alloc->free(alloc->userdata, memory);
 }
 NK_INTERN void
 nk_tt__add_point(struct nk_tt__point *points, int n, float x, float y)
@@ -1701,6 +1782,74 @@ nk_tt_MakeGlyphBitmapSubpixel(const struct nk_tt_fontinfo *info, unsigned char *
     alloc->free(alloc->userdata, vertices);
 }
 
+NK_INTERN void
+nk_tt_MakeGlyphSDF(const struct nk_tt_fontinfo *info, unsigned char *output,
+    int out_w, int out_h, int out_stride, float scale, int spread,
+    int glyph, struct nk_allocator *alloc)
+{
+    /* Signed distance field to the flattened glyph outline. Every texel stores
+     * 128 on the outline and +-127 at `spread` pixels inside/outside. */
+    int x, y, i, j, ix0, iy0, ix1, iy1;
+    int num_contours = 0, *contour_lengths = 0;
+    struct nk_tt_vertex *vertices;
+    struct nk_tt__point *points;
+    int num_verts = nk_tt_GetGlyphShape(info, alloc, glyph, &vertices);
+    float max_dist = (float)spread;
+
+    /* only write the glyph box plus spread, never into the packing padding */
+    nk_tt_GetGlyphBitmapBox(info, glyph, scale, scale, &ix0,&iy0,&ix1,&iy1);
+    out_w = NK_MIN(out_w, ix1 - ix0 + 2*spread);
+    out_h = NK_MIN(out_h, iy1 - iy0 + 2*spread);
+    points = nk_tt_FlattenCurves(vertices, num_verts, 0.35f / scale,
+        &contour_lengths, &num_contours, alloc);
+    alloc->free(alloc->userdata, vertices);
+    if (!points) return;
+
+    /* move outline into bitmap space */
+    for (i = 0, j = 0; i < num_contours; ++i) j += contour_lengths[i];
+    for (i = 0; i < j; ++i) {
+        points[i].x = points[i].x * scale - (float)(ix0 - spread);
+        points[i].y = -points[i].y * scale - (float)(iy0 - spread);
+    }
+    for (y = 0; y < out_h; ++y) {
+        for (x = 0; x < out_w; ++x) {
+            float px = (float)x + 0.5f, py = (float)y + 0.5f;
+            float best = max_dist * max_dist;
+            int winding = 0, start = 0, c;
+            for (c = 0; c < num_contours; ++c) {
+                int n = contour_lengths[c];
+                const struct nk_tt__point *pts = points + start;
+                for (i = 0, j = n-1; i < n; j = i++) {
+                    const struct nk_tt__point *a = &pts[j], *b = &pts[i];
+                    float ex = b->x - a->x, ey = b->y - a->y;
+                    float dx = px - a->x, dy = py - a->y;
+                    float len = ex*ex + ey*ey, t, d;
+
+                    /* nonzero winding rule for the sign */
+                    if ((a->y <= py) != (b->y <= py)) {
+                        float cross = ex * dy - ey * dx;
+                        if (b->y > a->y && cross > 0) winding++;
+                        else if (b->y <= a->y && cross < 0) winding--;
+                    }
+                    /* squared distance to segment */
+                    if (NK_MIN(a->x, b->x) - px >= max_dist || px - NK_MAX(a->x, b->x) >= max_dist ||
+                        NK_MIN(a->y, b->y) - py >= max_dist || py - NK_MAX(a->y, b->y) >= max_dist)
+                        continue;
+                    t = (len > 0) ? NK_CLAMP(0.0f, (dx*ex + dy*ey) / len, 1.0f): 0.0f;
+                    dx -= t * ex; dy -= t * ey;
+                    d = dx*dx + dy*dy;
+                    if (d < best) best = d;
+                }
+                start += n;
+            }
+            {float dist = NK_SQRT(best) * 127.0f / max_dist;
+            float v = (winding != 0) ? 128.0f + dist: 128.0f - dist;
+            output[y * out_stride + x] = (unsigned char)NK_CLAMP(0.0f, v + 0.5f, 255.0f);}
+        }
+    }
+    alloc->free(alloc->userdata, contour_lengths);
+    alloc->free(alloc->userdata, points);
+}
 /*-------------------------------------------------------------
  *                          Bitmap baking
  * --------------------------------------------------------------*/
@@ -1729,6 +1878,7 @@ nk_tt_PackBegin(struct nk_tt_pack_context *spc, unsigned char *pixels,
     spc->stride_in_bytes = (stride_in_bytes != 0) ? stride_in_bytes : pw;
     spc->h_oversample = 1;
     spc->v_oversample = 1;
+    spc->sdf_spread = 0;
 
     nk_rp_init_target(context, pw-padding, ph-padding, nodes, num_nodes);
     if (pixels)
@@ -1914,8 +2064,8 @@ nk_tt_PackFontRangesGatherRects(struct nk_tt_pack_context *spc,
             int glyph = nk_tt_FindGlyphIndex(info, codepoint);
             nk_tt_GetGlyphBitmapBoxSubpixel(info,glyph, scale * (float)spc->h_oversample,
                 scale * (float)spc->v_oversample, 0,0, &x0,&y0,&x1,&y1);
-            rects[k].w = (nk_rp_coord) (x1-x0 + spc->padding + (int)spc->h_oversample-1);
-            rects[k].h = (nk_rp_coord) (y1-y0 + spc->padding + (int)spc->v_oversample-1);
+            rects[k].w = (nk_rp_coord) (x1-x0 + spc->padding + (int)spc->h_oversample-1 + 2*spc->sdf_spread);
+            rects[k].h = (nk_rp_coord) (y1-y0 + spc->padding + (int)spc->v_oversample-1 + 2*spc->sdf_spread);
             ++k;
         }
     }
@@ -1971,7 +2121,15 @@ nk_tt_PackFontRangesRenderIntoRects(struct nk_tt_pack_context *spc,
                 nk_tt_GetGlyphHMetrics(info, glyph, &advance, &lsb);
                 nk_tt_GetGlyphBitmapBox(info, glyph, scale * (float)spc->h_oversample,
                         (scale * (float)spc->v_oversample), &x0,&y0,&x1,&y1);
-                nk_tt_MakeGlyphBitmapSubpixel(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
+                if (spc->sdf_spread) {
+                    /* distance fields are never oversampled and like bitmaps
+                     * only fill the rect without padding */
+                    nk_tt_MakeGlyphSDF(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
+                        (int)(r->w - spc->h_oversample+1), (int)(r->h - spc->v_oversample+1),
+                        spc->stride_in_bytes, scale, spc->sdf_spread, glyph, alloc);
+                    x0 -= spc->sdf_spread;
+                    y0 -= spc->sdf_spread;
+                } else nk_tt_MakeGlyphBitmapSubpixel(info, spc->pixels + r->x + r->y*spc->stride_in_bytes,
                     (int)(r->w - spc->h_oversample+1), (int)(r->h - spc->v_oversample+1),
                     spc->stride_in_bytes, scale * (float)spc->h_oversample,
                     scale * (float)spc->v_oversample, 0,0, glyph, alloc);
@@ -2129,6 +2287,14 @@ nk_font_korean_glyph_ranges(void)
     return ranges;
 }
 NK_INTERN void
+nk_font_bake_mode(struct nk_tt_pack_context *spc, const struct nk_font_config *cfg)
+{
+    /* distance field glyphs scale on their own and skip oversampling */
+    if (cfg->sdf) nk_tt_PackSetOversampling(spc, 1, 1);
+    else nk_tt_PackSetOversampling(spc, cfg->oversample_h, cfg->oversample_v);
+    spc->sdf_spread = cfg->sdf;
+}
+NK_INTERN void
 nk_font_baker_memory(nk_size *temp, int *glyph_count,
     struct nk_font_config *config_list, int count)
 {
@@ -2174,11 +2340,116 @@ nk_font_baker(void *memory, int glyph_count, int count, struct nk_allocator *all
     baker->alloc = *alloc;
     return baker;
 }
+enum nk_font_pack_heuristic {
+    NK_FONT_PACK_SKYLINE_BL = NK_RP_HEURISTIC_Skyline_BL_sortHeight,
+    NK_FONT_PACK_SKYLINE_BF = NK_RP_HEURISTIC_Skyline_BF_sortHeight,
+    NK_FONT_PACK_MAXRECTS,
+    NK_FONT_PACK_HEURISTIC_COUNT
+};
+NK_INTERN int
+nk_font_bake_pack_try(struct nk_rp_rect *rects, int count, int heuristic,
+    int width, int height, int padding, struct nk_rp_node *nodes,
+    struct nk_rp_space *spaces, int space_capacity)
+{
+    int i, result = 0;
+    if (heuristic == NK_FONT_PACK_MAXRECTS) {
+        if (!nk_rp_pack_rects_maxrects(rects, count, width - padding,
+            height - padding, spaces, space_capacity))
+            return 0;
+    } else {
+        struct nk_rp_context context;
+        nk_rp_init_target(&context, width - padding, height - padding,
+            nodes, width - padding);
+        context.heuristic = heuristic;
+        nk_rp_pack_rects(&context, rects, count);
+    }
+    for (i = 0; i < count; ++i) {
+        if (!rects[i].was_packed) return 0;
+        result = NK_MAX(result, rects[i].y + rects[i].h);
+    }
+    return result;
+}
+NK_INTERN int
+nk_font_bake_pack_tight(struct nk_rp_rect *glyphs, int glyph_count,
+    struct nk_recti *custom, int padding, int default_width,
+    int *width, int *height, struct nk_allocator *alloc)
+{
+    NK_STORAGE const float scales[] = {1.0f, 1.125f, 1.25f, 1.5f, 2.0f, 0.0f};
+    NK_STORAGE const int max_size = 1024 * 32;
+    struct nk_rp_rect *rects, *trial;
+    struct nk_rp_node *nodes = 0;
+    struct nk_rp_space *spaces = 0;
+    int i, s, first = custom ? 1: 0;
+    int count = glyph_count + first;
+    int space_capacity = 8 * count + 64;
+    int min_width = 0, best_width = 0, best_height = 0;
+    float area = 0;
+
+    /* pack glyphs and custom data together so all heuristics see every rect */
+    rects = (struct nk_rp_rect*)alloc->alloc(alloc->userdata, 0,
+        sizeof(struct nk_rp_rect) * (nk_size)(count * 2));
+    if (!rects) return nk_false;
+    trial = rects + count;
+    if (custom) {
+        nk_zero(rects, sizeof(struct nk_rp_rect));
+        rects[0].w = (nk_rp_coord)custom->w;
+        rects[0].h = (nk_rp_coord)custom->h;
+    }
+    NK_MEMCPY(rects + first, glyphs, sizeof(struct nk_rp_rect) * (nk_size)glyph_count);
+    for (i = 0; i < count; ++i) {
+        area += (float)rects[i].w * (float)rects[i].h;
+        min_width = NK_MAX(min_width, rects[i].w + padding);
+    }
+    nodes = (struct nk_rp_node*)alloc->alloc(alloc->userdata, 0,
+        sizeof(struct nk_rp_node) * (nk_size)max_size);
+    if (count <= NK_FONT_PACK_MAXRECTS_LIMIT)
+        spaces = (struct nk_rp_space*)alloc->alloc(alloc->userdata, 0,
+            sizeof(struct nk_rp_space) * (nk_size)space_capacity);
+    if (!nodes) goto cleanup;
+
+    /* try widths around a square atlas as well as the default width and keep
+     * the combination of width and heuristic with the smallest area */
+    for (s = 0; s < (int)NK_LEN(scales); ++s) {
+        int heuristic, w, h, limit;
+        if (scales[s] > 0)
+            w = (int)(NK_SQRT(area) * scales[s]) + 1;
+        else w = default_width;
+        w = NK_CLAMP(min_width, (w + 7) & ~7, max_size);
+        for (heuristic = 0; heuristic < NK_FONT_PACK_HEURISTIC_COUNT; ++heuristic) {
+            if (heuristic == NK_FONT_PACK_MAXRECTS && !spaces) continue;
+            /* no need to search beyond the best area found so far */
+            limit = best_width ? NK_MIN(max_size, best_width * best_height / w + 1): max_size;
+            if (limit <= padding) continue;
+            NK_MEMCPY(trial, rects, sizeof(struct nk_rp_rect) * (nk_size)count);
+            h = nk_font_bake_pack_try(trial, count, heuristic, w, limit, padding,
+                    nodes, spaces, space_capacity);
+            if (!h) continue;
+            if (!best_width || w * h < best_width * best_height ||
+                (w * h == best_width * best_height && w + h < best_width + best_height)) {
+                best_width = w;
+                best_height = h;
+                NK_MEMCPY(glyphs, trial + first, sizeof(struct nk_rp_rect) * (nk_size)glyph_count);
+                if (custom) {
+                    custom->x = (short)trial[0].x;
+                    custom->y = (short)trial[0].y;
+                }
+            }
+        }
+    }
+    *width = best_width;
+    *height = best_height;
+
+cleanup:
+    if (spaces) alloc->free(alloc->userdata, spaces);
+    if (nodes) alloc->free(alloc->userdata, nodes);
+    alloc->free(alloc->userdata, rects);
+    return best_width != 0;
+}
 NK_INTERN int
 nk_font_bake_pack(struct nk_font_baker *baker,
     nk_size *image_memory, int *width, int *height, struct nk_recti *custom,
     const struct nk_font_config *config_list, int count,
-    struct nk_allocator *alloc)
+    enum nk_font_atlas_packing packing, struct nk_allocator *alloc)
 {
     NK_STORAGE const nk_size max_height = 1024 * 32;
     const struct nk_font_config *config_iter, *it;
@@ -2218,7 +2489,7 @@ nk_font_bake_pack(struct nk_font_baker *baker,
         int rect_n = 0;
         int char_n = 0;
 
-        if (custom) {
+        if (custom && packing == NK_FONT_ATLAS_PACK_DEFAULT) {
             /* pack custom user data first so it will be in the upper left corner*/
             struct nk_rp_rect custom_space;
             nk_zero(&custom_space, sizeof(custom_space));
@@ -2268,9 +2539,10 @@ nk_font_bake_pack(struct nk_font_baker *baker,
                 /* pack */
                 tmp->rects = baker->rects + rect_n;
                 rect_n += glyph_count;
-                nk_tt_PackSetOversampling(&baker->spc, cfg->oversample_h, cfg->oversample_v);
+                nk_font_bake_mode(&baker->spc, cfg);
                 n = nk_tt_PackFontRangesGatherRects(&baker->spc, &tmp->info,
                     tmp->ranges, (int)tmp->range_count, tmp->rects);
+                if (packing != NK_FONT_ATLAS_PACK_DEFAULT) continue;
                 nk_rp_pack_rects((struct nk_rp_context*)baker->spc.pack_info, tmp->rects, (int)n);
 
                 /* texture height */
@@ -2284,7 +2556,11 @@ nk_font_bake_pack(struct nk_font_baker *baker,
         NK_ASSERT(char_n == total_glyph_count);
         NK_ASSERT(range_n == total_range_count);
     }
-    *height = (int)nk_round_up_pow2((nk_uint)*height);
+    if (packing == NK_FONT_ATLAS_PACK_TIGHT) {
+        if (!nk_font_bake_pack_tight(baker->rects, total_glyph_count, custom,
+            baker->spc.padding, *width, width, height, alloc))
+            return nk_false;
+    } else *height = (int)nk_round_up_pow2((nk_uint)*height);
     *image_memory = (nk_size)(*width) * (nk_size)(*height);
     return nk_true;
 }
@@ -2312,13 +2588,15 @@ nk_font_bake(struct nk_font_baker *baker, void *image_memory, int width, int hei
     /* second font pass: render glyphs */
     nk_zero(image_memory, (nk_size)((nk_size)width * (nk_size)height));
     baker->spc.pixels = (unsigned char*)image_memory;
+    baker->spc.width = (int)width;
     baker->spc.height = (int)height;
+    baker->spc.stride_in_bytes = (int)width;
     for (input_i = 0, config_iter = config_list; input_i < font_count && config_iter;
         config_iter = config_iter->next) {
         it = config_iter;
         do {const struct nk_font_config *cfg = it;
             struct nk_font_bake_data *tmp = &baker->build[input_i++];
-            nk_tt_PackSetOversampling(&baker->spc, cfg->oversample_h, cfg->oversample_v);
+            nk_font_bake_mode(&baker->spc, cfg);
             nk_tt_PackFontRangesRenderIntoRects(&baker->spc, &tmp->info, tmp->ranges,
                 (int)tmp->range_count, tmp->rects, &baker->alloc);
         } while ((it = it->n) != config_iter);
@@ -2347,8 +2625,8 @@ nk_font_bake(struct nk_font_baker *baker, void *image_memory, int width, int hei
                 dst_font->ascent = ((float)unscaled_ascent * font_scale);
                 dst_font->descent = ((float)unscaled_descent * font_scale);
                 dst_font->glyph_offset = glyph_n;
-                // Need to zero this, or it will carry over from a previous
-                // bake, and cause a segfault when accessing glyphs[].
+                /* Need to zero this, or it will carry over from a previous
+                 * bake, and cause a segfault when accessing glyphs[]. */
                 dst_font->glyph_count = 0;
             }
 
@@ -2454,6 +2732,7 @@ nk_font_bake_convert(void *out_memory, int img_width, int img_height,
  *                          FONT
  *
  * --------------------------------------------------------------*/
+NK_INTERN const struct nk_font_glyph* nk_font_dynamic_find_locked(struct nk_font*, nk_rune);
 NK_INTERN float
 nk_font_text_width(nk_handle handle, float height, const char *text, int len)
 {
@@ -2465,7 +2744,7 @@ nk_font_text_width(nk_handle handle, float height, const char *text, int len)
 
     struct nk_font *font = (struct nk_font*)handle.ptr;
     NK_ASSERT(font);
-    NK_ASSERT(font->glyphs);
+    NK_ASSERT(font->glyphs || font->dynamic);
     if (!font || !text || !len)
         return 0;
 
@@ -2500,7 +2779,7 @@ nk_font_query_font_glyph(nk_handle handle, float height,
 
     font = (struct nk_font*)handle.ptr;
     NK_ASSERT(font);
-    NK_ASSERT(font->glyphs);
+    NK_ASSERT(font->glyphs || font->dynamic);
     if (!font || !glyph)
         return;
 
@@ -2524,6 +2803,8 @@ nk_font_find_glyph(struct nk_font *font, nk_rune unicode)
     const struct nk_font_config *iter = 0;
 
     NK_ASSERT(font);
+    if (font && font->dynamic)
+        return nk_font_dynamic_find_locked(font, unicode);
     NK_ASSERT(font->glyphs);
     NK_ASSERT(font->info.ranges);
     if (!font || !font->glyphs) return 0;
@@ -3159,14 +3440,141 @@ nk_font_atlas_add_default(struct nk_font_atlas *atlas,
         nk_proggy_clean_ttf_compressed_data_base85, pixel_height, config);
 }
 #endif
+NK_INTERN void
+nk_font_atlas_setup_cursors(struct nk_font_atlas *atlas)
+{
+    int i = 0;
+    {NK_STORAGE const struct nk_vec2 nk_cursor_data[NK_CURSOR_COUNT][3] = {
+        /* Pos      Size        Offset */
+        {{ 0, 3},   {12,19},    { 0, 0}},
+        {{13, 0},   { 7,16},    { 4, 8}},
+        {{31, 0},   {23,23},    {11,11}},
+        {{21, 0},   { 9, 23},   { 5,11}},
+        {{55,18},   {23, 9},    {11, 5}},
+        {{73, 0},   {17,17},    { 9, 9}},
+        {{55, 0},   {17,17},    { 9, 9}}
+    };
+    for (i = 0; i < NK_CURSOR_COUNT; ++i) {
+        struct nk_cursor *cursor = &atlas->cursors[i];
+        cursor->img.w = (unsigned short)atlas->tex_width;
+        cursor->img.h = (unsigned short)atlas->tex_height;
+        cursor->img.region[0] = (unsigned short)(atlas->custom.x + nk_cursor_data[i][0].x);
+        cursor->img.region[1] = (unsigned short)(atlas->custom.y + nk_cursor_data[i][0].y);
+        cursor->img.region[2] = (unsigned short)nk_cursor_data[i][1].x;
+        cursor->img.region[3] = (unsigned short)nk_cursor_data[i][1].y;
+        cursor->size = nk_cursor_data[i][1];
+        cursor->offset = nk_cursor_data[i][2];
+    }}
+}
+NK_INTERN void
+nk_font_atlas_setup(struct nk_font_atlas *atlas)
+{
+    struct nk_font *font_iter;
+
+    /* initialize each font */
+    for (font_iter = atlas->fonts; font_iter; font_iter = font_iter->next) {
+        struct nk_font *font = font_iter;
+        struct nk_font_config *config = font->config;
+        nk_font_init(font, config->size, config->fallback_glyph, atlas->glyphs,
+            config->font, nk_handle_ptr(0));
+    }
+    nk_font_atlas_setup_cursors(atlas);
+}
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+NK_API const void*
+nk_font_atlas_bake_default(struct nk_font_atlas *atlas, int *width, int *height,
+    enum nk_font_atlas_format fmt)
+{
+    int i;
+    nk_size pixel_count;
+    struct nk_font *font;
+    struct nk_font_config *config;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+
+    NK_ASSERT(width);
+    NK_ASSERT(height);
+    NK_ASSERT(!atlas->font_num);
+    if (!atlas || !width || !height || atlas->font_num ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+    /* add default font without any font data since glyphs are already baked */
+    config = (struct nk_font_config*)atlas->permanent.alloc(atlas->permanent.userdata,0, sizeof(*config));
+    NK_ASSERT(config);
+    if (!config) return 0;
+    *config = nk_font_config(13.0f);
+    config->range = nk_default_font_atlas_ranges;
+    config->n = config->p = config;
+    atlas->config = config;
+
+    font = (struct nk_font*)atlas->permanent.alloc(atlas->permanent.userdata,0, sizeof(*font));
+    NK_ASSERT(font);
+    if (!font) return 0;
+    nk_zero(font, sizeof(*font));
+    font->config = config;
+    config->font = &font->info;
+    atlas->fonts = font;
+    atlas->font_num = 1;
+    atlas->default_font = font;
+
+    font->info.height = nk_default_font_atlas_metrics[0];
+    font->info.ascent = nk_default_font_atlas_metrics[1];
+    font->info.descent = nk_default_font_atlas_metrics[2];
+    font->info.glyph_offset = 0;
+    font->info.glyph_count = NK_DEFAULT_FONT_ATLAS_GLYPHS;
+    font->info.ranges = config->range;
+
+    /* copy glyphs and expand palette indices into the atlas image */
+    atlas->glyph_count = NK_DEFAULT_FONT_ATLAS_GLYPHS;
+    atlas->glyphs = (struct nk_font_glyph*)atlas->permanent.alloc(
+        atlas->permanent.userdata,0, sizeof(nk_default_font_atlas_glyphs));
+    NK_ASSERT(atlas->glyphs);
+    if (!atlas->glyphs) return 0;
+    NK_MEMCPY(atlas->glyphs, nk_default_font_atlas_glyphs, sizeof(nk_default_font_atlas_glyphs));
+
+    pixel_count = (nk_size)NK_DEFAULT_FONT_ATLAS_WIDTH * (nk_size)NK_DEFAULT_FONT_ATLAS_HEIGHT;
+    atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0,
+        (fmt == NK_FONT_ATLAS_RGBA32) ? pixel_count * 4: pixel_count);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas->pixel) return 0;
+    if (fmt == NK_FONT_ATLAS_RGBA32) {
+        nk_rune *dst = (nk_rune*)atlas->pixel;
+        for (i = 0; i < (int)pixel_count; ++i) {
+            nk_uint index = (nk_default_font_atlas_pixels[i >> 4] >> ((i & 15) * 2)) & 3;
+            dst[i] = ((nk_rune)nk_default_font_atlas_palette[index] << 24) | 0x00FFFFFF;
+        }
+    } else {
+        nk_byte *dst = (nk_byte*)atlas->pixel;
+        for (i = 0; i < (int)pixel_count; ++i) {
+            nk_uint index = (nk_default_font_atlas_pixels[i >> 4] >> ((i & 15) * 2)) & 3;
+            dst[i] = nk_default_font_atlas_palette[index];
+        }
+    }
+    atlas->custom.x = nk_default_font_atlas_custom[0];
+    atlas->custom.y = nk_default_font_atlas_custom[1];
+    atlas->custom.w = nk_default_font_atlas_custom[2];
+    atlas->custom.h = nk_default_font_atlas_custom[3];
+    atlas->tex_width = *width = NK_DEFAULT_FONT_ATLAS_WIDTH;
+    atlas->tex_height = *height = NK_DEFAULT_FONT_ATLAS_HEIGHT;
+    atlas->used_pixels = NK_DEFAULT_FONT_ATLAS_USED;
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
+    return atlas->pixel;
+}
+#endif
 NK_API const void*
 nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
     enum nk_font_atlas_format fmt)
 {
-    int i = 0;
+    int i;
     void *tmp = 0;
     nk_size tmp_size, img_size;
-    struct nk_font *font_iter;
     struct nk_font_baker *baker;
 
     NK_ASSERT(atlas);
@@ -3182,13 +3590,18 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
         !atlas->permanent.alloc || !atlas->permanent.free)
         return 0;
 
-#ifdef NK_INCLUDE_DEFAULT_FONT
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+    /* no font added so just use the pre-baked default font */
+    if (!atlas->font_num)
+        return nk_font_atlas_bake_default(atlas, width, height, fmt);
+#elif defined(NK_INCLUDE_DEFAULT_FONT)
     /* no font added so just use default font */
     if (!atlas->font_num)
         atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
 #endif
     NK_ASSERT(atlas->font_num);
     if (!atlas->font_num) return 0;
+    NK_PROFILE_BEGIN(atlas->profiler, NK_PROFILE_FONT_BAKE);
 
     /* allocate temporary baker memory required for the baking process */
     nk_font_baker_memory(&tmp_size, &atlas->glyph_count, atlas->config, atlas->font_num);
@@ -3208,8 +3621,11 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
     atlas->custom.w = (NK_CURSOR_DATA_W*2)+1;
     atlas->custom.h = NK_CURSOR_DATA_H + 1;
     if (!nk_font_bake_pack(baker, &img_size, width, height, &atlas->custom,
-        atlas->config, atlas->font_num, &atlas->temporary))
+        atlas->config, atlas->font_num, atlas->packing, &atlas->temporary))
         goto failed;
+    atlas->used_pixels = (nk_size)atlas->custom.w * (nk_size)atlas->custom.h;
+    for (i = 0; i < atlas->glyph_count; ++i)
+        atlas->used_pixels += (nk_size)baker->rects[i].w * (nk_size)baker->rects[i].h;
 
     /* allocate memory for the baked image font atlas */
     atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0, img_size);
@@ -3235,39 +3651,12 @@ nk_font_atlas_bake(struct nk_font_atlas *atlas, int *width, int *height,
     }
     atlas->tex_width = *width;
     atlas->tex_height = *height;
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
 
-    /* initialize each font */
-    for (font_iter = atlas->fonts; font_iter; font_iter = font_iter->next) {
-        struct nk_font *font = font_iter;
-        struct nk_font_config *config = font->config;
-        nk_font_init(font, config->size, config->fallback_glyph, atlas->glyphs,
-            config->font, nk_handle_ptr(0));
-    }
-
-    /* initialize each cursor */
-    {NK_STORAGE const struct nk_vec2 nk_cursor_data[NK_CURSOR_COUNT][3] = {
-        /* Pos      Size        Offset */
-        {{ 0, 3},   {12,19},    { 0, 0}},
-        {{13, 0},   { 7,16},    { 4, 8}},
-        {{31, 0},   {23,23},    {11,11}},
-        {{21, 0},   { 9, 23},   { 5,11}},
-        {{55,18},   {23, 9},    {11, 5}},
-        {{73, 0},   {17,17},    { 9, 9}},
-        {{55, 0},   {17,17},    { 9, 9}}
-    };
-    for (i = 0; i < NK_CURSOR_COUNT; ++i) {
-        struct nk_cursor *cursor = &atlas->cursors[i];
-        cursor->img.w = (unsigned short)*width;
-        cursor->img.h = (unsigned short)*height;
-        cursor->img.region[0] = (unsigned short)(atlas->custom.x + nk_cursor_data[i][0].x);
-        cursor->img.region[1] = (unsigned short)(atlas->custom.y + nk_cursor_data[i][0].y);
-        cursor->img.region[2] = (unsigned short)nk_cursor_data[i][1].x;
-        cursor->img.region[3] = (unsigned short)nk_cursor_data[i][1].y;
-        cursor->size = nk_cursor_data[i][1];
-        cursor->offset = nk_cursor_data[i][2];
-    }}
     /* free temporary memory */
     atlas->temporary.free(atlas->temporary.userdata, tmp);
+    NK_PROFILE_END(atlas->profiler, NK_PROFILE_FONT_BAKE);
     return atlas->pixel;
 
 failed:
@@ -3281,8 +3670,894 @@ failed:
         atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
         atlas->pixel = 0;
     }
+    NK_PROFILE_END(atlas->profiler, NK_PROFILE_FONT_BAKE);
+    return 0;
+}
+NK_API int
+nk_font_atlas_get_stats(const struct nk_font_atlas *atlas,
+    struct nk_font_atlas_stats *stats)
+{
+    nk_size pixel_size;
+    NK_ASSERT(atlas);
+    NK_ASSERT(stats);
+    if (!stats) return 0;
+    nk_zero_struct(*stats);
+    if (!atlas || atlas->dynamic || !atlas->tex_width || !atlas->tex_height)
+        return 0;
+
+    pixel_size = (atlas->format == NK_FONT_ATLAS_RGBA32) ? 4: 1;
+    stats->width = atlas->tex_width;
+    stats->height = atlas->tex_height;
+    stats->texture_bytes = (nk_size)atlas->tex_width * (nk_size)atlas->tex_height * pixel_size;
+    stats->used_bytes = NK_MIN(atlas->used_pixels * pixel_size, stats->texture_bytes);
+    stats->wasted_bytes = stats->texture_bytes - stats->used_bytes;
+    stats->utilization = (float)stats->used_bytes / (float)stats->texture_bytes;
+    return 1;
+}
+/* -------------------------------------------------------------
+ *
+ *                          FONT ATLAS CACHE
+ *
+ * --------------------------------------------------------------*/
+/* Baked atlas blob layout, all values in native byte order:
+ *  header      nk_uint[NK_FONT_CACHE_HEADER]
+ *  fonts       nk_uint[5] (height, ascent, descent, glyph offset, glyph count)
+ *  ranges      nk_rune[] of each font config including zero terminator
+ *  glyphs      struct nk_font_glyph[glyph count]
+ *  pixels      nk_byte[width * height * (1 or 4)] */
+#define NK_FONT_CACHE_MAGIC 0x41464B4E
+#define NK_FONT_ATLAS_CACHE_VERSION 2
+enum nk_font_cache_header {
+    NK_FONT_CACHE_MAGIC_ID, NK_FONT_CACHE_VERSION_ID, NK_FONT_CACHE_HASH,
+    NK_FONT_CACHE_FORMAT, NK_FONT_CACHE_WIDTH, NK_FONT_CACHE_HEIGHT,
+    NK_FONT_CACHE_CUSTOM_X, NK_FONT_CACHE_CUSTOM_Y,
+    NK_FONT_CACHE_CUSTOM_W, NK_FONT_CACHE_CUSTOM_H,
+    NK_FONT_CACHE_FONTS, NK_FONT_CACHE_RANGES, NK_FONT_CACHE_GLYPHS,
+    NK_FONT_CACHE_USED, NK_FONT_CACHE_HEADER
+};
+NK_INTERN void
+nk_font_cache_layout(nk_size *offsets, int font_count, int range_count,
+    int glyph_count, int width, int height, enum nk_font_atlas_format fmt)
+{
+    /* offsets of fonts, ranges, glyphs, pixels and end of blob */
+    offsets[0] = sizeof(nk_uint) * NK_FONT_CACHE_HEADER;
+    offsets[1] = offsets[0] + sizeof(nk_uint) * 5 * (nk_size)font_count;
+    offsets[2] = offsets[1] + sizeof(nk_rune) * (nk_size)range_count;
+    offsets[3] = offsets[2] + sizeof(struct nk_font_glyph) * (nk_size)glyph_count;
+    offsets[4] = offsets[3] + (nk_size)width * (nk_size)height *
+        ((fmt == NK_FONT_ATLAS_RGBA32) ? 4: 1);
+}
+NK_INTERN int
+nk_font_cache_ranges(const struct nk_font_atlas *atlas)
+{
+    int count = 0;
+    const struct nk_font_config *iter, *it;
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {count += nk_range_count(it->range) * 2 + 1;
+        } while ((it = it->n) != iter);
+    }
+    return count;
+}
+NK_INTERN int
+nk_font_cache_glyphs(const struct nk_font_atlas *atlas)
+{
+    int count = 0;
+    const struct nk_font *font;
+    for (font = atlas->fonts; font; font = font->next)
+        count = NK_MAX(count, (int)(font->info.glyph_offset + font->info.glyph_count));
+    return count;
+}
+NK_API nk_hash
+nk_font_atlas_hash(const struct nk_font_atlas *atlas, enum nk_font_atlas_format fmt)
+{
+    nk_hash hash = NK_FONT_ATLAS_CACHE_VERSION;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    if (!atlas) return 0;
+    hash = nk_murmur_hash(&fmt, (int)sizeof(fmt), hash);
+    hash = nk_murmur_hash(&atlas->packing, (int)sizeof(atlas->packing), hash);
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {/* font data and every config value that changes the baked output */
+            hash = nk_murmur_hash(it->ttf_blob, (int)it->ttf_size, hash);
+            hash = nk_murmur_hash(&it->merge_mode, 1, hash);
+            hash = nk_murmur_hash(&it->pixel_snap, 1, hash);
+            hash = nk_murmur_hash(&it->oversample_v, 1, hash);
+            hash = nk_murmur_hash(&it->oversample_h, 1, hash);
+            hash = nk_murmur_hash(&it->sdf, 1, hash);
+            hash = nk_murmur_hash(&it->size, (int)sizeof(it->size), hash);
+            hash = nk_murmur_hash(&it->coord_type, (int)sizeof(it->coord_type), hash);
+            hash = nk_murmur_hash(&it->spacing, (int)sizeof(it->spacing), hash);
+            hash = nk_murmur_hash(&it->fallback_glyph, (int)sizeof(it->fallback_glyph), hash);
+            hash = nk_murmur_hash(it->range, (int)sizeof(nk_rune) *
+                (nk_range_count(it->range) * 2 + 1), hash);
+        } while ((it = it->n) != iter);
+    }
+    return hash;
+}
+NK_API nk_size
+nk_font_atlas_save(const struct nk_font_atlas *atlas, void *memory, nk_size size)
+{
+    int i = 0;
+    nk_uint header[NK_FONT_CACHE_HEADER];
+    nk_size offsets[5];
+    int font_count = 0;
+    int range_count;
+    int glyph_count;
+    nk_byte *dst = (nk_byte*)memory;
+    const struct nk_font *font;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas || !atlas->pixel || !atlas->glyphs) return 0;
+
+    for (font = atlas->fonts; font; font = font->next)
+        font_count++;
+    range_count = nk_font_cache_ranges(atlas);
+    glyph_count = nk_font_cache_glyphs(atlas);
+    nk_font_cache_layout(offsets, font_count, range_count, glyph_count,
+        atlas->tex_width, atlas->tex_height, atlas->format);
+    if (!memory || size < offsets[4])
+        return offsets[4];
+
+    header[NK_FONT_CACHE_MAGIC_ID] = NK_FONT_CACHE_MAGIC;
+    header[NK_FONT_CACHE_VERSION_ID] = NK_FONT_ATLAS_CACHE_VERSION;
+    header[NK_FONT_CACHE_HASH] = nk_font_atlas_hash(atlas, atlas->format);
+    header[NK_FONT_CACHE_FORMAT] = (nk_uint)atlas->format;
+    header[NK_FONT_CACHE_WIDTH] = (nk_uint)atlas->tex_width;
+    header[NK_FONT_CACHE_HEIGHT] = (nk_uint)atlas->tex_height;
+    header[NK_FONT_CACHE_CUSTOM_X] = (nk_uint)atlas->custom.x;
+    header[NK_FONT_CACHE_CUSTOM_Y] = (nk_uint)atlas->custom.y;
+    header[NK_FONT_CACHE_CUSTOM_W] = (nk_uint)atlas->custom.w;
+    header[NK_FONT_CACHE_CUSTOM_H] = (nk_uint)atlas->custom.h;
+    header[NK_FONT_CACHE_FONTS] = (nk_uint)font_count;
+    header[NK_FONT_CACHE_RANGES] = (nk_uint)range_count;
+    header[NK_FONT_CACHE_GLYPHS] = (nk_uint)glyph_count;
+    header[NK_FONT_CACHE_USED] = (nk_uint)atlas->used_pixels;
+    NK_MEMCPY(dst, header, sizeof(header));
+
+    for (font = atlas->fonts; font; font = font->next, ++i) {
+        nk_uint info[5];
+        NK_MEMCPY(&info[0], &font->info.height, sizeof(nk_uint));
+        NK_MEMCPY(&info[1], &font->info.ascent, sizeof(nk_uint));
+        NK_MEMCPY(&info[2], &font->info.descent, sizeof(nk_uint));
+        info[3] = font->info.glyph_offset;
+        info[4] = font->info.glyph_count;
+        NK_MEMCPY(dst + offsets[0] + sizeof(info) * (nk_size)i, info, sizeof(info));
+    }
+    dst += offsets[1];
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {nk_size n = sizeof(nk_rune) * (nk_size)(nk_range_count(it->range) * 2 + 1);
+            NK_MEMCPY(dst, it->range, n);
+            dst += n;
+        } while ((it = it->n) != iter);
+    }
+    dst = (nk_byte*)memory;
+    NK_MEMCPY(dst + offsets[2], atlas->glyphs, offsets[3] - offsets[2]);
+    NK_MEMCPY(dst + offsets[3], atlas->pixel, offsets[4] - offsets[3]);
+    return offsets[4];
+}
+NK_API const void*
+nk_font_atlas_load(struct nk_font_atlas *atlas, const void *memory, nk_size size,
+    int *width, int *height, enum nk_font_atlas_format fmt)
+{
+    int i = 0;
+    nk_uint header[NK_FONT_CACHE_HEADER];
+    nk_size offsets[5];
+    int font_count = 0;
+    const nk_byte *src = (const nk_byte*)memory;
+    struct nk_font *font;
+    const struct nk_font_config *iter, *it;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+
+    NK_ASSERT(width);
+    NK_ASSERT(height);
+    if (!atlas || !width || !height || !memory ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+#ifdef NK_INCLUDE_DEFAULT_FONT
+    /* no font added so just use default font */
+    if (!atlas->font_num)
+        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
+#endif
+    if (!atlas->font_num || size < sizeof(header)) return 0;
+
+    /* validate blob against currently added fonts */
+    NK_MEMCPY(header, src, sizeof(header));
+    for (font = atlas->fonts; font; font = font->next)
+        font_count++;
+    if (header[NK_FONT_CACHE_MAGIC_ID] != NK_FONT_CACHE_MAGIC ||
+        header[NK_FONT_CACHE_VERSION_ID] != NK_FONT_ATLAS_CACHE_VERSION ||
+        header[NK_FONT_CACHE_FORMAT] != (nk_uint)fmt ||
+        header[NK_FONT_CACHE_FONTS] != (nk_uint)font_count ||
+        header[NK_FONT_CACHE_RANGES] != (nk_uint)nk_font_cache_ranges(atlas) ||
+        header[NK_FONT_CACHE_HASH] != nk_font_atlas_hash(atlas, fmt))
+        return 0;
+    nk_font_cache_layout(offsets, font_count, (int)header[NK_FONT_CACHE_RANGES],
+        (int)header[NK_FONT_CACHE_GLYPHS], (int)header[NK_FONT_CACHE_WIDTH],
+        (int)header[NK_FONT_CACHE_HEIGHT], fmt);
+    if (size < offsets[4]) return 0;
+    {const nk_byte *ranges = src + offsets[1];
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {int n = nk_range_count(it->range) * 2 + 1;
+            int j;
+            for (j = 0; j < n; ++j) {
+                nk_rune r;
+                NK_MEMCPY(&r, ranges, sizeof(r));
+                if (r != it->range[j]) return 0;
+                ranges += sizeof(r);
+            }
+        } while ((it = it->n) != iter);
+    }}
+
+    /* glyph ranges of each font and the custom rectangle have to lie inside
+     * the glyphs and texture of the blob */
+    for (i = 0; i < font_count; ++i) {
+        nk_uint info[5];
+        NK_MEMCPY(info, src + offsets[0] + sizeof(info) * (nk_size)i, sizeof(info));
+        if (info[3] > header[NK_FONT_CACHE_GLYPHS] ||
+            info[4] > header[NK_FONT_CACHE_GLYPHS] - info[3])
+            return 0;
+    }
+    if (header[NK_FONT_CACHE_CUSTOM_X] > header[NK_FONT_CACHE_WIDTH] ||
+        header[NK_FONT_CACHE_CUSTOM_W] > header[NK_FONT_CACHE_WIDTH] - header[NK_FONT_CACHE_CUSTOM_X] ||
+        header[NK_FONT_CACHE_CUSTOM_Y] > header[NK_FONT_CACHE_HEIGHT] ||
+        header[NK_FONT_CACHE_CUSTOM_H] > header[NK_FONT_CACHE_HEIGHT] - header[NK_FONT_CACHE_CUSTOM_Y])
+        return 0;
+
+    /* replace glyphs and pixels of an earlier bake or load */
+    if (atlas->glyphs) {
+        atlas->permanent.free(atlas->permanent.userdata, atlas->glyphs);
+        atlas->glyphs = 0;
+    }
+    if (atlas->pixel) {
+        atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
+        atlas->pixel = 0;
+    }
+
+    /* copy glyphs and pixels into the same memory as baking would */
+    atlas->glyph_count = (int)header[NK_FONT_CACHE_GLYPHS];
+    atlas->glyphs = (struct nk_font_glyph*)atlas->permanent.alloc(atlas->permanent.userdata,0,
+        NK_MAX(offsets[3] - offsets[2], sizeof(struct nk_font_glyph)));
+    NK_ASSERT(atlas->glyphs);
+    if (!atlas->glyphs) return 0;
+    atlas->pixel = atlas->temporary.alloc(atlas->temporary.userdata,0, offsets[4] - offsets[3]);
+    NK_ASSERT(atlas->pixel);
+    if (!atlas->pixel) {
+        atlas->permanent.free(atlas->permanent.userdata, atlas->glyphs);
+        atlas->glyphs = 0;
+        return 0;
+    }
+    NK_MEMCPY(atlas->glyphs, src + offsets[2], offsets[3] - offsets[2]);
+    NK_MEMCPY(atlas->pixel, src + offsets[3], offsets[4] - offsets[3]);
+
+    for (i = 0, font = atlas->fonts; font; font = font->next, ++i) {
+        nk_uint info[5];
+        struct nk_baked_font *baked = font->config->font;
+        NK_MEMCPY(info, src + offsets[0] + sizeof(info) * (nk_size)i, sizeof(info));
+        NK_MEMCPY(&baked->height, &info[0], sizeof(nk_uint));
+        NK_MEMCPY(&baked->ascent, &info[1], sizeof(nk_uint));
+        NK_MEMCPY(&baked->descent, &info[2], sizeof(nk_uint));
+        baked->glyph_offset = info[3];
+        baked->glyph_count = info[4];
+        baked->ranges = font->config->range;
+    }
+    atlas->custom.x = (short)header[NK_FONT_CACHE_CUSTOM_X];
+    atlas->custom.y = (short)header[NK_FONT_CACHE_CUSTOM_Y];
+    atlas->custom.w = (short)header[NK_FONT_CACHE_CUSTOM_W];
+    atlas->custom.h = (short)header[NK_FONT_CACHE_CUSTOM_H];
+    atlas->tex_width = *width = (int)header[NK_FONT_CACHE_WIDTH];
+    atlas->tex_height = *height = (int)header[NK_FONT_CACHE_HEIGHT];
+    atlas->used_pixels = (nk_size)header[NK_FONT_CACHE_USED];
+    atlas->format = fmt;
+    nk_font_atlas_setup(atlas);
+    return atlas->pixel;
+}
+#ifdef NK_INCLUDE_STANDARD_IO
+NK_API int
+nk_font_atlas_save_to_file(const struct nk_font_atlas *atlas, const char *file_path)
+{
+    FILE *fd;
+    void *memory;
+    nk_size size;
+    int ret;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(file_path);
+    if (!atlas || !file_path) return 0;
+    size = nk_font_atlas_save(atlas, 0, 0);
+    if (!size) return 0;
+    memory = atlas->temporary.alloc(atlas->temporary.userdata,0, size);
+    NK_ASSERT(memory);
+    if (!memory) return 0;
+    nk_font_atlas_save(atlas, memory, size);
+
+    fd = fopen(file_path, "wb");
+    ret = fd && fwrite(memory, 1, size, fd) == size;
+    if (fd && fclose(fd)) ret = 0;
+    atlas->temporary.free(atlas->temporary.userdata, memory);
+    return ret;
+}
+NK_API const void*
+nk_font_atlas_load_from_file(struct nk_font_atlas *atlas, const char *file_path,
+    int *width, int *height, enum nk_font_atlas_format fmt)
+{
+    nk_size size;
+    char *memory;
+    const void *pixel;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(file_path);
+    if (!atlas || !file_path) return 0;
+    memory = nk_file_load(file_path, &size, &atlas->temporary);
+    if (!memory) return 0;
+    pixel = nk_font_atlas_load(atlas, memory, size, width, height, fmt);
+    atlas->temporary.free(atlas->temporary.userdata, memory);
+    return pixel;
+}
+#endif
+
+/* -------------------------------------------------------------
+ *
+ *                          DYNAMIC GLYPHS
+ *
+ * --------------------------------------------------------------*/
+/* The dynamic atlas texture is split into horizontal pages each packed with
+ * its own skyline. Glyphs are rasterized on first use. Texture space is
+ * reclaimed a page at a time starting with the least recently used page,
+ * while running out of glyph slots only evicts the least recently used glyph.
+ * Glyphs used in the current frame are never evicted. Cached glyphs are kept
+ * in a list ordered by last use and removed from the open addressing table by
+ * shifting following entries back, so eviction never rebuilds the table. */
+struct nk_font_dynamic_source {
+    const struct nk_font_config *config;
+    struct nk_tt_fontinfo info;
+};
+struct nk_font_dynamic_glyph {
+    struct nk_font_glyph glyph;
+    const struct nk_font *font;
+    unsigned int used;
+    int page;
+    int failed;
+    int prev, next;
+};
+struct nk_font_dynamic_page {
+    struct nk_rp_context pack;
+    struct nk_rp_node *nodes;
+    int y, h;
+    int rect_count;
+    unsigned int used;
+    int dirty;
+    int dirty_x0, dirty_y0, dirty_x1, dirty_y1;
+};
+struct nk_font_dynamic {
+    struct nk_font_atlas *atlas;
+    struct nk_font_dynamic_source *sources;
+    int source_count;
+    struct nk_font_dynamic_glyph *glyphs;
+    int glyph_capacity;
+    int glyph_count;
+    int free_list;
+    int lru_first, lru_last;
+    int *table;
+    int table_size;
+    struct nk_font_dynamic_page pages[NK_FONT_DYNAMIC_PAGES];
+    nk_byte *alpha;
+    unsigned int frame;
+    struct nk_font_glyph empty;
+};
+NK_INTERN nk_hash
+nk_font_dynamic_hash(const struct nk_font *font, nk_rune unicode)
+{
+    return ((nk_hash)unicode * 2654435761u) ^ (nk_hash)((nk_ptr)font >> 4);
+}
+NK_INTERN void
+nk_font_dynamic_mark(struct nk_font_dynamic_page *page, int x, int y, int w, int h)
+{
+    if (!page->dirty) {
+        page->dirty_x0 = x; page->dirty_y0 = y;
+        page->dirty_x1 = x + w; page->dirty_y1 = y + h;
+        page->dirty = nk_true;
+    } else {
+        page->dirty_x0 = NK_MIN(page->dirty_x0, x);
+        page->dirty_y0 = NK_MIN(page->dirty_y0, y);
+        page->dirty_x1 = NK_MAX(page->dirty_x1, x + w);
+        page->dirty_y1 = NK_MAX(page->dirty_y1, y + h);
+    }
+}
+NK_INTERN void
+nk_font_dynamic_upload(struct nk_font_dynamic *dyn, int x, int y, int w, int h)
+{
+    /* copy rasterized alpha values into the rgba texture */
+    int i, j;
+    struct nk_font_atlas *atlas = dyn->atlas;
+    if (atlas->format != NK_FONT_ATLAS_RGBA32) return;
+    for (j = y; j < y + h; ++j) {
+        nk_rune *dst = (nk_rune*)atlas->pixel + j * atlas->tex_width + x;
+        const nk_byte *src = dyn->alpha + j * atlas->tex_width + x;
+        for (i = 0; i < w; ++i)
+            *dst++ = ((nk_rune)(*src++) << 24) | 0x00FFFFFF;
+    }
+}
+NK_INTERN void
+nk_font_dynamic_reset_page(struct nk_font_dynamic *dyn, int index)
+{
+    struct nk_font_atlas *atlas = dyn->atlas;
+    struct nk_font_dynamic_page *page = &dyn->pages[index];
+    int width = atlas->tex_width;
+
+    page->rect_count = 0;
+    NK_MEMSET(dyn->alpha + page->y * width, 0, (nk_size)(page->h * width));
+    nk_rp_init_target(&page->pack, width - 1, page->h - 1, page->nodes, width - 1);
+    if (index == 0) {
+        /* custom cursor data always stays in the upper left corner */
+        struct nk_rp_rect custom;
+        nk_zero(&custom, sizeof(custom));
+        custom.w = (nk_rp_coord)atlas->custom.w;
+        custom.h = (nk_rp_coord)atlas->custom.h;
+        nk_rp_pack_rects(&page->pack, &custom, 1);
+        atlas->custom.x = (short)custom.x;
+        atlas->custom.y = (short)custom.y;
+        nk_font_bake_custom_data(dyn->alpha, width, atlas->tex_height, atlas->custom,
+            nk_custom_cursor_data, NK_CURSOR_DATA_W, NK_CURSOR_DATA_H, '.', 'X');
+    }
+    nk_font_dynamic_upload(dyn, 0, page->y, width, page->h);
+    nk_font_dynamic_mark(page, 0, page->y, width, page->h);
+}
+NK_INTERN void
+nk_font_dynamic_insert(struct nk_font_dynamic *dyn, int slot)
+{
+    const struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_hash i = nk_font_dynamic_hash(g->font, g->glyph.codepoint);
+    nk_hash mask = (nk_hash)dyn->table_size - 1;
+    while (dyn->table[i & mask] >= 0) i++;
+    dyn->table[i & mask] = slot;
+}
+NK_INTERN void
+nk_font_dynamic_erase(struct nk_font_dynamic *dyn, int slot)
+{
+    const struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_hash mask = (nk_hash)dyn->table_size - 1;
+    nk_hash hole = nk_font_dynamic_hash(g->font, g->glyph.codepoint) & mask;
+    nk_hash i;
+    while (dyn->table[hole] != slot)
+        hole = (hole + 1) & mask;
+
+    /* move following entries of the probe sequence back into the hole unless
+     * their own hash position lies between the hole and their position */
+    for (i = (hole + 1) & mask; dyn->table[i] >= 0; i = (i + 1) & mask) {
+        const struct nk_font_dynamic_glyph *o = &dyn->glyphs[dyn->table[i]];
+        nk_hash home = nk_font_dynamic_hash(o->font, o->glyph.codepoint) & mask;
+        if (((i - home) & mask) < ((i - hole) & mask)) continue;
+        dyn->table[hole] = dyn->table[i];
+        hole = i;
+    }
+    dyn->table[hole] = -1;
+}
+NK_INTERN void
+nk_font_dynamic_unlink(struct nk_font_dynamic *dyn, int slot)
+{
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    if (g->prev >= 0) dyn->glyphs[g->prev].next = g->next;
+    else dyn->lru_first = g->next;
+    if (g->next >= 0) dyn->glyphs[g->next].prev = g->prev;
+    else dyn->lru_last = g->prev;
+}
+NK_INTERN void
+nk_font_dynamic_append(struct nk_font_dynamic *dyn, int slot)
+{
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    g->prev = dyn->lru_last;
+    g->next = -1;
+    if (dyn->lru_last >= 0) dyn->glyphs[dyn->lru_last].next = slot;
+    else dyn->lru_first = slot;
+    dyn->lru_last = slot;
+}
+NK_INTERN void
+nk_font_dynamic_touch(struct nk_font_dynamic *dyn, int slot)
+{
+    /* glyphs used in the current frame end up behind all others */
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    g->used = dyn->frame;
+    dyn->pages[g->page].used = dyn->frame;
+    if (dyn->lru_last == slot) return;
+    nk_font_dynamic_unlink(dyn, slot);
+    nk_font_dynamic_append(dyn, slot);
+}
+NK_INTERN void
+nk_font_dynamic_remove(struct nk_font_dynamic *dyn, int slot)
+{
+    /* glyph pixels stay until their page is reused */
+    struct nk_font_dynamic_glyph *g = &dyn->glyphs[slot];
+    nk_font_dynamic_erase(dyn, slot);
+    nk_font_dynamic_unlink(dyn, slot);
+    g->page = -1;
+    g->prev = -1;
+    g->next = dyn->free_list;
+    dyn->free_list = slot;
+    dyn->glyph_count--;
+}
+NK_INTERN int
+nk_font_dynamic_evict(struct nk_font_dynamic *dyn)
+{
+    int i, next, page = -1;
+    /* never evict glyphs already handed out during the current frame */
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        if (dyn->pages[i].used == dyn->frame || !dyn->pages[i].rect_count) continue;
+        if (page < 0 || dyn->pages[i].used < dyn->pages[page].used)
+            page = i;
+    }
+    if (page < 0) return -1;
+    for (i = dyn->lru_first; i >= 0; i = next) {
+        next = dyn->glyphs[i].next;
+        if (dyn->glyphs[i].page == page)
+            nk_font_dynamic_remove(dyn, i);
+    }
+    nk_font_dynamic_reset_page(dyn, page);
+    return page;
+}
+NK_INTERN int
+nk_font_dynamic_evict_glyph(struct nk_font_dynamic *dyn)
+{
+    int slot = dyn->lru_first;
+    if (slot < 0 || dyn->glyphs[slot].used == dyn->frame)
+        return nk_false;
+    nk_font_dynamic_remove(dyn, slot);
+    return nk_true;
+}
+NK_INTERN const struct nk_font_dynamic_source*
+nk_font_dynamic_source_for(const struct nk_font_dynamic *dyn,
+    const struct nk_font *font, nk_rune unicode)
+{
+    int i, j;
+    const struct nk_font_config *iter = font->config;
+    do {const nk_rune *range = iter->range;
+        for (i = 0; range[i] && range[i+1]; i += 2) {
+            if (unicode < range[i] || unicode > range[i+1]) continue;
+            for (j = 0; j < dyn->source_count; ++j)
+                if (dyn->sources[j].config == iter)
+                    return &dyn->sources[j];
+        }
+    } while ((iter = iter->n) != font->config);
     return 0;
 }
+NK_INTERN int
+nk_font_dynamic_rasterize(struct nk_font_dynamic *dyn, const struct nk_font *font,
+    const struct nk_font_dynamic_source *src, nk_rune unicode,
+    struct nk_font_glyph *glyph, int *packed)
+{
+    int i, page = -1;
+    float dummy_x = 0, dummy_y = 0;
+    struct nk_font_atlas *atlas = dyn->atlas;
+    const struct nk_font_config *cfg = src->config;
+    struct nk_tt_pack_context spc;
+    struct nk_tt_pack_range range;
+    struct nk_tt_packedchar pc;
+    struct nk_tt_aligned_quad q;
+    struct nk_rp_rect rect;
+
+    nk_zero(&spc, sizeof(spc));
+    spc.width = atlas->tex_width;
+    spc.height = atlas->tex_height;
+    spc.stride_in_bytes = atlas->tex_width;
+    spc.padding = 1;
+    spc.pixels = dyn->alpha;
+    nk_font_bake_mode(&spc, cfg);
+
+    nk_zero(&range, sizeof(range));
+    nk_zero(&pc, sizeof(pc));
+    nk_zero(&rect, sizeof(rect));
+    range.font_size = cfg->size;
+    range.first_unicode_codepoint_in_range = (int)unicode;
+    range.num_chars = 1;
+    range.chardata_for_range = &pc;
+    nk_tt_PackFontRangesGatherRects(&spc, (struct nk_tt_fontinfo*)&src->info, &range, 1, &rect);
+
+    /* pack into any page with free skyline space or evict the oldest page */
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES && page < 0; ++i) {
+        nk_rp_pack_rects(&dyn->pages[i].pack, &rect, 1);
+        if (rect.was_packed) page = i;
+    }
+    while (page < 0) {
+        i = nk_font_dynamic_evict(dyn);
+        if (i < 0) return nk_false;
+        nk_rp_pack_rects(&dyn->pages[i].pack, &rect, 1);
+        if (rect.was_packed) page = i;
+    }
+    *packed = page;
+    rect.y = (nk_rp_coord)(rect.y + dyn->pages[page].y);
+    nk_tt_PackFontRangesRenderIntoRects(&spc, (struct nk_tt_fontinfo*)&src->info,
+        &range, 1, &rect, &atlas->temporary);
+    if (!pc.x0 && !pc.x1 && !pc.y0 && !pc.y1) return nk_false;
+    dyn->pages[page].rect_count++;
+    nk_font_dynamic_upload(dyn, rect.x, rect.y, rect.w, rect.h);
+    nk_font_dynamic_mark(&dyn->pages[page], rect.x, rect.y, rect.w, rect.h);
+
+    /* same glyph setup as the static baker */
+    nk_tt_GetPackedQuad(&pc, atlas->tex_width, atlas->tex_height, 0, &dummy_x, &dummy_y, &q, 0);
+    glyph->codepoint = unicode;
+    glyph->x0 = q.x0; glyph->y0 = q.y0;
+    glyph->x1 = q.x1; glyph->y1 = q.y1;
+    glyph->y0 += (font->info.ascent + 0.5f);
+    glyph->y1 += (font->info.ascent + 0.5f);
+    glyph->w = glyph->x1 - glyph->x0 + 0.5f;
+    glyph->h = glyph->y1 - glyph->y0;
+    if (cfg->coord_type == NK_COORD_PIXEL) {
+        glyph->u0 = q.s0 * (float)atlas->tex_width;
+        glyph->v0 = q.t0 * (float)atlas->tex_height;
+        glyph->u1 = q.s1 * (float)atlas->tex_width;
+        glyph->v1 = q.t1 * (float)atlas->tex_height;
+    } else {
+        glyph->u0 = q.s0;
+        glyph->v0 = q.t0;
+        glyph->u1 = q.s1;
+        glyph->v1 = q.t1;
+    }
+    glyph->xadvance = (pc.xadvance + cfg->spacing.x);
+    if (cfg->pixel_snap)
+        glyph->xadvance = (float)(int)(glyph->xadvance + 0.5f);
+    return nk_true;
+}
+NK_INTERN const struct nk_font_glyph*
+nk_font_dynamic_find(struct nk_font *font, nk_rune unicode, int fallback)
+{
+    int slot, page = -1, rendered;
+    nk_hash i, mask;
+    struct nk_font_dynamic_glyph *g;
+    struct nk_font_dynamic *dyn = font->dynamic;
+    const struct nk_font_dynamic_source *src;
+
+    /* look up cached glyph */
+    mask = (nk_hash)dyn->table_size - 1;
+    for (i = nk_font_dynamic_hash(font, unicode); dyn->table[i & mask] >= 0; ++i) {
+        g = &dyn->glyphs[dyn->table[i & mask]];
+        if (g->font == font && g->glyph.codepoint == unicode) {
+            nk_font_dynamic_touch(dyn, dyn->table[i & mask]);
+            return (g->failed) ? &dyn->empty: &g->glyph;
+        }
+    }
+
+    /* rasterize glyph on first use */
+    src = nk_font_dynamic_source_for(dyn, font, unicode);
+    if (!src) return (fallback && font->fallback_codepoint != unicode) ?
+        nk_font_dynamic_find(font, font->fallback_codepoint, 0): &dyn->empty;
+    if (dyn->free_list < 0 && !nk_font_dynamic_evict_glyph(dyn))
+        return &dyn->empty;
+
+    slot = dyn->free_list;
+    g = &dyn->glyphs[slot];
+    dyn->free_list = g->next;
+    NK_PROFILE_BEGIN(dyn->atlas->profiler, NK_PROFILE_FONT_BAKE);
+    rendered = nk_font_dynamic_rasterize(dyn, font, src, unicode, &g->glyph, &page);
+    NK_PROFILE_END(dyn->atlas->profiler, NK_PROFILE_FONT_BAKE);
+    if (page < 0) {
+        /* no texture space left in this frame so try again later */
+        g->next = dyn->free_list;
+        dyn->free_list = slot;
+        return &dyn->empty;
+    }
+    /* glyphs without pixels are cached as well so their skyline space is
+     * only taken once until the page is reused */
+    if (!rendered) g->glyph = dyn->empty;
+    g->glyph.codepoint = unicode;
+    g->failed = !rendered;
+    g->font = font;
+    g->page = page;
+    dyn->glyph_count++;
+    nk_font_dynamic_append(dyn, slot);
+    nk_font_dynamic_touch(dyn, slot);
+    nk_font_dynamic_insert(dyn, slot);
+    return (g->failed) ? &dyn->empty: &g->glyph;
+}
+NK_INTERN const struct nk_font_glyph*
+nk_font_dynamic_find_locked(struct nk_font *font, nk_rune unicode)
+{
+    const struct nk_font_glyph *glyph;
+    struct nk_font_atlas *atlas = font->dynamic->atlas;
+    if (atlas->lock) atlas->lock(atlas->lock_userdata);
+    glyph = nk_font_dynamic_find(font, unicode, nk_true);
+    if (atlas->unlock) atlas->unlock(atlas->lock_userdata);
+    return glyph;
+}
+/* -------------------------------------------------------------
+ *
+ *                          DYNAMIC FONT ATLAS
+ *
+ * --------------------------------------------------------------*/
+NK_INTERN void
+nk_font_dynamic_free(struct nk_font_atlas *atlas)
+{
+    int i;
+    struct nk_font_dynamic *dyn = atlas->dynamic;
+    struct nk_allocator *a = &atlas->permanent;
+    if (!dyn) return;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i)
+        if (dyn->pages[i].nodes) a->free(a->userdata, dyn->pages[i].nodes);
+    if (dyn->sources) a->free(a->userdata, dyn->sources);
+    if (dyn->glyphs) a->free(a->userdata, dyn->glyphs);
+    if (dyn->table) a->free(a->userdata, dyn->table);
+    if (dyn->alpha && dyn->alpha != atlas->pixel) a->free(a->userdata, dyn->alpha);
+    if (atlas->pixel) a->free(a->userdata, atlas->pixel);
+    a->free(a->userdata, dyn);
+    atlas->pixel = 0;
+    atlas->dynamic = 0;
+}
+NK_API const void*
+nk_font_atlas_bake_dynamic(struct nk_font_atlas *atlas, int width, int height,
+    int glyph_capacity, enum nk_font_atlas_format fmt)
+{
+    int i = 0;
+    nk_size pixel_size;
+    struct nk_allocator *a;
+    struct nk_font *font;
+    struct nk_font_config *iter, *it;
+    struct nk_font_dynamic *dyn;
+
+    NK_ASSERT(atlas);
+    NK_ASSERT(atlas->temporary.alloc);
+    NK_ASSERT(atlas->temporary.free);
+    NK_ASSERT(atlas->permanent.alloc);
+    NK_ASSERT(atlas->permanent.free);
+    NK_ASSERT(height >= NK_FONT_DYNAMIC_PAGES * (NK_CURSOR_DATA_H + 2));
+    if (!atlas || width <= 0 || glyph_capacity <= 0 || width > 0xffff || height > 0xffff ||
+        height < NK_FONT_DYNAMIC_PAGES * (NK_CURSOR_DATA_H + 2) ||
+        !atlas->temporary.alloc || !atlas->temporary.free ||
+        !atlas->permanent.alloc || !atlas->permanent.free)
+        return 0;
+
+#ifdef NK_INCLUDE_DEFAULT_FONT
+    /* no font added so just use default font */
+    if (!atlas->font_num)
+        atlas->default_font = nk_font_atlas_add_default(atlas, 13.0f, 0);
+#endif
+    NK_ASSERT(atlas->font_num);
+    if (!atlas->font_num) return 0;
+    nk_font_dynamic_free(atlas);
+
+    /* allocate persistent glyph cache, pages and texture memory */
+    a = &atlas->permanent;
+    dyn = (struct nk_font_dynamic*)a->alloc(a->userdata,0, sizeof(*dyn));
+    NK_ASSERT(dyn);
+    if (!dyn) return 0;
+    nk_zero(dyn, sizeof(*dyn));
+    atlas->dynamic = dyn;
+    dyn->atlas = atlas;
+    dyn->frame = 1;
+    dyn->free_list = -1;
+    dyn->lru_first = dyn->lru_last = -1;
+    dyn->glyph_capacity = glyph_capacity;
+    dyn->table_size = (int)nk_round_up_pow2((nk_uint)glyph_capacity * 2);
+    dyn->source_count = atlas->font_num;
+    pixel_size = (nk_size)width * (nk_size)height;
+    dyn->sources = (struct nk_font_dynamic_source*)a->alloc(a->userdata,0,
+        sizeof(struct nk_font_dynamic_source) * (nk_size)atlas->font_num);
+    dyn->glyphs = (struct nk_font_dynamic_glyph*)a->alloc(a->userdata,0,
+        sizeof(struct nk_font_dynamic_glyph) * (nk_size)glyph_capacity);
+    dyn->table = (int*)a->alloc(a->userdata,0, sizeof(int) * (nk_size)dyn->table_size);
+    atlas->pixel = a->alloc(a->userdata,0, (fmt == NK_FONT_ATLAS_RGBA32) ? pixel_size * 4: pixel_size);
+    dyn->alpha = (fmt == NK_FONT_ATLAS_RGBA32) ?
+        (nk_byte*)a->alloc(a->userdata,0, pixel_size): (nk_byte*)atlas->pixel;
+    if (!dyn->sources || !dyn->glyphs || !dyn->table || !atlas->pixel || !dyn->alpha)
+        goto failed;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        dyn->pages[i].nodes = (struct nk_rp_node*)a->alloc(a->userdata,0,
+            sizeof(struct nk_rp_node) * (nk_size)width);
+        if (!dyn->pages[i].nodes) goto failed;
+    }
+    for (i = 0; i < glyph_capacity; ++i) {
+        dyn->glyphs[i].page = -1;
+        dyn->glyphs[i].next = dyn->free_list;
+        dyn->free_list = i;
+    }
+    for (i = 0; i < dyn->table_size; ++i)
+        dyn->table[i] = -1;
+
+    /* parse all fonts once and keep them around for rasterization */
+    i = 0;
+    for (iter = atlas->config; iter; iter = iter->next) {
+        it = iter;
+        do {if (!it->range) it->range = nk_font_default_glyph_ranges();
+            dyn->sources[i].config = it;
+            if (!nk_tt_InitFont(&dyn->sources[i++].info, (const unsigned char*)it->ttf_blob, 0))
+                goto failed;
+        } while ((it = it->n) != iter);
+    }
+
+    /* split texture into pages */
+    atlas->tex_width = width;
+    atlas->tex_height = height;
+    atlas->format = fmt;
+    atlas->custom.w = (NK_CURSOR_DATA_W*2)+1;
+    atlas->custom.h = NK_CURSOR_DATA_H + 1;
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        dyn->pages[i].y = (height / NK_FONT_DYNAMIC_PAGES) * i;
+        dyn->pages[i].h = (i == NK_FONT_DYNAMIC_PAGES-1) ?
+            height - dyn->pages[i].y: height / NK_FONT_DYNAMIC_PAGES;
+        nk_font_dynamic_reset_page(dyn, i);
+    }
+
+    /* initialize fonts without any glyphs */
+    for (font = atlas->fonts; font; font = font->next) {
+        struct nk_font_config *config = font->config;
+        const struct nk_font_dynamic_source *src = 0;
+        int ascent, descent, line_gap;
+        float scale;
+        for (i = 0; i < dyn->source_count; ++i)
+            if (dyn->sources[i].config == config) src = &dyn->sources[i];
+        NK_ASSERT(src);
+        if (!src) goto failed;
+
+        scale = nk_tt_ScaleForPixelHeight(&src->info, config->size);
+        nk_tt_GetFontVMetrics(&src->info, &ascent, &descent, &line_gap);
+        config->font->ranges = config->range;
+        config->font->height = config->size;
+        config->font->ascent = (float)ascent * scale;
+        config->font->descent = (float)descent * scale;
+        config->font->glyph_offset = 0;
+        config->font->glyph_count = 0;
+        font->dynamic = dyn;
+        nk_font_init(font, config->size, config->fallback_glyph, &dyn->empty,
+            config->font, nk_handle_ptr(0));
+        font->glyphs = 0;
+        font->fallback = 0;
+    }
+    nk_font_atlas_setup_cursors(atlas);
+    return atlas->pixel;
+
+failed:
+    nk_font_dynamic_free(atlas);
+    return 0;
+}
+NK_API int
+nk_font_atlas_dirty(struct nk_font_atlas *atlas, struct nk_recti *rect)
+{
+    int i;
+    struct nk_font_dynamic *dyn;
+    NK_ASSERT(atlas);
+    NK_ASSERT(rect);
+    if (!atlas || !rect || !atlas->dynamic) return 0;
+
+    dyn = atlas->dynamic;
+    if (atlas->lock) atlas->lock(atlas->lock_userdata);
+    for (i = 0; i < NK_FONT_DYNAMIC_PAGES; ++i) {
+        struct nk_font_dynamic_page *page = &dyn->pages[i];
+        if (!page->dirty) continue;
+        rect->x = (short)page->dirty_x0;
+        rect->y = (short)page->dirty_y0;
+        rect->w = (short)(page->dirty_x1 - page->dirty_x0);
+        rect->h = (short)(page->dirty_y1 - page->dirty_y0);
+        page->dirty = nk_false;
+        break;
+    }
+    /* all regions uploaded so glyphs used until now may be evicted */
+    if (i == NK_FONT_DYNAMIC_PAGES)
+        dyn->frame++;
+    if (atlas->unlock) atlas->unlock(atlas->lock_userdata);
+    return i < NK_FONT_DYNAMIC_PAGES;
+}
+NK_API void
+nk_font_atlas_set_lock(struct nk_font_atlas *atlas, nk_handle userdata,
+    void(*lock)(nk_handle), void(*unlock)(nk_handle))
+{
+    NK_ASSERT(atlas);
+    NK_ASSERT(!lock == !unlock);
+    if (!atlas) return;
+    atlas->lock_userdata = userdata;
+    atlas->lock = lock;
+    atlas->unlock = unlock;
+}
 NK_API void
 nk_font_atlas_end(struct nk_font_atlas *atlas, nk_handle texture,
     struct nk_draw_null_texture *null)
@@ -3309,6 +4584,8 @@ nk_font_atlas_end(struct nk_font_atlas *atlas, nk_handle texture,
     for (i = 0; i < NK_CURSOR_COUNT; ++i)
         atlas->cursors[i].img.handle = texture;
 
+    /* dynamic atlas keeps its texture memory for later glyphs */
+    if (atlas->dynamic) return;
     atlas->temporary.free(atlas->temporary.userdata, atlas->pixel);
     atlas->pixel = 0;
     atlas->tex_width = 0;
@@ -3327,15 +4604,18 @@ nk_font_atlas_cleanup(struct nk_font_atlas *atlas)
     NK_ASSERT(atlas->permanent.alloc);
     NK_ASSERT(atlas->permanent.free);
     if (!atlas || !atlas->permanent.alloc || !atlas->permanent.free) return;
+    if (atlas->dynamic) return;
     if (atlas->config) {
         struct nk_font_config *iter;
         for (iter = atlas->config; iter; iter = iter->next) {
             struct nk_font_config *i;
             for (i = iter->n; i != iter; i = i->n) {
-                atlas->permanent.free(atlas->permanent.userdata, i->ttf_blob);
+                if (i->ttf_blob)
+                    atlas->permanent.free(atlas->permanent.userdata, i->ttf_blob);
                 i->ttf_blob = 0;
             }
-            atlas->permanent.free(atlas->permanent.userdata, iter->ttf_blob);
+            if (iter->ttf_blob)
+                atlas->permanent.free(atlas->permanent.userdata, iter->ttf_blob);
             iter->ttf_blob = 0;
         }
     }
@@ -3350,6 +4630,7 @@ nk_font_atlas_clear(struct nk_font_atlas *atlas)
     NK_ASSERT(atlas->permanent.free);
     if (!atlas || !atlas->permanent.alloc || !atlas->permanent.free) return;
 
+    nk_font_dynamic_free(atlas);
     if (atlas->config) {
         struct nk_font_config *iter, *next;
         for (iter = atlas->config; iter; iter = next) {
@@ -0,0 +1,596 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          DEFAULT FONT ATLAS
+ *
+ * ===============================================================*/
+/* ProggyClean.ttf baked at 13 pixels with the default font configuration
+ * and glyph ranges. Pixels are stored with 2 bits per pixel as index into
+ * the palette. Generated by example/font_atlas_embed.c so do not edit. */
+#ifdef NK_INCLUDE_DEFAULT_FONT_ATLAS
+
+#define NK_DEFAULT_FONT_ATLAS_WIDTH 312
+#define NK_DEFAULT_FONT_ATLAS_HEIGHT 140
+#define NK_DEFAULT_FONT_ATLAS_GLYPHS 224
+#define NK_DEFAULT_FONT_ATLAS_USED 42379
+
+NK_GLOBAL const short nk_default_font_atlas_custom[4] = {0, 0, 181, 28};
+NK_GLOBAL const nk_byte nk_default_font_atlas_palette[4] = {0, 85, 170, 255};
+NK_GLOBAL const float nk_default_font_atlas_metrics[3] = {13.0f, 9.5f, -3.5f};
+NK_GLOBAL const nk_rune nk_default_font_atlas_ranges[] = {0x0020, 0x00FF, 0};
+
+NK_GLOBAL const struct nk_font_glyph nk_default_font_atlas_glyphs[NK_DEFAULT_FONT_ATLAS_GLYPHS] = {
+    {0x0020, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.660256445f, 0.200000003f, 0.666666687f, 0.200000003f},
+    {0x0021, 7.0f, 2.66666675f, 1.0f, 4.33333349f, 10.0f, 2.16666675f, 9.0f, 0.974358976f, 0.728571415f, 0.990384638f, 0.79285717f},
+    {0x0022, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 4.0f, 4.16666698f, 4.0f, 0.31089744f, 0.935714304f, 0.346153855f, 0.964285731f},
+    {0x0023, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.714743614f, 0.442857146f, 0.788461566f, 0.507142842f},
+    {0x0024, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 11.0f, 6.16666698f, 10.0f, 0.580128193f, 0.442857146f, 0.634615421f, 0.514285743f},
+    {0x0025, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.705128193f, 0.657142878f, 0.778846145f, 0.721428573f},
+    {0x0026, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.858974397f, 0.442857146f, 0.923076928f, 0.507142842f},
+    {0x0027, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 4.0f, 2.16666675f, 4.0f, 0.407051295f, 0.828571439f, 0.423076928f, 0.857142866f},
+    {0x0028, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.775641024f, 0.100000001f, 0.81089747f, 0.18571429f},
+    {0x0029, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.621794879f, 0.114285715f, 0.657051265f, 0.200000003f},
+    {0x002A, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.474358976f, 0.885714293f, 0.528846145f, 0.928571463f},
+    {0x002B, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.416666687f, 0.885714293f, 0.471153855f, 0.928571463f},
+    {0x002C, 7.0f, 0.666666627f, 7.0f, 3.33333349f, 12.0f, 3.16666698f, 5.0f, 0.445512831f, 0.757142842f, 0.471153855f, 0.79285717f},
+    {0x002D, 7.0f, 0.666666627f, 5.0f, 6.33333349f, 7.0f, 6.16666698f, 2.0f, 0.503205121f, 0.935714304f, 0.557692289f, 0.949999988f},
+    {0x002E, 7.0f, 1.66666663f, 7.0f, 3.33333349f, 10.0f, 2.16666698f, 3.0f, 0.407051295f, 0.935714304f, 0.423076928f, 0.957142889f},
+    {0x002F, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 11.0f, 6.16666698f, 11.0f, 0.926282048f, 0.357142866f, 0.980769217f, 0.435714275f},
+    {0x0030, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.878205121f, 0.800000012f, 0.932692349f, 0.864285707f},
+    {0x0031, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.820512831f, 0.800000012f, 0.875f, 0.864285707f},
+    {0x0032, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.93589747f, 0.800000012f, 0.990384638f, 0.864285707f},
+    {0x0033, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.349358976f, 0.757142842f, 0.403846145f, 0.821428597f},
+    {0x0034, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.858974397f, 0.514285743f, 0.923076928f, 0.578571439f},
+    {0x0035, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.0705128238f, 0.685714304f, 0.125f, 0.75f},
+    {0x0036, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.358974367f, 0.685714304f, 0.413461536f, 0.75f},
+    {0x0037, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.301282048f, 0.685714304f, 0.355769247f, 0.75f},
+    {0x0038, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.416666687f, 0.685714304f, 0.471153855f, 0.75f},
+    {0x0039, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.243589744f, 0.685714304f, 0.298076928f, 0.75f},
+    {0x003A, 7.0f, 2.66666675f, 3.0f, 4.33333349f, 10.0f, 2.16666675f, 7.0f, 0.426282048f, 0.757142842f, 0.442307711f, 0.807142854f},
+    {0x003B, 7.0f, 0.666666627f, 3.0f, 3.33333349f, 12.0f, 3.16666698f, 9.0f, 0.551282048f, 0.607142866f, 0.576923072f, 0.671428561f},
+    {0x003C, 7.0f, -0.333333343f, 3.0f, 6.33333349f, 9.0f, 7.16666698f, 6.0f, 0.637820542f, 0.821428597f, 0.701923072f, 0.864285707f},
+    {0x003D, 7.0f, 0.666666627f, 4.0f, 7.33333349f, 8.0f, 7.16666698f, 4.0f, 0.858974397f, 0.971428573f, 0.923076928f, 1.0f},
+    {0x003E, 7.0f, 0.666666627f, 3.0f, 7.33333349f, 9.0f, 7.16666698f, 6.0f, 0.176282048f, 0.885714293f, 0.240384623f, 0.928571463f},
+    {0x003F, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.705128193f, 0.800000012f, 0.759615421f, 0.864285707f},
+    {0x0040, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.442857146f, 0.711538494f, 0.507142842f},
+    {0x0041, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.849358976f, 0.585714281f, 0.913461566f, 0.649999976f},
+    {0x0042, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.839743614f, 0.728571415f, 0.903846145f, 0.79285717f},
+    {0x0043, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.926282048f, 0.442857146f, 0.990384638f, 0.507142842f},
+    {0x0044, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.926282048f, 0.514285743f, 0.990384638f, 0.578571439f},
+    {0x0045, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.647435904f, 0.75f, 0.701923072f, 0.814285696f},
+    {0x0046, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.762820542f, 0.800000012f, 0.817307711f, 0.864285707f},
+    {0x0047, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.916666687f, 0.585714281f, 0.980769217f, 0.649999976f},
+    {0x0048, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.907051265f, 0.728571415f, 0.971153855f, 0.79285717f},
+    {0x0049, 7.0f, 1.66666663f, 1.0f, 5.33333349f, 10.0f, 4.16666698f, 9.0f, 0.31089744f, 0.614285707f, 0.346153855f, 0.678571403f},
+    {0x004A, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 10.0f, 5.16666698f, 9.0f, 0.628205121f, 0.29285714f, 0.673076928f, 0.357142866f},
+    {0x004B, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.916666687f, 0.657142878f, 0.980769217f, 0.721428573f},
+    {0x004C, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.532051265f, 0.75f, 0.586538494f, 0.814285696f},
+    {0x004D, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.514285743f, 0.711538494f, 0.578571439f},
+    {0x004E, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.772435904f, 0.728571415f, 0.836538494f, 0.79285717f},
+    {0x004F, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.705128193f, 0.728571415f, 0.769230783f, 0.79285717f},
+    {0x0050, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.474358976f, 0.75f, 0.528846145f, 0.814285696f},
+    {0x0051, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 11.0f, 7.16666698f, 10.0f, 0.493589759f, 0.29285714f, 0.557692289f, 0.364285707f},
+    {0x0052, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.714743614f, 0.585714281f, 0.778846145f, 0.649999976f},
+    {0x0053, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.791666687f, 0.514285743f, 0.855769217f, 0.578571439f},
+    {0x0054, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.637820542f, 0.585714281f, 0.711538494f, 0.649999976f},
+    {0x0055, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.782051265f, 0.657142878f, 0.846153855f, 0.721428573f},
+    {0x0056, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.628205121f, 0.678571403f, 0.701923072f, 0.742857158f},
+    {0x0057, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.551282048f, 0.678571403f, 0.625f, 0.742857158f},
+    {0x0058, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.782051265f, 0.585714281f, 0.846153855f, 0.649999976f},
+    {0x0059, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.714743614f, 0.514285743f, 0.788461566f, 0.578571439f},
+    {0x005A, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.791666687f, 0.442857146f, 0.855769217f, 0.507142842f},
+    {0x005B, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.583333313f, 0.114285715f, 0.618589759f, 0.200000003f},
+    {0x005C, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 11.0f, 6.16666698f, 11.0f, 0.868589759f, 0.357142866f, 0.923076928f, 0.435714275f},
+    {0x005D, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 12.0f, 4.16666698f, 12.0f, 0.958333373f, 0.00714285718f, 0.993589759f, 0.0928571448f},
+    {0x005E, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 7.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.885714293f, 0.057692308f, 0.935714304f},
+    {0x005F, 7.0f, -0.333333343f, 10.0f, 7.33333349f, 11.0f, 8.16666698f, 1.0f, 0.387820512f, 0.992857158f, 0.461538464f, 1.0f},
+    {0x0060, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 3.0f, 3.16666698f, 3.0f, 0.349358976f, 0.935714304f, 0.375f, 0.957142889f},
+    {0x0061, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.942857146f, 0.115384616f, 0.992857158f},
+    {0x0062, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.060897436f, 0.378571421f, 0.115384616f, 0.449999988f},
+    {0x0063, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.828571439f, 0.115384616f, 0.878571451f},
+    {0x0064, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.378571421f, 0.230769232f, 0.449999988f},
+    {0x0065, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.233974367f, 0.828571439f, 0.288461536f, 0.878571451f},
+    {0x0066, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.371428579f, 0.403846145f, 0.442857146f},
+    {0x0067, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.522435904f, 0.371428579f, 0.576923072f, 0.442857146f},
+    {0x0068, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.371428579f, 0.519230783f, 0.442857146f},
+    {0x0069, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.445512831f, 0.607142866f, 0.471153855f, 0.678571403f},
+    {0x006A, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 12.0f, 5.16666698f, 12.0f, 0.660256445f, 0.107142858f, 0.705128193f, 0.192857146f},
+    {0x006B, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.449999988f, 0.519230783f, 0.521428585f},
+    {0x006C, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.416666687f, 0.607142866f, 0.442307711f, 0.678571403f},
+    {0x006D, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.791666687f, 0.871428549f, 0.865384638f, 0.921428561f},
+    {0x006E, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.828571439f, 0.057692308f, 0.878571451f},
+    {0x006F, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.176282048f, 0.828571439f, 0.230769232f, 0.878571451f},
+    {0x0070, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.291666657f, 0.378571421f, 0.346153855f, 0.449999988f},
+    {0x0071, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.407051295f, 0.449999988f, 0.461538464f, 0.521428585f},
+    {0x0072, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.118589744f, 0.828571439f, 0.173076928f, 0.878571451f},
+    {0x0073, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.118589744f, 0.885714293f, 0.173076928f, 0.935714304f},
+    {0x0074, 7.0f, 1.66666663f, 1.0f, 6.33333349f, 10.0f, 5.16666698f, 9.0f, 0.580128193f, 0.371428579f, 0.625f, 0.435714275f},
+    {0x0075, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.349358976f, 0.828571439f, 0.403846145f, 0.878571451f},
+    {0x0076, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.291666657f, 0.828571439f, 0.346153855f, 0.878571451f},
+    {0x0077, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.714743614f, 0.871428549f, 0.788461566f, 0.921428561f},
+    {0x0078, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.060897436f, 0.885714293f, 0.115384616f, 0.935714304f},
+    {0x0079, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.060897436f, 0.535714269f, 0.115384616f, 0.607142866f},
+    {0x007A, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 10.0f, 6.16666698f, 7.0f, 0.00320512825f, 0.942857146f, 0.057692308f, 0.992857158f},
+    {0x007B, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.842948735f, 0.00714285718f, 0.897435904f, 0.0928571448f},
+    {0x007C, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 12.0f, 2.16666675f, 12.0f, 0.81410259f, 0.100000001f, 0.830128193f, 0.18571429f},
+    {0x007D, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.717948735f, 0.100000001f, 0.772435904f, 0.18571429f},
+    {0x007E, 7.0f, -0.333333343f, 4.0f, 7.33333349f, 7.0f, 8.16666698f, 3.0f, 0.147435904f, 0.978571415f, 0.221153855f, 1.0f},
+    {0x007F, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.671428561f, 0.701923072f, 0.671428561f},
+    {0x0080, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 13.0f, 8.16666698f, 14.0f, 0.583333313f, 0.00714285718f, 0.657051265f, 0.107142858f},
+    {0x0081, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.657142878f, 0.701923072f, 0.657142878f},
+    {0x0082, 7.0f, 1.66666663f, 7.0f, 4.33333349f, 12.0f, 3.16666698f, 5.0f, 0.118589744f, 0.942857146f, 0.144230768f, 0.978571415f},
+    {0x0083, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 12.0f, 6.16666698f, 12.0f, 0.785256445f, 0.00714285718f, 0.839743614f, 0.0928571448f},
+    {0x0084, 7.0f, 1.66666663f, 7.0f, 5.33333349f, 11.0f, 4.16666698f, 4.0f, 0.272435904f, 0.971428573f, 0.307692319f, 1.0f},
+    {0x0085, 7.0f, 0.666666627f, 8.0f, 6.33333349f, 10.0f, 6.16666698f, 2.0f, 0.493589759f, 0.957142889f, 0.548076928f, 0.971428573f},
+    {0x0086, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.407051295f, 0.528571427f, 0.461538464f, 0.600000024f},
+    {0x0087, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.378571421f, 0.057692308f, 0.449999988f},
+    {0x0088, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 4.0f, 6.16666698f, 4.0f, 0.926282048f, 0.971428573f, 0.980769217f, 1.0f},
+    {0x0089, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.00320512825f, 0.685714304f, 0.0673076957f, 0.75f},
+    {0x008A, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.205128208f, 0.20714286f, 0.269230783f, 0.285714298f},
+    {0x008B, 7.0f, 0.666666627f, 3.0f, 4.33333349f, 9.0f, 4.16666698f, 6.0f, 0.782051265f, 0.928571463f, 0.817307711f, 0.971428573f},
+    {0x008C, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.00320512825f, 0.614285707f, 0.0769230798f, 0.678571403f},
+    {0x008D, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.426282048f, 0.814285696f, 0.432692319f, 0.814285696f},
+    {0x008E, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.407051295f, 0.20714286f, 0.471153855f, 0.285714298f},
+    {0x008F, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.368589759f, 0.964285731f, 0.375f, 0.964285731f},
+    {0x0090, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.695512831f, 0.664285719f, 0.701923072f, 0.664285719f},
+    {0x0091, 7.0f, 2.66666675f, 0.0f, 5.33333349f, 4.0f, 3.16666675f, 4.0f, 0.147435904f, 0.942857146f, 0.173076928f, 0.971428573f},
+    {0x0092, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 4.0f, 3.16666698f, 4.0f, 0.31089744f, 0.971428573f, 0.336538464f, 1.0f},
+    {0x0093, 7.0f, 1.66666663f, 0.0f, 6.33333349f, 4.0f, 5.16666698f, 4.0f, 0.224358976f, 0.971428573f, 0.269230783f, 1.0f},
+    {0x0094, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 4.0f, 5.16666698f, 4.0f, 0.224358976f, 0.935714304f, 0.269230783f, 0.964285731f},
+    {0x0095, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.358974367f, 0.885714293f, 0.413461536f, 0.928571463f},
+    {0x0096, 7.0f, 0.666666627f, 5.0f, 6.33333349f, 7.0f, 6.16666698f, 2.0f, 0.637820542f, 0.657142878f, 0.692307711f, 0.671428561f},
+    {0x0097, 7.0f, -0.333333343f, 5.0f, 7.33333349f, 7.0f, 8.16666698f, 2.0f, 0.426282048f, 0.935714304f, 0.5f, 0.949999988f},
+    {0x0098, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 4.0f, 5.16666698f, 3.0f, 0.339743584f, 0.971428573f, 0.384615391f, 0.992857158f},
+    {0x0099, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 6.0f, 8.16666698f, 5.0f, 0.858974397f, 0.928571463f, 0.932692349f, 0.964285731f},
+    {0x009A, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.060897436f, 0.45714286f, 0.115384616f, 0.528571427f},
+    {0x009B, 7.0f, 0.666666627f, 3.0f, 4.33333349f, 9.0f, 4.16666698f, 6.0f, 0.743589759f, 0.928571463f, 0.778846145f, 0.971428573f},
+    {0x009C, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.868589759f, 0.871428549f, 0.942307711f, 0.921428561f},
+    {0x009D, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.358974367f, 0.964285731f, 0.365384609f, 0.964285731f},
+    {0x009E, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.378571421f, 0.288461536f, 0.449999988f},
+    {0x009F, 7.0f, -0.333333343f, 0.0f, 7.33333349f, 10.0f, 8.16666698f, 10.0f, 0.349358976f, 0.29285714f, 0.423076928f, 0.364285707f},
+    {0x00A0, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.378205121f, 0.964285731f, 0.384615391f, 0.964285731f},
+    {0x00A1, 7.0f, 2.66666675f, 1.0f, 4.33333349f, 10.0f, 2.16666675f, 9.0f, 0.407051295f, 0.757142842f, 0.423076928f, 0.821428597f},
+    {0x00A2, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 11.0f, 6.16666698f, 9.0f, 0.233974367f, 0.757142842f, 0.288461536f, 0.821428597f},
+    {0x00A3, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.176282048f, 0.757142842f, 0.230769232f, 0.821428597f},
+    {0x00A4, 7.0f, -0.333333343f, 2.0f, 7.33333349f, 10.0f, 8.16666698f, 8.0f, 0.426282048f, 0.821428597f, 0.5f, 0.878571451f},
+    {0x00A5, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.15705128f, 0.614285707f, 0.230769232f, 0.678571403f},
+    {0x00A6, 7.0f, 2.66666675f, 0.0f, 4.33333349f, 12.0f, 2.16666675f, 12.0f, 0.833333373f, 0.100000001f, 0.849358976f, 0.18571429f},
+    {0x00A7, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.45714286f, 0.057692308f, 0.528571427f},
+    {0x00A8, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 2.0f, 4.16666698f, 2.0f, 0.551282048f, 0.957142889f, 0.586538494f, 0.971428573f},
+    {0x00A9, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.0801282078f, 0.614285707f, 0.15384616f, 0.678571403f},
+    {0x00AA, 7.0f, 0.666666627f, 1.0f, 5.33333349f, 7.0f, 5.16666698f, 6.0f, 0.647435904f, 0.928571463f, 0.692307711f, 0.971428573f},
+    {0x00AB, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.243589744f, 0.885714293f, 0.298076928f, 0.928571463f},
+    {0x00AC, 7.0f, 0.666666627f, 5.0f, 5.33333349f, 10.0f, 5.16666698f, 5.0f, 0.589743614f, 0.885714293f, 0.634615421f, 0.921428561f},
+    {0x00AD, 7.0f, -0.333333343f, 10.0f, 0.333333343f, 10.0f, 1.16666675f, 0.0f, 0.349358976f, 0.964285731f, 0.355769247f, 0.964285731f},
+    {0x00AE, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.474358976f, 0.678571403f, 0.548076928f, 0.742857158f},
+    {0x00AF, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 1.0f, 8.16666698f, 2.0f, 0.416666687f, 0.964285731f, 0.490384609f, 0.978571415f},
+    {0x00B0, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 5.0f, 5.16666698f, 5.0f, 0.176282048f, 0.935714304f, 0.221153855f, 0.971428573f},
+    {0x00B1, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 10.0f, 6.16666698f, 8.0f, 0.580128193f, 0.821428597f, 0.634615421f, 0.878571451f},
+    {0x00B2, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.945512831f, 0.871428549f, 0.990384638f, 0.914285719f},
+    {0x00B3, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.695512831f, 0.928571463f, 0.740384638f, 0.971428573f},
+    {0x00B4, 7.0f, 2.66666675f, 0.0f, 5.33333349f, 3.0f, 3.16666675f, 3.0f, 0.387820512f, 0.964285731f, 0.413461536f, 0.985714316f},
+    {0x00B5, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 12.0f, 8.16666698f, 9.0f, 0.233974367f, 0.614285707f, 0.307692319f, 0.678571403f},
+    {0x00B6, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 11.0f, 7.16666698f, 10.0f, 0.426282048f, 0.29285714f, 0.490384609f, 0.364285707f},
+    {0x00B7, 7.0f, 1.66666663f, 4.0f, 5.33333349f, 8.0f, 4.16666698f, 4.0f, 0.272435904f, 0.935714304f, 0.307692319f, 0.964285731f},
+    {0x00B8, 7.0f, 2.66666675f, 10.0f, 5.33333349f, 13.0f, 3.16666675f, 3.0f, 0.378205121f, 0.935714304f, 0.403846145f, 0.957142889f},
+    {0x00B9, 7.0f, 0.666666627f, 0.0f, 4.33333349f, 6.0f, 4.16666698f, 6.0f, 0.820512831f, 0.928571463f, 0.855769217f, 0.971428573f},
+    {0x00BA, 7.0f, 0.666666627f, 0.0f, 5.33333349f, 6.0f, 5.16666698f, 6.0f, 0.945512831f, 0.921428561f, 0.990384638f, 0.964285731f},
+    {0x00BB, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.532051265f, 0.885714293f, 0.586538494f, 0.928571463f},
+    {0x00BC, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.137820512f, 0.20714286f, 0.201923072f, 0.285714298f},
+    {0x00BD, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.272435904f, 0.20714286f, 0.336538464f, 0.285714298f},
+    {0x00BE, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 10.0f, 8.16666698f, 11.0f, 0.852564096f, 0.100000001f, 0.926282048f, 0.178571433f},
+    {0x00BF, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.589743614f, 0.75f, 0.644230783f, 0.814285696f},
+    {0x00C0, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.541666687f, 0.20714286f, 0.605769217f, 0.285714298f},
+    {0x00C1, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.474358976f, 0.20714286f, 0.538461566f, 0.285714298f},
+    {0x00C2, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.608974338f, 0.20714286f, 0.673076928f, 0.285714298f},
+    {0x00C3, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.929487169f, 0.18571429f, 0.993589759f, 0.264285713f},
+    {0x00C4, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.56089747f, 0.29285714f, 0.625f, 0.364285707f},
+    {0x00C5, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.929487169f, 0.100000001f, 0.993589759f, 0.178571433f},
+    {0x00C6, 7.0f, -0.333333343f, 1.0f, 7.33333349f, 10.0f, 8.16666698f, 9.0f, 0.474358976f, 0.607142866f, 0.548076928f, 0.671428561f},
+    {0x00C7, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 13.0f, 7.16666698f, 12.0f, 0.717948735f, 0.00714285718f, 0.782051265f, 0.0928571448f},
+    {0x00C8, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.060897436f, 0.29285714f, 0.115384616f, 0.371428579f},
+    {0x00C9, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.118589744f, 0.29285714f, 0.173076928f, 0.371428579f},
+    {0x00CA, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.81089747f, 0.357142866f, 0.865384638f, 0.435714275f},
+    {0x00CB, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.528571427f, 0.403846145f, 0.600000024f},
+    {0x00CC, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.272435904f, 0.29285714f, 0.307692319f, 0.371428579f},
+    {0x00CD, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.233974367f, 0.29285714f, 0.269230783f, 0.371428579f},
+    {0x00CE, 7.0f, 1.66666663f, -1.0f, 5.33333349f, 10.0f, 4.16666698f, 11.0f, 0.31089744f, 0.29285714f, 0.346153855f, 0.371428579f},
+    {0x00CF, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.81089747f, 0.278571427f, 0.846153855f, 0.349999994f},
+    {0x00D0, 7.0f, -0.333333343f, 2.0f, 7.33333349f, 10.0f, 8.16666698f, 8.0f, 0.503205121f, 0.821428597f, 0.576923072f, 0.878571451f},
+    {0x00D1, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.339743584f, 0.20714286f, 0.403846145f, 0.285714298f},
+    {0x00D2, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.743589759f, 0.278571427f, 0.807692289f, 0.357142866f},
+    {0x00D3, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.676282048f, 0.278571427f, 0.740384638f, 0.357142866f},
+    {0x00D4, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.785256445f, 0.192857146f, 0.849358976f, 0.271428585f},
+    {0x00D5, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.00320512825f, 0.20714286f, 0.0673076957f, 0.285714298f},
+    {0x00D6, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.695512831f, 0.364285707f, 0.759615421f, 0.435714275f},
+    {0x00D7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.301282048f, 0.885714293f, 0.355769247f, 0.928571463f},
+    {0x00D8, 7.0f, 0.666666627f, 1.0f, 7.33333349f, 10.0f, 7.16666698f, 9.0f, 0.849358976f, 0.657142878f, 0.913461566f, 0.721428573f},
+    {0x00D9, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.919871807f, 0.271428585f, 0.983974397f, 0.349999994f},
+    {0x00DA, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.852564096f, 0.271428585f, 0.916666687f, 0.349999994f},
+    {0x00DB, 7.0f, 0.666666627f, -1.0f, 7.33333349f, 10.0f, 7.16666698f, 11.0f, 0.0705128238f, 0.20714286f, 0.134615391f, 0.285714298f},
+    {0x00DC, 7.0f, 0.666666627f, 0.0f, 7.33333349f, 10.0f, 7.16666698f, 10.0f, 0.628205121f, 0.364285707f, 0.692307711f, 0.435714275f},
+    {0x00DD, 7.0f, -0.333333343f, -1.0f, 7.33333349f, 10.0f, 8.16666698f, 11.0f, 0.708333313f, 0.192857146f, 0.782051265f, 0.271428585f},
+    {0x00DE, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.18589744f, 0.685714304f, 0.240384623f, 0.75f},
+    {0x00DF, 7.0f, -0.333333343f, 0.0f, 7.33333349f, 11.0f, 8.16666698f, 11.0f, 0.852564096f, 0.18571429f, 0.926282048f, 0.264285713f},
+    {0x00E0, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.580128193f, 0.521428585f, 0.634615421f, 0.592857122f},
+    {0x00E1, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.464743584f, 0.528571427f, 0.519230783f, 0.600000024f},
+    {0x00E2, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.45714286f, 0.230769232f, 0.528571427f},
+    {0x00E3, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.45714286f, 0.173076928f, 0.528571427f},
+    {0x00E4, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.128205135f, 0.685714304f, 0.182692304f, 0.75f},
+    {0x00E5, 7.0f, 0.666666627f, -1.0f, 6.33333349f, 10.0f, 6.16666698f, 11.0f, 0.176282048f, 0.29285714f, 0.230769232f, 0.371428579f},
+    {0x00E6, 7.0f, -0.333333343f, 3.0f, 7.33333349f, 10.0f, 8.16666698f, 7.0f, 0.637820542f, 0.871428549f, 0.711538494f, 0.921428561f},
+    {0x00E7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 13.0f, 6.16666698f, 10.0f, 0.291666657f, 0.45714286f, 0.346153855f, 0.528571427f},
+    {0x00E8, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.45714286f, 0.288461536f, 0.528571427f},
+    {0x00E9, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.233974367f, 0.535714269f, 0.288461536f, 0.607142866f},
+    {0x00EA, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.176282048f, 0.535714269f, 0.230769232f, 0.607142866f},
+    {0x00EB, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.291666657f, 0.757142842f, 0.346153855f, 0.821428597f},
+    {0x00EC, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.387820512f, 0.607142866f, 0.413461536f, 0.678571403f},
+    {0x00ED, 7.0f, 1.66666663f, 0.0f, 4.33333349f, 10.0f, 3.16666698f, 10.0f, 0.676282048f, 0.200000003f, 0.701923072f, 0.271428585f},
+    {0x00EE, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.762820542f, 0.364285707f, 0.798076928f, 0.435714275f},
+    {0x00EF, 7.0f, 1.66666663f, 0.0f, 5.33333349f, 10.0f, 4.16666698f, 10.0f, 0.349358976f, 0.607142866f, 0.384615391f, 0.678571403f},
+    {0x00F0, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.580128193f, 0.600000024f, 0.634615421f, 0.671428561f},
+    {0x00F1, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.291666657f, 0.535714269f, 0.346153855f, 0.607142866f},
+    {0x00F2, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.00320512825f, 0.535714269f, 0.057692308f, 0.607142866f},
+    {0x00F3, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.522435904f, 0.528571427f, 0.576923072f, 0.600000024f},
+    {0x00F4, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.535714269f, 0.173076928f, 0.607142866f},
+    {0x00F5, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.118589744f, 0.378571421f, 0.173076928f, 0.449999988f},
+    {0x00F6, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.118589744f, 0.757142842f, 0.173076928f, 0.821428597f},
+    {0x00F7, 7.0f, 0.666666627f, 3.0f, 6.33333349f, 9.0f, 6.16666698f, 6.0f, 0.589743614f, 0.928571463f, 0.644230783f, 0.971428573f},
+    {0x00F8, 7.0f, 0.666666627f, 2.0f, 6.33333349f, 11.0f, 6.16666698f, 9.0f, 0.00320512825f, 0.757142842f, 0.057692308f, 0.821428597f},
+    {0x00F9, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.407051295f, 0.371428579f, 0.461538464f, 0.442857146f},
+    {0x00FA, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.522435904f, 0.449999988f, 0.576923072f, 0.521428585f},
+    {0x00FB, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 10.0f, 6.16666698f, 10.0f, 0.349358976f, 0.449999988f, 0.403846145f, 0.521428585f},
+    {0x00FC, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 10.0f, 6.16666698f, 9.0f, 0.060897436f, 0.757142842f, 0.115384616f, 0.821428597f},
+    {0x00FD, 7.0f, 0.666666627f, 0.0f, 6.33333349f, 13.0f, 6.16666698f, 13.0f, 0.660256445f, 0.00714285718f, 0.714743614f, 0.100000001f},
+    {0x00FE, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 12.0f, 6.16666698f, 11.0f, 0.00320512825f, 0.29285714f, 0.057692308f, 0.371428579f},
+    {0x00FF, 7.0f, 0.666666627f, 1.0f, 6.33333349f, 13.0f, 6.16666698f, 12.0f, 0.900641024f, 0.00714285718f, 0.955128193f, 0.0928571448f}
+};
+
+NK_GLOBAL const nk_uint nk_default_font_atlas_pixels[2730] = {
+    0x0000000F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3FFF0000,0x00000300,
+    0x00000C00,0x0003FFF0,0xF0000000,0x000003FF,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x000F0000,0x003FF000,0x0000000C,0x00000030,0x000003FF,
+    0xFF000000,0x00000003,0x0CC03003,0x33000000,0x00300000,0x00000003,0x03003000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x003F0003,0x00FC0000,0x00FF0000,0x00000000,0x0003FC00,0x3F3F0000,0x00003030,0x0000C0C0,
+    0x0000C030,0xC0000000,0xFFFF9300,0x01BFFFFF,0x006E4000,0xBFFF9000,0x90000001,0x000006FF,
+    0xB9006FF9,0xFE401B91,0x000006FF,0xC0030000,0x000000FF,0x000003FF,0x0000003F,0xF0000000,
+    0x000000C3,0xC00C0330,0x00300000,0x30300003,0x00000000,0x93030000,0x0000001B,0xB90001B9,
+    0x6E400001,0x006E4000,0x00006E40,0x0006E400,0x00000000,0x06E40000,0x00000000,0x03FFF003,
+    0x0FFFC000,0x00CF0000,0x00000000,0x03C3CC00,0x03300000,0x00030003,0x000C000C,0x0000CC30,
+    0xC0000000,0x001B930C,0x01B90000,0x00000000,0x000001B9,0x6E400000,0xE4000000,0x06E40006,
+    0x0006E400,0x000C06E4,0x00030000,0x0000000C,0x00000030,0x00000303,0x03000000,0x00000CC3,
+    0xFCFF0330,0xF3FC0003,0x3330000F,0x00000003,0x93333000,0x0000001B,0x001B91B9,0x01B91B90,
+    0x00000000,0x06FFFFF9,0x0006E400,0xE40006E4,0x06E40006,0x0000003C,0x000C0003,0x00300000,
+    0x0C000000,0x00000000,0x30C000C0,0x03300000,0x00000CC0,0x00003300,0x000CC0F0,0xCC000000,
+    0x001B93C0,0x91B90000,0x1B90001B,0x000001B9,0x6E400000,0xE4000000,0x06E40006,0x0006E400,
+    0x00FC06E4,0x00030000,0x0000000C,0x00000030,0x00003000,0x00300000,0x0000C0C0,0x0CC00330,
+    0x3300F000,0x000003C0,0x00000033,0x90003300,0x0000001B,0x001B91B9,0x01B91B90,0x00000000,
+    0x40006E40,0x00001BFE,0xE40006E4,0x06E40006,0x000003FC,0x000C0003,0x003000C0,0xC000000C,
+    0x00000000,0x00C0000C,0x03300003,0xCC000CC0,0x0CC03300,0x00CC0000,0x0CC00000,0x001B9000,
+    0x91B90000,0x1B90001B,0x40006E40,0x6E40006E,0xE4000000,0x06E40006,0x0006E400,0x0FFC06E4,
+    0x00030000,0x00F0000C,0x003C0030,0x00030000,0x00030000,0x000C00C0,0x0CC00330,0x3300C300,
+    0x000030C0,0x00000330,0x90000330,0x0000001B,0x001B91B9,0x90001B90,0x0001BFFF,0x00006E40,
+    0x0006E400,0xFFFFF900,0x06E40006,0x00003FFC,0x000C0003,0x003000FC,0x000000FC,0xC000000C,
+    0x00C00000,0x03300030,0xC0C00CC0,0xC0FFF3FF,0x0CC00000,0x00CC0F3C,0x001B9000,0x01B90000,
+    0x1BFFFFE4,0x06E40000,0x6E400000,0xE4000000,0x00000006,0x0006E400,0xFFFC06E4,0x00030000,
+    0xFFFF000C,0x03FFFFFF,0x30300000,0x00003030,0x00C000C0,0x0CC00330,0x00000030,0x00030000,
+    0x33333300,0x90000033,0x0000001B,0x000001B9,0x00001B90,0x000006E4,0x00006E40,0x0006E400,
+    0xE4000000,0x06E40006,0x0003FFFC,0x000C0003,0x003000FC,0x000000FC,0x0CF03CC0,0x00C00000,
+    0x03300300,0xC0C00CC0,0xC0FFF3FF,0xCC000000,0x000CC330,0x001B9000,0x01B90000,0x1B900000,
+    0x001B9000,0x01BFE400,0x00000000,0xF9006FF9,0xFE401BFF,0xFFFC06FF,0x0003000F,0x00F0000C,
+    0x003C0030,0x3F000000,0x000003F0,0x0C0000C0,0x0CC03F3F,0x3300C300,0x000030C0,0x03303000,
+    0x90000003,0x0000001B,0xFFE401B9,0x0000006F,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xF03FFFFC,0x000C003F,0x003000C0,0x0000000C,0x0FF03FC0,0x00C00000,0x30033000,
+    0xCC000CC0,0x0CC03300,0x0C000000,0x000C0330,0xFFFF9000,0x01BFFFFF,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x3FFC0000,0x00000000,0x0000000C,0x00000030,
+    0x3FF00000,0x00003FF0,0x3FF000C0,0x0CC03FFF,0x3300F000,0x000003C0,0x03300300,0x00000030,
+    0x00000000,0x00000000,0x6FF90000,0x00000000,0xB91B91B9,0x00000001,0x000006E4,0x00006FF9,
+    0x00003CFC,0x000C0000,0x00300000,0x00000000,0x00000000,0xC0C00000,0x00000030,0x00000CC0,
+    0x00003300,0xFF000000,0x003FFF3F,0x00000000,0x00000000,0x006E4000,0x001B9000,0x9006E400,
+    0xFF91B91B,0x06E40006,0x9006E400,0xF03C001B,0x00000000,0x0000000C,0x00000030,0x00000000,
+    0x00000000,0x00C330C0,0xFCFF0000,0xF3FC0003,0x0000000F,0x00000000,0x90000000,0x1B91BFFF,
+    0x00000000,0x90000000,0xE400001B,0xB91B9006,0x91B90001,0xE400001B,0x001B9006,0x0000F00C,
+    0x03FFF000,0x0FFFC000,0x00000000,0x00000000,0x0CC00000,0x000000C3,0x00030003,0x000C000C,
+    0x0000F000,0x000003C0,0x001B9000,0x0006E400,0x00000000,0x001B9000,0x90001B90,0xE401B91B,
+    0x001B91BF,0x6FF90000,0xC0000000,0xC0000003,0x000000FF,0x000003FF,0x000000C0,0x0000000C,
+    0x030C03C0,0xC00C0000,0x00300000,0xCC000003,0x0CC00000,0x90000000,0xE400001B,0xF9000006,
+    0x9000006F,0x1B90001B,0xB91B9000,0x6FF90001,0xE4000000,0x001B9006,0x0003C000,0x003F0000,
+    0x00FC0000,0x00F00000,0x003C0000,0x00000000,0x0000030C,0x00003030,0x0000C0C0,0x0000C300,
+    0x000030C0,0x001B9000,0x01B90000,0x006E4000,0xBFE40000,0x90001B91,0xFF90001B,0x00006E46,
+    0x9006E400,0x0000001B,0x00000000,0x0000000C,0x00000030,0x000000FC,0x000000FC,0x00F00000,
+    0x0CC00000,0x33000000,0xC0C00000,0xC0FFFFFF,0x90000000,0x0000001B,0x400001B9,0x9000006E,
+    0x1B90001B,0xB91B9000,0x01B90001,0xE40006E4,0x001BFFFF,0x00000000,0x00000000,0x00000000,
+    0xFFFF0000,0x03FFFFFF,0x00000000,0x00000000,0x00000300,0x00000C00,0x00000030,0x00030000,
+    0x001B9000,0x01B90000,0x006E4000,0x001B9000,0x90001B90,0x0001B91B,0x06FF91B9,0x00001B90,
+    0x000006E4,0x00000000,0x00000000,0x00000000,0x000000FC,0x000000FC,0x00000000,0x00000000,
+    0x00000000,0xC0C00000,0xC0FFFFFF,0x90000000,0x0000001B,0x400001B9,0x9000006E,0xE400001B,
+    0xB91B9006,0xFE46E401,0x1B91BFFF,0x06E40000,0x00000000,0x00000000,0x00000000,0x00F00000,
+    0x003C0000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000C300,0x000030C0,0x001B9000,
+    0x01B90000,0x006E4000,0x001B9000,0x9006E400,0xE401B91B,0x06E40006,0x00001B90,0x000006E4,
+    0x00000000,0x00000000,0x00000000,0x000000C0,0x0000000C,0x00000000,0x00000000,0x00000000,
+    0xCC000000,0x0CC00000,0x90000000,0xE400001B,0x40000006,0x6FF9006E,0x00000000,0xB91B91B9,
+    0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x0000F000,0x000003C0,0x001B9000,0x9006E400,
+    0x0001BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x1B91BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0xFFF90000,
+    0x0000001B,0x001B91B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x06E40000,0xFE400000,0xE400001B,0x06E40006,0x6E46E400,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x90000000,0x9000001B,0x0000001B,0x06E401B9,0x0006E400,0x000006E4,
+    0x00000000,0xE46E4000,0xF9000006,0x0000006F,0x006E4000,0x06E46E40,0x00000000,0x000006E4,
+    0x001B91B9,0x01B91B90,0xE4000000,0x40000006,0x0000006E,0x006FF900,0x00006E40,0x00000000,
+    0x00000000,0xE4000000,0x001BFFFF,0x6FF90000,0xB9000000,0x00001B91,0x1B9006E4,0x40006E40,
+    0x9000006E,0xE400001B,0x06E40006,0x6E46E400,0xE4000000,0x00000006,0x00001B90,0x1B900000,
+    0x06E40000,0x00001B90,0x0006E400,0x006E4000,0x001BFE40,0x0006E400,0xE40006E4,0x001B9006,
+    0x00000000,0x00000000,0x6E400000,0x0001B900,0xBFFFFE40,0x9006E401,0x0000001B,0x40000000,
+    0xFFFFFFFE,0x0000001B,0x00000000,0x00000000,0x00000000,0xE41BFE40,0x40000006,0x01B9006E,
+    0xE40006E4,0xB9000006,0x9006E401,0x4000001B,0x90001BFE,0xE400001B,0xB9006E46,0x01B90001,
+    0xE46E4000,0x001B9006,0x0006FF90,0x000006E4,0x001B9000,0x0006FF90,0x1BFE4000,0xF9000000,
+    0x9000006F,0x01B9001B,0xE401B900,0xB9000006,0x0006E401,0xE401B900,0x001BFFFF,0xE401B900,
+    0x001B9006,0x6E46E400,0x000006E4,0x000001B9,0x6E46E400,0x1B900000,0x06E401B9,0x6E400000,
+    0x006E4000,0xB90001B9,0x0006E401,0x1B9006E4,0x001B9000,0x06E46E40,0x0006E400,0xE401B900,
+    0xB9000006,0x00001B91,0x06E406E4,0x91B90000,0xE400001B,0x06E40006,0xFE400000,0x0000001B,
+    0x06FFFE40,0x01B91B90,0x000006E4,0x400001B9,0x01B9006E,0xE401B900,0x06E40006,0x90001B90,
+    0x9000001B,0xE400001B,0xB9000006,0xFFFFE401,0x1B9006FF,0x06E40000,0x000006E4,0x001B91B9,
+    0x9006E400,0x006E401B,0xBFE40000,0x01B90001,0x1B91B900,0x06E46E40,0x0006E400,0xFFFE4000,
+    0xF90001BF,0x0006FFFF,0x1BFFFFE4,0x001B9000,0x001B9000,0x01B90000,0x1B9006E4,0x00000000,
+    0x00001B90,0x06E406E4,0x91B90000,0xE400001B,0xF91B9006,0x0000006F,0x006E4000,0x06E401B9,
+    0x6E401B90,0x1B9006E4,0xB9000000,0x6E400001,0x000006E4,0x001B91B9,0x9006E400,0x9000001B,
+    0x0000001B,0x001BFE40,0x00000000,0x00000000,0x00000000,0xE401B900,0x001B9006,0x6E46E400,
+    0x1BFFFFE4,0x400001B9,0x9006E46E,0x1B90001B,0x46FF9000,0x0000006E,0x0001B900,0x06E46E40,
+    0x91B90000,0xE400001B,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x40000000,0x00001BFE,0x1BFFFFE4,0x40006E40,0xFE40006E,0xE401BFFF,0xBFFF9006,0x90001B91,
+    0xFFFE46FF,0xB91BFFFF,0x6E400001,0x000006E4,0x001B91B9,0x0006E400,0x00000000,0x00000000,
+    0x00000000,0x6E400000,0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xB9000000,0x90000001,0xE400001B,0x00006E46,0x000001B9,0x01B90000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000006E4,0x06E40000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x000006E4,0x001B9000,0x90000000,0xE400001B,0x40000006,
+    0x01B9006E,0x0001B900,0x06E46E40,0xFFF90000,0x0001BFFF,0x00006FF9,0x6E401B90,0xFFFE4000,
+    0x00000006,0x00000000,0xE4000000,0x1B906FFF,0x46E40000,0x9000006E,0x06E4001B,0x00000000,
+    0x000006E4,0x00006E40,0x01B91B90,0x0001B900,0x46E46E40,0x0000006E,0xE4000000,0x06E46FFF,
+    0x9006E400,0x0000001B,0x00000000,0x0006E400,0x0001BFE4,0x06FF9000,0x01B90000,0x00001B90,
+    0x006E46E4,0x001B9000,0x1BFFFFE4,0x00000000,0x00000000,0xE4000000,0x00000006,0x00000000,
+    0xE4000000,0x40000006,0x6FFFE46E,0x1B9006E4,0x06E40000,0x01BFE400,0xE4000000,0x401B9006,
+    0x6E40006E,0x0001B900,0x1B9001B9,0x46E40000,0x9000006E,0x06E4001B,0xFE46E400,0xE46FFFFF,
+    0x06FFFFFF,0x00000000,0xE46FFFE4,0xFFE46FFF,0x0006E46F,0x006E4000,0x06E46FF9,0x00001B90,
+    0x1B9006E4,0x00006E40,0x6E46E400,0x1B900000,0x400001B9,0x01B9006E,0x00001B90,0x006E46E4,
+    0x001B9000,0xE40006E4,0x00006E46,0x0006E400,0xFF900000,0xB90001BF,0x01B90001,0x0001B900,
+    0xB90001B9,0x6E400001,0x1B9006E4,0x06E40000,0x6E401B90,0xE4000000,0x00006E46,0x01B91B90,
+    0x006E4000,0x1B9001B9,0x46E40000,0x9000006E,0x06E4001B,0x6E46E400,0xE4000000,0x00000006,
+    0x6E400000,0x0001B900,0xB90001B9,0x6E400001,0x000006E4,0x06E46E40,0x00001B90,0xFF9006E4,
+    0x00006FFF,0x6E46E400,0x1B900000,0x400001B9,0x01B9006E,0x00001B90,0x006E46E4,0x001B9000,
+    0xE40006E4,0xBFFFFE46,0xFFFFE401,0xFF90001B,0xB9006FFF,0x01B90001,0x0001B900,0x001B9000,
+    0x6E400000,0xE40006E4,0x401B9006,0x9000006E,0xE400001B,0x401B9006,0x6E40006E,0xE401B900,
+    0xE4006FFF,0x001BFFFF,0x6FFFFF90,0xFFE40000,0x6E401BFF,0xE4000000,0x40000006,0x6E40006E,
+    0x0001B900,0xB90001B9,0x90000001,0x0000001B,0x06E46E40,0x6FF90000,0x006E46E4,0xF91B9000,
+    0x00001BFF,0x0001BFE4,0x06FF9000,0x00000000,0x00000000,0x00000000,0x00000000,0x000006E4,
+    0x00006E40,0x0006E400,0x006E4000,0xB9006E40,0x01B90001,0x0001B900,0x001B9000,0x6E400000,
+    0x000006E4,0x46E40000,0x9000006E,0x0000001B,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x06E40000,0xFE400000,0xE46FFFFF,0x06FFFFFF,0x6FFFFF90,0xE46FFFE4,
+    0xFFE46FFF,0x0000006F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x6E400000,0x006E4000,0x00000000,0x0006E400,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x006E4000,0xB90001B9,0x0006E401,0x000006E4,0x401B91B9,0x0000006E,
+    0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xFE400000,0x1B9006FF,0x06E40000,0x90000000,0xE46FFFFF,0x00000006,0x00000000,0x00000000,
+    0xB91B9000,0x00000001,0x1B900000,0x00000000,0x00001B90,0x006E4000,0x00006E40,0x6E400000,
+    0x000006E4,0xB9006E40,0xFE401B91,0x0001BFFF,0x000001B9,0x0006E400,0x000006E4,0x40006E40,
+    0x0006E46E,0x0001B900,0x40006E40,0x00001BFE,0xE4000000,0x06FFFFFF,0x00001B90,0x1B900000,
+    0x40000000,0x6E40006E,0x00000000,0x001B91B9,0x6E400000,0x006E4000,0x40006E40,0x01B9006E,
+    0x00000000,0x06E40000,0x6E400000,0xE46E4000,0xB91BFFFF,0x6E400001,0xE401B900,0x06FF9006,
+    0x0006E400,0xE4000000,0x40000006,0x0000006E,0xFFFFFFE4,0x00006E46,0x00000000,0x00000000,
+    0x00006E40,0x6E400000,0xE46E4000,0x401BFFFF,0x6E40006E,0x1BFFFFE4,0x40006E40,0x0006E46E,
+    0x0001B900,0x06E46E40,0x01B90000,0xE40006E4,0x00000006,0x0006E400,0x006E4000,0x40000000,
+    0xFE40006E,0x0001BFFF,0x001BFFF9,0x6FFFFF90,0xFFFFFFE4,0x40006E46,0x01B9006E,0x006E4000,
+    0x06E46E40,0x6E46E400,0xE46E4000,0xB9000006,0x6E400001,0x000006E4,0x06E401B9,0xFFFFE400,
+    0x0000001B,0xB90001B9,0x00000001,0xFFFFFFE4,0x40006E46,0x0006E46E,0x006E46E4,0x00006E40,
+    0x6E46E400,0x006E4000,0x400001B9,0x6E40006E,0xE40006E4,0xFFFF9006,0x0006E46F,0x0001B900,
+    0x06E46E40,0x01B90000,0xE40006E4,0x00000006,0x01B90000,0x0001B900,0x40000000,0x6E40006E,
+    0xE46E4000,0x46E40006,0x6E40006E,0x1B900000,0xBFFFFE40,0x01B90001,0x006E4000,0x06E46E40,
+    0x0006E400,0xE46E4000,0xB9000006,0x6E400001,0xE401B900,0x06E40006,0x0006E400,0x00000000,
+    0x06E46E40,0x00000000,0x006E4000,0x40006E40,0x0006E46E,0x006E46E4,0x40006E40,0x6E40006E,
+    0x00000000,0x400001B9,0x6E40006E,0xE40006E4,0x40000006,0xFFF9006E,0xFFFE401B,0x400001BF,
+    0x00001BFE,0xE40006E4,0x06FFFFFF,0x6E400000,0x000006E4,0x40000000,0x6E40006E,0xE46E4000,
+    0x46E40006,0x6E40006E,0x0001B900,0x00006E40,0x01B90000,0xFF900000,0x06E46FFF,0x9006E400,
+    0x0001BFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x006E4000,0xBFFFFE40,0xFFF90001,0xFF90001B,0xFFE46FFF,0x6E46FFFF,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00006E40,0x6FFFE400,0x00000000,0x401B91B9,0xFFFFFFFE,0x1BFE401B,0x40000000,0x0006FFFE,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00006E40,
+    0x6FFFFF90,0x000006E4,0x06E40000,0xFFF90000,0x1B9006FF,0x001B9000,0x91B90000,0x0000001B,
+    0xB91B9000,0x0006E401,0x0001B900,0xF90001B9,0x90001BFF,0x0001B91B,0x06E46E40,0x0006E400,
+    0x0001B900,0xBFFF9000,0x91B90001,0x006E401B,0x06E46E40,0x90000000,0xE400001B,0x40006E46,
+    0x6FF9006E,0xFF9006E4,0x06FFFFFF,0x6E400000,0xE401B900,0x06E40006,0x00000000,0xE40006E4,
+    0x06E40006,0x91B90000,0x1B90001B,0x400001B9,0x6E40006E,0x006E4000,0x40000000,0x6E40006E,
+    0x000006E4,0x00000000,0x6E46E400,0xE46E4000,0x06E46E46,0x6E46E400,0x00000000,0x400001B9,
+    0x6E401BFE,0x000006E4,0x06E40000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00006E40,0x0006E400,0x006E46E4,0x06E46E40,0x6E46E400,0x006E4000,0x401BFFF9,0x6E46E46E,
+    0xE40006E4,0x00006E46,0x0006E400,0xE401B900,0x06E46E46,0x00000000,0x006FF900,0xFFFF9000,
+    0xFFF9006F,0xFF90001B,0xF90001BF,0x6E401BFF,0xE4000000,0x46E40006,0x6E40006E,0x1B9006E4,
+    0x40006E40,0x6E40006E,0x006E46E4,0x401BFFF9,0xFFFFFFFE,0x1B90001B,0xB9000000,0x01B90001,
+    0x000006E4,0xB9000000,0x6E401B91,0x00000000,0x06E40000,0x6E400000,0xE40006E4,0x40006E46,
+    0x0006E46E,0xFF9006E4,0x46E46FFF,0x6E40006E,0x006E4000,0x06E46E40,0x00001B90,0x1B900000,
+    0x400001B9,0x0000006E,0x0001B900,0xB90001B9,0x01B90001,0x1BFE4000,0x06FF9000,0xFFF90000,
+    0xFF9006FF,0xFFE46FFF,0x9006FFFF,0xE401BFFF,0x06E40006,0x6E400000,0x006FFFE4,0x40006E40,
+    0xFFFFE46E,0xE400001B,0x001BFFFF,0x01B91B90,0xFFFE4000,0x401BFFFF,0x6E46FFFE,0xFFFE4000,
+    0x00000006,0x0006E400,0xE401B900,0x46E40006,0x6E40006E,0x000006E4,0x06E40000,0x0006E400,
+    0x000006E4,0x06E46E40,0x6E401B90,0x006E4000,0x00006E40,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,0x40000006,0x0006E46E,0x006E46E4,
+    0x06E46E40,0x0006E400,0x000006E4,0x06FFFFF9,0x6E400000,0xE40006E4,0xFFFF9006,0x0000006F,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xF9000000,
+    0xFE401BFF,0x0001BFFF,0x06FFFFF9,0x6FFFFF90,0x1BFFF900,0x001B9000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x40000000,0x90001BFE,0x006E46FF,0x06E40000,0x6FFFFF90,
+    0x00000000,0xFFE401B9,0x00001BFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x6E400000,0x1BFE4000,
+    0x46FF9000,0x0000006E,0x006E46E4,0x001B9000,0x01BFE400,0xE40006E4,0x00000006,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x91B90000,0xE400001B,0x00000006,
+    0x00001B90,0x0001B900,0x401B9000,0x6E46E46E,0x1B9006E4,0x401B9000,0x0000006E,0x1B900000,
+    0x06E401B9,0x01B90000,0x0001B900,0x40006E40,0x6E40006E,0xE4000000,0x40000006,0x9000006E,
+    0x0001B91B,0x00000000,0x0006E400,0x006E4000,0x06E40000,0x00000000,0xE46E4000,0x06E46E46,
+    0x6E46E400,0xFF900000,0x40000006,0x01B9006E,0x000006E4,0x400001B9,0x6E40006E,0x006E4000,
+    0x001B91B9,0x01B91B90,0x0001B900,0x06E46E40,0xFFFFE400,0xFFFE46FF,0x00006FFF,0x00000000,
+    0x00000000,0x401BFFF9,0x01B9006E,0x000006E4,0x000001B9,0x6FF90000,0x0001B900,0x06E401B9,
+    0x01B90000,0x00000000,0x40006E40,0x0000006E,0x00000000,0x00000000,0x00000000,0xE4000000,
+    0x00000006,0x0006E400,0x1BFFF900,0xBFFF9000,0x00000001,0x006E46E4,0x06E401B9,0x01B90000,
+    0x00000000,0xF91B9000,0x6FFFFFFF,0x000006E4,0xF90001B9,0x6E401BFF,0x006E4000,0x001BFFF9,
+    0x01BFFF90,0x1BFFF900,0xBFFFFE40,0x0006E401,0xE4000000,0x00000006,0x6E46E400,0x006E4000,
+    0x46FFFFF9,0x0000006E,0x000006E4,0x400001B9,0x9000006E,0x0000001B,0x06E401B9,0x0006E400,
+    0xE40006E4,0x40006E46,0x0006E46E,0x006E46E4,0x06E46E40,0x6E46E400,0xE46E4000,0x001BFFFF,
+    0x0006E400,0xFFFFF900,0x40006E46,0x0006E46E,0x006E46E4,0x06E40000,0x01B90000,0xFF900000,
+    0x00006FFF,0x01B90000,0x1BFFFFE4,0x06E40000,0x9006E400,0xE46FFFFF,0x46E40006,0x6FFFFFFE,
+    0xFFFFFFE4,0x40006E46,0x0006E46E,0xE4000000,0x06E40006,0x6E46E400,0xE46E4000,0x06E40006,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,
+    0x40000006,0x0006E46E,0x006E46E4,0x06E40000,0x6E400000,0xE46E4000,0x00000006,0x0006E400,
+    0xE40006E4,0x40006E46,0xFFF9006E,0x000006FF,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x06E40000,0x0006E400,0xE46E4000,0x46E40006,0x6E40006E,0xE40006E4,
+    0x40006E46,0xFFFFE46E,0xE40006FF,0xF9000006,0x9006FFFF,0x0001BFFF,0x40000000,0xFFFFFFFE,
+    0xFFFE46FF,0xB90001BF,0x6E400001,0x1BFE4000,0xF9000000,0x00001BFF,0x1BFFF900,0xBFFF9000,
+    0xFFF90001,0xFF90001B,0xF90001BF,0x6E401BFF,0x006E4000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x400001B9,0x6E40006E,0x0001B900,0x40006E40,0x00001BFE,
+    0xE40006E4,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06E46FF9,0x01B90000,0x006E4000,
+    0x40006E40,0x01B9006E,0xE401B900,0x001B9006,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xE4000000,0x06E46E46,0x9006FF90,0xE400001B,0x401BFFFF,
+    0x9000006E,0x0000001B,0x400001B9,0x6E40006E,0xFF900000,0xB9000006,0x9006E401,0x0000001B,
+    0xF9000000,0x6FFFE46F,0xFFFFF900,0x06E401BF,0x6E400000,0x0001B900,0xFFE401B9,0x0000006F,
+    0xE401B900,0x00000006,0x01B91B90,0x006E4000,0x06E46E40,0x01B90000,0xFFFE4000,0x000001BF,
+    0x0006FF90,0xFFFFF900,0x401B9006,0x0006FFFE,0x1B9006E4,0x06E40000,0x6E400000,0x000006E4,
+    0xB9006E40,0x01B90001,0x0001B900,0x00000000,0x0006E400,0x1B900000,0x000001B9,0x00000000,
+    0x000006E4,0x400001B9,0x01B9006E,0x006E4000,0x06E401B9,0x91B90000,0xE400001B,0x06E40006,
+    0x00001B90,0xFF9006E4,0xB9006E46,0x01B90001,0x0001B900,0xB90001B9,0x01BFE401,0xE401BFE4,
+    0x401BFE46,0x6FF9006E,0x00000000,0x06FFFFF9,0x01B90000,0x006E4000,0xB9006E40,0x6E400001,
+    0x000006E4,0x06E401B9,0x0006E400,0xFF9006E4,0x46E401BF,0x6E40006E,0xE46E4000,0xB9000006,
+    0x01B90001,0x0001B900,0xB90001B9,0x9006E401,0xFFFE401B,0x400001BF,0x0006E46E,0x000006E4,
+    0x400001B9,0x9000006E,0x0001B91B,0x06E46E40,0x01B90000,0x1BFFF900,0x06E40000,0x00001B90,
+    0x006E46E4,0x00006E40,0x00001B90,0x006FF900,0xB90001B9,0x01B90001,0xE401B900,0xB91B9006,
+    0x01B90001,0xE46E4000,0x06E40006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x1B9006E4,0x06E40000,0x6E46FF90,0xFFFFF900,0xB90001BF,0x6E46FF91,
+    0x0001B900,0xB90001B9,0x9006E401,0x0001B91B,0x400001B9,0x0006E46E,0x000006E4,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x06E40000,0x00001B90,0x000006E4,
+    0x00006E40,0x00001B90,0x0001B900,0xB9000000,0x01B90001,0xE401B900,0xB91B9006,0xFFF90001,
+    0x0001B91B,0x401BFFF9,0x6FFFFFFE,0x006E4000,0xB9006E40,0x6E400001,0x1BFE4000,0x001B91B9,
+    0x0006E400,0xE46FF900,0xF9006FFF,0x01BFFFFF,0x1B900000,0x06E40000,0x00000000,0x006FFFE4,
+    0xB90001B9,0x9006E401,0x0000001B,0x00000000,0x00000000,0x00000000,0xB9000000,0x01B91B91,
+    0x0001B900,0xB9006E40,0x9006E401,0x1B90001B,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x1B91B900,0xB90001B9,0x6E400001,0x1B9006E4,0x401B91B9,0x0000006E,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xFFFE4000,0xB9006FFF,0x90000001,0x0001B91B,0x401B9000,0x0006E46E,0x0001B900,
+    0x06E46E40,0x91B91B90,0x0001B91B,0x00000000,0x90001B90,0x1BFFFFFF,0x06E46E40,0x00001B90,
+    0xFFFE4000,0xFFFF9006,0x90001BFF,0xE40006FF,0xB9006FFF,0x90000001,0xE401B91B,0xB91B9006,
+    0x90000001,0xE400001B,0xB9006E46,0x6E400001,0x006E46E4,0xBFFF91B9,0x00000001,0x1B9006E4,
+    0x001B9000,0x00000000,0x1B900000,0xB9000000,0x01B90001,0x1B900000,0x00006E40,0x90001B90,
+    0xFF91B91B,0xB91B9006,0x9006E401,0x006E401B,0x00006E40,0x91B91B90,0x0001B91B,0x46E46E40,
+    0x91B9006E,0x006E401B,0x46E40000,0x9000006E,0x0000001B,0x06FFFE40,0x6FFFFF90,0x0001B900,
+    0x400001B9,0x01B9006E,0x1B900000,0xB91B9000,0x91B91B91,0x1B91B91B,0x401B91B9,0x6E40006E,
+    0x1B900000,0xB91B91B9,0x6E400001,0xE401B900,0x001B9006,0x00001B90,0x006E4000,0xFFFF9000,
+    0x0000006F,0x1B91B900,0xB91B9000,0x01B90001,0x006E4000,0x06FFFFF9,0x6FFFE400,0xFF91B900,
+    0xB91B9006,0x91B91B91,0x1B90001B,0x400001B9,0x6E40006E,0xFFFE4000,0x46E401BF,0x90001BFE,
+    0xE400001B,0xB9000006,0x00000001,0x1B900000,0xBFFFFE40,0x90001B91,0xFFFE401B,0xB90001BF,
+    0x01B90001,0x1B91B900,0xB91B9000,0x91B91B91,0x1BFE401B,0x00006FF9,0x01B91B90,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B91B900,0x000001B9,0x01B91B90,
+    0xFF91B900,0x00006FFF,0x01B90000,0x0001B900,0xB90001B9,0x90001B91,0x0001B91B,0x401B9000,
+    0x6E40006E,0xE4000000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x06E40000,0x91B91B90,0x1B90001B,0xB90001B9,0x00001B91,0xE4000000,0x06E40006,0x01B90000,
+    0x1B91B900,0x401B9000,0x6FFFFFFE,0x006E4000,0x00006E40,0x0006E400,0xFF900000,0xBFE40006,
+    0x91B90001,0x006FFFFF,0x00006E40,0x01B91B90,0x000006E4,0xFFE40000,0xFE40006F,0x1B91BFFF,
+    0x40000000,0x00001BFE,0x000006E4,0x06FFFE40,0x6FFFE400,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x40000000,0x01B9006E,0x0001BFE4,0x001B91B9,0x6E401B90,0x1B900000,0x000001B9,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0001B900,0x46E46E40,0x91B9006E,
+    0x1B90001B,0x00006E40,0x01B91B90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF900,0x001B9006,0x90000000,0xFF90001B,
+    0xB91BFFFF,0x6E400001,0x006E46E4,0xFFFF91B9,0xFE401BFF,0x1BFFFFFF,0x000001B9,0x9006E400,
+    0x0001B91B,0x001B91B9,0x01BFE400,0x006E4000,0xB91B9000,0xFFF90001,0xE46E401B,0xB91B9006,
+    0x91B90001,0x0000001B,0x00000000,0x00001B90,0x0001B900,0x06E46E40,0x91B91B90,0xE400001B,
+    0x00006E46,0x01B91B90,0x1BFFF900,0x00000000,0x00000000,0x1B900000,0xF9000000,0x00001BFF,
+    0xE4000000,0x06E40006,0x9006E400,0x0001B91B,0x001B91B9,0x90000000,0x1B90001B,0xB9000000,
+    0x6E400001,0x1B9006E4,0x001B91B9,0x6E46E400,0x1B900000,0x06E401B9,0x6E46FF90,0x006E4000,
+    0x001BFFF9,0x00001B90,0xE46E46E4,0xBFFF9006,0x00000001,0x006E46E4,0xB91B9000,0x91B90001,
+    0x0000001B,0x001B9000,0x6FFFFF90,0x006E4000,0x06E401B9,0x91BFE400,0xE400001B,0x00006E46,
+    0x00001B90,0xE46E46E4,0x40006E46,0x0006E46E,0xFFFE46E4,0x46E401BF,0x6E40006E,0x006E4000,
+    0x401BFE40,0x6E40006E,0xFFFFF900,0x001B9006,0x6E400000,0x1B900000,0x00000000,0x0006FF90,
+    0xE40006E4,0xFFFF91BF,0x6E401BFF,0x1B900000,0x46E401B9,0x6E46E46E,0xE46E4000,0x06E40006,
+    0x00001B90,0x006E46E4,0xFFFFFE40,0x0000006F,0xE46E46E4,0xB9000006,0x90000001,0x0000001B,
+    0x000001B9,0x00001B90,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xE401BFE4,0x40006E46,0x0006E46E,0x1B9006E4,0x46E40000,0x6E46E46E,0x00000000,0x46E40000,
+    0x0006E46E,0x0001B900,0x001B9000,0x01B90000,0x1B91B900,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xF9000000,0x6E401BFF,0xE46E4000,0x46E40006,0x0000006E,
+    0x1BFFF900,0x40006E40,0x0006E46E,0x006E46E4,0xB9000000,0x90000001,0x1BFFFFFF,0x06FFFE40,
+    0xFFFFFF90,0xFFFE401B,0xFFFF9006,0x90001BFF,0xE400001B,0x40006FFF,0x0006FFFE,0x000006E4,
+    0xFFFF9000,0xFFF9006F,0xFFFE401B,0x40006FFF,0x9000006E,0x0001BFFF,0x401BFFF9,0x0000006E,
+    0x00000000,0x00000000,0x00000000,0x00000000,0xB9000000,0x91B90001,0x0000001B,0x001BFE40,
+    0x90001B90,0x0001B91B,0x000001B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x001B91B9,0x91B90000,0x1B90001B,0x001B9000,0x01B90000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0006E400,0x006E4000,
+    0x06FFFFF9,0x6E400000,0x00000000,0x001BFE40,0x9006E400,0x006FFFFF,0x001B9000,0x91B91B90,
+    0xE400001B,0xFFE40006,0x90001BFF,0xE401BFFF,0x001BFE46,0x01BFFF90,0x1BFFF900,0x40006E40,
+    0x0006E46E,0x006E46E4,0xBFFFFFF9,0x01B90001,0x0001B900,0x00006E40,0x01BFE400,0x1B900000,
+    0x001B9000,0x90000000,0x1B90001B,0x001B91B9,0x00001B90,0xE40006E4,0x40006E46,0x01BFE46E,
+    0x006E46E4,0x06E46E40,0x6E46E400,0xE46E4000,0x46E40006,0x01B9006E,0x0001B900,0x400001B9,
+    0xFFFFE46E,0x1BFE46FF,0x00000000,0x90001B90,0x0000001B,0x001B9000,0x90001B90,0x006E401B,
+    0x06E40000,0x6E46E400,0xE4000000,0x40000006,0x6E40006E,0xFFFFFFE4,0xB91B9006,0x0006E401,
+    0x006E46E4,0xB90001B9,0xFFFFE401,0x006E401B,0x00006E40,0x01BFE400,0x00000000,0x001B9000,
+    0x90000000,0x1B90001B,0xB91B9000,0x00000001,0xE40006E4,0x00006E46,0x0006E400,0x006E4000,
+    0x06E46E40,0x90000000,0xE401B91B,0x06E40006,0x01B90000,0x0001B900,0x400001B9,0x6E40006E,
+    0x00000000,0x001BFE40,0x90001B90,0x0000001B,0xBFFFFFF9,0x6FFFE401,0xFFFFF900,0x06E401BF,
+    0x6E46E400,0xE46E4000,0x40000006,0x6E40006E,0xE40006E4,0x06E40006,0x0006E400,0x000006E4,
+    0xBFFFFFF9,0x01B90001,0x0001B900,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xE40006E4,0xBFFF9006,0x0006E401,0xFF900000,0xF90001BF,
+    0x00001BFF,0x000006E4,0x06FFFFF9,0x0006E400,0x006E4000,0x06FFFFF9,0xFFFFE400,0x000006FF,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xFE46FF90,0x006E401B,0x46E40000,0xFE46FFFE,0xFF90001B,
+    0x401BFE46,0x0006FFFE,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x46E401B9,
+    0x01B9006E,0x006E46E4,0x46E401B9,0x01B9006E,0x000006E4,0x400001B9,0x6E40006E,0x006E4000,
+    0x46FFFFF9,0x00001BFE,0x1B900000,0x001B91B9,0x90001B90,0x0000001B,0x000001B9,0x90001B90,
+    0x0001B91B,0x06FFFFF9,0xFFFFFF90,0x006E46FF,0x46E401B9,0x01B9006E,0x006E46E4,0x06FFFFF9,
+    0x0006E400,0x006E4000,0xB91B9000,0x0006E401,0xE4000000,0x400001BF,0x0006E46E,0x006E46E4,
+    0x06FFFE40,0x01B90000,0x1B91B900,0x46E401B9,0x0000006E,0x006E46E4,0x400001B9,0x6E46E46E,
+    0x006E46E4,0x46E401B9,0x01B9006E,0x1B900000,0xB9000000,0x00001B91,0x000006E4,0x00006FF9,
+    0xFE400000,0x1B91B91B,0xB9000000,0xFFF90001,0xFF91BFFF,0x401BFFFF,0x0006FFFE,0x1B91B900,
+    0x46E40000,0x01B9006E,0xFF9006E4,0x401BFE46,0x01B9006E,0x006E46E4,0x46E401B9,0x01BFFFFE,
+    0x1B91B900,0x06E40000,0x90000000,0xE400001B,0x400001BF,0x0006E46E,0x006E46E4,0x06FFFE40,
+    0x01B90000,0x1B91B900,0x46E401B9,0x0000006E,0xFF9006E4,0x001BFFFF,0x90001B90,0x006E401B,
+    0x06E401B9,0xFE46FF90,0x0000001B,0x06E40000,0x9006E400,0x0001B91B,0x46E40000,0x00001BFE,
+    0x1B900000,0x001B91B9,0x90001B90,0x0000001B,0x000001B9,0x90001B90,0x0001B91B,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xE40006E4,
+    0x40006E46,0xFFFFE46E,0x0000001B,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0xFF900000,0x00000006,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x90000000,0x000006FF,0x00000000,0x00000000,0x00000000,0x001B9000,0x01BFE400,
+    0x006FFFE4,0x000001B9,0x6E401B90,0x1BFFF900,0x401BFFF9,0x01B9006E,0x00000000,0x00000000,
+    0x00000000,0xFF900000,0x46E40006,0x6FFFE46E,0xE46E46E4,0x46E40006,0xFFFFE46E,0xE46FFFFF,
+    0x06FFFFFF,0x00000000,0x00000000,0x00006E40,0x6E401B90,0x006E4000,0x40006FF9,0xFFF9006E,
+    0x006E401B,0xFFE401B9,0x9006FFFF,0x0001BFFF,0x401B91B9,0x01B9006E,0xE46E46E4,0x46E46FFF,
+    0x91B9006E,0x006E401B,0x00000000,0x00000000,0x00000000,0xBFFFFFF9,0x6FFFE401,0x006FF900,
+    0xB91B9000,0x6E400001,0x006E4000,0x401B91B9,0x01B9006E,0xE4000000,0x40000006,0x91B9006E,
+    0x006E401B,0xB91B91B9,0x6FFFE401,0x006E46E4,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x1B900000,0x00006E40,0x6E401B90,0x006E4000,0x40006E40,0x91B9006E,0xFF90001B,
+    0x00000006,0x90001B90,0x006FFFFF,0x06E401B9,0x0006FF90,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x91B91B90,0x1B91B91B,0x001B9000,0x6FFFE400,0x006FFFE4,0x000001B9,
+    0xFFF91B90,0x0000001B,0x00000000,0x00000000,0x006E4000,0x40006E40,0x0006E46E,0x00000000,
+    0x00000000,0x00000000,0x00000000,0xB9000000,0xFFFFFF91,0x0001BFFF,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xB9000000,
+    0x6E400001,0x006E4000,0x00000000,0x90000000,0xE401B91B,0xB9006E46,0x6E46E401,0x000006E4,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0xFFFFF900,0x40006FFF,0x0000006E,0xFFFFFFE4,0xFFFF9006,0x0000006F,0x006FFFE4,0xB91B91B9,
+    0x6E46E401,0x1B91B900,0x000001B9,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B91B900,0x00000000,0x00000000,
+    0x00000000,0x401B9000,0x0006FFFE,0xE46E46E4,0x06E46E46,0x00000000,0xFFFFFFE4,0x00006FFF,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xFFFFF900,
+    0x06E46FFF,0x0006E400
+};
+
+#endif /* NK_INCLUDE_DEFAULT_FONT_ATLAS */
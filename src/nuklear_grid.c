@@ -0,0 +1,262 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                              GRID
+ *
+ * ===============================================================*/
+NK_INTERN void
+nk_grid_header(struct nk_grid *grid)
+{
+    int i;
+    struct nk_context *ctx = grid->ctx;
+    struct nk_window *win = ctx->current;
+    struct nk_panel *layout = win->layout;
+    const struct nk_style *style = &ctx->style;
+    const struct nk_user_font *font = style->font;
+    struct nk_command_buffer *out = &win->buffer;
+    struct nk_input *in;
+    struct nk_rect header;
+    struct nk_text text;
+
+    in = ((win->flags|layout->flags) & NK_WINDOW_ROM) ? 0: &ctx->input;
+    header.x = layout->bounds.x;
+    header.y = layout->bounds.y;
+    header.w = layout->bounds.w;
+    header.h = grid->row_height;
+    nk_fill_rect(out, header, 0, style->window.header.normal.data.color);
+
+    text.padding = style->text.padding;
+    text.background = style->window.header.normal.data.color;
+    for (i = grid->col_begin; i < grid->col_end; ++i) {
+        nk_flags ws = 0;
+        struct nk_rect cell, handle;
+        struct nk_grid_column *col = &grid->columns[i];
+        cell.x = grid->origin.x + col->offset;
+        cell.y = header.y;
+        cell.w = col->width;
+        cell.h = header.h;
+
+        /* column resizing by dragging the right column border */
+        handle.x = cell.x + cell.w - style->window.spacing.x;
+        handle.y = cell.y;
+        handle.w = 2 * style->window.spacing.x;
+        handle.h = cell.h;
+        if (in && (grid->flags & NK_GRID_RESIZABLE) && in->mouse.buttons[NK_BUTTON_LEFT].down &&
+            nk_input_has_mouse_click_down_in_rect(in, NK_BUTTON_LEFT, handle, nk_true)) {
+            col->width = NK_MAX(col->width + in->mouse.delta.x, col->min_width);
+            in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x = cell.x + col->width;
+            ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_RESIZE_HORIZONTAL];
+        } else if ((grid->flags & NK_GRID_SORTABLE) && nk_button_behavior(&ws,
+            nk_shrink_rect(cell, (grid->flags & NK_GRID_RESIZABLE) ? style->window.spacing.x: 0),
+            (in && nk_input_is_mouse_hovering_rect(in, layout->clip)) ? in: 0, NK_BUTTON_DEFAULT)) {
+            /* clicking a column header cycles sort order and resets all other columns */
+            int j;
+            enum nk_grid_sort sort = (col->sort == NK_GRID_SORT_ASCENDING) ?
+                NK_GRID_SORT_DESCENDING: NK_GRID_SORT_ASCENDING;
+            for (j = 0; j < grid->column_count; ++j)
+                grid->columns[j].sort = NK_GRID_SORT_NONE;
+            col->sort = sort;
+            grid->sorted = nk_true;
+        }
+        if (ws & NK_WIDGET_STATE_HOVER) {
+            text.text = style->window.header.label_hover;
+            text.background = style->window.header.hover.data.color;
+            nk_fill_rect(out, cell, 0, text.background);
+        } else {
+            text.text = style->window.header.label_normal;
+            text.background = style->window.header.normal.data.color;
+        }
+
+        /* sort indicator */
+        if (col->sort != NK_GRID_SORT_NONE) {
+            struct nk_rect sym;
+            sym.w = sym.h = font->height * 0.5f;
+            sym.x = cell.x + cell.w - (sym.w + style->text.padding.x + style->window.spacing.x);
+            sym.y = cell.y + (cell.h - sym.h) * 0.5f;
+            nk_draw_symbol(out, (col->sort == NK_GRID_SORT_ASCENDING) ?
+                NK_SYMBOL_TRIANGLE_UP: NK_SYMBOL_TRIANGLE_DOWN, sym,
+                text.background, text.text, 0, font);
+            cell.w -= sym.w + style->window.spacing.x;
+        }
+        if (col->title)
+            nk_widget_text(out, cell, col->title, nk_strlen(col->title),
+                &text, col->align, font);
+        nk_stroke_line(out, grid->origin.x + col->offset + col->width, header.y,
+            grid->origin.x + col->offset + col->width, header.y + header.h, 1.0f,
+            style->window.border_color);
+    }
+}
+NK_API int
+nk_grid_begin(struct nk_context *ctx, struct nk_grid *grid, const char *id,
+    nk_flags flags, struct nk_grid_column *columns, int column_count,
+    float row_height, int row_count)
+{
+    int i;
+    float offset;
+    float visible_begin;
+    float visible_end;
+    struct nk_window *win;
+    struct nk_panel *layout;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(grid);
+    NK_ASSERT(id);
+    NK_ASSERT(columns || !column_count);
+    if (!ctx || !grid || !id || (!columns && column_count)) return 0;
+
+    nk_zero(grid, sizeof(*grid));
+    if (!nk_group_begin(ctx, id, flags & ~(nk_flags)(NK_GRID_SORTABLE|NK_GRID_RESIZABLE)))
+        return 0;
+
+    win = ctx->current;
+    layout = win->layout;
+    if (row_height <= 0)
+        row_height = ctx->style.font->height + 2 * ctx->style.text.padding.y;
+
+    grid->ctx = ctx;
+    grid->flags = flags;
+    grid->columns = columns;
+    grid->column_count = column_count;
+    grid->row_count = NK_MAX(row_count, 0);
+    grid->row_height = row_height;
+    grid->origin.x = layout->bounds.x - (float)*layout->offset_x;
+    grid->origin.y = layout->bounds.y + row_height;
+    grid->scroll_y = *layout->offset_y;
+
+    /* resolve column offsets once instead of laying out every cell */
+    for (offset = 0, i = 0; i < column_count; ++i) {
+        struct nk_grid_column *col = &columns[i];
+        col->width = NK_MAX(col->width, col->min_width);
+        col->offset = offset;
+        col->text_width = NK_MAX(col->width - 2 * ctx->style.text.padding.x, 0);
+        offset += col->width;
+
+        /* measured texts only stay valid for the same font and width */
+        if (col->font != ctx->style.font || col->font_height != ctx->style.font->height ||
+            col->measured_width != col->text_width) {
+            nk_zero(col->texts, sizeof(col->texts));
+            col->font = ctx->style.font;
+            col->font_height = ctx->style.font->height;
+            col->measured_width = col->text_width;
+        }
+    }
+    grid->total_width = offset;
+
+    /* visible columns */
+    visible_begin = (float)*layout->offset_x;
+    visible_end = visible_begin + layout->clip.w;
+    for (i = 0; i < column_count && columns[i].offset + columns[i].width <= visible_begin; ++i);
+    grid->col_begin = i;
+    for (; i < column_count && columns[i].offset < visible_end; ++i);
+    grid->col_end = i;
+
+    /* visible rows */
+    visible_begin = (float)*layout->offset_y;
+    visible_end = visible_begin + NK_MAX(layout->clip.h - row_height, 0);
+    grid->row_begin = NK_MIN((int)(visible_begin / row_height), grid->row_count);
+    grid->row_end = NK_MIN(nk_iceilf(visible_end / row_height) + 1, grid->row_count);
+    return 1;
+}
+NK_API struct nk_rect
+nk_grid_cell_bounds(const struct nk_grid *grid, int row, int col)
+{
+    struct nk_rect bounds;
+    NK_ASSERT(grid);
+    NK_ASSERT(col >= 0 && col < grid->column_count);
+    if (!grid || col < 0 || col >= grid->column_count)
+        return nk_rect(0,0,0,0);
+
+    /* row offsets in huge grids exceed float precision so subtract scrolling first */
+    bounds.x = grid->origin.x + grid->columns[col].offset;
+    bounds.y = grid->origin.y + (float)((double)row * (double)grid->row_height - (double)grid->scroll_y);
+    bounds.w = grid->columns[col].width;
+    bounds.h = grid->row_height;
+    return bounds;
+}
+NK_API void
+nk_grid_cell_text(struct nk_grid *grid, int row, int col,
+    const char *str, int len)
+{
+    float text_width;
+    struct nk_rect cell;
+    struct nk_rect label;
+    const struct nk_user_font *font;
+    struct nk_grid_column *column;
+    struct nk_grid_text *text;
+    struct nk_command_buffer *out;
+    const struct nk_style *style;
+    nk_hash hash;
+
+    NK_ASSERT(grid);
+    NK_ASSERT(grid->ctx);
+    if (!grid || !grid->ctx || !str || !len) return;
+    if (row < grid->row_begin || row >= grid->row_end) return;
+    if (col < grid->col_begin || col >= grid->col_end) return;
+
+    style = &grid->ctx->style;
+    font = style->font;
+    out = &grid->ctx->current->buffer;
+    column = &grid->columns[col];
+    cell = nk_grid_cell_bounds(grid, row, col);
+    if (cell.y + cell.h <= out->clip.y || cell.y >= out->clip.y + out->clip.h)
+        return;
+
+    /* visible cells mostly show the same text as in the last frame so the
+     * measured and clamped width is looked up by text hash first */
+    hash = nk_murmur_hash(str, len, 0);
+    text = &column->texts[hash % NK_GRID_TEXT_CACHE_SIZE];
+    if (text->length != len || text->hash != hash) {
+        text->hash = hash;
+        text->length = len;
+        text->clamped = len;
+        text->width = font->width(font->userdata, font->height, str, len);
+        if (text->width > column->text_width) {
+            int glyphs = 0;
+            text->clamped = nk_text_clamp(font, str, len, column->text_width,
+                &glyphs, &text->width, 0,0);
+        }
+    }
+    len = text->clamped;
+    text_width = text->width;
+    if (!len) return;
+    label.y = cell.y + (cell.h - font->height) * 0.5f;
+    label.h = font->height;
+    label.w = text_width;
+    if (column->align & NK_TEXT_ALIGN_RIGHT)
+        label.x = cell.x + cell.w - (style->text.padding.x + text_width);
+    else if (column->align & NK_TEXT_ALIGN_CENTERED)
+        label.x = cell.x + (cell.w - text_width) * 0.5f;
+    else label.x = cell.x + style->text.padding.x;
+    nk_push_text(out, label, str, len, font, style->window.background, style->text.color);
+}
+NK_API void
+nk_grid_cell_label(struct nk_grid *grid, int row, int col, const char *str)
+{
+    nk_grid_cell_text(grid, row, col, str, nk_strlen(str));
+}
+NK_API int
+nk_grid_end(struct nk_grid *grid)
+{
+    struct nk_context *ctx;
+    struct nk_panel *layout;
+
+    NK_ASSERT(grid);
+    NK_ASSERT(grid->ctx);
+    if (!grid || !grid->ctx) return 0;
+
+    /* header is drawn last so scrolled rows vanish below it */
+    ctx = grid->ctx;
+    layout = ctx->current->layout;
+    nk_grid_header(grid);
+
+    /* content size of all rows and columns for scrollbars, the height of
+     * huge grids is computed in double so it is only rounded once */
+    layout->at_y = (float)((double)layout->bounds.y +
+        (double)grid->row_height * (double)(grid->row_count + 1));
+    layout->row.height = 0;
+    layout->max_x = layout->bounds.x + grid->total_width;
+    nk_group_end(ctx);
+    return grid->sorted;
+}
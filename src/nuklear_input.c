@@ -13,6 +13,8 @@ nk_input_begin(struct nk_context *ctx)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder)
+        nk_input_record_op(ctx, NK_INPUT_RECORD_BEGIN);
     in = &ctx->input;
     for (i = 0; i < NK_BUTTON_MAX; ++i)
         in->mouse.buttons[i].clicked = 0;
@@ -26,6 +28,93 @@ nk_input_begin(struct nk_context *ctx)
     for (i = 0; i < NK_KEY_MAX; i++)
         in->keyboard.keys[i].clicked = 0;
 }
+NK_INTERN int
+nk_input_is_modifier(enum nk_keys key)
+{
+    return key == NK_KEY_SHIFT || key == NK_KEY_CTRL;
+}
+NK_INTERN int
+nk_input_text_key_changed(const struct nk_input *in)
+{
+    int i;
+    for (i = 0; i < NK_KEY_MAX; ++i)
+        if (in->keyboard.keys[i].clicked && !nk_input_is_modifier((enum nk_keys)i))
+            return nk_true;
+    return nk_false;
+}
+NK_INTERN int
+nk_input_apply_event(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    /* state is only latched once per frame so an event is deferred to the
+     * next frame if it would overwrite or reorder a change of this frame */
+    int i, buttons_changed = nk_false;
+    struct nk_input *in = &ctx->input;
+    for (i = 0; i < NK_BUTTON_MAX; ++i)
+        buttons_changed |= in->mouse.buttons[i].clicked != 0;
+
+    switch (evt->type) {
+    case NK_INPUT_EVENT_MOTION:
+        if (buttons_changed) return nk_false;
+        nk_input_motion(ctx, evt->data.motion.x, evt->data.motion.y);
+        break;
+    case NK_INPUT_EVENT_BUTTON: {
+        /* a left button press close enough in time to the last one also
+         * presses the double click button until the left one is released */
+        int dbl = nk_false;
+        if (evt->data.button.id == NK_BUTTON_LEFT && evt->data.button.down)
+            dbl = ctx->input_click_armed &&
+                evt->time - ctx->input_click_time <= NK_INPUT_DOUBLE_CLICK_TIME;
+        else if (evt->data.button.id == NK_BUTTON_LEFT)
+            dbl = in->mouse.buttons[NK_BUTTON_DOUBLE].down;
+        if (in->mouse.buttons[evt->data.button.id].clicked ||
+            (dbl && in->mouse.buttons[NK_BUTTON_DOUBLE].clicked))
+            return nk_false;
+        if (evt->data.button.id == NK_BUTTON_LEFT && evt->data.button.down) {
+            ctx->input_click_armed = !dbl;
+            ctx->input_click_time = evt->time;
+        }
+        nk_input_button(ctx, evt->data.button.id, evt->data.button.x,
+            evt->data.button.y, evt->data.button.down);
+        if (dbl)
+            nk_input_button(ctx, NK_BUTTON_DOUBLE, evt->data.button.x,
+                evt->data.button.y, evt->data.button.down);
+    } break;
+    case NK_INPUT_EVENT_KEY:
+        if (in->keyboard.keys[evt->data.key.key].clicked || buttons_changed ||
+            (in->keyboard.text_len && !nk_input_is_modifier(evt->data.key.key)))
+            return nk_false;
+        nk_input_key(ctx, evt->data.key.key, evt->data.key.down);
+        break;
+    case NK_INPUT_EVENT_SCROLL:
+        if (buttons_changed) return nk_false;
+        nk_input_scroll(ctx, evt->data.scroll);
+        break;
+    case NK_INPUT_EVENT_UNICODE: {
+        nk_glyph glyph;
+        int len = nk_utf_encode(evt->data.unicode, glyph, NK_UTF_SIZE);
+        if (!len) break;
+        if (buttons_changed || nk_input_text_key_changed(in) ||
+            in->keyboard.text_len + len >= NK_INPUT_MAX)
+            return nk_false;
+        nk_input_glyph(ctx, glyph);
+    } break;
+    default: break;
+    }
+    return nk_true;
+}
+NK_INTERN void
+nk_input_queue_apply(struct nk_context *ctx)
+{
+    int i, applied = 0;
+    while (applied < ctx->input_queue_count &&
+        nk_input_apply_event(ctx, &ctx->input_queue[applied]))
+        applied++;
+    if (!applied) return;
+
+    ctx->input_queue_count -= applied;
+    for (i = 0; i < ctx->input_queue_count; ++i)
+        ctx->input_queue[i] = ctx->input_queue[i + applied];
+}
 NK_API void
 nk_input_end(struct nk_context *ctx)
 {
@@ -33,6 +122,7 @@ nk_input_end(struct nk_context *ctx)
     NK_ASSERT(ctx);
     if (!ctx) return;
     in = &ctx->input;
+    nk_input_queue_apply(ctx);
     if (in->mouse.grab)
         in->mouse.grab = 0;
     if (in->mouse.ungrab) {
@@ -40,6 +130,9 @@ nk_input_end(struct nk_context *ctx)
         in->mouse.ungrab = 0;
         in->mouse.grab = 0;
     }
+    /* recorded after queued events so a replay applies them first */
+    if (ctx->recorder)
+        nk_input_record_op(ctx, NK_INPUT_RECORD_END);
 }
 NK_API void
 nk_input_motion(struct nk_context *ctx, int x, int y)
@@ -47,6 +140,13 @@ nk_input_motion(struct nk_context *ctx, int x, int y)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_MOTION;
+        evt.data.motion.x = x;
+        evt.data.motion.y = y;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
     in->mouse.pos.x = (float)x;
     in->mouse.pos.y = (float)y;
@@ -59,6 +159,13 @@ nk_input_key(struct nk_context *ctx, enum nk_keys key, int down)
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_KEY;
+        evt.data.key.key = key;
+        evt.data.key.down = down;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
 #ifdef NK_KEYSTATE_BASED_INPUT
     if (in->keyboard.keys[key].down != down)
@@ -75,6 +182,15 @@ nk_input_button(struct nk_context *ctx, enum nk_buttons id, int x, int y, int do
     struct nk_input *in;
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_BUTTON;
+        evt.data.button.id = id;
+        evt.data.button.x = x;
+        evt.data.button.y = y;
+        evt.data.button.down = down;
+        nk_input_record(ctx, &evt);
+    }
     in = &ctx->input;
     if (in->mouse.buttons[id].down == down) return;
 
@@ -89,6 +205,12 @@ nk_input_scroll(struct nk_context *ctx, struct nk_vec2 val)
 {
     NK_ASSERT(ctx);
     if (!ctx) return;
+    if (ctx->recorder) {
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_SCROLL;
+        evt.data.scroll = val;
+        nk_input_record(ctx, &evt);
+    }
     ctx->input.mouse.scroll_delta.x += val.x;
     ctx->input.mouse.scroll_delta.y += val.y;
 }
@@ -104,6 +226,13 @@ nk_input_glyph(struct nk_context *ctx, const nk_glyph glyph)
     in = &ctx->input;
 
     len = nk_utf_decode(glyph, &unicode, NK_UTF_SIZE);
+    if (len && ctx->recorder) {
+        /* characters and runes are recorded as the rune they add */
+        struct nk_input_event evt;
+        evt.type = NK_INPUT_EVENT_UNICODE;
+        evt.data.unicode = unicode;
+        nk_input_record(ctx, &evt);
+    }
     if (len && ((in->keyboard.text_len + len) < NK_INPUT_MAX)) {
         nk_utf_encode(unicode, &in->keyboard.text[in->keyboard.text_len],
             NK_INPUT_MAX - in->keyboard.text_len);
@@ -129,6 +258,100 @@ nk_input_unicode(struct nk_context *ctx, nk_rune unicode)
     nk_input_glyph(ctx, rune);
 }
 NK_API int
+nk_input_push(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    struct nk_input_event *last;
+    NK_ASSERT(ctx);
+    NK_ASSERT(evt);
+    if (!ctx || !evt) return nk_false;
+    if ((evt->type == NK_INPUT_EVENT_BUTTON &&
+        ((unsigned)evt->data.button.id >= NK_BUTTON_MAX)) ||
+        (evt->type == NK_INPUT_EVENT_KEY &&
+        ((unsigned)evt->data.key.key >= NK_KEY_MAX)))
+        return nk_false;
+
+    /* merge with previous event of the same type */
+    last = (ctx->input_queue_count) ? &ctx->input_queue[ctx->input_queue_count-1]: 0;
+    if (last && last->type == evt->type && evt->type == NK_INPUT_EVENT_MOTION) {
+        *last = *evt;
+        return nk_true;
+    } else if (last && last->type == evt->type && evt->type == NK_INPUT_EVENT_SCROLL) {
+        last->time = evt->time;
+        last->data.scroll.x += evt->data.scroll.x;
+        last->data.scroll.y += evt->data.scroll.y;
+        return nk_true;
+    }
+    if (ctx->input_queue_count >= NK_INPUT_QUEUE_SIZE)
+        return nk_false;
+    ctx->input_queue[ctx->input_queue_count++] = *evt;
+    return nk_true;
+}
+NK_API int
+nk_input_push_motion(struct nk_context *ctx, nk_uint time, int x, int y)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_MOTION;
+    evt.time = time;
+    evt.data.motion.x = x;
+    evt.data.motion.y = y;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_button(struct nk_context *ctx, nk_uint time, enum nk_buttons id,
+    int x, int y, int down)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_BUTTON;
+    evt.time = time;
+    evt.data.button.id = id;
+    evt.data.button.x = x;
+    evt.data.button.y = y;
+    evt.data.button.down = down;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_key(struct nk_context *ctx, nk_uint time, enum nk_keys key, int down)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_KEY;
+    evt.time = time;
+    evt.data.key.key = key;
+    evt.data.key.down = down;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_scroll(struct nk_context *ctx, nk_uint time, struct nk_vec2 val)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_SCROLL;
+    evt.time = time;
+    evt.data.scroll = val;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_push_unicode(struct nk_context *ctx, nk_uint time, nk_rune unicode)
+{
+    struct nk_input_event evt;
+    evt.type = NK_INPUT_EVENT_UNICODE;
+    evt.time = time;
+    evt.data.unicode = unicode;
+    return nk_input_push(ctx, &evt);
+}
+NK_API int
+nk_input_queue_count(const struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    return ctx->input_queue_count;
+}
+NK_API void
+nk_input_queue_clear(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->input_queue_count = 0;
+}
+NK_API int
 nk_input_has_mouse_click(const struct nk_input *i, enum nk_buttons id)
 {
     const struct nk_mouse_button *btn;
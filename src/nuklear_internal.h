@@ -13,6 +13,14 @@
 #define NK_BUFFER_DEFAULT_INITIAL_SIZE (4*1024)
 #endif
 
+#ifndef NK_BUFFER_SEGMENT_MIN_SIZE
+#define NK_BUFFER_SEGMENT_MIN_SIZE (4*1024)
+#endif
+
+#ifndef NK_FONT_PACK_MAXRECTS_LIMIT
+#define NK_FONT_PACK_MAXRECTS_LIMIT 4096
+#endif
+
 /* standard library headers */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 #include <stdlib.h> /* malloc, free */
@@ -23,10 +31,32 @@
 #ifdef NK_INCLUDE_STANDARD_VARARGS
 #include <stdarg.h> /* valist, va_start, va_end, ... */
 #endif
+#ifdef NK_INCLUDE_SSE2
+#include <emmintrin.h> /* __m128, _mm_add_ps, ... */
+#endif
 #ifndef NK_ASSERT
 #include <assert.h>
 #define NK_ASSERT(expr) assert(expr)
 #endif
+#if defined(NK_INCLUDE_PROFILER) && !defined(NK_PROFILE_CLOCK)
+#include <time.h> /* clock */
+#define NK_PROFILE_CLOCK() ((double)clock() / (double)CLOCKS_PER_SEC)
+#define NK_PROFILE_COARSE_CLOCK
+#endif
+#ifndef NK_PROFILE_BEGIN
+#ifdef NK_INCLUDE_PROFILER
+#define NK_PROFILE_BEGIN(profiler, zone) nk_profile_zone_begin(profiler, zone)
+#else
+#define NK_PROFILE_BEGIN(profiler, zone)
+#endif
+#endif
+#ifndef NK_PROFILE_END
+#ifdef NK_INCLUDE_PROFILER
+#define NK_PROFILE_END(profiler, zone) nk_profile_zone_end(profiler, zone)
+#else
+#define NK_PROFILE_END(profiler, zone)
+#endif
+#endif
 
 #ifndef NK_MEMSET
 #define NK_MEMSET nk_memset
@@ -137,7 +167,7 @@ NK_LIB void nk_zero(void *ptr, nk_size size);
 NK_LIB char *nk_itoa(char *s, long n);
 NK_LIB int nk_string_float_limit(char *string, int prec);
 NK_LIB char *nk_dtoa(char *s, double n);
-NK_LIB int nk_text_clamp(const struct nk_user_font *font, const char *text, int text_len, float space, int *glyphs, float *text_width, nk_rune *sep_list, int sep_count);
+NK_LIB int nk_text_clamp(const struct nk_user_font *font, const char *text, int text_len, float space, int *glyphs, float *text_width, const nk_rune *sep_list, int sep_count);
 NK_LIB struct nk_vec2 nk_text_calculate_text_bounds(const struct nk_user_font *font, const char *begin, int byte_len, float row_height, const char **remaining, struct nk_vec2 *out_offset, int *glyphs, int op);
 #ifdef NK_INCLUDE_STANDARD_VARARGS
 NK_LIB int nk_strfmt(char *buf, int buf_size, const char *fmt, va_list args);
@@ -146,6 +176,12 @@ NK_LIB int nk_strfmt(char *buf, int buf_size, const char *fmt, va_list args);
 NK_LIB char *nk_file_load(const char* path, nk_size* siz, struct nk_allocator *alloc);
 #endif
 
+/* profiling */
+#ifdef NK_INCLUDE_PROFILER
+NK_LIB void nk_profile_zone_begin(struct nk_profiler *profiler, enum nk_profile_zone zone);
+NK_LIB void nk_profile_zone_end(struct nk_profiler *profiler, enum nk_profile_zone zone);
+#endif
+
 /* buffer */
 #ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
 NK_LIB void* nk_malloc(nk_handle unused, void *old,nk_size size);
@@ -154,6 +190,7 @@ NK_LIB void nk_mfree(nk_handle unused, void *ptr);
 NK_LIB void* nk_buffer_align(void *unaligned, nk_size align, nk_size *alignment, enum nk_buffer_allocation_type type);
 NK_LIB void* nk_buffer_alloc(struct nk_buffer *b, enum nk_buffer_allocation_type type, nk_size size, nk_size align);
 NK_LIB void* nk_buffer_realloc(struct nk_buffer *b, nk_size capacity, nk_size *size);
+NK_LIB void* nk_buffer_at(const struct nk_buffer *b, nk_size offset);
 
 /* draw */
 NK_LIB void nk_command_buffer_init(struct nk_command_buffer *cb, struct nk_buffer *b, enum nk_command_clipping clip);
@@ -169,6 +206,39 @@ NK_LIB void nk_finish_popup(struct nk_context *ctx, struct nk_window*);
 NK_LIB void nk_finish_buffer(struct nk_context *ctx, struct nk_command_buffer *b);
 NK_LIB void nk_finish(struct nk_context *ctx, struct nk_window *w);
 NK_LIB void nk_build(struct nk_context *ctx);
+NK_LIB int nk_command_list_begin(struct nk_context *ctx, nk_size *offset);
+NK_LIB const struct nk_command *nk_command_list_at(const struct nk_buffer *memory, nk_size offset);
+NK_LIB const struct nk_command *nk_command_list_next(const struct nk_buffer *memory, const struct nk_command *cmd);
+
+/* command packing */
+struct nk_packed_ref {
+    const struct nk_user_font *font;
+    float height;
+    struct nk_image img;
+    nk_command_custom_callback callback;
+    nk_handle handle;
+};
+NK_LIB nk_byte *nk_pack_uint(nk_byte *p, nk_uint v);
+NK_LIB nk_byte *nk_pack_int(nk_byte *p, int v);
+NK_LIB nk_byte *nk_pack_float(nk_byte *p, float f);
+NK_LIB nk_uint nk_unpack_uint(const nk_byte **p);
+NK_LIB int nk_unpack_int(const nk_byte **p);
+NK_LIB float nk_unpack_float(const nk_byte **p);
+NK_LIB nk_size nk_command_packed_size(const struct nk_command *cmd);
+NK_LIB nk_byte *nk_pack_command(struct nk_command_packing *packing, nk_byte *p, const struct nk_command *cmd);
+NK_LIB struct nk_command *nk_unpack_command(const struct nk_command_packing *packing, const nk_byte **in, const nk_byte *end, struct nk_buffer *out);
+NK_LIB void nk_command_packing_init(struct nk_command_packing *packing, const struct nk_allocator *alloc);
+NK_LIB void nk_command_packing_free(struct nk_command_packing *packing);
+
+/* input recording */
+enum nk_input_record_op {
+    NK_INPUT_RECORD_BEGIN = NK_INPUT_EVENT_UNICODE + 1,
+    NK_INPUT_RECORD_END,
+    NK_INPUT_RECORD_FRAME
+};
+NK_LIB void nk_input_record(struct nk_context *ctx, const struct nk_input_event *evt);
+NK_LIB void nk_input_record_op(struct nk_context *ctx, enum nk_input_record_op op);
+NK_LIB void nk_input_record_frame(struct nk_context *ctx);
 
 /* text editor */
 NK_LIB void nk_textedit_clear_state(struct nk_text_edit *state, enum nk_text_edit_type type, nk_plugin_filter filter);
@@ -186,11 +256,15 @@ NK_LIB void nk_remove_window(struct nk_context*, struct nk_window*);
 NK_LIB void nk_free_window(struct nk_context *ctx, struct nk_window *win);
 NK_LIB struct nk_window *nk_find_window(struct nk_context *ctx, nk_hash hash, const char *name);
 NK_LIB void nk_insert_window(struct nk_context *ctx, struct nk_window *win, enum nk_window_insert_location loc);
+NK_LIB int nk_window_is_any_at(const struct nk_context *ctx, struct nk_vec2 pos);
+NK_LIB struct nk_window *nk_window_at_mouse(struct nk_context *ctx);
+NK_LIB void nk_window_index_invalidate(struct nk_context *ctx);
 
 /* pool */
 NK_LIB void nk_pool_init(struct nk_pool *pool, struct nk_allocator *alloc, unsigned int capacity);
 NK_LIB void nk_pool_free(struct nk_pool *pool);
 NK_LIB void nk_pool_init_fixed(struct nk_pool *pool, void *memory, nk_size size);
+NK_LIB nk_size nk_pool_page_size(const struct nk_pool *pool);
 NK_LIB struct nk_page_element *nk_pool_alloc(struct nk_pool *pool);
 
 /* page-element */
@@ -224,12 +298,16 @@ NK_LIB void nk_panel_layout(const struct nk_context *ctx, struct nk_window *win,
 NK_LIB void nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt, float height, int cols, int width);
 NK_LIB void nk_panel_alloc_row(const struct nk_context *ctx, struct nk_window *win);
 NK_LIB void nk_layout_widget_space(struct nk_rect *bounds, const struct nk_context *ctx, struct nk_window *win, int modify);
-NK_LIB void nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx);
+NK_LIB int nk_panel_row_is_culled(const struct nk_panel *layout);
+NK_LIB int nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx);
 NK_LIB void nk_layout_peek(struct nk_rect *bounds, struct nk_context *ctx);
 
 /* popup */
 NK_LIB int nk_nonblock_begin(struct nk_context *ctx, nk_flags flags, struct nk_rect body, struct nk_rect header, enum nk_panel_type panel_type);
 
+/* draw */
+NK_LIB void nk_push_text(struct nk_command_buffer *b, struct nk_rect r, const char *string, int length, const struct nk_user_font *font, struct nk_color bg, struct nk_color fg);
+
 /* text */
 struct nk_text {
     struct nk_vec2 padding;
@@ -124,6 +124,7 @@ nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt,
     if (!ctx || !ctx->current || !ctx->current->layout)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_LAYOUT);
     win = ctx->current;
     nk_panel_layout(ctx, win, height, cols);
     if (fmt == NK_DYNAMIC)
@@ -134,6 +135,7 @@ nk_row_layout(struct nk_context *ctx, enum nk_layout_format fmt,
     win->layout->row.filled = 0;
     win->layout->row.item_offset = 0;
     win->layout->row.item_width = (float)width;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_LAYOUT);
 }
 NK_API float
 nk_layout_ratio_from_pixel(struct nk_context *ctx, float pixel_width)
@@ -353,12 +355,10 @@ nk_layout_row_template_push_static(struct nk_context *ctx, float width)
     if (layout->row.columns >= NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS) return;
     layout->row.templates[layout->row.columns++] = width;
 }
-NK_API void
-nk_layout_row_template_end(struct nk_context *ctx)
+NK_INTERN void
+nk_layout_template_resolve(const float *templates, float *widths, int columns,
+    float space)
 {
-    struct nk_window *win;
-    struct nk_panel *layout;
-
     int i = 0;
     int variable_count = 0;
     int min_variable_count = 0;
@@ -366,18 +366,9 @@ nk_layout_row_template_end(struct nk_context *ctx)
     float total_fixed_width = 0.0f;
     float max_variable_width = 0.0f;
 
-    NK_ASSERT(ctx);
-    NK_ASSERT(ctx->current);
-    NK_ASSERT(ctx->current->layout);
-    if (!ctx || !ctx->current || !ctx->current->layout)
-        return;
-
-    win = ctx->current;
-    layout = win->layout;
-    NK_ASSERT(layout->row.type == NK_LAYOUT_TEMPLATE);
-    if (layout->row.type != NK_LAYOUT_TEMPLATE) return;
-    for (i = 0; i < layout->row.columns; ++i) {
-        float width = layout->row.templates[i];
+    for (i = 0; i < columns; ++i) {
+        float width = templates[i];
+        widths[i] = width;
         if (width >= 0.0f) {
             total_fixed_width += width;
             min_fixed_width += width;
@@ -392,19 +383,147 @@ nk_layout_row_template_end(struct nk_context *ctx)
         }
     }
     if (variable_count) {
-        float space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
-                            layout->bounds.w, layout->row.columns);
         float var_width = (NK_MAX(space-min_fixed_width,0.0f)) / (float)variable_count;
         int enough_space = var_width >= max_variable_width;
         if (!enough_space)
             var_width = (NK_MAX(space-total_fixed_width,0)) / (float)min_variable_count;
-        for (i = 0; i < layout->row.columns; ++i) {
-            float *width = &layout->row.templates[i];
+        for (i = 0; i < columns; ++i) {
+            float *width = &widths[i];
             *width = (*width >= 0.0f)? *width: (*width < -1.0f && !enough_space)? -(*width): var_width;
         }
     }
 }
 NK_API void
+nk_layout_row_template_end(struct nk_context *ctx)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+    float space;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout)
+        return;
+
+    win = ctx->current;
+    layout = win->layout;
+    NK_ASSERT(layout->row.type == NK_LAYOUT_TEMPLATE);
+    if (layout->row.type != NK_LAYOUT_TEMPLATE) return;
+
+    space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
+                layout->bounds.w, layout->row.columns);
+    nk_layout_template_resolve(layout->row.templates, layout->row.templates,
+        layout->row.columns, space);
+}
+NK_API void
+nk_layout_template_init(struct nk_layout_template *tmpl)
+{
+    NK_ASSERT(tmpl);
+    if (!tmpl) return;
+    nk_zero(tmpl, sizeof(*tmpl));
+}
+NK_INTERN void
+nk_layout_template_push(struct nk_layout_template *tmpl, float width)
+{
+    NK_ASSERT(tmpl);
+    NK_ASSERT(tmpl->columns < NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS);
+    if (!tmpl || tmpl->columns >= NK_MAX_LAYOUT_ROW_TEMPLATE_COLUMNS) return;
+    tmpl->templates[tmpl->columns++] = width;
+    tmpl->resolved = nk_false;
+}
+NK_API void
+nk_layout_template_push_dynamic(struct nk_layout_template *tmpl)
+{
+    nk_layout_template_push(tmpl, -1.0f);
+}
+NK_API void
+nk_layout_template_push_variable(struct nk_layout_template *tmpl, float min_width)
+{
+    nk_layout_template_push(tmpl, -min_width);
+}
+NK_API void
+nk_layout_template_push_static(struct nk_layout_template *tmpl, float width)
+{
+    nk_layout_template_push(tmpl, width);
+}
+NK_API void
+nk_layout_row_template(struct nk_context *ctx, float height,
+    struct nk_layout_template *tmpl)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+    float space;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    NK_ASSERT(tmpl);
+    if (!ctx || !ctx->current || !ctx->current->layout || !tmpl)
+        return;
+
+    win = ctx->current;
+    layout = win->layout;
+    nk_layout_row_template_begin(ctx, height);
+    space = nk_layout_row_calculate_usable_space(&ctx->style, layout->type,
+                layout->bounds.w, tmpl->columns);
+    if (!tmpl->resolved || tmpl->space != space) {
+        nk_layout_template_resolve(tmpl->templates, tmpl->widths, tmpl->columns, space);
+        tmpl->space = space;
+        tmpl->resolved = nk_true;
+    }
+    layout->row.columns = tmpl->columns;
+    NK_MEMCPY(layout->row.templates, tmpl->widths,
+        sizeof(float) * (nk_size)tmpl->columns);
+}
+NK_API void
+nk_layout_row_skip(struct nk_context *ctx, float height, int rows)
+{
+    struct nk_window *win;
+    struct nk_panel *layout;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout || rows <= 0)
+        return;
+
+    /* allocate the first skipped row like any other row to finish the
+     * previous row, then jump over all remaining rows at once */
+    win = ctx->current;
+    layout = win->layout;
+    nk_panel_layout(ctx, win, height, 1);
+    layout->row.type = NK_LAYOUT_DYNAMIC_FIXED;
+    layout->row.ratio = 0;
+    layout->row.filled = 0;
+    layout->row.item_width = 0;
+    layout->row.item_offset = 0;
+    layout->row.index = layout->row.columns;
+    if (rows > 1) {
+        float skipped = layout->row.height * (float)(rows - 1);
+        if (layout->flags & NK_WINDOW_DYNAMIC) {
+            /* draw background for skipped rows of dynamic panels */
+            struct nk_rect background;
+            background.x = win->bounds.x;
+            background.w = win->bounds.w;
+            background.y = layout->at_y + layout->row.height;
+            background.h = skipped;
+            nk_fill_rect(&win->buffer, background, 0, ctx->style.window.background);
+        }
+        layout->at_y += skipped;
+    }
+}
+NK_API int
+nk_layout_row_is_visible(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout)
+        return 0;
+    return !nk_panel_row_is_culled(ctx->current->layout);
+}
+NK_API void
 nk_layout_space_begin(struct nk_context *ctx, enum nk_layout_format fmt,
     float height, int widget_count)
 {
@@ -711,7 +830,22 @@ nk_layout_widget_space(struct nk_rect *bounds, const struct nk_context *ctx,
         layout->max_x = bounds->x + bounds->w;
     bounds->x -= (float)*layout->offset_x;
 }
-NK_LIB void
+NK_LIB int
+nk_panel_row_is_culled(const struct nk_panel *layout)
+{
+    /* free layouts can place widgets anywhere so they are never culled */
+    float y;
+    if (layout->row.type == NK_LAYOUT_DYNAMIC_FREE ||
+        layout->row.type == NK_LAYOUT_STATIC_FREE)
+        return nk_false;
+
+    /* one pixel of slack to stay conservative with the integer
+     * rounding done by `nk_widget` */
+    y = layout->at_y - (float)*layout->offset_y;
+    return ((y + layout->row.height + 1.0f) < layout->clip.y) ||
+        (y > (layout->clip.y + layout->clip.h + 1.0f));
+}
+NK_LIB int
 nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx)
 {
     struct nk_window *win;
@@ -721,17 +855,21 @@ nk_panel_alloc_space(struct nk_rect *bounds, const struct nk_context *ctx)
     NK_ASSERT(ctx->current);
     NK_ASSERT(ctx->current->layout);
     if (!ctx || !ctx->current || !ctx->current->layout)
-        return;
+        return 0;
 
     /* check if the end of the row has been hit and begin new row if so */
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_LAYOUT);
     win = ctx->current;
     layout = win->layout;
     if (layout->row.index >= layout->row.columns)
         nk_panel_alloc_row(ctx, win);
 
-    /* calculate widget position and size */
+    /* calculate widget position and size. Still required for culled rows
+     * since the horizontal scrollbar depends on `max_x` of every row */
     nk_layout_widget_space(bounds, ctx, win, nk_true);
     layout->row.index++;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_LAYOUT);
+    return !nk_panel_row_is_culled(layout);
 }
 NK_LIB void
 nk_layout_peek(struct nk_rect *bounds, struct nk_context *ctx)
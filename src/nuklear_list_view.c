@@ -58,6 +58,47 @@ nk_list_view_begin(struct nk_context *ctx, struct nk_list_view *view,
     view->count = NK_MIN(view->count, row_count - view->begin);
     view->end = view->begin + view->count;
     view->ctx = ctx;
+    view->index = 0;
+    return result;
+}
+NK_API int
+nk_list_view_begin_variable(struct nk_context *ctx, struct nk_list_view *view,
+    const char *title, nk_flags flags, const struct nk_list_view_index *index)
+{
+    int result;
+    float spacing;
+    float visible_begin;
+    float visible_end;
+    struct nk_window *win;
+    struct nk_panel *layout;
+    struct nk_vec2 panel_padding;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(view);
+    NK_ASSERT(title);
+    NK_ASSERT(index);
+    if (!ctx || !view || !title || !index) return 0;
+
+    nk_zero(view, sizeof(*view));
+    result = nk_group_begin(ctx, title, flags);
+    if (!result) return result;
+
+    /* unlike fixed height list views the real scroll offset is kept, and all
+     * rows above the visible area are skipped by moving the layout cursor */
+    win = ctx->current;
+    layout = win->layout;
+    spacing = ctx->style.window.spacing.y;
+    panel_padding = nk_panel_get_padding(&ctx->style, NK_PANEL_GROUP);
+    visible_begin = NK_MAX((float)*layout->offset_y - panel_padding.y, 0.0f);
+    visible_end = visible_begin + layout->clip.h;
+
+    view->begin = nk_list_view_index_find(index, visible_begin, spacing);
+    view->end = NK_MIN(nk_list_view_index_find(index, visible_end, spacing) + 1, index->count);
+    view->count = NK_MAX(view->end - view->begin, 0);
+    view->total_height = (int)nk_list_view_index_offset(index, index->count, spacing);
+    view->index = index;
+    view->ctx = ctx;
+    layout->at_y += nk_list_view_index_offset(index, view->begin, spacing);
     return result;
 }
 NK_API void
@@ -69,14 +110,124 @@ nk_list_view_end(struct nk_list_view *view)
 
     NK_ASSERT(view);
     NK_ASSERT(view->ctx);
-    NK_ASSERT(view->scroll_pointer);
     if (!view || !view->ctx) return;
 
     ctx = view->ctx;
     win = ctx->current;
     layout = win->layout;
+    if (view->index) {
+        /* extend content height over all rows below the visible area */
+        struct nk_vec2 panel_padding = nk_panel_get_padding(&ctx->style, NK_PANEL_GROUP);
+        layout->at_y = layout->bounds.y + panel_padding.y + nk_list_view_index_offset(view->index,
+            view->index->count, ctx->style.window.spacing.y);
+        layout->row.height = 0;
+        nk_group_end(ctx);
+        return;
+    }
+    NK_ASSERT(view->scroll_pointer);
     layout->at_y = layout->bounds.y + (float)view->total_height;
     *view->scroll_pointer = *view->scroll_pointer + view->scroll_value;
     nk_group_end(view->ctx);
 }
 
+NK_API void
+nk_list_view_index_init(struct nk_list_view_index *index,
+    struct nk_list_view_row *memory, int capacity)
+{
+    NK_ASSERT(index);
+    NK_ASSERT(memory || !capacity);
+    if (!index) return;
+    index->rows = memory;
+    index->count = 0;
+    index->capacity = capacity;
+}
+NK_API int
+nk_list_view_index_build(struct nk_list_view_index *index,
+    nk_list_view_row_height height, nk_handle userdata, int row_count)
+{
+    /* O(n) construction: every node passes its sum on to its parent */
+    int i;
+    NK_ASSERT(index);
+    NK_ASSERT(height);
+    NK_ASSERT(row_count <= index->capacity);
+    if (!index || !height || row_count < 0) return 0;
+
+    row_count = NK_MIN(row_count, index->capacity);
+    for (i = 0; i < row_count; ++i) {
+        float row_height = height(userdata, i);
+        NK_ASSERT(row_height >= 0);
+        index->rows[i].height = NK_MAX(row_height, 0);
+        index->rows[i].sum = index->rows[i].height;
+    }
+    for (i = 1; i <= row_count; ++i) {
+        int parent = i + (i & -i);
+        if (parent <= row_count)
+            index->rows[parent-1].sum += index->rows[i-1].sum;
+    }
+    index->count = row_count;
+    return row_count;
+}
+NK_API float
+nk_list_view_index_height(const struct nk_list_view_index *index, int row)
+{
+    NK_ASSERT(index);
+    if (!index || row < 0 || row >= index->count) return 0;
+    return index->rows[row].height;
+}
+NK_API void
+nk_list_view_index_set(struct nk_list_view_index *index, int row, float height)
+{
+    /* the delta is taken from the stored height and not from the tree sums
+     * so rounding errors of earlier updates are not fed back */
+    int i;
+    double delta;
+    NK_ASSERT(index);
+    NK_ASSERT(row >= 0 && row < index->count);
+    NK_ASSERT(height >= 0);
+    if (!index || row < 0 || row >= index->count) return;
+
+    height = NK_MAX(height, 0);
+    delta = (double)height - (double)index->rows[row].height;
+    index->rows[row].height = height;
+    for (i = row + 1; i <= index->count; i += (i & -i))
+        index->rows[i-1].sum += delta;
+}
+NK_API float
+nk_list_view_index_offset(const struct nk_list_view_index *index, int row, float spacing)
+{
+    /* sum of all row heights in front of `row` */
+    int i;
+    double offset = 0;
+    NK_ASSERT(index);
+    if (!index) return 0;
+
+    row = NK_CLAMP(0, row, index->count);
+    for (i = row; i > 0; i -= (i & -i))
+        offset += index->rows[i-1].sum;
+    return (float)(offset + (double)row * (double)spacing);
+}
+NK_API int
+nk_list_view_index_find(const struct nk_list_view_index *index, float offset,
+    float spacing)
+{
+    /* descend the implicit tree to find the row containing `offset` */
+    int row = 0;
+    int step = 1;
+    double left = offset;
+    NK_ASSERT(index);
+    if (!index || index->count <= 0 || offset <= 0) return 0;
+
+    while ((step << 1) <= index->count)
+        step <<= 1;
+    for (; step; step >>= 1) {
+        int next = row + step;
+        double size;
+        if (next > index->count) continue;
+        size = index->rows[next-1].sum + (double)step * (double)spacing;
+        if (size <= left) {
+            row = next;
+            left -= size;
+        }
+    }
+    return NK_MIN(row, index->count - 1);
+}
@@ -0,0 +1,589 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          COMMAND PACKING
+ *
+ * ===============================================================*/
+/*  Packed commands start with their type byte followed by the userdata
+    table index if enabled and the command payload. Integers are stored as
+    variable length integers with signed values zigzag encoded, so common
+    coordinates only take one or two bytes. Secondary points are stored
+    relative to the first point of a command. Fonts, images and callbacks
+    are replaced by indices into a side table. Commands have no padding and
+    no `next` offset since the next command directly follows.
+    Packing is the wire format of command streams and the input recorder.
+    Context command buffers always keep the native layout so drawing and
+    iterating never pay for encoding. */
+NK_LIB void
+nk_command_packing_init(struct nk_command_packing *packing,
+    const struct nk_allocator *alloc)
+{
+    NK_ASSERT(packing);
+    NK_ASSERT(alloc);
+    if (!packing || !alloc) return;
+    nk_zero(packing, sizeof(*packing));
+    nk_buffer_init(&packing->table, alloc, 16 * sizeof(struct nk_packed_ref));
+    nk_buffer_init(&packing->scratch, alloc, 256);
+}
+NK_LIB void
+nk_command_packing_free(struct nk_command_packing *packing)
+{
+    NK_ASSERT(packing);
+    if (!packing) return;
+    if (packing->table.pool.alloc)
+        nk_buffer_free(&packing->table);
+    if (packing->scratch.pool.alloc)
+        nk_buffer_free(&packing->scratch);
+    nk_zero(packing, sizeof(*packing));
+}
+NK_LIB nk_byte*
+nk_pack_uint(nk_byte *p, nk_uint v)
+{
+    while (v >= 0x80) {
+        *p++ = (nk_byte)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (nk_byte)v;
+    return p;
+}
+NK_LIB nk_byte*
+nk_pack_int(nk_byte *p, int v)
+{
+    nk_uint zigzag = (v < 0) ? (((nk_uint)(-(v + 1))) << 1) | 1u: (nk_uint)v << 1;
+    return nk_pack_uint(p, zigzag);
+}
+NK_INTERN nk_byte*
+nk_pack_color(nk_byte *p, struct nk_color c)
+{
+    p[0] = c.r; p[1] = c.g; p[2] = c.b; p[3] = c.a;
+    return p + 4;
+}
+NK_LIB nk_byte*
+nk_pack_float(nk_byte *p, float f)
+{
+    NK_MEMCPY(p, &f, sizeof(f));
+    return p + sizeof(f);
+}
+NK_LIB nk_uint
+nk_unpack_uint(const nk_byte **p)
+{
+    nk_uint v = 0;
+    int shift = 0;
+    const nk_byte *in = *p;
+    while (*in & 0x80) {
+        /* bits beyond 32 only appear in corrupt streams and are dropped */
+        if (shift < 32) v |= (nk_uint)(*in & 0x7F) << shift;
+        shift += 7;
+        in++;
+    }
+    if (shift < 32) v |= (nk_uint)(*in) << shift;
+    in++;
+    *p = in;
+    return v;
+}
+NK_LIB int
+nk_unpack_int(const nk_byte **p)
+{
+    nk_uint v = nk_unpack_uint(p);
+    return (v & 1) ? -(int)(v >> 1) - 1: (int)(v >> 1);
+}
+NK_INTERN struct nk_color
+nk_unpack_color(const nk_byte **p)
+{
+    struct nk_color c;
+    const nk_byte *in = *p;
+    c.r = in[0]; c.g = in[1]; c.b = in[2]; c.a = in[3];
+    *p = in + 4;
+    return c;
+}
+NK_LIB float
+nk_unpack_float(const nk_byte **p)
+{
+    float f;
+    NK_MEMCPY(&f, *p, sizeof(f));
+    *p += sizeof(f);
+    return f;
+}
+NK_INTERN int
+nk_packed_ref_equal(const struct nk_packed_ref *a, const struct nk_packed_ref *b)
+{
+    return a->font == b->font && a->height == b->height &&
+        a->img.handle.ptr == b->img.handle.ptr && a->img.w == b->img.w &&
+        a->img.h == b->img.h && a->img.region[0] == b->img.region[0] &&
+        a->img.region[1] == b->img.region[1] && a->img.region[2] == b->img.region[2] &&
+        a->img.region[3] == b->img.region[3] && a->callback == b->callback &&
+        a->handle.ptr == b->handle.ptr;
+}
+NK_INTERN nk_uint
+nk_packing_ref(struct nk_command_packing *packing, const struct nk_packed_ref *ref)
+{
+    /* tables only hold a handful of fonts and images so a linear search
+     * starting with the most recently added entry is sufficient */
+    const struct nk_packed_ref *entries = (const struct nk_packed_ref*)packing->table.memory.ptr;
+    nk_uint count = (nk_uint)(packing->table.allocated / sizeof(*ref));
+    nk_uint i = count;
+    struct nk_packed_ref *entry;
+    while (i--) {
+        if (nk_packed_ref_equal(&entries[i], ref))
+            return i;
+    }
+    entry = (struct nk_packed_ref*)nk_buffer_alloc(&packing->table,
+        NK_BUFFER_FRONT, sizeof(*ref), NK_ALIGNOF(struct nk_packed_ref));
+    NK_ASSERT(entry);
+    if (!entry) return count;
+    *entry = *ref;
+    return count;
+}
+NK_INTERN struct nk_packed_ref
+nk_packing_lookup(const struct nk_command_packing *packing, nk_uint index)
+{
+    struct nk_packed_ref ref;
+    if (index < packing->table.allocated / sizeof(ref)) {
+        const struct nk_packed_ref *entries = (const struct nk_packed_ref*)packing->table.memory.ptr;
+        return entries[index];
+    }
+    nk_zero(&ref, sizeof(ref));
+    return ref;
+}
+NK_INTERN nk_byte*
+nk_pack_points(nk_byte *p, const struct nk_vec2i *points, int count)
+{
+    int i;
+    if (count <= 0) return p;
+    p = nk_pack_int(p, points[0].x);
+    p = nk_pack_int(p, points[0].y);
+    for (i = 1; i < count; ++i) {
+        p = nk_pack_int(p, points[i].x - points[i-1].x);
+        p = nk_pack_int(p, points[i].y - points[i-1].y);
+    }
+    return p;
+}
+NK_INTERN void
+nk_unpack_points(const nk_byte **p, const nk_byte *end, struct nk_vec2i *points, int count)
+{
+    int i;
+    if (count <= 0) return;
+    points[0].x = (short)nk_unpack_int(p);
+    points[0].y = (short)nk_unpack_int(p);
+    /* corrupt streams can hold fewer points than their count */
+    for (i = 1; i < count && *p <= end; ++i) {
+        points[i].x = (short)(points[i-1].x + nk_unpack_int(p));
+        points[i].y = (short)(points[i-1].y + nk_unpack_int(p));
+    }
+}
+NK_INTERN nk_byte*
+nk_pack_rect(nk_byte *p, short x, short y, unsigned short w, unsigned short h)
+{
+    p = nk_pack_int(p, x);
+    p = nk_pack_int(p, y);
+    p = nk_pack_uint(p, w);
+    return nk_pack_uint(p, h);
+}
+NK_INTERN void
+nk_unpack_rect(const nk_byte **p, short *x, short *y, unsigned short *w, unsigned short *h)
+{
+    *x = (short)nk_unpack_int(p);
+    *y = (short)nk_unpack_int(p);
+    *w = (unsigned short)nk_unpack_uint(p);
+    *h = (unsigned short)nk_unpack_uint(p);
+}
+NK_LIB nk_byte*
+nk_pack_command(struct nk_command_packing *packing, nk_byte *p,
+    const struct nk_command *cmd)
+{
+    struct nk_packed_ref ref;
+    *p++ = (nk_byte)cmd->type;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    nk_zero(&ref, sizeof(ref));
+    ref.handle = cmd->userdata;
+    p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+#endif
+    switch (cmd->type) {
+    case NK_COMMAND_NOP: break;
+    case NK_COMMAND_SCISSOR: {
+        const struct nk_command_scissor *s = (const struct nk_command_scissor*)cmd;
+        p = nk_pack_rect(p, s->x, s->y, s->w, s->h);
+    } break;
+    case NK_COMMAND_LINE: {
+        const struct nk_command_line *l = (const struct nk_command_line*)cmd;
+        p = nk_pack_uint(p, l->line_thickness);
+        p = nk_pack_int(p, l->begin.x);
+        p = nk_pack_int(p, l->begin.y);
+        p = nk_pack_int(p, l->end.x - l->begin.x);
+        p = nk_pack_int(p, l->end.y - l->begin.y);
+        p = nk_pack_color(p, l->color);
+    } break;
+    case NK_COMMAND_CURVE: {
+        const struct nk_command_curve *q = (const struct nk_command_curve*)cmd;
+        p = nk_pack_uint(p, q->line_thickness);
+        p = nk_pack_int(p, q->begin.x);
+        p = nk_pack_int(p, q->begin.y);
+        p = nk_pack_int(p, q->ctrl[0].x - q->begin.x);
+        p = nk_pack_int(p, q->ctrl[0].y - q->begin.y);
+        p = nk_pack_int(p, q->ctrl[1].x - q->begin.x);
+        p = nk_pack_int(p, q->ctrl[1].y - q->begin.y);
+        p = nk_pack_int(p, q->end.x - q->begin.x);
+        p = nk_pack_int(p, q->end.y - q->begin.y);
+        p = nk_pack_color(p, q->color);
+    } break;
+    case NK_COMMAND_RECT: {
+        const struct nk_command_rect *r = (const struct nk_command_rect*)cmd;
+        p = nk_pack_uint(p, r->rounding);
+        p = nk_pack_uint(p, r->line_thickness);
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->color);
+    } break;
+    case NK_COMMAND_RECT_FILLED: {
+        const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled*)cmd;
+        p = nk_pack_uint(p, r->rounding);
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->color);
+    } break;
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        const struct nk_command_rect_multi_color *r = (const struct nk_command_rect_multi_color*)cmd;
+        p = nk_pack_rect(p, r->x, r->y, r->w, r->h);
+        p = nk_pack_color(p, r->left);
+        p = nk_pack_color(p, r->top);
+        p = nk_pack_color(p, r->bottom);
+        p = nk_pack_color(p, r->right);
+    } break;
+    case NK_COMMAND_CIRCLE: {
+        const struct nk_command_circle *c = (const struct nk_command_circle*)cmd;
+        p = nk_pack_uint(p, c->line_thickness);
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+        p = nk_pack_color(p, c->color);
+    } break;
+    case NK_COMMAND_CIRCLE_FILLED: {
+        const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled*)cmd;
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+        p = nk_pack_color(p, c->color);
+    } break;
+    case NK_COMMAND_ARC: {
+        const struct nk_command_arc *a = (const struct nk_command_arc*)cmd;
+        p = nk_pack_uint(p, a->line_thickness);
+        p = nk_pack_int(p, a->cx);
+        p = nk_pack_int(p, a->cy);
+        p = nk_pack_uint(p, a->r);
+        p = nk_pack_float(p, a->a[0]);
+        p = nk_pack_float(p, a->a[1]);
+        p = nk_pack_color(p, a->color);
+    } break;
+    case NK_COMMAND_ARC_FILLED: {
+        const struct nk_command_arc_filled *a = (const struct nk_command_arc_filled*)cmd;
+        p = nk_pack_int(p, a->cx);
+        p = nk_pack_int(p, a->cy);
+        p = nk_pack_uint(p, a->r);
+        p = nk_pack_float(p, a->a[0]);
+        p = nk_pack_float(p, a->a[1]);
+        p = nk_pack_color(p, a->color);
+    } break;
+    case NK_COMMAND_TRIANGLE: {
+        const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
+        p = nk_pack_uint(p, t->line_thickness);
+        p = nk_pack_int(p, t->a.x);
+        p = nk_pack_int(p, t->a.y);
+        p = nk_pack_int(p, t->b.x - t->a.x);
+        p = nk_pack_int(p, t->b.y - t->a.y);
+        p = nk_pack_int(p, t->c.x - t->a.x);
+        p = nk_pack_int(p, t->c.y - t->a.y);
+        p = nk_pack_color(p, t->color);
+    } break;
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
+        p = nk_pack_int(p, t->a.x);
+        p = nk_pack_int(p, t->a.y);
+        p = nk_pack_int(p, t->b.x - t->a.x);
+        p = nk_pack_int(p, t->b.y - t->a.y);
+        p = nk_pack_int(p, t->c.x - t->a.x);
+        p = nk_pack_int(p, t->c.y - t->a.y);
+        p = nk_pack_color(p, t->color);
+    } break;
+    case NK_COMMAND_POLYGON: {
+        const struct nk_command_polygon *g = (const struct nk_command_polygon*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_uint(p, g->line_thickness);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYGON_FILLED: {
+        const struct nk_command_polygon_filled *g = (const struct nk_command_polygon_filled*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYLINE: {
+        const struct nk_command_polyline *g = (const struct nk_command_polyline*)cmd;
+        p = nk_pack_uint(p, g->point_count);
+        p = nk_pack_uint(p, g->line_thickness);
+        p = nk_pack_color(p, g->color);
+        p = nk_pack_points(p, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_TEXT: {
+        const struct nk_command_text *t = (const struct nk_command_text*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.font = t->font;
+        ref.height = t->height;
+        p = nk_pack_uint(p, (nk_uint)t->length);
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_color(p, t->background);
+        p = nk_pack_color(p, t->foreground);
+        p = nk_pack_rect(p, t->x, t->y, t->w, t->h);
+        NK_MEMCPY(p, t->string, (nk_size)t->length);
+        p += t->length;
+    } break;
+    case NK_COMMAND_IMAGE: {
+        const struct nk_command_image *i = (const struct nk_command_image*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.img.handle = i->img.handle;
+        ref.img.w = i->img.w;
+        ref.img.h = i->img.h;
+        NK_MEMCPY(ref.img.region, i->img.region, sizeof(ref.img.region));
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_rect(p, i->x, i->y, i->w, i->h);
+        p = nk_pack_color(p, i->col);
+    } break;
+    case NK_COMMAND_CUSTOM: {
+        const struct nk_command_custom *c = (const struct nk_command_custom*)cmd;
+        nk_zero(&ref, sizeof(ref));
+        ref.callback = c->callback;
+        ref.handle = c->callback_data;
+        p = nk_pack_uint(p, nk_packing_ref(packing, &ref));
+        p = nk_pack_rect(p, c->x, c->y, c->w, c->h);
+    } break;
+    }
+    return p;
+}
+NK_LIB nk_size
+nk_command_packed_size(const struct nk_command *cmd)
+{
+    /* upper bound of every packed command without text or points */
+    NK_STORAGE const nk_size packed_size = 64;
+    switch (cmd->type) {
+    default: return packed_size;
+    case NK_COMMAND_TEXT:
+        return packed_size + (nk_size)((const struct nk_command_text*)cmd)->length;
+    case NK_COMMAND_POLYGON:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polygon*)cmd)->point_count;
+    case NK_COMMAND_POLYGON_FILLED:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polygon_filled*)cmd)->point_count;
+    case NK_COMMAND_POLYLINE:
+        return packed_size + 6 * (nk_size)((const struct nk_command_polyline*)cmd)->point_count;
+    }
+}
+NK_INTERN nk_size
+nk_command_unpacked_size(enum nk_command_type type, const nk_byte *payload,
+    const nk_byte *end)
+{
+    nk_uint count;
+    switch (type) {
+    default: return 0;
+    case NK_COMMAND_NOP: return sizeof(struct nk_command);
+    case NK_COMMAND_SCISSOR: return sizeof(struct nk_command_scissor);
+    case NK_COMMAND_LINE: return sizeof(struct nk_command_line);
+    case NK_COMMAND_CURVE: return sizeof(struct nk_command_curve);
+    case NK_COMMAND_RECT: return sizeof(struct nk_command_rect);
+    case NK_COMMAND_RECT_FILLED: return sizeof(struct nk_command_rect_filled);
+    case NK_COMMAND_RECT_MULTI_COLOR: return sizeof(struct nk_command_rect_multi_color);
+    case NK_COMMAND_CIRCLE: return sizeof(struct nk_command_circle);
+    case NK_COMMAND_CIRCLE_FILLED: return sizeof(struct nk_command_circle_filled);
+    case NK_COMMAND_ARC: return sizeof(struct nk_command_arc);
+    case NK_COMMAND_ARC_FILLED: return sizeof(struct nk_command_arc_filled);
+    case NK_COMMAND_TRIANGLE: return sizeof(struct nk_command_triangle);
+    case NK_COMMAND_TRIANGLE_FILLED: return sizeof(struct nk_command_triangle_filled);
+    case NK_COMMAND_IMAGE: return sizeof(struct nk_command_image);
+    case NK_COMMAND_CUSTOM: return sizeof(struct nk_command_custom);
+    case NK_COMMAND_TEXT:
+        /* text length and point counts are the first value of the payload */
+        count = nk_unpack_uint(&payload);
+        if (count > (nk_size)(end - payload)) return 0;
+        return sizeof(struct nk_command_text) + count + 1;
+    case NK_COMMAND_POLYGON:
+    case NK_COMMAND_POLYGON_FILLED:
+    case NK_COMMAND_POLYLINE:
+        /* every point takes at least two bytes */
+        count = nk_unpack_uint(&payload);
+        if (count > (nk_size)(end - payload) / 2) return 0;
+        return sizeof(struct nk_command_polyline) + sizeof(struct nk_vec2i) * count;
+    }
+}
+NK_LIB struct nk_command*
+nk_unpack_command(const struct nk_command_packing *packing, const nk_byte **in,
+    const nk_byte *end, struct nk_buffer *out)
+{
+    NK_STORAGE const nk_size align = NK_ALIGNOF(struct nk_command);
+    enum nk_command_type type;
+    struct nk_command *cmd;
+    struct nk_packed_ref ref;
+    const nk_byte *p = *in;
+    nk_size size;
+
+    type = (enum nk_command_type)*p++;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+#endif
+    if (p > end) return 0;
+    size = nk_command_unpacked_size(type, p, end);
+    if (!size) return 0;
+    /* keep the offset of a following command aligned */
+    size = (size + align - 1) & ~(align - 1);
+    cmd = (struct nk_command*)nk_buffer_alloc(out, NK_BUFFER_FRONT, size, align);
+    if (!cmd) return 0;
+    cmd->type = type;
+#ifdef NK_INCLUDE_COMMAND_USERDATA
+    cmd->userdata = ref.handle;
+#endif
+
+    switch (type) {
+    case NK_COMMAND_NOP: break;
+    case NK_COMMAND_SCISSOR: {
+        struct nk_command_scissor *s = (struct nk_command_scissor*)cmd;
+        nk_unpack_rect(&p, &s->x, &s->y, &s->w, &s->h);
+    } break;
+    case NK_COMMAND_LINE: {
+        struct nk_command_line *l = (struct nk_command_line*)cmd;
+        l->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        l->begin.x = (short)nk_unpack_int(&p);
+        l->begin.y = (short)nk_unpack_int(&p);
+        l->end.x = (short)(l->begin.x + nk_unpack_int(&p));
+        l->end.y = (short)(l->begin.y + nk_unpack_int(&p));
+        l->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CURVE: {
+        struct nk_command_curve *q = (struct nk_command_curve*)cmd;
+        q->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        q->begin.x = (short)nk_unpack_int(&p);
+        q->begin.y = (short)nk_unpack_int(&p);
+        q->ctrl[0].x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->ctrl[0].y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->ctrl[1].x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->ctrl[1].y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->end.x = (short)(q->begin.x + nk_unpack_int(&p));
+        q->end.y = (short)(q->begin.y + nk_unpack_int(&p));
+        q->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT: {
+        struct nk_command_rect *r = (struct nk_command_rect*)cmd;
+        r->rounding = (unsigned short)nk_unpack_uint(&p);
+        r->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT_FILLED: {
+        struct nk_command_rect_filled *r = (struct nk_command_rect_filled*)cmd;
+        r->rounding = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_RECT_MULTI_COLOR: {
+        struct nk_command_rect_multi_color *r = (struct nk_command_rect_multi_color*)cmd;
+        nk_unpack_rect(&p, &r->x, &r->y, &r->w, &r->h);
+        r->left = nk_unpack_color(&p);
+        r->top = nk_unpack_color(&p);
+        r->bottom = nk_unpack_color(&p);
+        r->right = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CIRCLE: {
+        struct nk_command_circle *c = (struct nk_command_circle*)cmd;
+        c->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+        c->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CIRCLE_FILLED: {
+        struct nk_command_circle_filled *c = (struct nk_command_circle_filled*)cmd;
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+        c->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_ARC: {
+        struct nk_command_arc *a = (struct nk_command_arc*)cmd;
+        a->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        a->cx = (short)nk_unpack_int(&p);
+        a->cy = (short)nk_unpack_int(&p);
+        a->r = (unsigned short)nk_unpack_uint(&p);
+        a->a[0] = nk_unpack_float(&p);
+        a->a[1] = nk_unpack_float(&p);
+        a->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_ARC_FILLED: {
+        struct nk_command_arc_filled *a = (struct nk_command_arc_filled*)cmd;
+        a->cx = (short)nk_unpack_int(&p);
+        a->cy = (short)nk_unpack_int(&p);
+        a->r = (unsigned short)nk_unpack_uint(&p);
+        a->a[0] = nk_unpack_float(&p);
+        a->a[1] = nk_unpack_float(&p);
+        a->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_TRIANGLE: {
+        struct nk_command_triangle *t = (struct nk_command_triangle*)cmd;
+        t->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        t->a.x = (short)nk_unpack_int(&p);
+        t->a.y = (short)nk_unpack_int(&p);
+        t->b.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->b.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->c.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->c.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_TRIANGLE_FILLED: {
+        struct nk_command_triangle_filled *t = (struct nk_command_triangle_filled*)cmd;
+        t->a.x = (short)nk_unpack_int(&p);
+        t->a.y = (short)nk_unpack_int(&p);
+        t->b.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->b.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->c.x = (short)(t->a.x + nk_unpack_int(&p));
+        t->c.y = (short)(t->a.y + nk_unpack_int(&p));
+        t->color = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_POLYGON: {
+        struct nk_command_polygon *g = (struct nk_command_polygon*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYGON_FILLED: {
+        struct nk_command_polygon_filled *g = (struct nk_command_polygon_filled*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_POLYLINE: {
+        struct nk_command_polyline *g = (struct nk_command_polyline*)cmd;
+        g->point_count = (unsigned short)nk_unpack_uint(&p);
+        g->line_thickness = (unsigned short)nk_unpack_uint(&p);
+        g->color = nk_unpack_color(&p);
+        nk_unpack_points(&p, end, g->points, g->point_count);
+    } break;
+    case NK_COMMAND_TEXT: {
+        struct nk_command_text *t = (struct nk_command_text*)cmd;
+        t->length = (int)nk_unpack_uint(&p);
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        t->font = ref.font;
+        t->height = ref.height;
+        t->background = nk_unpack_color(&p);
+        t->foreground = nk_unpack_color(&p);
+        nk_unpack_rect(&p, &t->x, &t->y, &t->w, &t->h);
+        NK_MEMCPY(t->string, p, (nk_size)t->length);
+        t->string[t->length] = '\0';
+        p += t->length;
+    } break;
+    case NK_COMMAND_IMAGE: {
+        struct nk_command_image *i = (struct nk_command_image*)cmd;
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        i->img = ref.img;
+        nk_unpack_rect(&p, &i->x, &i->y, &i->w, &i->h);
+        i->col = nk_unpack_color(&p);
+    } break;
+    case NK_COMMAND_CUSTOM: {
+        struct nk_command_custom *c = (struct nk_command_custom*)cmd;
+        ref = nk_packing_lookup(packing, nk_unpack_uint(&p));
+        c->callback = ref.callback;
+        c->callback_data = ref.handle;
+        nk_unpack_rect(&p, &c->x, &c->y, &c->w, &c->h);
+    } break;
+    }
+    cmd->next = 0;
+    *in = p;
+    return cmd;
+}
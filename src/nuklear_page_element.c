@@ -60,3 +60,135 @@ nk_free_page_element(struct nk_context *ctx, struct nk_page_element *elem)
     else nk_link_page_element_into_freelist(ctx, elem);}
 }
 
+NK_INTERN struct nk_page_element*
+nk_page_element_of(void *data)
+{
+    union nk_page_data *pd = (union nk_page_data*)data;
+    return NK_CONTAINER_OF(pd, struct nk_page_element, data);
+}
+NK_INTERN void*
+nk_page_element_moved(void *data)
+{
+    /* moved elements point to their new location */
+    struct nk_page_element *elem;
+    if (!data) return 0;
+    elem = nk_page_element_of(data);
+    if (elem->prev && elem->prev != elem)
+        return &elem->prev->data;
+    return data;
+}
+NK_INTERN void
+nk_page_element_fix_window(struct nk_window *win)
+{
+    struct nk_table *it;
+    for (; win; win = win->popup.win) {
+        win->next = (struct nk_window*)nk_page_element_moved(win->next);
+        win->prev = (struct nk_window*)nk_page_element_moved(win->prev);
+        win->parent = (struct nk_window*)nk_page_element_moved(win->parent);
+        win->popup.win = (struct nk_window*)nk_page_element_moved(win->popup.win);
+        win->tables = (struct nk_table*)nk_page_element_moved(win->tables);
+        /* panels only live between `nk_begin` and `nk_end` */
+        win->layout = 0;
+        for (it = win->tables; it; it = it->next) {
+            it->next = (struct nk_table*)nk_page_element_moved(it->next);
+            it->prev = (struct nk_table*)nk_page_element_moved(it->prev);
+        }
+    }
+}
+NK_API nk_size
+nk_memory_compact(struct nk_context *ctx)
+{
+    struct nk_pool *pool;
+    struct nk_page **pages, *page;
+    struct nk_page_element *elem, *slot;
+    struct nk_window *win;
+    unsigned int *live;
+    unsigned int count = 0, keep, total = 0, i, j, k, n;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(!ctx->current && "page elements can only be compacted outside of a frame");
+    if (!ctx || ctx->current || !ctx->use_pool) return 0;
+    pool = &ctx->pool;
+    if (pool->type == NK_BUFFER_FIXED || !pool->pages) return 0;
+
+    /* free elements are marked by pointing to themselves, live elements
+     * always have a null `prev` pointer since only the free list links them */
+    for (page = pool->pages; page; page = page->next)
+        count++;
+    pages = (struct nk_page**)pool->alloc.alloc(pool->alloc.userdata, 0,
+        count * (sizeof(*pages) + sizeof(*live)));
+    if (!pages) return 0;
+    live = (unsigned int*)(void*)(pages + count);
+    for (elem = ctx->freelist; elem; elem = elem->next)
+        elem->prev = elem;
+
+    /* sort pages by number of live elements, fullest first */
+    for (i = 0, page = pool->pages; page; page = page->next, ++i) {
+        n = 0;
+        for (j = 0; j < page->size; ++j)
+            if (page->win[j].prev != &page->win[j]) n++;
+        total += n;
+        for (k = i; k > 0 && live[k-1] < n; --k) {
+            live[k] = live[k-1];
+            pages[k] = pages[k-1];
+        }
+        live[k] = n;
+        pages[k] = page;
+    }
+    keep = (total + pool->capacity - 1) / pool->capacity;
+    if (keep >= count) {
+        for (elem = ctx->freelist; elem; elem = elem->next)
+            elem->prev = 0;
+        pool->alloc.free(pool->alloc.userdata, pages);
+        return 0;
+    }
+
+    /* move live elements from the emptiest pages into free slots of the others */
+    for (i = 0; i < keep; ++i) {
+        for (j = pages[i]->size; j < pool->capacity; ++j)
+            pages[i]->win[j].prev = &pages[i]->win[j];
+        pages[i]->size = pool->capacity;
+    }
+    k = 0; n = 0;
+    for (i = keep; i < count; ++i) {
+        for (j = 0; j < pages[i]->size; ++j) {
+            elem = &pages[i]->win[j];
+            if (elem->prev == elem) continue;
+            while (pages[k]->win[n].prev != &pages[k]->win[n]) {
+                if (++n == pool->capacity) {n = 0; k++;}
+                NK_ASSERT(k < keep);
+            }
+            slot = &pages[k]->win[n];
+            *slot = *elem;
+            elem->prev = slot;
+        }
+    }
+
+    /* fix up pointers while forward pointers inside the old pages are intact */
+    ctx->begin = (struct nk_window*)nk_page_element_moved(ctx->begin);
+    ctx->end = (struct nk_window*)nk_page_element_moved(ctx->end);
+    ctx->active = (struct nk_window*)nk_page_element_moved(ctx->active);
+    ctx->hovered = (struct nk_window*)nk_page_element_moved(ctx->hovered);
+    for (win = ctx->begin; win; win = win->next)
+        nk_page_element_fix_window(win);
+    nk_window_index_invalidate(ctx);
+
+    /* rebuild page list and free list out of the kept pages */
+    pool->pages = 0;
+    ctx->freelist = 0;
+    for (i = keep; i-- > 0;) {
+        pages[i]->next = pool->pages;
+        pool->pages = pages[i];
+        for (j = pool->capacity; j-- > 0;) {
+            elem = &pages[i]->win[j];
+            if (elem->prev != elem) continue;
+            elem->prev = 0;
+            elem->next = 0;
+            nk_link_page_element_into_freelist(ctx, elem);
+        }
+    }
+    for (i = keep; i < count; ++i)
+        pool->alloc.free(pool->alloc.userdata, pages[i]);
+    pool->alloc.free(pool->alloc.userdata, pages);
+    return (nk_size)(count - keep) * nk_pool_page_size(pool);
+}
@@ -100,10 +100,12 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
     NK_ASSERT(ctx->current);
     NK_ASSERT(ctx->current->layout);
     if (!ctx || !ctx->current || !ctx->current->layout) return 0;
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
     nk_zero(ctx->current->layout, sizeof(*ctx->current->layout));
     if ((ctx->current->flags & NK_WINDOW_HIDDEN) || (ctx->current->flags & NK_WINDOW_CLOSED)) {
         nk_zero(ctx->current->layout, sizeof(struct nk_panel));
         ctx->current->layout->type = panel_type;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
         return 0;
     }
     /* pull state into local stack */
@@ -144,6 +146,7 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
         if (left_mouse_down && left_mouse_click_in_cursor && !left_mouse_clicked) {
             win->bounds.x = win->bounds.x + in->mouse.delta.x;
             win->bounds.y = win->bounds.y + in->mouse.delta.y;
+            nk_window_index_invalidate(ctx);
             in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x += in->mouse.delta.x;
             in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.y += in->mouse.delta.y;
             ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_MOVE];
@@ -265,9 +268,12 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
             if (nk_do_button_symbol(&ws, &win->buffer, button, (layout->flags & NK_WINDOW_MINIMIZED)?
                 style->window.header.maximize_symbol: style->window.header.minimize_symbol,
                 NK_BUTTON_DEFAULT, &style->window.header.minimize_button, in, style->font) && !(win->flags & NK_WINDOW_ROM))
+            {
                 layout->flags = (layout->flags & NK_WINDOW_MINIMIZED) ?
                     layout->flags & (nk_flags)~NK_WINDOW_MINIMIZED:
                     layout->flags | NK_WINDOW_MINIMIZED;
+                nk_window_index_invalidate(ctx);
+            }
         }}
 
         {/* window header title */
@@ -304,6 +310,7 @@ nk_panel_begin(struct nk_context *ctx, const char *title, enum nk_panel_type pan
         layout->clip.x + layout->clip.w, layout->clip.y + layout->clip.h);
     nk_push_scissor(out, clip);
     layout->clip = clip;}
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_BEGIN);
     return !(layout->flags & NK_WINDOW_HIDDEN) && !(layout->flags & NK_WINDOW_MINIMIZED);
 }
 NK_LIB void
@@ -317,6 +324,7 @@ nk_panel_end(struct nk_context *ctx)
 
     struct nk_vec2 scrollbar_size;
     struct nk_vec2 panel_padding;
+    int scrollbars_visible;
 
     NK_ASSERT(ctx);
     NK_ASSERT(ctx->current);
@@ -324,6 +332,7 @@ nk_panel_end(struct nk_context *ctx)
     if (!ctx || !ctx->current || !ctx->current->layout)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_PANEL_END);
     window = ctx->current;
     layout = window->layout;
     style = &ctx->style;
@@ -381,9 +390,10 @@ nk_panel_end(struct nk_context *ctx)
     }
 
     /* scrollbars */
-    if (!(layout->flags & NK_WINDOW_NO_SCROLLBAR) &&
+    scrollbars_visible = !(layout->flags & NK_WINDOW_NO_SCROLLBAR) &&
         !(layout->flags & NK_WINDOW_MINIMIZED) &&
-        window->scrollbar_hiding_timer < NK_SCROLLBAR_HIDING_TIMEOUT)
+        window->scrollbar_hiding_timer < NK_SCROLLBAR_HIDING_TIMEOUT;
+    if (scrollbars_visible)
     {
         struct nk_rect scroll;
         int scroll_has_scrolling;
@@ -475,6 +485,10 @@ nk_panel_end(struct nk_context *ctx)
         if ((!has_input && is_window_hovered) || (!is_window_hovered && !any_item_active))
             window->scrollbar_hiding_timer += ctx->delta_time_seconds;
         else window->scrollbar_hiding_timer = 0;
+
+        /* scrollbars drawn this frame disappear once the timer runs out */
+        if (scrollbars_visible)
+            nk_frame_schedule(ctx, NK_SCROLLBAR_HIDING_TIMEOUT - window->scrollbar_hiding_timer);
     } else window->scrollbar_hiding_timer = 0;
 
     /* window border */
@@ -549,6 +563,7 @@ nk_panel_end(struct nk_context *ctx)
                         }
                     }
                 }
+                nk_window_index_invalidate(ctx);
                 ctx->style.cursor_active = ctx->style.cursors[NK_CURSOR_RESIZE_TOP_RIGHT_DOWN_LEFT];
                 in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.x = scaler.x + scaler.w/2.0f;
                 in->mouse.buttons[NK_BUTTON_LEFT].clicked_pos.y = scaler.y + scaler.h/2.0f;
@@ -600,5 +615,6 @@ nk_panel_end(struct nk_context *ctx)
     window->popup.combo_count = 0;
     /* helper to make sure you have a 'nk_tree_push' for every 'nk_tree_pop' */
     NK_ASSERT(!layout->row.tree_depth);
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_PANEL_END);
 }
 
@@ -39,6 +39,13 @@ nk_pool_init_fixed(struct nk_pool *pool, void *memory, nk_size size)
     pool->type = NK_BUFFER_FIXED;
     pool->size = size;
 }
+NK_LIB nk_size
+nk_pool_page_size(const struct nk_pool *pool)
+{
+    if (pool->type == NK_BUFFER_FIXED)
+        return pool->size;
+    return sizeof(struct nk_page) + NK_POOL_DEFAULT_CAPACITY * sizeof(union nk_page_data);
+}
 NK_LIB struct nk_page_element*
 nk_pool_alloc(struct nk_pool *pool)
 {
@@ -51,8 +58,7 @@ nk_pool_alloc(struct nk_pool *pool)
             NK_ASSERT(pool->pages->size < pool->capacity);
             return 0;
         } else {
-            nk_size size = sizeof(struct nk_page);
-            size += NK_POOL_DEFAULT_CAPACITY * sizeof(union nk_page_data);
+            nk_size size = nk_pool_page_size(pool);
             page = (struct nk_page*)pool->alloc.alloc(pool->alloc.userdata,0, size);
             page->next = pool->pages;
             pool->pages = page;
@@ -0,0 +1,66 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          PROFILING
+ *
+ * ===============================================================*/
+NK_API const char*
+nk_profile_zone_name(enum nk_profile_zone zone)
+{
+    NK_STORAGE const char *names[NK_PROFILE_ZONE_MAX] = {
+        "window begin", "window end", "panel begin", "panel end", "layout",
+        "button", "toggle", "selectable", "slider", "progress", "scrollbar",
+        "edit", "property", "color picker", "build", "convert", "path",
+        "stroke", "fill", "font bake"
+    };
+    if ((unsigned)zone >= NK_PROFILE_ZONE_MAX) return 0;
+    return names[zone];
+}
+#ifdef NK_INCLUDE_PROFILER
+/*  Zones of the same kind can be nested so only the outermost zone is timed.
+    Open zones keep running over `nk_profile_collect` and are accounted to the
+    collection they end in. Objects without an attached profiler pass NULL. */
+NK_INTERN int
+nk_profile_zone_timed(enum nk_profile_zone zone)
+{
+#ifdef NK_PROFILE_COARSE_CLOCK
+    /* the default clock is a system call with millisecond resolution on some
+     * platforms so it is only taken for zones entered a few times a frame,
+     * all other zones only count calls and report zero seconds */
+    return zone == NK_PROFILE_WINDOW_BEGIN || zone == NK_PROFILE_WINDOW_END ||
+        zone == NK_PROFILE_BUILD || zone == NK_PROFILE_CONVERT ||
+        zone == NK_PROFILE_FONT_BAKE;
+#else
+    NK_UNUSED(zone);
+    return nk_true;
+#endif
+}
+NK_LIB void
+nk_profile_zone_begin(struct nk_profiler *profiler, enum nk_profile_zone zone)
+{
+    if (!profiler) return;
+    profiler->data.zones[zone].calls++;
+    if (!profiler->depth[zone]++ && nk_profile_zone_timed(zone))
+        profiler->start[zone] = NK_PROFILE_CLOCK();
+}
+NK_LIB void
+nk_profile_zone_end(struct nk_profiler *profiler, enum nk_profile_zone zone)
+{
+    if (!profiler) return;
+    NK_ASSERT(profiler->depth[zone]);
+    if (!profiler->depth[zone] || --profiler->depth[zone]) return;
+    if (nk_profile_zone_timed(zone))
+        profiler->data.zones[zone].seconds += NK_PROFILE_CLOCK() - profiler->start[zone];
+}
+NK_API void
+nk_profile_collect(struct nk_profiler *profiler, struct nk_profile *profile)
+{
+    NK_ASSERT(profiler);
+    NK_ASSERT(profile);
+    if (!profiler || !profile) return;
+    *profile = profiler->data;
+    nk_zero_struct(profiler->data);
+}
+#endif
@@ -84,6 +84,7 @@ nk_do_progress(nk_flags *state,
     NK_ASSERT(style);
     NK_ASSERT(out);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_PROGRESS);
 
     /* calculate progressbar cursor */
     cursor.w = NK_MAX(bounds.w, 2 * style->padding.x + 2 * style->border);
@@ -100,6 +101,7 @@ nk_do_progress(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_progress(out, *state, style, &bounds, &cursor, value, max);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_PROGRESS);
     return prog_value;
 }
 NK_API int
@@ -127,6 +127,7 @@ nk_do_property(nk_flags *ws,
     struct nk_rect edit;
     struct nk_rect empty;
 
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_PROPERTY);
     /* left decrement button */
     left.h = font->height/2;
     left.w = left.h;
@@ -273,6 +274,7 @@ nk_do_property(nk_flags *ws,
             break;
         }
     }
+    NK_PROFILE_END(out->profiler, NK_PROFILE_PROPERTY);
 }
 NK_LIB struct nk_property_variant
 nk_property_variant_int(int value, int min_value, int max_value, int step)
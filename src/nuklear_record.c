@@ -0,0 +1,268 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          INPUT RECORDING
+ *
+ * ===============================================================*/
+/*  A recording starts with 'N' 'K' 'I' version followed by operations.
+    Each operation is a byte holding either a `nk_input_event_type` for
+    one mirroring call or a `nk_input_record_op`. Arguments are packed as
+    variable length integers and raw floats the same way as packed draw
+    commands. Every frame ends with `NK_INPUT_RECORD_FRAME` followed by
+    `delta_time_seconds` and the hash of all draw commands packed with a
+    handle table local to the frame, so hashes do not depend on font
+    pointers. */
+#define NK_INPUT_RECORD_VERSION 1
+#define NK_INPUT_REPLAY_PADDING 32
+
+NK_INTERN void
+nk_input_record_write(struct nk_input_recorder *rec, const nk_byte *data, nk_size size)
+{
+    void *memory = nk_buffer_alloc(&rec->data, NK_BUFFER_FRONT, size, 1);
+    if (!memory) return;
+    NK_MEMCPY(memory, data, size);
+}
+NK_INTERN nk_hash
+nk_input_command_hash(struct nk_context *ctx, struct nk_command_packing *packing)
+{
+    const struct nk_command *cmd;
+    nk_hash hash = 0;
+    nk_buffer_clear(&packing->table);
+    nk_foreach(cmd, ctx) {
+        nk_size size = nk_command_packed_size(cmd);
+        nk_byte *p;
+        nk_buffer_clear(&packing->scratch);
+        p = (nk_byte*)nk_buffer_alloc(&packing->scratch, NK_BUFFER_FRONT, size, 1);
+        if (!p) break;
+        size = (nk_size)(nk_pack_command(packing, p, cmd) - p);
+        hash = nk_murmur_hash(p, (int)size, hash);
+    }
+    return hash;
+}
+NK_LIB void
+nk_input_record(struct nk_context *ctx, const struct nk_input_event *evt)
+{
+    nk_byte tmp[32], *p = tmp;
+    *p++ = (nk_byte)evt->type;
+    switch (evt->type) {
+    case NK_INPUT_EVENT_MOTION:
+        p = nk_pack_int(p, evt->data.motion.x);
+        p = nk_pack_int(p, evt->data.motion.y);
+        break;
+    case NK_INPUT_EVENT_BUTTON:
+        p = nk_pack_uint(p, (nk_uint)evt->data.button.id);
+        p = nk_pack_int(p, evt->data.button.x);
+        p = nk_pack_int(p, evt->data.button.y);
+        p = nk_pack_int(p, evt->data.button.down);
+        break;
+    case NK_INPUT_EVENT_KEY:
+        p = nk_pack_uint(p, (nk_uint)evt->data.key.key);
+        p = nk_pack_int(p, evt->data.key.down);
+        break;
+    case NK_INPUT_EVENT_SCROLL:
+        p = nk_pack_float(p, evt->data.scroll.x);
+        p = nk_pack_float(p, evt->data.scroll.y);
+        break;
+    case NK_INPUT_EVENT_UNICODE:
+        p = nk_pack_uint(p, evt->data.unicode);
+        break;
+    default: return;
+    }
+    nk_input_record_write(ctx->recorder, tmp, (nk_size)(p - tmp));
+}
+NK_LIB void
+nk_input_record_op(struct nk_context *ctx, enum nk_input_record_op op)
+{
+    nk_byte tmp = (nk_byte)op;
+    nk_input_record_write(ctx->recorder, &tmp, 1);
+}
+NK_LIB void
+nk_input_record_frame(struct nk_context *ctx)
+{
+    nk_byte tmp[16], *p = tmp;
+    struct nk_input_recorder *rec = ctx->recorder;
+    *p++ = (nk_byte)NK_INPUT_RECORD_FRAME;
+    p = nk_pack_float(p, ctx->delta_time_seconds);
+    p = nk_pack_uint(p, nk_input_command_hash(ctx, &rec->packing));
+    nk_input_record_write(rec, tmp, (nk_size)(p - tmp));
+    rec->frames++;
+}
+NK_API void
+nk_input_recorder_init(struct nk_input_recorder *rec, const struct nk_allocator *alloc)
+{
+    NK_ASSERT(rec);
+    NK_ASSERT(alloc);
+    if (!rec || !alloc) return;
+    nk_zero(rec, sizeof(*rec));
+    nk_buffer_init(&rec->data, alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    nk_command_packing_init(&rec->packing, alloc);
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_input_recorder_init_default(struct nk_input_recorder *rec)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_input_recorder_init(rec, &alloc);
+}
+#endif
+NK_API void
+nk_input_recorder_free(struct nk_input_recorder *rec)
+{
+    NK_ASSERT(rec);
+    if (!rec) return;
+    if (rec->data.pool.alloc)
+        nk_buffer_free(&rec->data);
+    nk_command_packing_free(&rec->packing);
+    nk_zero(rec, sizeof(*rec));
+}
+NK_API void
+nk_input_record_begin(struct nk_context *ctx, struct nk_input_recorder *rec)
+{
+    nk_byte header[4];
+    NK_ASSERT(ctx);
+    NK_ASSERT(rec);
+    NK_ASSERT(!ctx->current && "input can only be recorded from the start of a frame");
+    if (!ctx || !rec) return;
+    header[0] = 'N'; header[1] = 'K'; header[2] = 'I';
+    header[3] = NK_INPUT_RECORD_VERSION;
+    nk_buffer_clear(&rec->data);
+    rec->frames = 0;
+    ctx->recorder = rec;
+    nk_input_record_write(rec, header, sizeof(header));
+}
+NK_API void
+nk_input_record_end(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->recorder = 0;
+}
+NK_API int
+nk_input_replay_init(struct nk_input_replay *replay, const struct nk_allocator *alloc,
+    const void *memory, nk_size size)
+{
+    const nk_byte *header = (const nk_byte*)memory;
+    nk_byte *data;
+
+    NK_ASSERT(replay);
+    NK_ASSERT(alloc);
+    NK_ASSERT(memory || !size);
+    if (!replay || !alloc) return nk_false;
+    nk_zero(replay, sizeof(*replay));
+    nk_buffer_init(&replay->data, alloc, size + NK_INPUT_REPLAY_PADDING);
+    nk_command_packing_init(&replay->packing, alloc);
+    if (!memory || size < 4 || header[0] != 'N' || header[1] != 'K' ||
+        header[2] != 'I' || header[3] != NK_INPUT_RECORD_VERSION)
+        return nk_false;
+
+    /* zero padding lets operations cut off at the end decode without
+     * reading past the copy */
+    data = (nk_byte*)nk_buffer_alloc(&replay->data, NK_BUFFER_FRONT,
+        size + NK_INPUT_REPLAY_PADDING, 1);
+    if (!data) return nk_false;
+    NK_MEMCPY(data, memory, size);
+    NK_MEMSET(data + size, 0, NK_INPUT_REPLAY_PADDING);
+    replay->offset = 4;
+    return nk_true;
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API int
+nk_input_replay_init_default(struct nk_input_replay *replay,
+    const void *memory, nk_size size)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    return nk_input_replay_init(replay, &alloc, memory, size);
+}
+#endif
+NK_API void
+nk_input_replay_free(struct nk_input_replay *replay)
+{
+    NK_ASSERT(replay);
+    if (!replay) return;
+    if (replay->data.pool.alloc)
+        nk_buffer_free(&replay->data);
+    nk_command_packing_free(&replay->packing);
+    nk_zero(replay, sizeof(*replay));
+}
+NK_API int
+nk_input_replay_frame(struct nk_context *ctx, struct nk_input_replay *replay)
+{
+    const nk_byte *begin, *end, *p;
+    NK_ASSERT(ctx);
+    NK_ASSERT(replay);
+    if (!ctx || !replay || replay->data.allocated < NK_INPUT_REPLAY_PADDING)
+        return nk_false;
+
+    begin = (const nk_byte*)nk_buffer_memory_const(&replay->data);
+    end = begin + replay->data.allocated - NK_INPUT_REPLAY_PADDING;
+    p = begin + replay->offset;
+    while (p < end) {
+        nk_uint id;
+        int x, y;
+        switch (*p++) {
+        case NK_INPUT_EVENT_MOTION:
+            x = nk_unpack_int(&p);
+            y = nk_unpack_int(&p);
+            nk_input_motion(ctx, x, y);
+            break;
+        case NK_INPUT_EVENT_BUTTON:
+            id = nk_unpack_uint(&p);
+            x = nk_unpack_int(&p);
+            y = nk_unpack_int(&p);
+            if (id >= NK_BUTTON_MAX) goto corrupt;
+            nk_input_button(ctx, (enum nk_buttons)id, x, y, nk_unpack_int(&p));
+            break;
+        case NK_INPUT_EVENT_KEY:
+            id = nk_unpack_uint(&p);
+            if (id >= NK_KEY_MAX) goto corrupt;
+            nk_input_key(ctx, (enum nk_keys)id, nk_unpack_int(&p));
+            break;
+        case NK_INPUT_EVENT_SCROLL: {
+            struct nk_vec2 scroll;
+            scroll.x = nk_unpack_float(&p);
+            scroll.y = nk_unpack_float(&p);
+            nk_input_scroll(ctx, scroll);
+        } break;
+        case NK_INPUT_EVENT_UNICODE:
+            nk_input_unicode(ctx, nk_unpack_uint(&p));
+            break;
+        case NK_INPUT_RECORD_BEGIN:
+            nk_input_begin(ctx);
+            break;
+        case NK_INPUT_RECORD_END:
+            nk_input_end(ctx);
+            break;
+        case NK_INPUT_RECORD_FRAME:
+            ctx->delta_time_seconds = nk_unpack_float(&p);
+            replay->hash = nk_unpack_uint(&p);
+            if (p > end) goto corrupt;
+            replay->offset = (nk_size)(p - begin);
+            replay->frame++;
+            return nk_true;
+        default: goto corrupt;
+        }
+    }
+corrupt:
+    replay->offset = (nk_size)(end - begin);
+    return nk_false;
+}
+NK_API int
+nk_input_replay_verify(struct nk_context *ctx, struct nk_input_replay *replay)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(replay);
+    if (!ctx || !replay || !replay->frame) return nk_false;
+    if (nk_input_command_hash(ctx, &replay->packing) == replay->hash)
+        return nk_true;
+    if (!replay->diverged)
+        replay->diverged = replay->frame;
+    return nk_false;
+}
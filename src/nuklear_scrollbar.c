@@ -136,10 +136,14 @@ nk_do_scrollbarv(nk_flags *state,
     NK_ASSERT(style);
     NK_ASSERT(state);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SCROLLBAR);
 
     scroll.w = NK_MAX(scroll.w, 1);
     scroll.h = NK_MAX(scroll.h, 0);
-    if (target <= scroll.h) return 0;
+    if (target <= scroll.h) {
+        NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
+        return 0;
+    }
 
     /* optional scrollbar buttons */
     if (style->show_buttons) {
@@ -203,6 +207,7 @@ nk_do_scrollbarv(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_scrollbar(out, *state, style, &scroll, &cursor);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
     return scroll_offset;
 }
 NK_LIB float
@@ -224,11 +229,15 @@ nk_do_scrollbarh(nk_flags *state,
     NK_ASSERT(out);
     NK_ASSERT(style);
     if (!out || !style) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SCROLLBAR);
 
     /* scrollbar background */
     scroll.h = NK_MAX(scroll.h, 1);
     scroll.w = NK_MAX(scroll.w, 2 * scroll.h);
-    if (target <= scroll.w) return 0;
+    if (target <= scroll.w) {
+        NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
+        return 0;
+    }
 
     /* optional scrollbar buttons */
     if (style->show_buttons) {
@@ -291,6 +300,7 @@ nk_do_scrollbarh(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_scrollbar(out, *state, style, &scroll, &cursor);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SCROLLBAR);
     return scroll_offset;
 }
 
@@ -73,6 +73,7 @@ nk_do_selectable(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* remove padding */
@@ -89,6 +90,7 @@ nk_do_selectable(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, 0,0,NK_SYMBOL_NONE, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 NK_LIB int
@@ -110,6 +112,7 @@ nk_do_selectable_image(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* toggle behavior */
@@ -136,6 +139,7 @@ nk_do_selectable_image(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, &icon, img, NK_SYMBOL_NONE, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 NK_LIB int
@@ -157,6 +161,7 @@ nk_do_selectable_symbol(nk_flags *state, struct nk_command_buffer *out,
     NK_ASSERT(font);
 
     if (!state || !out || !str || !len || !value || !style || !font) return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SELECTABLE);
     old_value = *value;
 
     /* toggle behavior */
@@ -183,6 +188,7 @@ nk_do_selectable_symbol(nk_flags *state, struct nk_command_buffer *out,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_selectable(out, *state, style, *value, &bounds, &icon, 0, sym, str, len, align, font);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SELECTABLE);
     return old_value != *value;
 }
 
@@ -128,6 +128,7 @@ nk_do_slider(nk_flags *state,
     NK_ASSERT(out);
     if (!out || !style)
         return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_SLIDER);
 
     /* remove padding from slider bounds */
     bounds.x = bounds.x + style->padding.x;
@@ -194,6 +195,7 @@ nk_do_slider(nk_flags *state,
     if (style->draw_begin) style->draw_begin(out, style->userdata);
     nk_draw_slider(out, *state, style, &bounds, &visual_cursor, slider_min, slider_value, slider_max);
     if (style->draw_end) style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_SLIDER);
     return slider_value;
 }
 NK_API int
@@ -0,0 +1,491 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          COMMAND STREAM
+ *
+ * ===============================================================*/
+/*  A stream message holds one frame:
+
+        'N' 'K' version flags
+        sequence number
+        number of new handle table entries followed by the entries
+        number of window ranges followed by the ranges
+
+    Handle table entries are appended to the table of the previous message
+    unless the message is a key frame which starts with an empty table.
+    Each entry is a kind byte followed by a font index and height, an image
+    or a userdata handle. Handles are copied as raw bytes.
+    Window ranges start with the window name hash and a tag. Bit zero of the
+    tag marks a range that is unchanged from the range with the same name
+    inside the previous message. Otherwise the tag holds the size of the
+    range shifted left by one followed by the packed commands described in
+    the command packing section. */
+#define NK_STREAM_VERSION 1
+enum nk_stream_flags {
+    NK_STREAM_KEY_FRAME = NK_FLAG(0)
+};
+enum nk_stream_entry {
+    NK_STREAM_ENTRY_FONT,
+    NK_STREAM_ENTRY_IMAGE,
+    NK_STREAM_ENTRY_HANDLE
+};
+struct nk_stream_range {
+    nk_hash key;
+    nk_size offset;
+    nk_size size;
+};
+NK_INTERN void
+nk_stream_history_init(struct nk_stream_history *history,
+    const struct nk_allocator *alloc)
+{
+    int i;
+    nk_zero(history, sizeof(*history));
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_init(&history->ranges[i], alloc, 16 * sizeof(struct nk_stream_range));
+        nk_buffer_init(&history->data[i], alloc, NK_DEFAULT_COMMAND_BUFFER_SIZE);
+    }
+}
+NK_INTERN void
+nk_stream_history_free(struct nk_stream_history *history)
+{
+    int i;
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_free(&history->ranges[i]);
+        nk_buffer_free(&history->data[i]);
+    }
+    nk_zero(history, sizeof(*history));
+}
+NK_INTERN void
+nk_stream_history_clear(struct nk_stream_history *history)
+{
+    int i;
+    for (i = 0; i < 2; ++i) {
+        nk_buffer_clear(&history->ranges[i]);
+        nk_buffer_clear(&history->data[i]);
+    }
+}
+NK_INTERN struct nk_stream_range*
+nk_stream_history_add(struct nk_stream_history *history, nk_hash key)
+{
+    struct nk_buffer *ranges = &history->ranges[history->current ^ 1];
+    struct nk_stream_range *range = (struct nk_stream_range*)nk_buffer_alloc(ranges,
+        NK_BUFFER_FRONT, sizeof(*range), NK_ALIGNOF(struct nk_stream_range));
+    if (!range) return 0;
+    range->key = key;
+    range->offset = history->data[history->current ^ 1].allocated;
+    range->size = 0;
+    return range;
+}
+NK_INTERN const struct nk_stream_range*
+nk_stream_history_find(const struct nk_stream_history *history, nk_hash key)
+{
+    /* encoder and decoder have to agree on the first range with a name */
+    const struct nk_buffer *ranges = &history->ranges[history->current];
+    const struct nk_stream_range *range = (const struct nk_stream_range*)ranges->memory.ptr;
+    nk_size count = ranges->allocated / sizeof(*range);
+    nk_size i;
+    for (i = 0; i < count; ++i) {
+        if (range[i].key == key)
+            return &range[i];
+    }
+    return 0;
+}
+NK_INTERN int
+nk_stream_write(struct nk_buffer *out, const void *data, nk_size size)
+{
+    void *memory;
+    if (!size) return 1;
+    memory = nk_buffer_alloc(out, NK_BUFFER_FRONT, size, 1);
+    if (!memory) return 0;
+    NK_MEMCPY(memory, data, size);
+    return 1;
+}
+NK_INTERN int
+nk_stream_write_uint(struct nk_buffer *out, nk_uint v)
+{
+    nk_byte tmp[8];
+    return nk_stream_write(out, tmp, (nk_size)(nk_pack_uint(tmp, v) - tmp));
+}
+NK_INTERN int
+nk_stream_write_entry(const struct nk_stream_encoder *enc, struct nk_buffer *out,
+    const struct nk_packed_ref *ref)
+{
+    nk_byte tmp[64];
+    nk_byte *p = tmp;
+    int i;
+    if (ref->font) {
+        /* fonts are sent as index into the font list shared with the decoder */
+        for (i = 0; i < enc->font_count && enc->fonts[i] != ref->font; ++i);
+        NK_ASSERT(i < enc->font_count && "font used by a text command was not registered");
+        *p++ = NK_STREAM_ENTRY_FONT;
+        p = nk_pack_uint(p, (nk_uint)((i < enc->font_count) ? i: 0));
+        p = nk_pack_float(p, ref->height);
+    } else if (ref->handle.ptr) {
+        *p++ = NK_STREAM_ENTRY_HANDLE;
+        NK_MEMCPY(p, &ref->handle, sizeof(ref->handle));
+        p += sizeof(ref->handle);
+    } else {
+        *p++ = NK_STREAM_ENTRY_IMAGE;
+        NK_MEMCPY(p, &ref->img.handle, sizeof(ref->img.handle));
+        p += sizeof(ref->img.handle);
+        p = nk_pack_uint(p, ref->img.w);
+        p = nk_pack_uint(p, ref->img.h);
+        for (i = 0; i < 4; ++i)
+            p = nk_pack_uint(p, ref->img.region[i]);
+    }
+    return nk_stream_write(out, tmp, (nk_size)(p - tmp));
+}
+NK_INTERN int
+nk_stream_read(const nk_byte **p, const nk_byte *end, void *data, nk_size size)
+{
+    if ((nk_size)(end - *p) < size) return 0;
+    NK_MEMCPY(data, *p, size);
+    *p += size;
+    return 1;
+}
+NK_INTERN int
+nk_stream_read_uint(const nk_byte **p, const nk_byte *end, nk_uint *v)
+{
+    const nk_byte *in = *p;
+    int shift = 0;
+    *v = 0;
+    while (in < end && shift < 32) {
+        *v |= (nk_uint)(*in & 0x7F) << shift;
+        shift += 7;
+        if (!(*in++ & 0x80)) {
+            *p = in;
+            return 1;
+        }
+    }
+    return 0;
+}
+NK_INTERN int
+nk_stream_read_entry(const struct nk_stream_decoder *dec, const nk_byte **p,
+    const nk_byte *end, struct nk_packed_ref *ref)
+{
+    nk_byte kind;
+    nk_uint v;
+    int i;
+    nk_zero(ref, sizeof(*ref));
+    if (!nk_stream_read(p, end, &kind, 1)) return 0;
+    switch (kind) {
+    case NK_STREAM_ENTRY_FONT:
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        if (!nk_stream_read(p, end, &ref->height, sizeof(ref->height))) return 0;
+        if (v < (nk_uint)dec->font_count)
+            ref->font = dec->fonts[v];
+        return 1;
+    case NK_STREAM_ENTRY_HANDLE:
+        return nk_stream_read(p, end, &ref->handle, sizeof(ref->handle));
+    case NK_STREAM_ENTRY_IMAGE:
+        if (!nk_stream_read(p, end, &ref->img.handle, sizeof(ref->img.handle))) return 0;
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        ref->img.w = (unsigned short)v;
+        if (!nk_stream_read_uint(p, end, &v)) return 0;
+        ref->img.h = (unsigned short)v;
+        for (i = 0; i < 4; ++i) {
+            if (!nk_stream_read_uint(p, end, &v)) return 0;
+            ref->img.region[i] = (unsigned short)v;
+        }
+        return 1;
+    default: return 0;
+    }
+}
+NK_API void
+nk_stream_encoder_init(struct nk_stream_encoder *enc, const struct nk_allocator *alloc,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    NK_ASSERT(enc);
+    NK_ASSERT(alloc);
+    NK_ASSERT(fonts || !font_count);
+    if (!enc || !alloc) return;
+    nk_zero(enc, sizeof(*enc));
+    nk_command_packing_init(&enc->packing, alloc);
+    nk_stream_history_init(&enc->history, alloc);
+    enc->fonts = fonts;
+    enc->font_count = font_count;
+    enc->key = nk_true;
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_stream_encoder_init_default(struct nk_stream_encoder *enc,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_stream_encoder_init(enc, &alloc, fonts, font_count);
+}
+#endif
+NK_API void
+nk_stream_encoder_free(struct nk_stream_encoder *enc)
+{
+    NK_ASSERT(enc);
+    if (!enc) return;
+    nk_command_packing_free(&enc->packing);
+    nk_stream_history_free(&enc->history);
+    nk_zero(enc, sizeof(*enc));
+}
+NK_API void
+nk_stream_encoder_reset(struct nk_stream_encoder *enc)
+{
+    NK_ASSERT(enc);
+    if (!enc) return;
+    enc->key = nk_true;
+}
+NK_API nk_size
+nk_stream_encode(struct nk_stream_encoder *enc, struct nk_context *ctx,
+    struct nk_buffer *out)
+{
+    /* handle table entries before the table is sent again from scratch */
+    NK_STORAGE const nk_size table_limit = 1024;
+    struct nk_stream_history *history;
+    struct nk_buffer *data;
+    struct nk_stream_range *range = 0;
+    const struct nk_stream_range *ranges, *prev;
+    const struct nk_packed_ref *table;
+    const struct nk_command *cmd;
+    struct nk_window *win;
+    nk_size offset = 0, begin, count, i;
+    nk_uint entries;
+    nk_byte header[4];
+    int key;
+
+    NK_ASSERT(enc);
+    NK_ASSERT(ctx);
+    NK_ASSERT(out);
+    NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
+    if (!enc || !ctx || !out || ctx->current) return 0;
+
+    history = &enc->history;
+    key = enc->key || enc->packing.table.allocated > table_limit * sizeof(struct nk_packed_ref);
+    if (key) {
+        nk_buffer_clear(&enc->packing.table);
+        enc->sent = 0;
+    }
+
+    /* pack commands of each window into its own range */
+    data = &history->data[history->current ^ 1];
+    nk_buffer_clear(data);
+    nk_buffer_clear(&history->ranges[history->current ^ 1]);
+    if (ctx->count && nk_command_list_begin(ctx, &offset)) {
+        win = ctx->begin;
+        for (;;) {
+            nk_size size, used;
+            nk_byte *memory;
+            cmd = nk_command_list_at(&ctx->memory, offset);
+            if (!cmd) break;
+
+            /* windows are visited in the order linked by `nk_build`, popups
+             * and the cursor overlay follow as part of the last range */
+            for (; win; win = win->next) {
+                nk_size start = win->buffer.begin;
+                if (win->buffer.last == win->buffer.begin ||
+                    (win->flags & NK_WINDOW_HIDDEN) || win->seq != ctx->seq)
+                    continue;
+                if (start != offset) break;
+                range = nk_stream_history_add(history, win->name);
+                if (!range) return 0;
+            }
+            if (!range && !(range = nk_stream_history_add(history, 0)))
+                return 0;
+
+            /* callbacks cannot be called by another process */
+            offset = cmd->next;
+            if (cmd->type == NK_COMMAND_NOP || cmd->type == NK_COMMAND_CUSTOM)
+                continue;
+            size = nk_command_packed_size(cmd);
+            memory = (nk_byte*)nk_buffer_alloc(data, NK_BUFFER_FRONT, size, 1);
+            if (!memory) return 0;
+            used = (nk_size)(nk_pack_command(&enc->packing, memory, cmd) - memory);
+            data->allocated -= size - used;
+            data->needed -= size - used;
+            range->size += used;
+        }
+    }
+
+    /* header and handle table entries added by this frame */
+    begin = out->allocated;
+    header[0] = 'N';
+    header[1] = 'K';
+    header[2] = NK_STREAM_VERSION;
+    header[3] = (nk_byte)((key) ? NK_STREAM_KEY_FRAME: 0);
+    table = (const struct nk_packed_ref*)enc->packing.table.memory.ptr;
+    entries = (nk_uint)(enc->packing.table.allocated / sizeof(*table));
+    if (!nk_stream_write(out, header, sizeof(header)) ||
+        !nk_stream_write_uint(out, ctx->seq) ||
+        !nk_stream_write_uint(out, entries - enc->sent))
+        goto fail;
+    for (i = enc->sent; i < entries; ++i) {
+        if (!nk_stream_write_entry(enc, out, &table[i]))
+            goto fail;
+    }
+
+    /* ranges equal to the previous frame are sent as reference */
+    ranges = (const struct nk_stream_range*)history->ranges[history->current ^ 1].memory.ptr;
+    count = history->ranges[history->current ^ 1].allocated / sizeof(*ranges);
+    if (!nk_stream_write_uint(out, (nk_uint)count))
+        goto fail;
+    for (i = 0; i < count; ++i) {
+        const nk_byte *bytes = (const nk_byte*)nk_buffer_at(data, ranges[i].offset);
+        prev = (key) ? 0: nk_stream_history_find(history, ranges[i].key);
+        if (!nk_stream_write_uint(out, ranges[i].key))
+            goto fail;
+        if (prev && prev->size == ranges[i].size) {
+            const nk_byte *old = (const nk_byte*)nk_buffer_at(&history->data[history->current], prev->offset);
+            nk_size n = 0;
+            while (n < prev->size && old[n] == bytes[n]) n++;
+            if (n == prev->size) {
+                if (!nk_stream_write_uint(out, 1)) goto fail;
+                continue;
+            }
+        }
+        if (!nk_stream_write_uint(out, (nk_uint)(ranges[i].size << 1)) ||
+            !nk_stream_write(out, bytes, ranges[i].size))
+            goto fail;
+    }
+    history->current ^= 1;
+    enc->sent = entries;
+    enc->key = nk_false;
+    return out->allocated - begin;
+
+fail:
+    /* nothing was sent so the next message has to include this frame's entries */
+    out->allocated = begin;
+    out->needed = begin;
+    return 0;
+}
+NK_API void
+nk_stream_decoder_init(struct nk_stream_decoder *dec, const struct nk_allocator *alloc,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    NK_ASSERT(dec);
+    NK_ASSERT(alloc);
+    NK_ASSERT(fonts || !font_count);
+    if (!dec || !alloc) return;
+    nk_zero(dec, sizeof(*dec));
+    nk_command_packing_init(&dec->packing, alloc);
+    nk_stream_history_init(&dec->history, alloc);
+    dec->fonts = fonts;
+    dec->font_count = font_count;
+}
+#ifdef NK_INCLUDE_DEFAULT_ALLOCATOR
+NK_API void
+nk_stream_decoder_init_default(struct nk_stream_decoder *dec,
+    const struct nk_user_font *const *fonts, int font_count)
+{
+    struct nk_allocator alloc;
+    alloc.userdata.ptr = 0;
+    alloc.alloc = nk_malloc;
+    alloc.free = nk_mfree;
+    nk_stream_decoder_init(dec, &alloc, fonts, font_count);
+}
+#endif
+NK_API void
+nk_stream_decoder_free(struct nk_stream_decoder *dec)
+{
+    NK_ASSERT(dec);
+    if (!dec) return;
+    nk_command_packing_free(&dec->packing);
+    nk_stream_history_free(&dec->history);
+    nk_zero(dec, sizeof(*dec));
+}
+NK_API int
+nk_stream_decode(struct nk_stream_decoder *dec, struct nk_frame *frame,
+    const void *message, nk_size size)
+{
+    /* upper bound of a packed command without text or points so reading a
+     * truncated command never leaves the range memory */
+    NK_STORAGE const nk_size slack = 64;
+    struct nk_stream_history *history;
+    struct nk_buffer *data;
+    const struct nk_stream_range *ranges;
+    const nk_byte *p = (const nk_byte*)message;
+    const nk_byte *end = p + size;
+    nk_byte header[4];
+    nk_uint seq, entries, count, key, tag, i;
+    void *memory;
+
+    NK_ASSERT(dec);
+    NK_ASSERT(frame);
+    NK_ASSERT(message || !size);
+    if (!dec || !frame || !message) return 0;
+    if (!nk_stream_read(&p, end, header, sizeof(header)) ||
+        header[0] != 'N' || header[1] != 'K' || header[2] != NK_STREAM_VERSION)
+        goto fail;
+
+    /* messages after a decoding error reference state the decoder lost */
+    history = &dec->history;
+    if (header[3] & NK_STREAM_KEY_FRAME) {
+        nk_buffer_clear(&dec->packing.table);
+        nk_stream_history_clear(history);
+        dec->valid = nk_true;
+    } else if (!dec->valid) return 0;
+
+    if (!nk_stream_read_uint(&p, end, &seq) || !nk_stream_read_uint(&p, end, &entries))
+        goto fail;
+    for (i = 0; i < entries; ++i) {
+        struct nk_packed_ref ref, *entry;
+        if (!nk_stream_read_entry(dec, &p, end, &ref)) goto fail;
+        entry = (struct nk_packed_ref*)nk_buffer_alloc(&dec->packing.table,
+            NK_BUFFER_FRONT, sizeof(ref), NK_ALIGNOF(struct nk_packed_ref));
+        if (!entry) goto fail;
+        *entry = ref;
+    }
+
+    /* gather packed commands of all ranges */
+    data = &history->data[history->current ^ 1];
+    nk_buffer_clear(data);
+    nk_buffer_clear(&history->ranges[history->current ^ 1]);
+    if (!nk_stream_read_uint(&p, end, &count)) goto fail;
+    for (i = 0; i < count; ++i) {
+        struct nk_stream_range *range;
+        const nk_byte *bytes;
+        nk_size n;
+        if (!nk_stream_read_uint(&p, end, &key) || !nk_stream_read_uint(&p, end, &tag))
+            goto fail;
+        if (tag & 1) {
+            const struct nk_stream_range *prev = nk_stream_history_find(history, key);
+            if (!prev) goto fail;
+            bytes = (const nk_byte*)nk_buffer_at(&history->data[history->current], prev->offset);
+            n = prev->size;
+        } else {
+            bytes = p;
+            n = (nk_size)(tag >> 1);
+            if ((nk_size)(end - p) < n) goto fail;
+            p += n;
+        }
+        range = nk_stream_history_add(history, key);
+        if (!range || !nk_stream_write(data, bytes, n)) goto fail;
+        range->size = n;
+    }
+    memory = nk_buffer_alloc(data, NK_BUFFER_FRONT, slack, 1);
+    if (!memory) goto fail;
+    NK_MEMSET(memory, 0, slack);
+
+    /* unpack into a native command list */
+    nk_buffer_clear(&frame->memory);
+    frame->begin = frame->memory.allocated;
+    frame->seq = seq;
+    ranges = (const struct nk_stream_range*)history->ranges[history->current ^ 1].memory.ptr;
+    for (i = 0; i < count; ++i) {
+        const nk_byte *in = (const nk_byte*)nk_buffer_at(data, ranges[i].offset);
+        const nk_byte *last = in + ranges[i].size;
+        while (in < last) {
+            struct nk_command *cmd = nk_unpack_command(&dec->packing, &in, last, &frame->memory);
+            if (!cmd || in > last) goto fail;
+            cmd->next = frame->memory.allocated;
+        }
+    }
+    history->current ^= 1;
+    return 1;
+
+fail:
+    nk_buffer_clear(&frame->memory);
+    frame->begin = frame->memory.allocated;
+    dec->valid = nk_false;
+    return 0;
+}
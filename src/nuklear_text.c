@@ -62,7 +62,7 @@ nk_widget_text_wrap(struct nk_command_buffer *o, struct nk_rect b,
     int done = 0;
     struct nk_rect line;
     struct nk_text text;
-    NK_INTERN nk_rune seperator[] = {' '};
+    NK_STORAGE const nk_rune seperator[] = {' '};
 
     NK_ASSERT(o);
     NK_ASSERT(t);
@@ -108,7 +108,8 @@ nk_text_colored(struct nk_context *ctx, const char *str, int len,
 
     win = ctx->current;
     style = &ctx->style;
-    nk_panel_alloc_space(&bounds, ctx);
+    if (!nk_panel_alloc_space(&bounds, ctx))
+        return;
     item_padding = style->text.padding;
 
     text.padding.x = item_padding.x;
@@ -135,7 +136,8 @@ nk_text_wrap_colored(struct nk_context *ctx, const char *str,
 
     win = ctx->current;
     style = &ctx->style;
-    nk_panel_alloc_space(&bounds, ctx);
+    if (!nk_panel_alloc_space(&bounds, ctx))
+        return;
     item_padding = style->text.padding;
 
     text.padding.x = item_padding.x;
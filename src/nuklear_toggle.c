@@ -123,6 +123,7 @@ nk_do_toggle(nk_flags *state,
     NK_ASSERT(font);
     if (!out || !style || !font || !active)
         return 0;
+    NK_PROFILE_BEGIN(out->profiler, NK_PROFILE_TOGGLE);
 
     r.w = NK_MAX(r.w, font->height + 2 * style->padding.x);
     r.h = NK_MAX(r.h, font->height + 2 * style->padding.y);
@@ -165,6 +166,7 @@ nk_do_toggle(nk_flags *state,
     }
     if (style->draw_end)
         style->draw_end(out, style->userdata);
+    NK_PROFILE_END(out->profiler, NK_PROFILE_TOGGLE);
     return (was_active != *active);
 }
 /*----------------------------------------------------------------
@@ -0,0 +1,168 @@
+#include "nuklear.h"
+#include "nuklear_internal.h"
+
+/* ===============================================================
+ *
+ *                          TREE VIEW
+ *
+ * ===============================================================*/
+NK_API void
+nk_tree_view_init(struct nk_tree_view_state *state,
+    const struct nk_tree_view_node *nodes, int node_count,
+    nk_byte *expanded, int *rows)
+{
+    NK_ASSERT(state);
+    NK_ASSERT((nodes && expanded && rows) || !node_count);
+    if (!state) return;
+    nk_zero(state, sizeof(*state));
+    state->nodes = nodes;
+    state->node_count = NK_MAX(node_count, 0);
+    state->expanded = expanded;
+    state->rows = rows;
+    state->dirty = nk_true;
+}
+NK_API void
+nk_tree_view_set_expanded(struct nk_tree_view_state *state, int node, int expanded)
+{
+    NK_ASSERT(state);
+    NK_ASSERT(node >= 0 && node < state->node_count);
+    if (!state || node < 0 || node >= state->node_count) return;
+    if (!state->expanded[node] == !expanded) return;
+    state->expanded[node] = (nk_byte)(expanded != 0);
+    state->dirty = nk_true;
+}
+NK_API int
+nk_tree_view_is_expanded(const struct nk_tree_view_state *state, int node)
+{
+    NK_ASSERT(state);
+    if (!state || node < 0 || node >= state->node_count) return 0;
+    return state->expanded[node] != 0;
+}
+NK_API int
+nk_tree_view_update(struct nk_tree_view_state *state)
+{
+    int i = 0;
+    NK_ASSERT(state);
+    if (!state) return 0;
+    if (!state->dirty) return state->row_count;
+
+    /* flatten expanded nodes into visible rows and jump over the descendants
+     * of collapsed nodes, so collapsed subtrees are never visited */
+    state->row_count = 0;
+    while (i < state->node_count) {
+        const struct nk_tree_view_node *node = &state->nodes[i];
+        state->rows[state->row_count++] = i;
+        if (!state->expanded[i])
+            i += NK_MAX(node->descendants, 0);
+        i++;
+    }
+    state->dirty = nk_false;
+    return state->row_count;
+}
+NK_API int
+nk_tree_view_begin(struct nk_context *ctx, struct nk_tree_view *view,
+    const char *id, nk_flags flags, struct nk_tree_view_state *state)
+{
+    int result;
+    const struct nk_style *style;
+
+    NK_ASSERT(ctx);
+    NK_ASSERT(view);
+    NK_ASSERT(id);
+    NK_ASSERT(state);
+    if (!ctx || !view || !id || !state) return 0;
+
+    nk_zero(view, sizeof(*view));
+    style = &ctx->style;
+    nk_tree_view_update(state);
+    view->row_height = (float)nk_iceilf(style->font->height + 2 * style->tab.padding.y);
+    result = nk_list_view_begin(ctx, &view->list, id, flags,
+        (int)view->row_height, state->row_count);
+    if (!result) return result;
+
+    view->begin = view->list.begin;
+    view->end = view->list.end;
+    view->state = state;
+    return result;
+}
+NK_API int
+nk_tree_view_node(struct nk_tree_view *view, int row)
+{
+    int node;
+    struct nk_context *ctx;
+    struct nk_window *win;
+    struct nk_panel *layout;
+    struct nk_tree_view_state *state;
+    const struct nk_tree_view_node *data;
+    const struct nk_style *style;
+    const struct nk_input *in;
+    enum nk_widget_layout_states widget_state;
+
+    nk_flags ws = 0;
+    struct nk_rect header;
+    struct nk_rect sym;
+    struct nk_rect label;
+    struct nk_text text;
+    float indent;
+
+    NK_ASSERT(view);
+    NK_ASSERT(view->list.ctx);
+    if (!view || !view->list.ctx) return -1;
+
+    state = view->state;
+    NK_ASSERT(row >= 0 && row < state->row_count);
+    if (row < 0 || row >= state->row_count) return -1;
+
+    ctx = view->list.ctx;
+    win = ctx->current;
+    layout = win->layout;
+    style = &ctx->style;
+    node = state->rows[row];
+    data = &state->nodes[node];
+
+    nk_layout_row_dynamic(ctx, view->row_height, 1);
+    widget_state = nk_widget(&header, ctx);
+    if (!widget_state) return node;
+
+    indent = (float)NK_MAX(data->depth, 0) * style->tab.indent;
+    header.x += indent;
+    header.w = NK_MAX(header.w - indent, 0);
+
+    /* update node state */
+    in = (!(layout->flags & NK_WINDOW_ROM)) ? &ctx->input: 0;
+    in = (in && widget_state == NK_WIDGET_VALID) ? &ctx->input : 0;
+    if (data->descendants > 0 && nk_button_behavior(&ws, header, in, NK_BUTTON_DEFAULT))
+        nk_tree_view_set_expanded(state, node, !state->expanded[node]);
+
+    /* draw triangle button for nodes with children */
+    sym.w = sym.h = style->font->height;
+    sym.y = header.y + style->tab.padding.y;
+    sym.x = header.x + style->tab.padding.x;
+    if (data->descendants > 0) {
+        int expanded = state->expanded[node] != 0;
+        nk_do_button_symbol(&ws, &win->buffer, sym,
+            expanded ? style->tab.sym_maximize: style->tab.sym_minimize, NK_BUTTON_DEFAULT,
+            expanded ? &style->tab.node_maximize_button: &style->tab.node_minimize_button,
+            0, style->font);
+    }
+
+    /* draw label */
+    label.x = sym.x + sym.w + style->window.spacing.x;
+    label.y = sym.y;
+    label.w = NK_MAX(header.x + header.w - label.x, 0);
+    label.h = style->font->height;
+    text.text = style->tab.text;
+    text.background = style->window.background;
+    text.padding = nk_vec2(0,0);
+    if (data->label)
+        nk_widget_text(&win->buffer, label, data->label, nk_strlen(data->label),
+            &text, NK_TEXT_LEFT, style->font);
+    return node;
+}
+NK_API void
+nk_tree_view_end(struct nk_tree_view *view)
+{
+    NK_ASSERT(view);
+    if (!view || !view->list.ctx) return;
+    nk_list_view_end(&view->list);
+}
@@ -7,6 +7,8 @@
  *
  * ===============================================================*/
 #ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_DRAW_LIST_MAX_SEGMENTS 512
+
 NK_API void
 nk_draw_list_init(struct nk_draw_list *list)
 {
@@ -421,6 +423,7 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
     struct nk_colorf col_trans;
     NK_ASSERT(list);
     if (!list || points_count < 2) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_STROKE);
 
     color.a = (nk_byte)((float)color.a * list->config.global_alpha);
     count = points_count;
@@ -455,14 +458,14 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
 
         nk_size size;
         struct nk_vec2 *normals, *temp;
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         /* temporary allocate normals + points */
         vertex_offset = (nk_size)((nk_byte*)vtx - (nk_byte*)list->vertices->memory.ptr);
         nk_buffer_mark(list->vertices, NK_BUFFER_FRONT);
         size = pnt_size * ((thick_line) ? 5 : 3) * points_count;
         normals = (struct nk_vec2*) nk_buffer_alloc(list->vertices, NK_BUFFER_FRONT, size, pnt_align);
-        if (!normals) return;
+        if (!normals) goto end;
         temp = normals + points_count;
 
         /* make sure vertex pointer is still correct */
@@ -614,7 +617,7 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
         const nk_size vtx_count = count * 4;
         void *vtx = nk_draw_list_alloc_vertices(list, vtx_count);
         nk_draw_index *ids = nk_draw_list_alloc_elements(list, idx_count);
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         for (i1 = 0; i1 < count; ++i1) {
             float dx, dy;
@@ -649,6 +652,8 @@ nk_draw_list_stroke_poly_line(struct nk_draw_list *list, const struct nk_vec2 *p
             idx += 4;
         }
     }
+end:
+    NK_PROFILE_END(list->profiler, NK_PROFILE_STROKE);
 }
 NK_API void
 nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
@@ -662,6 +667,7 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
     NK_STORAGE const nk_size pnt_size = sizeof(struct nk_vec2);
     NK_ASSERT(list);
     if (!list || points_count < 3) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_FILL);
 
 #ifdef NK_INCLUDE_COMMAND_USERDATA
     nk_draw_list_push_userdata(list, list->userdata);
@@ -691,14 +697,14 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
         struct nk_vec2 *normals = 0;
         unsigned int vtx_inner_idx = (unsigned int)(index + 0);
         unsigned int vtx_outer_idx = (unsigned int)(index + 1);
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
 
         /* temporary allocate normals */
         vertex_offset = (nk_size)((nk_byte*)vtx - (nk_byte*)list->vertices->memory.ptr);
         nk_buffer_mark(list->vertices, NK_BUFFER_FRONT);
         size = pnt_size * points_count;
         normals = (struct nk_vec2*) nk_buffer_alloc(list->vertices, NK_BUFFER_FRONT, size, pnt_align);
-        if (!normals) return;
+        if (!normals) goto end;
         vtx = (void*)((nk_byte*)list->vertices->memory.ptr + vertex_offset);
 
         /* add elements */
@@ -763,7 +769,7 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
         void *vtx = nk_draw_list_alloc_vertices(list, vtx_count);
         nk_draw_index *ids = nk_draw_list_alloc_elements(list, idx_count);
 
-        if (!vtx || !ids) return;
+        if (!vtx || !ids) goto end;
         for (i = 0; i < vtx_count; ++i)
             vtx = nk_draw_vertex(vtx, &list->config, points[i], list->config.null.uv, col);
         for (i = 2; i < points_count; ++i) {
@@ -773,6 +779,8 @@ nk_draw_list_fill_poly_convex(struct nk_draw_list *list,
             ids += 3;
         }
     }
+end:
+    NK_PROFILE_END(list->profiler, NK_PROFILE_FILL);
 }
 NK_API void
 nk_draw_list_path_clear(struct nk_draw_list *list)
@@ -801,31 +809,36 @@ nk_draw_list_path_line_to(struct nk_draw_list *list, struct nk_vec2 pos)
     if (!points) return;
     points[0] = pos;
 }
-NK_API void
-nk_draw_list_path_arc_to_fast(struct nk_draw_list *list, struct nk_vec2 center,
-    float radius, int a_min, int a_max)
+NK_INTERN unsigned int
+nk_draw_list_circle_segments(const struct nk_draw_list *list, float radius)
 {
-    int a = 0;
-    NK_ASSERT(list);
-    if (!list) return;
-    if (a_min <= a_max) {
-        for (a = a_min; a <= a_max; a++) {
-            const struct nk_vec2 c = list->circle_vtx[(nk_size)a % NK_LEN(list->circle_vtx)];
-            const float x = center.x + c.x * radius;
-            const float y = center.y + c.y * radius;
-            nk_draw_list_path_line_to(list, nk_vec2(x, y));
-        }
+    /* a chord spanning 2*pi/n keeps r*(1-cos(pi/n)) ~ r*(pi/n)^2/2 away
+     * from the circle, which is solved for n at the error tolerance */
+    float n;
+    radius = (radius < 0) ? -radius: radius;
+    n = NK_PI * NK_SQRT(radius / (2.0f * list->config.curve_tolerance));
+    n = NK_MIN(n, (float)NK_DRAW_LIST_MAX_SEGMENTS);
+    return (unsigned int)NK_CLAMP(4, nk_iceilf(n), NK_DRAW_LIST_MAX_SEGMENTS);
+}
+NK_INTERN unsigned int
+nk_draw_list_circle_step(const struct nk_draw_list *list,
+    unsigned int segments, unsigned int multiple)
+{
+    /* smallest segment count of at least `segments` dividing the unit circle
+     * table, returned as step between table entries or 0 if there is none */
+    NK_STORAGE const unsigned char counts[] = {4, 6, 8, 12, 16, 24, 48};
+    nk_size i;
+    for (i = 0; i < NK_LEN(counts); ++i) {
+        if (counts[i] >= segments && !(counts[i] % multiple))
+            return (unsigned int)(NK_LEN(list->circle_vtx) / counts[i]);
     }
+    return 0;
 }
-NK_API void
-nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
+NK_INTERN void
+nk_draw_list_path_arc_points(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, float a_min, float a_max, unsigned int segments)
 {
     unsigned int i = 0;
-    NK_ASSERT(list);
-    if (!list) return;
-    if (radius == 0.0f) return;
-
     /*  This algorithm for arc drawing relies on these two trigonometric identities[1]:
             sin(a + b) = sin(a) * cos(b) + cos(a) * sin(b)
             cos(a + b) = cos(a) * cos(b) - sin(a) * sin(b)
@@ -863,6 +876,75 @@ nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
     }}
 }
 NK_API void
+nk_draw_list_path_arc_to_fast(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, int a_min, int a_max)
+{
+    /* angles are given in twelfths of a circle */
+    const int scale = (int)NK_LEN(list->circle_vtx) / 12;
+    int a = 0, step = scale;
+    NK_ASSERT(list);
+    if (!list || a_min > a_max) return;
+    if (list->config.curve_tolerance > 0.0f) {
+        unsigned int n = nk_draw_list_circle_segments(list, radius);
+        step = (int)nk_draw_list_circle_step(list, n, 4);
+        if (!step) {
+            /* finer than the table so points have to be calculated */
+            n = (unsigned int)nk_iceilf((float)n * (float)(a_max - a_min) / 12.0f);
+            nk_draw_list_path_arc_points(list, center, radius, (float)a_min * NK_PI / 6.0f,
+                (float)a_max * NK_PI / 6.0f, NK_MAX(n, 1));
+            return;
+        }
+    }
+    for (a = a_min * scale; a < a_max * scale; a += step) {
+        const struct nk_vec2 c = list->circle_vtx[(nk_size)a % NK_LEN(list->circle_vtx)];
+        nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));
+    }
+    {const struct nk_vec2 c = list->circle_vtx[(nk_size)(a_max * scale) % NK_LEN(list->circle_vtx)];
+    nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));}
+}
+NK_API void
+nk_draw_list_path_arc_to(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, float a_min, float a_max, unsigned int segments)
+{
+    NK_ASSERT(list);
+    if (!list) return;
+    if (radius == 0.0f) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
+    if (list->config.curve_tolerance > 0.0f) {
+        const float span = (a_max < a_min) ? a_min - a_max: a_max - a_min;
+        const unsigned int n = nk_draw_list_circle_segments(list, radius);
+        segments = (unsigned int)NK_MAX(1, nk_iceilf((float)n * span / (2.0f * NK_PI)));
+    }
+    nk_draw_list_path_arc_points(list, center, radius, a_min, a_max, segments);
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
+}
+NK_INTERN void
+nk_draw_list_path_circle_to(struct nk_draw_list *list, struct nk_vec2 center,
+    float radius, unsigned int segs)
+{
+    unsigned int i, step = 0;
+    if (radius == 0.0f) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
+    if (list->config.curve_tolerance > 0.0f) {
+        segs = nk_draw_list_circle_segments(list, radius);
+        step = nk_draw_list_circle_step(list, segs, 1);
+    }
+    if (step) {
+        /* common segment counts walk the unit circle table */
+        for (i = 0; i < NK_LEN(list->circle_vtx); i += step) {
+            const struct nk_vec2 c = list->circle_vtx[i];
+            nk_draw_list_path_line_to(list, nk_vec2(center.x + c.x * radius, center.y + c.y * radius));
+        }
+    } else if (list->config.curve_tolerance > 0.0f) {
+        nk_draw_list_path_arc_points(list, center, radius, 0.0f,
+            NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs, segs - 1);
+    } else {
+        nk_draw_list_path_arc_points(list, center, radius, 0.0f,
+            NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs, segs);
+    }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
+}
+NK_API void
 nk_draw_list_path_rect_to(struct nk_draw_list *list, struct nk_vec2 a,
     struct nk_vec2 b, float rounding)
 {
@@ -896,9 +978,22 @@ nk_draw_list_path_curve_to(struct nk_draw_list *list, struct nk_vec2 p2,
     NK_ASSERT(list);
     NK_ASSERT(list->path_count);
     if (!list || !list->path_count) return;
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_PATH);
     num_segments = NK_MAX(num_segments, 1);
 
     p1 = nk_draw_list_path_last(list);
+    if (list->config.curve_tolerance > 0.0f) {
+        /* Wang's formula: n segments keep a cubic bezier within 3/4 of its
+         * biggest second difference of control points divided by n^2 */
+        struct nk_vec2 d0, d1;
+        float dd;
+        d0 = nk_vec2(p1.x - 2.0f * p2.x + p3.x, p1.y - 2.0f * p2.y + p3.y);
+        d1 = nk_vec2(p2.x - 2.0f * p3.x + p4.x, p2.y - 2.0f * p3.y + p4.y);
+        dd = NK_MAX(d0.x * d0.x + d0.y * d0.y, d1.x * d1.x + d1.y * d1.y);
+        dd = NK_SQRT(0.75f * NK_SQRT(dd) / list->config.curve_tolerance);
+        dd = NK_MIN(dd, (float)NK_DRAW_LIST_MAX_SEGMENTS);
+        num_segments = (unsigned int)NK_CLAMP(1, nk_iceilf(dd), NK_DRAW_LIST_MAX_SEGMENTS);
+    }
     t_step = 1.0f/(float)num_segments;
     for (i_step = 1; i_step <= num_segments; ++i_step) {
         float t = t_step * (float)i_step;
@@ -911,6 +1006,7 @@ nk_draw_list_path_curve_to(struct nk_draw_list *list, struct nk_vec2 p2,
         float y = w1 * p1.y + w2 * p2.y + w3 * p3.y + w4 * p4.y;
         nk_draw_list_path_line_to(list, nk_vec2(x,y));
     }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_PATH);
 }
 NK_API void
 nk_draw_list_path_fill(struct nk_draw_list *list, struct nk_color color)
@@ -1038,22 +1134,18 @@ NK_API void
 nk_draw_list_fill_circle(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, struct nk_color col, unsigned int segs)
 {
-    float a_max;
     NK_ASSERT(list);
     if (!list || !col.a) return;
-    a_max = NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs;
-    nk_draw_list_path_arc_to(list, center, radius, 0.0f, a_max, segs);
+    nk_draw_list_path_circle_to(list, center, radius, segs);
     nk_draw_list_path_fill(list, col);
 }
 NK_API void
 nk_draw_list_stroke_circle(struct nk_draw_list *list, struct nk_vec2 center,
     float radius, struct nk_color col, unsigned int segs, float thickness)
 {
-    float a_max;
     NK_ASSERT(list);
     if (!list || !col.a) return;
-    a_max = NK_PI * 2.0f * ((float)segs - 1.0f) / (float)segs;
-    nk_draw_list_path_arc_to(list, center, radius, 0.0f, a_max, segs);
+    nk_draw_list_path_circle_to(list, center, radius, segs);
     nk_draw_list_path_stroke(list, col, NK_STROKE_CLOSED, thickness);
 }
 NK_API void
@@ -1175,98 +1267,84 @@ nk_draw_list_add_text(struct nk_draw_list *list, const struct nk_user_font *font
         unicode = next;
     }
 }
-NK_API nk_flags
-nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
-    struct nk_buffer *vertices, struct nk_buffer *elements,
-    const struct nk_convert_config *config)
+NK_INTERN void
+nk_convert_commands(struct nk_draw_list *list, const struct nk_buffer *memory,
+    const struct nk_command *cmd, const struct nk_convert_config *config)
 {
-    nk_flags res = NK_CONVERT_SUCCESS;
-    const struct nk_command *cmd;
-    NK_ASSERT(ctx);
-    NK_ASSERT(cmds);
-    NK_ASSERT(vertices);
-    NK_ASSERT(elements);
-    NK_ASSERT(config);
-    NK_ASSERT(config->vertex_layout);
-    NK_ASSERT(config->vertex_size);
-    if (!ctx || !cmds || !vertices || !elements || !config || !config->vertex_layout)
-        return NK_CONVERT_INVALID_PARAM;
-
-    nk_draw_list_setup(&ctx->draw_list, config, cmds, vertices, elements,
-        config->line_AA, config->shape_AA);
-    nk_foreach(cmd, ctx)
+    NK_PROFILE_BEGIN(list->profiler, NK_PROFILE_CONVERT);
+    for (; cmd; cmd = nk_command_list_next(memory, cmd))
     {
 #ifdef NK_INCLUDE_COMMAND_USERDATA
-        ctx->draw_list.userdata = cmd->userdata;
+        list->userdata = cmd->userdata;
 #endif
         switch (cmd->type) {
         case NK_COMMAND_NOP: break;
         case NK_COMMAND_SCISSOR: {
             const struct nk_command_scissor *s = (const struct nk_command_scissor*)cmd;
-            nk_draw_list_add_clip(&ctx->draw_list, nk_rect(s->x, s->y, s->w, s->h));
+            nk_draw_list_add_clip(list, nk_rect(s->x, s->y, s->w, s->h));
         } break;
         case NK_COMMAND_LINE: {
             const struct nk_command_line *l = (const struct nk_command_line*)cmd;
-            nk_draw_list_stroke_line(&ctx->draw_list, nk_vec2(l->begin.x, l->begin.y),
+            nk_draw_list_stroke_line(list, nk_vec2(l->begin.x, l->begin.y),
                 nk_vec2(l->end.x, l->end.y), l->color, l->line_thickness);
         } break;
         case NK_COMMAND_CURVE: {
             const struct nk_command_curve *q = (const struct nk_command_curve*)cmd;
-            nk_draw_list_stroke_curve(&ctx->draw_list, nk_vec2(q->begin.x, q->begin.y),
+            nk_draw_list_stroke_curve(list, nk_vec2(q->begin.x, q->begin.y),
                 nk_vec2(q->ctrl[0].x, q->ctrl[0].y), nk_vec2(q->ctrl[1].x,
                 q->ctrl[1].y), nk_vec2(q->end.x, q->end.y), q->color,
                 config->curve_segment_count, q->line_thickness);
         } break;
         case NK_COMMAND_RECT: {
             const struct nk_command_rect *r = (const struct nk_command_rect*)cmd;
-            nk_draw_list_stroke_rect(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_stroke_rect(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->color, (float)r->rounding, r->line_thickness);
         } break;
         case NK_COMMAND_RECT_FILLED: {
             const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled*)cmd;
-            nk_draw_list_fill_rect(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_fill_rect(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->color, (float)r->rounding);
         } break;
         case NK_COMMAND_RECT_MULTI_COLOR: {
             const struct nk_command_rect_multi_color *r = (const struct nk_command_rect_multi_color*)cmd;
-            nk_draw_list_fill_rect_multi_color(&ctx->draw_list, nk_rect(r->x, r->y, r->w, r->h),
+            nk_draw_list_fill_rect_multi_color(list, nk_rect(r->x, r->y, r->w, r->h),
                 r->left, r->top, r->right, r->bottom);
         } break;
         case NK_COMMAND_CIRCLE: {
             const struct nk_command_circle *c = (const struct nk_command_circle*)cmd;
-            nk_draw_list_stroke_circle(&ctx->draw_list, nk_vec2((float)c->x + (float)c->w/2,
+            nk_draw_list_stroke_circle(list, nk_vec2((float)c->x + (float)c->w/2,
                 (float)c->y + (float)c->h/2), (float)c->w/2, c->color,
                 config->circle_segment_count, c->line_thickness);
         } break;
         case NK_COMMAND_CIRCLE_FILLED: {
             const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled *)cmd;
-            nk_draw_list_fill_circle(&ctx->draw_list, nk_vec2((float)c->x + (float)c->w/2,
+            nk_draw_list_fill_circle(list, nk_vec2((float)c->x + (float)c->w/2,
                 (float)c->y + (float)c->h/2), (float)c->w/2, c->color,
                 config->circle_segment_count);
         } break;
         case NK_COMMAND_ARC: {
             const struct nk_command_arc *c = (const struct nk_command_arc*)cmd;
-            nk_draw_list_path_line_to(&ctx->draw_list, nk_vec2(c->cx, c->cy));
-            nk_draw_list_path_arc_to(&ctx->draw_list, nk_vec2(c->cx, c->cy), c->r,
+            nk_draw_list_path_line_to(list, nk_vec2(c->cx, c->cy));
+            nk_draw_list_path_arc_to(list, nk_vec2(c->cx, c->cy), c->r,
                 c->a[0], c->a[1], config->arc_segment_count);
-            nk_draw_list_path_stroke(&ctx->draw_list, c->color, NK_STROKE_CLOSED, c->line_thickness);
+            nk_draw_list_path_stroke(list, c->color, NK_STROKE_CLOSED, c->line_thickness);
         } break;
         case NK_COMMAND_ARC_FILLED: {
             const struct nk_command_arc_filled *c = (const struct nk_command_arc_filled*)cmd;
-            nk_draw_list_path_line_to(&ctx->draw_list, nk_vec2(c->cx, c->cy));
-            nk_draw_list_path_arc_to(&ctx->draw_list, nk_vec2(c->cx, c->cy), c->r,
+            nk_draw_list_path_line_to(list, nk_vec2(c->cx, c->cy));
+            nk_draw_list_path_arc_to(list, nk_vec2(c->cx, c->cy), c->r,
                 c->a[0], c->a[1], config->arc_segment_count);
-            nk_draw_list_path_fill(&ctx->draw_list, c->color);
+            nk_draw_list_path_fill(list, c->color);
         } break;
         case NK_COMMAND_TRIANGLE: {
             const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
-            nk_draw_list_stroke_triangle(&ctx->draw_list, nk_vec2(t->a.x, t->a.y),
+            nk_draw_list_stroke_triangle(list, nk_vec2(t->a.x, t->a.y),
                 nk_vec2(t->b.x, t->b.y), nk_vec2(t->c.x, t->c.y), t->color,
                 t->line_thickness);
         } break;
         case NK_COMMAND_TRIANGLE_FILLED: {
             const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
-            nk_draw_list_fill_triangle(&ctx->draw_list, nk_vec2(t->a.x, t->a.y),
+            nk_draw_list_fill_triangle(list, nk_vec2(t->a.x, t->a.y),
                 nk_vec2(t->b.x, t->b.y), nk_vec2(t->c.x, t->c.y), t->color);
         } break;
         case NK_COMMAND_POLYGON: {
@@ -1274,49 +1352,145 @@ nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
             const struct nk_command_polygon*p = (const struct nk_command_polygon*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_stroke(&ctx->draw_list, p->color, NK_STROKE_CLOSED, p->line_thickness);
+            nk_draw_list_path_stroke(list, p->color, NK_STROKE_CLOSED, p->line_thickness);
         } break;
         case NK_COMMAND_POLYGON_FILLED: {
             int i;
             const struct nk_command_polygon_filled *p = (const struct nk_command_polygon_filled*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_fill(&ctx->draw_list, p->color);
+            nk_draw_list_path_fill(list, p->color);
         } break;
         case NK_COMMAND_POLYLINE: {
             int i;
             const struct nk_command_polyline *p = (const struct nk_command_polyline*)cmd;
             for (i = 0; i < p->point_count; ++i) {
                 struct nk_vec2 pnt = nk_vec2((float)p->points[i].x, (float)p->points[i].y);
-                nk_draw_list_path_line_to(&ctx->draw_list, pnt);
+                nk_draw_list_path_line_to(list, pnt);
             }
-            nk_draw_list_path_stroke(&ctx->draw_list, p->color, NK_STROKE_OPEN, p->line_thickness);
+            nk_draw_list_path_stroke(list, p->color, NK_STROKE_OPEN, p->line_thickness);
         } break;
         case NK_COMMAND_TEXT: {
             const struct nk_command_text *t = (const struct nk_command_text*)cmd;
-            nk_draw_list_add_text(&ctx->draw_list, t->font, nk_rect(t->x, t->y, t->w, t->h),
+            nk_draw_list_add_text(list, t->font, nk_rect(t->x, t->y, t->w, t->h),
                 t->string, t->length, t->height, t->foreground);
         } break;
         case NK_COMMAND_IMAGE: {
             const struct nk_command_image *i = (const struct nk_command_image*)cmd;
-            nk_draw_list_add_image(&ctx->draw_list, i->img, nk_rect(i->x, i->y, i->w, i->h), i->col);
+            nk_draw_list_add_image(list, i->img, nk_rect(i->x, i->y, i->w, i->h), i->col);
         } break;
         case NK_COMMAND_CUSTOM: {
             const struct nk_command_custom *c = (const struct nk_command_custom*)cmd;
-            c->callback(&ctx->draw_list, c->x, c->y, c->w, c->h, c->callback_data);
+            c->callback(list, c->x, c->y, c->w, c->h, c->callback_data);
         } break;
         default: break;
         }
     }
+    NK_PROFILE_END(list->profiler, NK_PROFILE_CONVERT);
+}
+NK_INTERN nk_flags
+nk_convert_result(struct nk_context *ctx, const struct nk_buffer *cmds,
+    const struct nk_buffer *vertices, const struct nk_buffer *elements)
+{
+    nk_flags res = NK_CONVERT_SUCCESS;
     res |= (cmds->needed > cmds->allocated + (cmds->memory.size - cmds->size)) ? NK_CONVERT_COMMAND_BUFFER_FULL: 0;
     res |= (vertices->needed > vertices->allocated) ? NK_CONVERT_VERTEX_BUFFER_FULL: 0;
     res |= (elements->needed > elements->allocated) ? NK_CONVERT_ELEMENT_BUFFER_FULL: 0;
+    if (!ctx) return res;
+
+    /* memory telemetry */
+    {struct nk_memory_stats *stats = &ctx->memory_stats;
+    stats->vertex_bytes = vertices->needed;
+    stats->vertex_capacity = vertices->memory.size;
+    stats->vertex_high_water = NK_MAX(stats->vertex_high_water, vertices->needed);
+    stats->element_bytes = elements->needed;
+    stats->element_capacity = elements->memory.size;
+    stats->element_high_water = NK_MAX(stats->element_high_water, elements->needed);}
     return res;
 }
+NK_API nk_flags
+nk_convert(struct nk_context *ctx, struct nk_buffer *cmds,
+    struct nk_buffer *vertices, struct nk_buffer *elements,
+    const struct nk_convert_config *config)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!ctx || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    nk_draw_list_setup(&ctx->draw_list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    ctx->draw_list.profiler = ctx->profiler;
+#endif
+    nk_convert_commands(&ctx->draw_list, &ctx->memory, nk__begin(ctx), config);
+    return nk_convert_result(ctx, cmds, vertices, elements);
+}
+NK_API nk_flags
+nk_convert_contexts(struct nk_context *const *ctxs, int count,
+    struct nk_buffer *cmds, struct nk_buffer *vertices,
+    struct nk_buffer *elements, const struct nk_convert_config *config)
+{
+    int i;
+    struct nk_draw_list *list;
+    NK_ASSERT(ctxs);
+    NK_ASSERT(count > 0);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!ctxs || count <= 0 || !ctxs[0] || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    /* contexts are converted back to front into the draw list of the first
+     * context so the result can be drawn with a single `nk_draw_foreach` */
+    list = &ctxs[0]->draw_list;
+    nk_draw_list_setup(list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    list->profiler = ctxs[0]->profiler;
+#endif
+    for (i = 0; i < count; ++i) {
+        NK_ASSERT(ctxs[i]);
+        if (ctxs[i]) nk_convert_commands(list, &ctxs[i]->memory, nk__begin(ctxs[i]), config);
+    }
+    return nk_convert_result(ctxs[0], cmds, vertices, elements);
+}
+NK_API nk_flags
+nk_frame_convert(struct nk_frame *frame, struct nk_buffer *cmds,
+    struct nk_buffer *vertices, struct nk_buffer *elements,
+    const struct nk_convert_config *config)
+{
+    NK_ASSERT(frame);
+    NK_ASSERT(cmds);
+    NK_ASSERT(vertices);
+    NK_ASSERT(elements);
+    NK_ASSERT(config);
+    NK_ASSERT(config->vertex_layout);
+    NK_ASSERT(config->vertex_size);
+    if (!frame || !cmds || !vertices || !elements || !config || !config->vertex_layout)
+        return NK_CONVERT_INVALID_PARAM;
+
+    /* only frame memory is read so this can run while the context builds */
+    nk_draw_list_setup(&frame->draw_list, config, cmds, vertices, elements,
+        config->line_AA, config->shape_AA);
+#ifdef NK_INCLUDE_PROFILER
+    frame->draw_list.profiler = frame->profiler;
+#endif
+    nk_convert_commands(&frame->draw_list, &frame->memory, nk__frame_begin(frame), config);
+    return nk_convert_result(0, cmds, vertices, elements);
+}
 NK_API const struct nk_draw_command*
 nk__draw_begin(const struct nk_context *ctx,
     const struct nk_buffer *buffer)
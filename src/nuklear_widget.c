@@ -138,6 +138,7 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
     struct nk_window *win;
     struct nk_panel *layout;
     const struct nk_input *in;
+    int visible;
 
     NK_ASSERT(ctx);
     NK_ASSERT(ctx->current);
@@ -146,7 +147,7 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
         return NK_WIDGET_INVALID;
 
     /* allocate space and check if the widget needs to be updated and drawn */
-    nk_panel_alloc_space(bounds, ctx);
+    visible = nk_panel_alloc_space(bounds, ctx);
     win = ctx->current;
     layout = win->layout;
     in = &ctx->input;
@@ -167,6 +168,10 @@ nk_widget(struct nk_rect *bounds, const struct nk_context *ctx)
     bounds->w = (float)((int)bounds->w);
     bounds->h = (float)((int)bounds->h);
 
+    /* whole row is outside the visible area so skip clipping tests */
+    if (!visible)
+        return NK_WIDGET_INVALID;
+
     c.x = (float)((int)c.x);
     c.y = (float)((int)c.y);
     c.w = (float)((int)c.w);
@@ -75,6 +75,7 @@ nk_insert_window(struct nk_context *ctx, struct nk_window *win,
         iter = iter->next;
     }
 
+    nk_window_index_invalidate(ctx);
     if (!ctx->begin) {
         win->next = 0;
         win->prev = 0;
@@ -106,6 +107,7 @@ nk_insert_window(struct nk_context *ctx, struct nk_window *win,
 NK_LIB void
 nk_remove_window(struct nk_context *ctx, struct nk_window *win)
 {
+    nk_window_index_invalidate(ctx);
     if (win == ctx->begin || win == ctx->end) {
         if (win == ctx->begin) {
             ctx->begin = win->next;
@@ -155,6 +157,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     NK_ASSERT(!ctx->current && "if this triggers you missed a `nk_end` call");
     if (!ctx || ctx->current || !title || !name)
         return 0;
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
 
     /* find or create window */
     style = &ctx->style;
@@ -166,7 +169,10 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         nk_size name_length = (nk_size)name_len;
         win = (struct nk_window*)nk_create_window(ctx);
         NK_ASSERT(win);
-        if (!win) return 0;
+        if (!win) {
+            NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
+            return 0;
+        }
 
         if (flags & NK_WINDOW_BACKGROUND)
             nk_insert_window(ctx, win, NK_INSERT_FRONT);
@@ -186,8 +192,12 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         /* update window */
         win->flags &= ~(nk_flags)(NK_WINDOW_PRIVATE-1);
         win->flags |= flags;
-        if (!(win->flags & (NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE)))
+        if (!(win->flags & (NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE)) &&
+            (win->bounds.x != bounds.x || win->bounds.y != bounds.y ||
+            win->bounds.w != bounds.w || win->bounds.h != bounds.h)) {
             win->bounds = bounds;
+            nk_window_index_invalidate(ctx);
+        }
         /* If this assert triggers you either:
          *
          * I.) Have more than one window with the same name or
@@ -198,6 +208,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         NK_ASSERT(win->seq != ctx->seq);
         win->seq = ctx->seq;
         if (!ctx->active && !(win->flags & NK_WINDOW_HIDDEN)) {
+            nk_window_index_invalidate(ctx);
             ctx->active = win;
             ctx->end = win;
         }
@@ -205,6 +216,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     if (win->flags & NK_WINDOW_HIDDEN) {
         ctx->current = win;
         win->layout = 0;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
         return 0;
     } else nk_start(ctx, win);
 
@@ -223,8 +235,13 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
         inpanel = inpanel && ctx->input.mouse.buttons[NK_BUTTON_LEFT].clicked;
         ishovered = nk_input_is_mouse_hovering_rect(&ctx->input, win_bounds);
         if ((win != ctx->active) && ishovered && !ctx->input.mouse.buttons[NK_BUTTON_LEFT].down) {
+            /* a window above this one under the mouse always overlaps it, so
+             * only the topmost hovered window has to look at all windows above */
+            struct nk_window *top = nk_window_at_mouse(ctx);
             iter = win->next;
-            while (iter) {
+            if (top && top != win && top->order > win->order && !(win->flags & NK_WINDOW_BACKGROUND))
+                iter = top;
+            else while (iter) {
                 struct nk_rect iter_bounds = (!(iter->flags & NK_WINDOW_MINIMIZED))?
                     iter->bounds: nk_rect(iter->bounds.x, iter->bounds.y, iter->bounds.w, h);
                 if (NK_INTERSECT(win_bounds.x, win_bounds.y, win_bounds.w, win_bounds.h,
@@ -243,8 +260,11 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
 
         /* activate window if clicked */
         if (iter && inpanel && (win != ctx->end)) {
+            struct nk_window *top = nk_window_at_mouse(ctx);
             iter = win->next;
-            while (iter) {
+            if (top && top != win && top->order > win->order && !(win->flags & NK_WINDOW_BACKGROUND))
+                iter = top;
+            else while (iter) {
                 /* try to find a panel with higher priority in the same position */
                 struct nk_rect iter_bounds = (!(iter->flags & NK_WINDOW_MINIMIZED))?
                 iter->bounds: nk_rect(iter->bounds.x, iter->bounds.y, iter->bounds.w, h);
@@ -290,6 +310,7 @@ nk_begin_titled(struct nk_context *ctx, const char *name, const char *title,
     ret = nk_panel_begin(ctx, title, NK_PANEL_WINDOW);
     win->layout->offset_x = &win->scrollbar.x;
     win->layout->offset_y = &win->scrollbar.y;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_BEGIN);
     return ret;
 }
 NK_API void
@@ -301,14 +322,17 @@ nk_end(struct nk_context *ctx)
     if (!ctx || !ctx->current)
         return;
 
+    NK_PROFILE_BEGIN(ctx->profiler, NK_PROFILE_WINDOW_END);
     layout = ctx->current->layout;
     if (!layout || (layout->type == NK_PANEL_WINDOW && (ctx->current->flags & NK_WINDOW_HIDDEN))) {
         ctx->current = 0;
+        NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_END);
         return;
     }
     nk_panel_end(ctx);
     nk_free_panel(ctx, ctx->current->layout);
     ctx->current = 0;
+    NK_PROFILE_END(ctx->profiler, NK_PROFILE_WINDOW_END);
 }
 NK_API struct nk_rect
 nk_window_get_bounds(const struct nk_context *ctx)
@@ -436,33 +460,81 @@ nk_window_is_hovered(struct nk_context *ctx)
         return 0;
     return nk_input_is_mouse_hovering_rect(&ctx->input, ctx->current->bounds);
 }
-NK_API int
-nk_window_is_any_hovered(struct nk_context *ctx)
+NK_INTERN int
+nk_window_is_at(const struct nk_context *ctx, const struct nk_window *win,
+    struct nk_vec2 pos)
 {
-    struct nk_window *iter;
+    struct nk_rect r;
+    if (win->flags & NK_WINDOW_HIDDEN)
+        return 0;
+    /* check if window popup is being hovered */
+    if (win->popup.active && win->popup.win) {
+        r = win->popup.win->bounds;
+        if (NK_INBOX(pos.x, pos.y, r.x, r.y, r.w, r.h))
+            return 1;
+    }
+    r = win->bounds;
+    if (win->flags & NK_WINDOW_MINIMIZED)
+        r.h = ctx->style.font->height + 2 * ctx->style.window.header.padding.y;
+    return NK_INBOX(pos.x, pos.y, r.x, r.y, r.w, r.h);
+}
+NK_LIB int
+nk_window_is_any_at(const struct nk_context *ctx, struct nk_vec2 pos)
+{
+    const struct nk_window *iter;
     NK_ASSERT(ctx);
     if (!ctx) return 0;
     iter = ctx->begin;
     while (iter) {
-        /* check if window is being hovered */
-        if(!(iter->flags & NK_WINDOW_HIDDEN)) {
-            /* check if window popup is being hovered */
-            if (iter->popup.active && iter->popup.win && nk_input_is_mouse_hovering_rect(&ctx->input, iter->popup.win->bounds))
-                return 1;
-
-            if (iter->flags & NK_WINDOW_MINIMIZED) {
-                struct nk_rect header = iter->bounds;
-                header.h = ctx->style.font->height + 2 * ctx->style.window.header.padding.y;
-                if (nk_input_is_mouse_hovering_rect(&ctx->input, header))
-                    return 1;
-            } else if (nk_input_is_mouse_hovering_rect(&ctx->input, iter->bounds)) {
-                return 1;
-            }
-        }
+        if (nk_window_is_at(ctx, iter, pos))
+            return 1;
         iter = iter->next;
     }
     return 0;
 }
+NK_LIB void
+nk_window_index_invalidate(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    ctx->hovered_seq = 0;
+}
+NK_LIB struct nk_window*
+nk_window_at_mouse(struct nk_context *ctx)
+{
+    unsigned int order = 0;
+    struct nk_window *iter;
+    struct nk_vec2 pos;
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+
+    /* the index stays valid for the frame unless windows were added, removed,
+     * reordered or resized. Windows that moved away or got hidden are caught
+     * by checking the cached window again */
+    pos = ctx->input.mouse.pos;
+    if (ctx->hovered_seq == ctx->seq && ctx->hovered_pos.x == pos.x &&
+        ctx->hovered_pos.y == pos.y && (!ctx->hovered ||
+        nk_window_is_at(ctx, ctx->hovered, pos)))
+        return ctx->hovered;
+
+    /* number windows from back to front and keep the last one under the mouse */
+    ctx->hovered = 0;
+    for (iter = ctx->begin; iter; iter = iter->next) {
+        iter->order = ++order;
+        if (nk_window_is_at(ctx, iter, pos))
+            ctx->hovered = iter;
+    }
+    ctx->hovered_pos = pos;
+    ctx->hovered_seq = ctx->seq;
+    return ctx->hovered;
+}
+NK_API int
+nk_window_is_any_hovered(struct nk_context *ctx)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return 0;
+    return nk_window_at_mouse(ctx) != 0;
+}
 NK_API int
 nk_item_is_any_active(struct nk_context *ctx)
 {
@@ -563,6 +635,7 @@ nk_window_set_bounds(struct nk_context *ctx,
     if (!win) return;
     NK_ASSERT(ctx->current != win && "You cannot update a currently in procecss window");
     win->bounds = bounds;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_position(struct nk_context *ctx,
@@ -572,6 +645,7 @@ nk_window_set_position(struct nk_context *ctx,
     if (!win) return;
     win->bounds.x = pos.x;
     win->bounds.y = pos.y;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_size(struct nk_context *ctx,
@@ -581,6 +655,7 @@ nk_window_set_size(struct nk_context *ctx,
     if (!win) return;
     win->bounds.w = size.x;
     win->bounds.h = size.y;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_set_scroll(struct nk_context *ctx, nk_uint offset_x, nk_uint offset_y)
@@ -611,6 +686,7 @@ nk_window_collapse(struct nk_context *ctx, const char *name,
     if (c == NK_MINIMIZED)
         win->flags |= NK_WINDOW_MINIMIZED;
     else win->flags &= ~(nk_flags)NK_WINDOW_MINIMIZED;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_collapse_if(struct nk_context *ctx, const char *name,
@@ -636,6 +712,7 @@ nk_window_show(struct nk_context *ctx, const char *name, enum nk_show_states s)
     if (s == NK_HIDDEN) {
         win->flags |= NK_WINDOW_HIDDEN;
     } else win->flags &= ~(nk_flags)NK_WINDOW_HIDDEN;
+    nk_window_index_invalidate(ctx);
 }
 NK_API void
 nk_window_show_if(struct nk_context *ctx, const char *name,